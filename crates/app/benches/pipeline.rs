@@ -0,0 +1,347 @@
+//! Per-frame cost of the live pipeline's hot paths, capture ring to method
+//! ordering, with allocation counts and a budget gate.
+//!
+//! Every path is stepped one frame (512 samples at 16 kHz, or the device input
+//! that produces it) at a time. Criterion reports the mean; `budget_gate`
+//! measures p99 wall time and mean allocations per frame and fails when the
+//! allocations (or, with `COLDVOX_BENCH_ENFORCE_TIME=1`, the time) exceed
+//! `pipeline_budgets.toml`. CI runs the gate on every build and sets
+//! `COLDVOX_BENCH_ENFORCE_TIME=1` only on the nightly scheduled run, on the
+//! self-hosted runner the budgets are recorded on.
+
+use coldvox_app::audio::vad_processor::VadProcessor;
+use coldvox_audio::{
+    AudioChunker, AudioRingBuffer, ChunkerConfig, Delivery, FrameBus, FrameFeatures, FrameReader,
+    ResamplerQuality, SharedAudioFrame, StreamResampler,
+};
+use coldvox_text_injection::types::InjectionMetrics;
+use coldvox_text_injection::{InjectionConfig, StrategyManager};
+use coldvox_vad::{UnifiedVadConfig, VadEngine, VadEvent};
+use coldvox_vad_silero::{SileroConfig, SileroEngine};
+use criterion::{criterion_group, criterion_main, Criterion};
+use serde::Deserialize;
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::collections::BTreeMap;
+use std::hint::black_box;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex};
+use std::time::Instant;
+use tokio::runtime::Runtime;
+use tokio::sync::mpsc;
+
+/// Counts heap allocations so each path can report allocations per frame.
+struct CountingAlloc;
+
+static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+
+unsafe impl GlobalAlloc for CountingAlloc {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.realloc(ptr, layout, new_size)
+    }
+}
+
+#[global_allocator]
+static GLOBAL: CountingAlloc = CountingAlloc;
+
+const FRAME: usize = 512;
+const RING: usize = 16_384;
+const WARMUP_FRAMES: usize = 64;
+const MEASURED_FRAMES: usize = 2000;
+/// Headroom applied to measured p99 when printing a new baseline.
+const RECORD_TIME_HEADROOM: f64 = 4.0;
+
+const BUDGETS: &str = include_str!("pipeline_budgets.toml");
+
+/// A path's budget. A missing limit is reported but not gated, for paths
+/// whose cost has not been recorded yet.
+#[derive(Debug, Deserialize)]
+struct Budget {
+    p99_us: f64,
+    allocs_per_frame: Option<f64>,
+}
+
+/// Whether an opt-in switch is set to something other than empty or `0`.
+fn env_flag(name: &str) -> bool {
+    std::env::var(name).is_ok_and(|v| !v.is_empty() && v != "0")
+}
+
+/// One path under test: advances the pipeline by one frame per call.
+type Step = Box<dyn FnMut()>;
+
+fn runtime() -> Runtime {
+    tokio::runtime::Builder::new_current_thread()
+        .enable_all()
+        .build()
+        .expect("tokio runtime")
+}
+
+/// Speech-band tone with a slow amplitude swing, so the VAD sees both
+/// loud and quiet frames.
+fn mono_signal(len: usize) -> Vec<i16> {
+    (0..len)
+        .map(|i| {
+            let t = i as f32 / 16_000.0;
+            let envelope = 0.5 + 0.5 * (t * 2.0 * std::f32::consts::PI * 1.5).sin();
+            ((t * 2.0 * std::f32::consts::PI * 220.0).sin() * 12_000.0 * envelope) as i16
+        })
+        .collect()
+}
+
+fn stereo_signal(frames: usize) -> Vec<i16> {
+    mono_signal(frames)
+        .into_iter()
+        .flat_map(|s| [s, s / 2])
+        .collect()
+}
+
+fn shared_frame(samples: &[i16]) -> SharedAudioFrame {
+    let now = Instant::now();
+    SharedAudioFrame {
+        samples: Arc::from(samples),
+        timestamp: now,
+        sample_rate: 16_000,
+        read_at: now,
+        emitted_at: now,
+        features: FrameFeatures::measure(samples),
+    }
+}
+
+fn ring_buffer() -> Step {
+    let (mut prod, mut cons) = AudioRingBuffer::new(RING).split();
+    let input = mono_signal(FRAME);
+    let mut out = vec![0i16; FRAME];
+    Box::new(move || {
+        prod.write(black_box(&input)).unwrap();
+        black_box(cons.read(&mut out));
+    })
+}
+
+fn frame_reader(into: bool) -> Step {
+    let (mut prod, cons) = AudioRingBuffer::new(RING).split();
+    let mut reader = FrameReader::new(cons, 16_000, 1, RING, None);
+    let input = mono_signal(FRAME);
+    let mut frame = coldvox_audio::capture::AudioFrame {
+        samples: Vec::with_capacity(FRAME),
+        timestamp: Instant::now(),
+        sample_rate: 0,
+        channels: 0,
+    };
+    Box::new(move || {
+        prod.write(black_box(&input)).unwrap();
+        if into {
+            black_box(reader.read_frame_into(FRAME, &mut frame));
+        } else {
+            black_box(reader.read_frame(FRAME));
+        }
+    })
+}
+
+/// Chunker fed one output frame's worth of device input per step, with a
+/// lossless subscriber draining the frame bus.
+fn chunker(rate: u32, channels: u16, quality: ResamplerQuality) -> Step {
+    let (mut prod, cons) = AudioRingBuffer::new(RING).split();
+    let reader = FrameReader::new(cons, rate, channels, RING, None);
+    let tx = FrameBus::new();
+    let mut rx = tx.subscribe("stt", Delivery::Lossless { capacity: 64 });
+    let cfg = ChunkerConfig {
+        frame_size_samples: FRAME,
+        sample_rate_hz: 16_000,
+        resampler_quality: quality,
+    };
+    let mut chunker = AudioChunker::new(reader, tx, cfg).into_inline();
+    let device_frames = FRAME * rate as usize / 16_000;
+    let input = if channels == 1 {
+        mono_signal(device_frames)
+    } else {
+        stereo_signal(device_frames)
+    };
+    Box::new(move || {
+        prod.write(black_box(&input)).unwrap();
+        chunker.pump();
+        while let Ok(frame) = rx.try_recv() {
+            black_box(frame);
+        }
+    })
+}
+
+/// 48 kHz stereo device input to one 16 kHz mono frame.
+fn resampler(quality: ResamplerQuality) -> Step {
+    let mut resampler = StreamResampler::new_with_quality(48_000, 16_000, quality);
+    let input = stereo_signal(FRAME * 3);
+    let mut out = Vec::with_capacity(FRAME * 2);
+    Box::new(move || {
+        out.clear();
+        resampler.process_interleaved_into(black_box(&input), 2, &mut out);
+    })
+}
+
+fn silero() -> Step {
+    let mut engine = SileroEngine::new(SileroConfig::default()).expect("Silero VAD");
+    let signal = mono_signal(FRAME * 64);
+    let mut frames = (0..signal.len() / FRAME).cycle();
+    Box::new(move || {
+        let i = frames.next().unwrap() * FRAME;
+        black_box(engine.process(&signal[i..i + FRAME]).unwrap());
+    })
+}
+
+/// One frame bus consumed by a `VadProcessor` and `subscribers - 1` other
+/// subscribers (STT, level meters), as in the live pipeline.
+fn vad_fanout(subscribers: usize) -> Step {
+    let rt = runtime();
+    let tx = FrameBus::<SharedAudioFrame>::new();
+    let vad_rx = tx.subscribe("vad", Delivery::Lossless { capacity: 64 });
+    let mut others: Vec<_> = (1..subscribers)
+        .map(|_| tx.subscribe("meter", Delivery::DropOldest { capacity: 64 }))
+        .collect();
+    let (event_tx, mut event_rx) = mpsc::channel::<VadEvent>(64);
+    let mut vad =
+        VadProcessor::new(UnifiedVadConfig::default(), vad_rx, event_tx, None).expect("VAD");
+    let signal = mono_signal(FRAME * 64);
+    let frames: Vec<_> = signal.chunks_exact(FRAME).map(shared_frame).collect();
+    let mut next = (0..frames.len()).cycle();
+    Box::new(move || {
+        tx.send(frames[next.next().unwrap()].clone());
+        rt.block_on(vad.pump());
+        for rx in &mut others {
+            while let Ok(frame) = rx.try_recv() {
+                black_box(frame);
+            }
+        }
+        while let Ok(event) = event_rx.try_recv() {
+            black_box(event);
+        }
+    })
+}
+
+/// Method order lookup for an app with injection history.
+fn method_order_cached() -> Step {
+    let rt = runtime();
+    let metrics = Arc::new(Mutex::new(InjectionMetrics::default()));
+    let manager = rt.block_on(StrategyManager::new(InjectionConfig::default(), metrics));
+    let app = "org.example.Editor";
+    let preferred = manager.get_method_order_uncached()[0];
+    manager.update_success_record(app, preferred, true);
+    Box::new(move || {
+        black_box(manager.get_method_order_cached(black_box(app)));
+    })
+}
+
+fn paths() -> Vec<(&'static str, Step)> {
+    vec![
+        ("ring_buffer", ring_buffer()),
+        ("frame_reader_read_frame", frame_reader(false)),
+        ("frame_reader_read_frame_into", frame_reader(true)),
+        (
+            "chunker_16k_mono",
+            chunker(16_000, 1, ResamplerQuality::Balanced),
+        ),
+        (
+            "chunker_48k_stereo",
+            chunker(48_000, 2, ResamplerQuality::Balanced),
+        ),
+        ("resampler_fast", resampler(ResamplerQuality::Fast)),
+        ("resampler_balanced", resampler(ResamplerQuality::Balanced)),
+        ("resampler_quality", resampler(ResamplerQuality::Quality)),
+        ("silero", silero()),
+        ("vad_fanout_1", vad_fanout(1)),
+        ("vad_fanout_4", vad_fanout(4)),
+        ("vad_fanout_16", vad_fanout(16)),
+        ("method_order_cached", method_order_cached()),
+    ]
+}
+
+struct Measurement {
+    p99_us: f64,
+    allocs_per_frame: f64,
+}
+
+fn measure(step: &mut Step) -> Measurement {
+    // Warm up pools, scratch buffers and model state before counting
+    for _ in 0..WARMUP_FRAMES {
+        step();
+    }
+    let mut times = Vec::with_capacity(MEASURED_FRAMES);
+    let before = ALLOCATIONS.load(Ordering::Relaxed);
+    for _ in 0..MEASURED_FRAMES {
+        let start = Instant::now();
+        step();
+        times.push(start.elapsed());
+    }
+    let allocs = ALLOCATIONS.load(Ordering::Relaxed) - before;
+    times.sort_unstable();
+    Measurement {
+        p99_us: times[MEASURED_FRAMES * 99 / 100].as_secs_f64() * 1e6,
+        allocs_per_frame: allocs as f64 / MEASURED_FRAMES as f64,
+    }
+}
+
+fn bench_pipeline(c: &mut Criterion) {
+    let mut group = c.benchmark_group("pipeline");
+    for (name, mut step) in paths() {
+        group.bench_function(name, |b| b.iter(&mut step));
+    }
+    group.finish();
+}
+
+/// Fail the run when any path exceeds its checked-in allocation budget, or
+/// its time budget with `COLDVOX_BENCH_ENFORCE_TIME=1`. With
+/// `COLDVOX_BENCH_RECORD=1`, print a new baseline instead.
+fn bench_budget_gate(_c: &mut Criterion) {
+    let budgets: BTreeMap<String, Budget> =
+        toml::from_str(BUDGETS).expect("pipeline_budgets.toml is valid");
+    let record = env_flag("COLDVOX_BENCH_RECORD");
+    let enforce_time = env_flag("COLDVOX_BENCH_ENFORCE_TIME");
+
+    let mut over = Vec::new();
+    for (name, mut step) in paths() {
+        let m = measure(&mut step);
+        println!(
+            "budget_gate/{name}: p99 {:.1} us, {:.2} allocations per frame",
+            m.p99_us, m.allocs_per_frame
+        );
+        if record {
+            println!(
+                "[{name}]\np99_us = {:.1}\nallocs_per_frame = {:.1}\n",
+                (m.p99_us * RECORD_TIME_HEADROOM).ceil(),
+                m.allocs_per_frame.ceil()
+            );
+            continue;
+        }
+        let budget = budgets
+            .get(name)
+            .unwrap_or_else(|| panic!("no budget for {name} in pipeline_budgets.toml"));
+        if enforce_time && m.p99_us > budget.p99_us {
+            over.push(format!(
+                "{name}: p99 {:.1} us over budget {:.1} us",
+                m.p99_us, budget.p99_us
+            ));
+        }
+        match budget.allocs_per_frame {
+            Some(limit) if m.allocs_per_frame > limit => over.push(format!(
+                "{name}: {:.2} allocations per frame over budget {:.1}",
+                m.allocs_per_frame, limit
+            )),
+            Some(_) => {}
+            None => println!("budget_gate/{name}: no allocation budget recorded yet"),
+        }
+    }
+    assert!(
+        over.is_empty(),
+        "pipeline budgets exceeded:\n{}",
+        over.join("\n")
+    );
+}
+
+criterion_group!(benches, bench_pipeline, bench_budget_gate);
+criterion_main!(benches);
@@ -1,5 +1,5 @@
 use coldvox_audio::StreamResampler;
-use coldvox_vad::{UnifiedVadConfig, VadEngine, VadEvent, VadMode, VadState};
+use coldvox_vad::{GateStats, UnifiedVadConfig, VadEngine, VadEvent, VadMode, VadState};
 #[cfg(feature = "silero")]
 use coldvox_vad_silero::SileroEngine;
 
@@ -17,15 +17,13 @@ impl VadAdapter {
         }
 
         #[cfg(feature = "silero")]
-        let engine: Box<dyn VadEngine> = match config.mode {
-            VadMode::Silero => {
-                let silero_config = coldvox_vad_silero::SileroConfig {
-                    threshold: config.silero.threshold,
-                    min_speech_duration_ms: config.silero.min_speech_duration_ms,
-                    min_silence_duration_ms: config.silero.min_silence_duration_ms,
-                    window_size_samples: config.silero.window_size_samples,
-                };
-                Box::new(SileroEngine::new(silero_config)?)
+        let engine: Box<dyn VadEngine> = {
+            let silero_config = config.silero.clone();
+            match config.mode {
+                VadMode::Silero => Box::new(SileroEngine::new(silero_config)?),
+                VadMode::Cascade => {
+                    Box::new(SileroEngine::new(silero_config)?.with_gate(&config.cascade))
+                }
             }
         };
 
@@ -62,6 +60,20 @@ impl VadAdapter {
         }
     }
 
+    /// Like [`process`](Self::process), reusing the frame's RMS level measured
+    /// by the chunker. Frames that need resampling are re-framed here, so their
+    /// energy no longer lines up and the engine measures it itself.
+    pub fn process_with_energy(
+        &mut self,
+        frame: &[i16],
+        energy_dbfs: f32,
+    ) -> Result<Option<VadEvent>, String> {
+        if self.resampler.is_some() {
+            return self.process(frame);
+        }
+        self.engine.process_with_energy(frame, energy_dbfs)
+    }
+
     pub fn reset(&mut self) {
         self.engine.reset();
         if let Some(resampler) = &mut self.resampler {
@@ -73,6 +85,10 @@ impl VadAdapter {
         self.engine.current_state()
     }
 
+    pub fn gate_stats(&self) -> Option<GateStats> {
+        self.engine.gate_stats()
+    }
+
     pub fn config(&self) -> &UnifiedVadConfig {
         &self.config
     }
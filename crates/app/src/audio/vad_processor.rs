@@ -1,9 +1,8 @@
 use std::sync::Arc;
 
-use coldvox_audio::SharedAudioFrame;
-use coldvox_telemetry::{FpsTracker, PipelineMetrics};
+use coldvox_audio::{FrameSubscriber, SharedAudioFrame};
+use coldvox_telemetry::{FpsTracker, FrameTimes, PipelineMetrics, TraceId};
 use coldvox_vad::{UnifiedVadConfig, VadEvent};
-use tokio::sync::broadcast;
 use tokio::sync::mpsc::Sender;
 use tokio::task::JoinHandle;
 use tracing::{debug, error, info, trace};
@@ -12,18 +11,20 @@ use super::vad_adapter::VadAdapter;
 
 pub struct VadProcessor {
     adapter: VadAdapter,
-    audio_rx: broadcast::Receiver<SharedAudioFrame>,
+    audio_rx: FrameSubscriber<SharedAudioFrame>,
     event_tx: Sender<VadEvent>,
     metrics: Option<Arc<PipelineMetrics>>,
     fps_tracker: FpsTracker,
     frames_processed: u64,
     events_generated: u64,
+    /// Timeline of the speech in progress, if traced.
+    trace: Option<TraceId>,
 }
 
 impl VadProcessor {
     pub fn new(
         config: UnifiedVadConfig,
-        audio_rx: broadcast::Receiver<SharedAudioFrame>,
+        audio_rx: FrameSubscriber<SharedAudioFrame>,
         event_tx: Sender<VadEvent>,
         metrics: Option<Arc<PipelineMetrics>>,
     ) -> Result<Self, String> {
@@ -37,13 +38,14 @@ impl VadProcessor {
             fps_tracker: FpsTracker::new(),
             frames_processed: 0,
             events_generated: 0,
+            trace: None,
         })
     }
 
     pub async fn run(mut self) {
         info!("VAD processor task started");
 
-        // This loop will automatically exit when the sender side of the broadcast channel is dropped.
+        // This loop will automatically exit when every sender of the frame bus is dropped.
         while let Ok(frame) = self.audio_rx.recv().await {
             self.process_frame(frame).await;
         }
@@ -54,6 +56,18 @@ impl VadProcessor {
         );
     }
 
+    /// Process every frame already queued on the audio channel without
+    /// waiting, for callers that drive the pipeline themselves. Returns the
+    /// number of frames processed.
+    pub async fn pump(&mut self) -> usize {
+        let mut processed = 0;
+        while let Ok(frame) = self.audio_rx.try_recv() {
+            self.process_frame(frame).await;
+            processed += 1;
+        }
+        processed
+    }
+
     async fn process_frame(&mut self, frame: SharedAudioFrame) {
         trace!(
             "VAD: Processing frame {:?} with {} samples",
@@ -62,13 +76,18 @@ impl VadProcessor {
         );
 
         if let Some(metrics) = &self.metrics {
+            metrics.record_chunker_to_vad_handoff(frame.emitted_at.elapsed());
             if let Some(fps) = self.fps_tracker.tick() {
                 metrics.update_vad_fps(fps);
             }
         }
 
-        // Process i16 samples directly (zero-copy from SharedAudioFrame)
-        match self.adapter.process(&frame.samples) {
+        // Process i16 samples directly (zero-copy from SharedAudioFrame),
+        // reusing the level the chunker already measured
+        match self
+            .adapter
+            .process_with_energy(&frame.samples, frame.features.dbfs())
+        {
             Ok(Some(event)) => {
                 self.events_generated += 1;
 
@@ -82,6 +101,13 @@ impl VadProcessor {
                             "VAD: Speech started at {}ms (energy: {:.2} dB)",
                             timestamp_ms, energy_db
                         );
+                        if let Some(metrics) = &self.metrics {
+                            self.trace = Some(
+                                metrics
+                                    .utterance_trace
+                                    .speech_start(*timestamp_ms, frame_times(&frame)),
+                            );
+                        }
                     }
                     VadEvent::SpeechEnd {
                         timestamp_ms,
@@ -92,6 +118,25 @@ impl VadProcessor {
                             "VAD: Speech ended at {}ms (duration: {}ms, energy: {:.2} dB)",
                             timestamp_ms, duration_ms, energy_db
                         );
+                        if let (Some(metrics), Some(trace)) = (&self.metrics, self.trace.take()) {
+                            metrics.utterance_trace.speech_end(
+                                trace,
+                                *timestamp_ms,
+                                frame_times(&frame),
+                            );
+                        }
+                    }
+                    VadEvent::SpeculativeStart {
+                        timestamp_ms,
+                        probability,
+                    } => {
+                        debug!(
+                            "VAD: Speculative start at {}ms (probability: {:.2})",
+                            timestamp_ms, probability
+                        );
+                    }
+                    VadEvent::SpeculativeCancel { timestamp_ms } => {
+                        debug!("VAD: Speculative start cancelled at {}ms", timestamp_ms);
                     }
                 }
 
@@ -101,6 +146,8 @@ impl VadProcessor {
                     match &event {
                         VadEvent::SpeechStart { timestamp_ms, .. } => *timestamp_ms,
                         VadEvent::SpeechEnd { timestamp_ms, .. } => *timestamp_ms,
+                        VadEvent::SpeculativeStart { timestamp_ms, .. } => *timestamp_ms,
+                        VadEvent::SpeculativeCancel { timestamp_ms } => *timestamp_ms,
                     }
                 );
 
@@ -116,6 +163,10 @@ impl VadProcessor {
             }
         }
 
+        if let (Some(metrics), Some(stats)) = (&self.metrics, self.adapter.gate_stats()) {
+            metrics.update_vad_gate(stats.inferred, stats.gated);
+        }
+
         self.frames_processed += 1;
 
         if self.frames_processed.is_multiple_of(100) {
@@ -137,7 +188,7 @@ impl VadProcessor {
 
     pub fn spawn(
         config: UnifiedVadConfig,
-        audio_rx: broadcast::Receiver<SharedAudioFrame>,
+        audio_rx: FrameSubscriber<SharedAudioFrame>,
         event_tx: Sender<VadEvent>,
         metrics: Option<Arc<PipelineMetrics>>,
     ) -> Result<JoinHandle<()>, String> {
@@ -151,3 +202,11 @@ impl VadProcessor {
         Ok(handle)
     }
 }
+
+fn frame_times(frame: &SharedAudioFrame) -> FrameTimes {
+    FrameTimes {
+        captured: frame.timestamp,
+        read: frame.read_at,
+        chunked: frame.emitted_at,
+    }
+}
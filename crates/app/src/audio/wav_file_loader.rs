@@ -117,7 +117,7 @@ impl WavFileLoader {
                     tokio::time::sleep(Duration::from_nanos(clamped)).await;
                 }
                 PlaybackMode::Deterministic => {
-                    // No real sleep; logical frame progression (future: integrate TestClock)
+                    // No real sleep; see `crate::offline` for a virtual-clock pipeline
                 }
             }
         }
@@ -139,7 +139,9 @@ impl WavFileLoader {
                     tokio::time::sleep(Duration::from_millis(1)).await;
                 }
             }
-            tokio::time::sleep(Duration::from_millis(32)).await;
+            if !matches!(self.playback_mode, PlaybackMode::Deterministic) {
+                tokio::time::sleep(Duration::from_millis(32)).await;
+            }
         }
 
         Ok(())
@@ -213,7 +215,9 @@ impl WavFileLoader {
                     tokio::time::sleep(Duration::from_millis(1)).await;
                 }
             }
-            tokio::time::sleep(Duration::from_millis(32)).await;
+            if !matches!(self.playback_mode, PlaybackMode::Deterministic) {
+                tokio::time::sleep(Duration::from_millis(32)).await;
+            }
         }
 
         Ok(())
@@ -231,6 +235,11 @@ impl WavFileLoader {
         }
     }
 
+    /// All samples, interleaved at the file's rate and channel count.
+    pub fn samples(&self) -> &[i16] {
+        &self.samples
+    }
+
     pub fn sample_rate(&self) -> u32 {
         self.sample_rate
     }
@@ -8,6 +8,7 @@ use clap::{builder::BoolishValueParser, Parser, ValueEnum};
 use coldvox_app::runtime::{self as app_runtime, ActivationMode};
 #[cfg(any(feature = "moonshine", feature = "parakeet"))]
 use coldvox_app::stt::TranscriptionEvent;
+use coldvox_audio::Delivery;
 use coldvox_vad::types::VadEvent;
 use crossterm::{
     event::{self, DisableMouseCapture, EnableMouseCapture, Event, KeyCode},
@@ -160,6 +161,7 @@ struct PipelineMetricsSnapshot {
     stage_output: bool,
     capture_frames: u64,
     chunker_frames: u64,
+    last_utterance: Option<coldvox_telemetry::UtteranceTimeline>,
 }
 
 struct DashboardState {
@@ -271,6 +273,7 @@ impl Default for DashboardState {
                 stage_output: false,
                 capture_frames: 0,
                 chunker_frames: 0,
+                last_utterance: None,
             },
             has_metrics_snapshot: false,
             current_tab: Tab::Audio,
@@ -489,7 +492,8 @@ async fn run_app(
                                             if matches!(env_disable.as_str(), "1" | "true" | "yes") {
                                                 let _ = tx.send(AppEvent::Log(LogLevel::Warning, "Audio dump disabled by COLDVOX_DISABLE_AUDIO_DUMP".to_string())).await;
                                             } else {
-                                                let mut audio_rx = app.subscribe_audio();
+                                                // Generous queue so a slow disk drops frames from the dump, not the pipeline
+                                                let mut audio_rx = app.subscribe_audio_with("audio_dump", Delivery::DropOldest { capacity: 256 });
                                                 let ui_tx3 = tx.clone();
                                                 tokio::spawn(async move {
                                                     // Resolve output directory
@@ -529,10 +533,6 @@ async fn run_app(
                                                                             break;
                                                                         }
                                                                     }
-                                                                    Err(tokio::sync::broadcast::error::RecvError::Lagged(n)) => {
-                                                                        let _ = ui_tx3.send(AppEvent::Log(LogLevel::Debug, format!("Audio dump lagged; dropped {} frames", n))).await;
-                                                                        continue;
-                                                                    }
                                                                     Err(_) => {
                                                                         // Channel closed or canceled
                                                                         break;
@@ -540,6 +540,9 @@ async fn run_app(
                                                                 }
                                                             }
                                                             let _ = writer.flush();
+                                                            if audio_rx.dropped() > 0 {
+                                                                let _ = ui_tx3.send(AppEvent::Log(LogLevel::Debug, format!("Audio dump lagged; dropped {} frames", audio_rx.dropped()))).await;
+                                                            }
                                                             let _ = ui_tx3.send(AppEvent::Log(LogLevel::Info, "Audio dump stopped".to_string())).await;
                                                         }
                                                         DumpFormat::Wav => {
@@ -582,14 +585,13 @@ async fn run_app(
                                                                             }
                                                                         }
                                                                     }
-                                                                    Err(tokio::sync::broadcast::error::RecvError::Lagged(n)) => {
-                                                                        let _ = ui_tx3.send(AppEvent::Log(LogLevel::Debug, format!("Audio dump lagged; dropped {} frames", n))).await;
-                                                                        continue;
-                                                                    }
                                                                     Err(_) => break,
                                                                 }
                                                             }
                                                             let _ = wav.flush();
+                                                            if audio_rx.dropped() > 0 {
+                                                                let _ = ui_tx3.send(AppEvent::Log(LogLevel::Debug, format!("Audio dump lagged; dropped {} frames", audio_rx.dropped()))).await;
+                                                            }
                                                             if let Err(e) = wav.finalize() {
                                                                 let _ = ui_tx3.send(AppEvent::Log(LogLevel::Error, format!("Error finalizing WAV: {}", e))).await;
                                                             } else {
@@ -714,6 +716,12 @@ async fn run_app(
                                 state.last_vad_event = Some(format!("Speech END @ {}ms ({}ms, {:.1}dB)", timestamp_ms, duration_ms, energy_db));
                                 state.log(LogLevel::Info, format!("Speech ended, duration: {}ms", duration_ms));
                             }
+                            VadEvent::SpeculativeStart { timestamp_ms, probability } => {
+                                state.last_vad_event = Some(format!("Speculative START @ {}ms (p={:.2})", timestamp_ms, probability));
+                            }
+                            VadEvent::SpeculativeCancel { timestamp_ms } => {
+                                state.last_vad_event = Some(format!("Speculative CANCEL @ {}ms", timestamp_ms));
+                            }
                         }
                     }
                     AppEvent::AppReplaced(app) => {
@@ -807,6 +815,7 @@ async fn run_app(
                             stage_output: m.stage_output.load(Ordering::Relaxed),
                             capture_frames: m.capture_frames.load(Ordering::Relaxed),
                             chunker_frames: m.chunker_frames.load(Ordering::Relaxed),
+                            last_utterance: m.utterance_trace.last(),
                         };
                         state.has_metrics_snapshot = true;
                         state.update_level_history();
@@ -984,7 +993,7 @@ fn draw_metrics(f: &mut Frame, area: Rect, state: &DashboardState) {
     f.render_widget(block, area);
 
     let elapsed = state.start_time.elapsed().as_secs();
-    let metrics_text = vec![
+    let mut metrics_text = vec![
         Line::from(format!("Runtime: {}s", elapsed)),
         Line::from(""),
         Line::from(format!(
@@ -1005,6 +1014,23 @@ fn draw_metrics(f: &mut Frame, area: Rect, state: &DashboardState) {
         Line::from(format!("  Chunker: {}%", state.metrics.chunker_buffer_fill)),
         Line::from(format!("  VAD: {}%", state.metrics.vad_buffer_fill)),
     ];
+    if let Some(utterance) = &state.metrics.last_utterance {
+        metrics_text.push(Line::from(""));
+        metrics_text.push(Line::from(format!(
+            "Last utterance #{}: tail {}",
+            utterance.id,
+            utterance
+                .tail_latency()
+                .map_or("-".to_string(), |tail| format!("{}ms", tail.as_millis()))
+        )));
+        if let Some((stage, took)) = utterance.slowest_stage() {
+            metrics_text.push(Line::from(format!(
+                "  Slowest: {} {}ms",
+                stage.as_str(),
+                took.as_millis()
+            )));
+        }
+    }
 
     let paragraph = Paragraph::new(metrics_text);
     f.render_widget(paragraph, inner);
@@ -1,6 +1,7 @@
 use coldvox_stt::plugin::PluginSelectionConfig;
 #[cfg(feature = "http-remote")]
 use coldvox_stt::plugins::http_remote::HttpRemoteConfig;
+use coldvox_vad::{CascadeConfig, UnifiedVadConfig, VadMode};
 use config::{Case, Config, ConfigError, Environment, File};
 use serde::Deserialize;
 use std::collections::HashMap;
@@ -36,6 +37,7 @@ pub struct InjectionSettings {
     pub blocklist: Vec<String>,
     pub min_success_rate: f32,
     pub min_sample_size: u32,
+    pub incremental_partials: bool,
 }
 
 impl Default for InjectionSettings {
@@ -67,6 +69,7 @@ impl Default for InjectionSettings {
             blocklist: Vec::new(),
             min_success_rate: 0.3,
             min_sample_size: 5,
+            incremental_partials: false,
         }
     }
 }
@@ -89,6 +92,16 @@ pub struct SttRemoteSettings {
     pub max_audio_bytes: u64,
     pub max_audio_seconds: u32,
     pub max_payload_bytes: u64,
+    /// Chunked-upload endpoint; when set, audio is streamed during speech.
+    pub stream_api_path: Option<String>,
+    pub stream_chunk_ms: u32,
+    /// Upload format: "flac" (default) or "wav"
+    pub codec: String,
+    /// Secondary endpoint that slow batch requests are duplicated to
+    pub hedge_base_url: Option<String>,
+    pub hedge_initial_delay_ms: u64,
+    pub hedge_min_delay_ms: u64,
+    pub http2_prior_knowledge: bool,
 }
 
 impl Default for SttRemoteSettings {
@@ -105,6 +118,13 @@ impl Default for SttRemoteSettings {
             max_audio_bytes: 2_097_152,
             max_audio_seconds: 30,
             max_payload_bytes: 2_621_440,
+            stream_api_path: None,
+            stream_chunk_ms: 100,
+            codec: "flac".to_string(),
+            hedge_base_url: None,
+            hedge_initial_delay_ms: 500,
+            hedge_min_delay_ms: 50,
+            http2_prior_knowledge: false,
         }
     }
 }
@@ -118,6 +138,11 @@ pub struct SttSettings {
     pub language: Option<String>,
     pub failover_threshold: u32,
     pub failover_cooldown_secs: u32,
+    /// Keep the first usable fallback loaded for instant failover
+    pub hot_standby: bool,
+    /// Plugin raced against the active one; the first confident final wins
+    pub race_plugin: Option<String>,
+    pub race_min_confidence: f32,
     pub model_ttl_secs: u32,
     pub disable_gc: bool,
     pub metrics_log_interval_secs: u32,
@@ -136,6 +161,9 @@ impl Default for SttSettings {
             language: None,
             failover_threshold: 5,
             failover_cooldown_secs: 10,
+            hot_standby: false,
+            race_plugin: None,
+            race_min_confidence: 0.0,
             model_ttl_secs: 300,
             disable_gc: false,
             metrics_log_interval_secs: 30,
@@ -159,6 +187,23 @@ impl Default for AudioSettings {
     }
 }
 
+#[derive(Debug, Deserialize)]
+pub struct VadSettings {
+    /// "silero", or "cascade" for an energy gate in front of Silero
+    pub mode: String,
+    /// Gate settings, used by "cascade" only
+    pub cascade: CascadeConfig,
+}
+
+impl Default for VadSettings {
+    fn default() -> Self {
+        Self {
+            mode: "silero".to_string(),
+            cascade: CascadeConfig::default(),
+        }
+    }
+}
+
 #[derive(Debug, Deserialize)]
 pub struct Settings {
     pub device: Option<String>,
@@ -166,6 +211,7 @@ pub struct Settings {
     pub enable_device_monitor: bool,
     pub activation_mode: String,
     pub audio: AudioSettings,
+    pub vad: VadSettings,
     pub injection: InjectionSettings,
     pub stt: SttSettings,
 }
@@ -178,6 +224,7 @@ impl Default for Settings {
             enable_device_monitor: true,
             activation_mode: "".to_string(), // Empty; config builder sets "vad" if not overridden
             audio: AudioSettings::default(),
+            vad: VadSettings::default(),
             injection: InjectionSettings::default(),
             stt: SttSettings::default(),
         }
@@ -207,6 +254,7 @@ impl Settings {
             failover: Some(coldvox_stt::plugin::FailoverConfig {
                 failover_threshold: stt.failover_threshold,
                 failover_cooldown_secs: stt.failover_cooldown_secs,
+                hot_standby: stt.hot_standby,
             }),
             gc_policy: Some(coldvox_stt::plugin::GcPolicy {
                 model_ttl_secs: stt.model_ttl_secs,
@@ -221,6 +269,13 @@ impl Settings {
                 debug_dump_events: stt.debug_dump_events,
             }),
             auto_extract_model: stt.auto_extract,
+            race: stt
+                .race_plugin
+                .clone()
+                .map(|plugin| coldvox_stt::plugin::RaceConfig {
+                    plugin,
+                    min_confidence: stt.race_min_confidence,
+                }),
         }
     }
 
@@ -231,6 +286,11 @@ impl Settings {
             .set_default("enable_device_monitor", true)?
             // Audio settings defaults
             .set_default("audio.capture_buffer_samples", 65_536)?
+            // VAD settings defaults
+            .set_default("vad.mode", "silero")?
+            .set_default("vad.cascade.gate_margin_db", 6.0)?
+            .set_default("vad.cascade.initial_floor_db", -50.0)?
+            .set_default("vad.cascade.ema_alpha", 0.02)?
             // Injection settings defaults
             .set_default("injection.fail_fast", false)?
             .set_default("injection.allow_kdotool", false)?
@@ -258,6 +318,7 @@ impl Settings {
             .set_default("injection.blocklist", Vec::<String>::new())?
             .set_default("injection.min_success_rate", 0.3)?
             .set_default("injection.min_sample_size", 5)?
+            .set_default("injection.incremental_partials", false)?
             // STT settings defaults
             .set_default("stt.preferred", Option::<String>::None)?
             .set_default("stt.fallbacks", Vec::<String>::new())?
@@ -266,6 +327,9 @@ impl Settings {
             .set_default("stt.language", Option::<String>::None)?
             .set_default("stt.failover_threshold", 5)?
             .set_default("stt.failover_cooldown_secs", 10)?
+            .set_default("stt.hot_standby", false)?
+            .set_default("stt.race_plugin", Option::<String>::None)?
+            .set_default("stt.race_min_confidence", 0.0)?
             .set_default("stt.model_ttl_secs", 300)?
             .set_default("stt.disable_gc", false)?
             .set_default("stt.metrics_log_interval_secs", 30)?
@@ -284,7 +348,14 @@ impl Settings {
             )?
             .set_default("stt.remote.max_audio_bytes", 2_097_152)?
             .set_default("stt.remote.max_audio_seconds", 30)?
-            .set_default("stt.remote.max_payload_bytes", 2_621_440)?;
+            .set_default("stt.remote.max_payload_bytes", 2_621_440)?
+            .set_default("stt.remote.stream_api_path", Option::<String>::None)?
+            .set_default("stt.remote.stream_chunk_ms", 100)?
+            .set_default("stt.remote.codec", "flac")?
+            .set_default("stt.remote.hedge_base_url", Option::<String>::None)?
+            .set_default("stt.remote.hedge_initial_delay_ms", 500)?
+            .set_default("stt.remote.hedge_min_delay_ms", 50)?
+            .set_default("stt.remote.http2_prior_knowledge", false)?;
 
         // Allow tests or callers to skip config file discovery entirely
         let skip_discovery = std::env::var("COLDVOX_SKIP_CONFIG_DISCOVERY")
@@ -417,9 +488,30 @@ impl Settings {
             max_audio_bytes: self.stt.remote.max_audio_bytes,
             max_audio_seconds: self.stt.remote.max_audio_seconds,
             max_payload_bytes: self.stt.remote.max_payload_bytes,
+            stream_api_path: self.stt.remote.stream_api_path.clone(),
+            stream_chunk_ms: self.stt.remote.stream_chunk_ms,
+            // validate() rejects unknown names
+            codec: self.stt.remote.codec.parse().unwrap_or_default(),
+            hedge_base_url: self.stt.remote.hedge_base_url.clone(),
+            hedge_initial_delay_ms: self.stt.remote.hedge_initial_delay_ms,
+            hedge_min_delay_ms: self.stt.remote.hedge_min_delay_ms,
+            http2_prior_knowledge: self.stt.remote.http2_prior_knowledge,
         }
     }
 
+    /// The runtime's tuned VAD settings with the configured mode and gate.
+    pub fn runtime_vad_config(&self) -> UnifiedVadConfig {
+        let mut config = runtime::default_vad_config();
+        // validate() rejects unknown modes
+        config.mode = if self.vad.mode.eq_ignore_ascii_case("cascade") {
+            VadMode::Cascade
+        } else {
+            VadMode::Silero
+        };
+        config.cascade = self.vad.cascade.clone();
+        config
+    }
+
     /// Load settings from a specific config file path (for tests)
     pub fn from_path(config_path: impl AsRef<Path>) -> Result<Self, String> {
         let config = Self::build_config(Some(config_path.as_ref().to_path_buf()))
@@ -469,6 +561,30 @@ impl Settings {
             self.activation_mode = "vad".to_string();
         }
 
+        // Validate VAD settings
+        if !matches!(
+            self.vad.mode.to_ascii_lowercase().as_str(),
+            "silero" | "cascade"
+        ) {
+            errors.push(format!(
+                "VAD mode '{}' must be one of silero, cascade",
+                self.vad.mode
+            ));
+        }
+        let margin = self.vad.cascade.gate_margin_db;
+        if !(margin.is_finite() && margin >= 0.0) {
+            errors.push(format!(
+                "VAD cascade gate_margin_db ({}) must be >= 0",
+                self.vad.cascade.gate_margin_db
+            ));
+        }
+        if !(self.vad.cascade.ema_alpha > 0.0 && self.vad.cascade.ema_alpha <= 1.0) {
+            errors.push(format!(
+                "VAD cascade ema_alpha ({}) must be within (0, 1]",
+                self.vad.cascade.ema_alpha
+            ));
+        }
+
         // Validate injection settings
         if self.injection.max_total_latency_ms == 0 {
             errors.push("Injection max_total_latency_ms must be >0".to_string());
@@ -549,6 +665,9 @@ impl Settings {
         if self.stt.model_ttl_secs == 0 {
             errors.push("STT model_ttl_secs must be >0".to_string());
         }
+        if !(0.0..=1.0).contains(&self.stt.race_min_confidence) {
+            errors.push("STT race_min_confidence must be between 0.0 and 1.0".to_string());
+        }
         if self.stt.remote.base_url.trim().is_empty() {
             errors.push("STT remote base_url must not be empty".to_string());
         } else if !self.stt.remote.base_url.starts_with("http://") {
@@ -582,6 +701,15 @@ impl Settings {
         if self.stt.remote.sample_rate == 0 {
             errors.push("STT remote sample_rate must be >0".to_string());
         }
+        if !matches!(
+            self.stt.remote.codec.to_ascii_lowercase().as_str(),
+            "wav" | "flac"
+        ) {
+            errors.push(format!(
+                "STT remote codec '{}' must be one of wav, flac",
+                self.stt.remote.codec
+            ));
+        }
         if self.stt.remote.max_audio_bytes == 0 {
             errors.push("STT remote max_audio_bytes must be >0".to_string());
         }
@@ -723,9 +851,12 @@ pub mod audio;
 pub mod clock;
 pub mod foundation;
 pub mod hotkey;
+#[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
+pub mod offline;
 pub mod probes;
 pub mod runtime;
 pub mod sleep_instrumentation;
+pub mod startup;
 pub mod stt;
 pub mod telemetry;
 pub mod text_injection;
@@ -761,6 +892,7 @@ mod tests {
                 gc_policy: None,
                 metrics: None,
                 auto_extract_model: true,
+                race: None,
             }),
         );
 
@@ -164,11 +164,14 @@ async fn main() -> Result<(), Box<dyn std::error::Error>> {
 
     // Build STT configuration from settings
     let stt_selection = {
-        use coldvox_stt::plugin::{FailoverConfig, GcPolicy, MetricsConfig, PluginSelectionConfig};
+        use coldvox_stt::plugin::{
+            FailoverConfig, GcPolicy, MetricsConfig, PluginSelectionConfig, RaceConfig,
+        };
 
         let failover = FailoverConfig {
             failover_threshold: settings.stt.failover_threshold,
             failover_cooldown_secs: settings.stt.failover_cooldown_secs,
+            hot_standby: settings.stt.hot_standby,
         };
 
         let gc_policy = GcPolicy {
@@ -195,6 +198,10 @@ async fn main() -> Result<(), Box<dyn std::error::Error>> {
             gc_policy: Some(gc_policy),
             metrics: Some(metrics),
             auto_extract_model: settings.stt.auto_extract,
+            race: settings.stt.race_plugin.map(|plugin| RaceConfig {
+                plugin,
+                min_confidence: settings.stt.race_min_confidence,
+            }),
         })
     };
 
@@ -217,6 +224,7 @@ async fn main() -> Result<(), Box<dyn std::error::Error>> {
         stt_selection,
         enable_device_monitor: settings.enable_device_monitor,
         capture_buffer_samples: settings.audio.capture_buffer_samples,
+        vad_config: Some(settings.runtime_vad_config()),
         ..Default::default()
     };
 
@@ -229,6 +237,7 @@ async fn main() -> Result<(), Box<dyn std::error::Error>> {
         per_method_timeout_ms: Some(settings.injection.per_method_timeout_ms),
         cooldown_initial_ms: Some(settings.injection.cooldown_initial_ms),
         fail_fast: settings.injection.fail_fast,
+        incremental_partials: settings.injection.incremental_partials,
     });
     let app = app_runtime::start(opts)
         .await
@@ -0,0 +1,598 @@
+//! Offline pipeline: recorded WAV files through chunker → VAD → STT as fast as
+//! the CPU allows.
+//!
+//! The live runtime paces input at real time and connects stages through
+//! a frame bus and spawned tasks. Here a single driver pushes each
+//! capture chunk through an [`InlineChunker`], the VAD adapter and the STT
+//! processor's handlers in order, and awaits the processor's plugin calls in
+//! place, so the event sequence for a file does not depend on scheduling.
+//! Session timestamps come from a [`TestClock`] advanced by each frame's
+//! duration. Files are spread over worker threads, each with its own
+//! current-thread runtime and STT plugin instance.
+
+use std::collections::VecDeque;
+use std::fmt;
+use std::path::{Path, PathBuf};
+use std::time::{Duration, Instant};
+
+use anyhow::{anyhow, Context, Result};
+use coldvox_audio::{
+    AudioChunker, AudioRingBuffer, ChunkerConfig, Delivery, FrameBus, FrameReader,
+    ResamplerQuality, SharedAudioFrame,
+};
+use coldvox_foundation::{Clock, TestClock};
+use coldvox_stt::plugin::PluginSelectionConfig;
+use coldvox_vad::constants::{FRAME_SIZE_SAMPLES, SAMPLE_RATE_HZ};
+use coldvox_vad::{UnifiedVadConfig, VadEvent};
+use parking_lot::Mutex;
+use tokio::sync::mpsc;
+use tracing::{info, warn};
+
+use crate::audio::vad_adapter::VadAdapter;
+use crate::audio::wav_file_loader::WavFileLoader;
+use crate::stt::plugin_manager::{SttAudioPath, SttPluginManager};
+use crate::stt::processor::{PluginSttProcessor, UtteranceState};
+use crate::stt::session::{ActivationMode, SessionEvent, SessionSource, Settings};
+use crate::stt::wer::{calculate_wer, format_wer_percentage, normalize_transcript};
+use crate::stt::{TranscriptionConfig, TranscriptionEvent};
+
+/// Silence appended to each file so the VAD closes the last utterance; the
+/// same ~480 ms the WAV loader feeds after live playback.
+const FLUSH_SILENCE_FRAMES: usize = 15;
+
+/// Transcription events buffered between drains; drained after every frame.
+const EVENT_CAPACITY: usize = 1024;
+
+/// Upper bound on the default worker count: every worker loads its own
+/// model, so past a few workers the extra copies only cost memory.
+const MAX_DEFAULT_WORKERS: usize = 4;
+
+/// Plugins backed by one GPU. Extra model copies would only contend for the
+/// device (or exhaust its memory), so they default to a single worker.
+const GPU_PLUGINS: &[&str] = &["parakeet", "http-remote-parakeet-gpu"];
+
+/// Settings for an offline run.
+#[derive(Clone)]
+pub struct OfflineConfig {
+    pub vad: UnifiedVadConfig,
+    pub stt_selection: PluginSelectionConfig,
+    pub transcription: TranscriptionConfig,
+    /// Worker threads, each loading its own STT plugin. `0` picks a default:
+    /// one worker for GPU plugins, otherwise the available parallelism up to
+    /// [`MAX_DEFAULT_WORKERS`]. Never more than the number of files.
+    pub workers: usize,
+}
+
+impl OfflineConfig {
+    pub fn new(vad: UnifiedVadConfig, stt_selection: PluginSelectionConfig) -> Self {
+        Self {
+            vad,
+            stt_selection,
+            transcription: TranscriptionConfig {
+                enabled: true,
+                streaming: true,
+                ..Default::default()
+            },
+            workers: 0,
+        }
+    }
+
+    /// Worker count used when `workers` is `0`.
+    fn default_workers(&self) -> usize {
+        let preferred = self.stt_selection.preferred_plugin.as_deref();
+        if preferred.is_some_and(|id| GPU_PLUGINS.contains(&id)) {
+            1
+        } else {
+            std::thread::available_parallelism()
+                .map_or(1, |n| n.get())
+                .min(MAX_DEFAULT_WORKERS)
+        }
+    }
+}
+
+/// Wall time spent in each pipeline stage.
+#[derive(Debug, Clone, Copy, Default, PartialEq)]
+pub struct StageTimes {
+    pub chunker: Duration,
+    pub vad: Duration,
+    pub stt: Duration,
+}
+
+impl StageTimes {
+    pub fn total(&self) -> Duration {
+        self.chunker + self.vad + self.stt
+    }
+
+    fn accumulate(&mut self, other: &StageTimes) {
+        self.chunker += other.chunker;
+        self.vad += other.vad;
+        self.stt += other.stt;
+    }
+}
+
+/// Outcome of one file.
+#[derive(Debug, Clone)]
+pub struct FileReport {
+    pub path: PathBuf,
+    /// Duration of the recording, excluding flush silence.
+    pub audio: Duration,
+    pub frames: u64,
+    pub vad_events: Vec<VadEvent>,
+    /// Final transcriptions joined with spaces.
+    pub transcript: String,
+    pub partials: u64,
+    pub errors: u64,
+    /// Contents of the `.txt` file next to the WAV, if any.
+    pub reference: Option<String>,
+    pub stages: StageTimes,
+    pub wall: Duration,
+}
+
+impl FileReport {
+    /// WER of the normalized transcript against the reference.
+    pub fn wer(&self) -> Option<f64> {
+        let reference = normalize_transcript(self.reference.as_deref()?);
+        Some(calculate_wer(
+            &reference,
+            &normalize_transcript(&self.transcript),
+        ))
+    }
+
+    /// Seconds of audio processed per second of wall time.
+    pub fn realtime_factor(&self) -> f64 {
+        ratio(self.audio, self.wall)
+    }
+}
+
+/// Outcome of a corpus run.
+#[derive(Debug, Clone, Default)]
+pub struct CorpusReport {
+    /// Processed files, in input order.
+    pub files: Vec<FileReport>,
+    /// Files that could not be processed, with the reason.
+    pub failures: Vec<(PathBuf, String)>,
+    pub workers: usize,
+    pub wall: Duration,
+}
+
+impl CorpusReport {
+    /// Corpus WER: total word errors over total reference words, across files
+    /// that have a reference.
+    pub fn wer(&self) -> Option<f64> {
+        let (mut errors, mut words) = (0.0, 0usize);
+        for file in &self.files {
+            let (Some(wer), Some(reference)) = (file.wer(), &file.reference) else {
+                continue;
+            };
+            let n = normalize_transcript(reference).split_whitespace().count();
+            errors += wer * n as f64;
+            words += n;
+        }
+        (words > 0).then(|| errors / words as f64)
+    }
+
+    pub fn audio(&self) -> Duration {
+        self.files.iter().map(|f| f.audio).sum()
+    }
+
+    pub fn stages(&self) -> StageTimes {
+        let mut total = StageTimes::default();
+        for file in &self.files {
+            total.accumulate(&file.stages);
+        }
+        total
+    }
+
+    /// Seconds of audio per second of wall time for the whole run, including
+    /// parallelism.
+    pub fn realtime_factor(&self) -> f64 {
+        ratio(self.audio(), self.wall)
+    }
+}
+
+impl fmt::Display for CorpusReport {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        for file in &self.files {
+            let name = file.path.file_name().unwrap_or_default().to_string_lossy();
+            let wer = file
+                .wer()
+                .map_or_else(|| "n/a".to_string(), format_wer_percentage);
+            writeln!(
+                f,
+                "{name}: WER {wer}, {:.1}s audio in {:.2}s ({:.1}x), {} VAD events",
+                file.audio.as_secs_f64(),
+                file.wall.as_secs_f64(),
+                file.realtime_factor(),
+                file.vad_events.len()
+            )?;
+        }
+        for (path, reason) in &self.failures {
+            writeln!(f, "{}: FAILED: {reason}", path.display())?;
+        }
+
+        let audio = self.audio();
+        let stages = self.stages();
+        let wer = self
+            .wer()
+            .map_or_else(|| "n/a".to_string(), format_wer_percentage);
+        writeln!(
+            f,
+            "corpus: {} files, WER {wer}, {:.1}s audio in {:.2}s on {} workers ({:.1}x realtime)",
+            self.files.len(),
+            audio.as_secs_f64(),
+            self.wall.as_secs_f64(),
+            self.workers,
+            self.realtime_factor()
+        )?;
+        write!(
+            f,
+            "stage throughput: chunker {:.0}x, vad {:.0}x, stt {:.1}x realtime",
+            ratio(audio, stages.chunker),
+            ratio(audio, stages.vad),
+            ratio(audio, stages.stt)
+        )
+    }
+}
+
+fn ratio(audio: Duration, spent: Duration) -> f64 {
+    if spent.is_zero() {
+        return f64::INFINITY;
+    }
+    audio.as_secs_f64() / spent.as_secs_f64()
+}
+
+/// `test_*.wav` files in `dir`, sorted by name.
+pub fn corpus_files(dir: &Path) -> Result<Vec<PathBuf>> {
+    let mut files: Vec<PathBuf> = std::fs::read_dir(dir)
+        .with_context(|| format!("reading corpus directory {}", dir.display()))?
+        .filter_map(|entry| entry.ok().map(|e| e.path()))
+        .filter(|path| {
+            let name = path.file_name().unwrap_or_default().to_string_lossy();
+            name.starts_with("test_") && name.ends_with(".wav")
+        })
+        .collect();
+    files.sort();
+    Ok(files)
+}
+
+/// Process `files` across worker threads and collect the results.
+///
+/// Blocks the calling thread; each worker builds its own runtime, so this
+/// must not be called from inside an async task.
+pub fn run_corpus(files: &[PathBuf], config: &OfflineConfig) -> CorpusReport {
+    let workers = match config.workers {
+        0 => config.default_workers(),
+        n => n,
+    }
+    .min(files.len())
+    .max(1);
+    info!("Offline run: {} files on {} workers", files.len(), workers);
+
+    let queue = Mutex::new(files.iter().cloned().enumerate().collect::<VecDeque<_>>());
+    let results = Mutex::new(Vec::with_capacity(files.len()));
+    let started = Instant::now();
+
+    std::thread::scope(|scope| {
+        for _ in 0..workers {
+            scope.spawn(|| {
+                let runtime = match tokio::runtime::Builder::new_current_thread()
+                    .enable_all()
+                    .build()
+                {
+                    Ok(runtime) => runtime,
+                    Err(e) => {
+                        drain_failed(&queue, &results, &format!("runtime: {e}"));
+                        return;
+                    }
+                };
+                runtime.block_on(run_worker(config, &queue, &results));
+            });
+        }
+    });
+
+    let mut results = results.into_inner();
+    results.sort_by_key(|(index, _)| *index);
+    let mut report = CorpusReport {
+        workers,
+        wall: started.elapsed(),
+        ..Default::default()
+    };
+    for (_, result) in results {
+        match result {
+            Ok(file) => report.files.push(file),
+            Err(failure) => report.failures.push(failure),
+        }
+    }
+    report
+}
+
+type FileResult = (usize, std::result::Result<FileReport, (PathBuf, String)>);
+
+async fn run_worker(
+    config: &OfflineConfig,
+    queue: &Mutex<VecDeque<(usize, PathBuf)>>,
+    results: &Mutex<Vec<FileResult>>,
+) {
+    // One plugin per worker, reused across its files
+    let mut manager = SttPluginManager::new();
+    let init = async {
+        manager
+            .set_selection_config(config.stt_selection.clone())
+            .await?;
+        manager.initialize().await
+    }
+    .await;
+    if let Err(e) = init {
+        drain_failed(queue, results, &format!("STT initialization: {e}"));
+        return;
+    }
+    let plugin = manager.audio_path();
+
+    loop {
+        let Some((index, path)) = queue.lock().pop_front() else {
+            break;
+        };
+        let result = process_file(&path, config, plugin.clone())
+            .await
+            .map_err(|e| (path.clone(), format!("{e:#}")));
+        if let Err((_, reason)) = &result {
+            warn!(
+                "Offline processing of {} failed: {}",
+                path.display(),
+                reason
+            );
+        }
+        results.lock().push((index, result));
+    }
+}
+
+fn drain_failed(
+    queue: &Mutex<VecDeque<(usize, PathBuf)>>,
+    results: &Mutex<Vec<FileResult>>,
+    reason: &str,
+) {
+    while let Some((index, path)) = queue.lock().pop_front() {
+        results
+            .lock()
+            .push((index, Err((path, reason.to_string()))));
+    }
+}
+
+/// Run one WAV file through the pipeline with `plugin`.
+pub async fn process_file(
+    path: &Path,
+    config: &OfflineConfig,
+    plugin: SttAudioPath,
+) -> Result<FileReport> {
+    let started = Instant::now();
+    let loader = WavFileLoader::new(path)?;
+    let channels = loader.channels().max(1) as usize;
+    let reference = std::fs::read_to_string(path.with_extension("txt"))
+        .ok()
+        .map(|text| text.trim().to_string());
+
+    // The chunker is pumped after every chunk, so the ring only ever holds one
+    let chunk_len = FRAME_SIZE_SAMPLES * channels;
+    let capacity = chunk_len * 4;
+    let (mut producer, consumer) = AudioRingBuffer::new(capacity).split();
+    let reader = FrameReader::new(
+        consumer,
+        loader.sample_rate(),
+        loader.channels(),
+        capacity,
+        None,
+    );
+    let audio_tx = FrameBus::<SharedAudioFrame>::new();
+    let mut audio_rx = audio_tx.subscribe("offline", Delivery::Lossless { capacity: 16 });
+    let mut chunker = AudioChunker::new(
+        reader,
+        audio_tx,
+        ChunkerConfig {
+            frame_size_samples: FRAME_SIZE_SAMPLES,
+            sample_rate_hz: SAMPLE_RATE_HZ,
+            resampler_quality: ResamplerQuality::Balanced,
+        },
+    )
+    .into_inline();
+
+    let mut vad = VadAdapter::new(config.vad.clone()).map_err(|e| anyhow!(e))?;
+
+    // The processor's own channels stay idle; the driver calls its handlers
+    let unused_audio_rx =
+        FrameBus::<SharedAudioFrame>::new().subscribe("stt", Delivery::DropOldest { capacity: 1 });
+    let (_unused_session_tx, unused_session_rx) = mpsc::channel::<SessionEvent>(1);
+    let (event_tx, mut event_rx) = mpsc::channel::<TranscriptionEvent>(EVENT_CAPACITY);
+    let settings = Settings {
+        activation_mode: ActivationMode::Vad,
+        ..Default::default()
+    };
+    let stt = PluginSttProcessor::new(
+        unused_audio_rx,
+        unused_session_rx,
+        event_tx,
+        plugin,
+        config.transcription.clone(),
+        settings,
+    )
+    .with_inline_tasks();
+    stt.apply_transcription_config().await;
+
+    let clock = TestClock::new();
+    let frame_duration =
+        Duration::from_nanos(FRAME_SIZE_SAMPLES as u64 * 1_000_000_000 / SAMPLE_RATE_HZ as u64);
+    let mut report = FileReport {
+        path: path.to_path_buf(),
+        audio: Duration::from_secs_f64(
+            loader.samples().len() as f64 / (loader.sample_rate() as f64 * channels as f64),
+        ),
+        frames: 0,
+        vad_events: Vec::new(),
+        transcript: String::new(),
+        partials: 0,
+        errors: 0,
+        reference,
+        stages: StageTimes::default(),
+        wall: Duration::ZERO,
+    };
+    let mut finals = Vec::new();
+
+    let silence = vec![0i16; chunk_len];
+    let chunks = loader
+        .samples()
+        .chunks(chunk_len)
+        .chain(std::iter::repeat_n(&silence[..], FLUSH_SILENCE_FRAMES));
+    for chunk in chunks {
+        let written = producer
+            .write(chunk)
+            .map_err(|e| anyhow!("ring buffer write: {e}"))?;
+        if written < chunk.len() {
+            return Err(anyhow!("ring buffer overflow"));
+        }
+        let t = Instant::now();
+        chunker.pump();
+        report.stages.chunker += t.elapsed();
+
+        while let Ok(frame) = audio_rx.try_recv() {
+            let t = Instant::now();
+            let event = vad
+                .process_with_energy(&frame.samples, frame.features.dbfs())
+                .map_err(|e| anyhow!("VAD: {e}"))?;
+            report.stages.vad += t.elapsed();
+
+            let t = Instant::now();
+            if let Some(event) = event {
+                report.vad_events.push(event);
+                stt.handle_session_event(SessionEvent::from_vad(
+                    &event,
+                    SessionSource::Vad,
+                    clock.now(),
+                ))
+                .await;
+                stt.run_inline_tasks().await;
+            }
+            stt.handle_audio_frame(frame).await;
+            stt.run_inline_tasks().await;
+            report.stages.stt += t.elapsed();
+
+            report.frames += 1;
+            clock.advance(frame_duration);
+            drain_events(&mut event_rx, &mut report, &mut finals);
+        }
+    }
+
+    // Close an utterance the flush silence did not end
+    if matches!(
+        stt.utterance_state(),
+        UtteranceState::SpeechActive | UtteranceState::Speculative
+    ) {
+        let t = Instant::now();
+        stt.handle_session_event(SessionEvent::End(SessionSource::Vad, clock.now()))
+            .await;
+        stt.run_inline_tasks().await;
+        report.stages.stt += t.elapsed();
+    }
+    drain_events(&mut event_rx, &mut report, &mut finals);
+
+    report.transcript = finals.join(" ");
+    report.wall = started.elapsed();
+    Ok(report)
+}
+
+fn drain_events(
+    event_rx: &mut mpsc::Receiver<TranscriptionEvent>,
+    report: &mut FileReport,
+    finals: &mut Vec<String>,
+) {
+    while let Ok(event) = event_rx.try_recv() {
+        match event {
+            TranscriptionEvent::Final { text, .. } => {
+                if !text.trim().is_empty() {
+                    finals.push(text.trim().to_string());
+                }
+            }
+            TranscriptionEvent::Partial { .. } => report.partials += 1,
+            TranscriptionEvent::Error { code, message } => {
+                warn!("STT error during offline run: {}: {}", code, message);
+                report.errors += 1;
+            }
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn file(audio_secs: u64, reference: Option<&str>, transcript: &str) -> FileReport {
+        FileReport {
+            path: PathBuf::from("test_1.wav"),
+            audio: Duration::from_secs(audio_secs),
+            frames: 0,
+            vad_events: Vec::new(),
+            transcript: transcript.to_string(),
+            partials: 0,
+            errors: 0,
+            reference: reference.map(str::to_string),
+            stages: StageTimes {
+                chunker: Duration::from_millis(10),
+                vad: Duration::from_millis(100),
+                stt: Duration::from_secs(1),
+            },
+            wall: Duration::from_secs(2),
+        }
+    }
+
+    #[test]
+    fn corpus_wer_weights_by_reference_words() {
+        let report = CorpusReport {
+            files: vec![
+                // One insertion against three reference words once normalized
+                file(4, Some("RUN BACK, UNCAS!"), "run back uncas now"),
+                // 0 errors in 2 words
+                file(2, Some("hello world"), "Hello, world."),
+                file(3, None, "no reference"),
+            ],
+            workers: 2,
+            wall: Duration::from_secs(3),
+            ..Default::default()
+        };
+        assert_eq!(report.files[2].wer(), None);
+        assert!((report.wer().unwrap() - 1.0 / 5.0).abs() < 1e-9);
+        assert_eq!(report.audio(), Duration::from_secs(9));
+        assert!((report.realtime_factor() - 3.0).abs() < 1e-9);
+        assert_eq!(report.stages().stt, Duration::from_secs(3));
+        assert!(report.to_string().contains("corpus: 3 files, WER 20.0%"));
+    }
+
+    #[test]
+    fn default_workers_keep_gpu_plugins_on_one_worker() {
+        let mut config = OfflineConfig::new(
+            UnifiedVadConfig::default(),
+            PluginSelectionConfig {
+                preferred_plugin: Some("parakeet".to_string()),
+                ..Default::default()
+            },
+        );
+        assert_eq!(config.default_workers(), 1);
+
+        config.stt_selection.preferred_plugin = Some("moonshine".to_string());
+        let workers = config.default_workers();
+        assert!((1..=MAX_DEFAULT_WORKERS).contains(&workers));
+    }
+
+    #[test]
+    fn corpus_files_are_filtered_and_sorted() {
+        let dir = std::env::temp_dir().join(format!("coldvox-offline-{}", std::process::id()));
+        std::fs::create_dir_all(&dir).unwrap();
+        for name in ["test_2.wav", "test_10.wav", "test_2.txt", "other.wav"] {
+            std::fs::write(dir.join(name), b"").unwrap();
+        }
+        let files = corpus_files(&dir).unwrap();
+        std::fs::remove_dir_all(&dir).unwrap();
+        let names: Vec<_> = files
+            .iter()
+            .map(|p| p.file_name().unwrap().to_str().unwrap())
+            .collect();
+        assert_eq!(names, ["test_10.wav", "test_2.wav"]);
+    }
+}
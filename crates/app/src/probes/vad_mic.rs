@@ -8,14 +8,14 @@ use coldvox_audio::capture::AudioCaptureThread;
 use coldvox_audio::chunker::{AudioChunker, ChunkerConfig, ResamplerQuality};
 use coldvox_audio::frame_reader::FrameReader;
 use coldvox_audio::ring_buffer::AudioRingBuffer;
-use coldvox_audio::SharedAudioFrame;
+use coldvox_audio::{Delivery, FrameBus, SharedAudioFrame};
 use coldvox_foundation::error::AudioConfig;
 use coldvox_vad::config::{UnifiedVadConfig, VadMode};
 use coldvox_vad::types::VadEvent;
 use serde_json::json;
 use std::collections::HashMap;
 use std::time::{Duration, Instant};
-use tokio::sync::{broadcast, mpsc};
+use tokio::sync::mpsc;
 
 #[derive(Debug)]
 pub struct VadMicCheck;
@@ -88,7 +88,7 @@ impl VadMicCheck {
         });
 
         // Set up VAD processing pipeline
-        let (audio_tx, _) = broadcast::channel::<SharedAudioFrame>(200);
+        let audio_tx = FrameBus::<SharedAudioFrame>::with_metrics(metrics.clone());
         let (event_tx, mut event_rx) = mpsc::channel::<VadEvent>(100);
 
         let chunker_cfg = ChunkerConfig {
@@ -115,11 +115,12 @@ impl VadMicCheck {
                 threshold: 0.2,
                 ..Default::default()
             },
+            cascade: Default::default(),
             frame_size_samples: 512,
             sample_rate_hz: 16000, // Silero requires 16kHz - resampler will handle conversion
         };
 
-        let vad_audio_rx = audio_tx.subscribe();
+        let vad_audio_rx = audio_tx.subscribe("vad", Delivery::Lossless { capacity: 64 });
         let vad_handle =
             match VadProcessor::spawn(vad_cfg, vad_audio_rx, event_tx, Some(metrics.clone())) {
                 Ok(h) => h,
@@ -153,6 +154,7 @@ impl VadMicCheck {
                         VadEvent::SpeechEnd { duration_ms, .. } => {
                             total_speech_duration_ms += *duration_ms;
                         }
+                        VadEvent::SpeculativeStart { .. } | VadEvent::SpeculativeCancel { .. } => {}
                     }
                     vad_events.push((timestamp_ms, event));
                 }
@@ -199,6 +201,10 @@ impl VadMicCheck {
             "vad_fps".to_string(),
             json!(metrics.vad_fps.load(std::sync::atomic::Ordering::Relaxed)),
         );
+        result_metrics.insert(
+            "vad_gated_percent".to_string(),
+            json!(metrics.vad_gated_percent()),
+        );
         result_metrics.insert(
             "capture_buffer_fill".to_string(),
             json!(metrics
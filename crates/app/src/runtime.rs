@@ -1,23 +1,25 @@
-use coldvox_audio::ring_buffer::AudioProducer;
-use coldvox_audio::SharedAudioFrame;
+use coldvox_audio::ring_buffer::{AudioConsumer, AudioProducer};
+use coldvox_audio::{Delivery, FrameBus, FrameSubscriber, SharedAudioFrame};
 use std::sync::Arc;
+use std::time::Instant;
 
 use parking_lot::Mutex;
 use tokio::signal;
 use tokio::sync::{broadcast, mpsc, RwLock};
 use tokio::task::JoinHandle;
-use tracing::{debug, error, info};
+use tracing::{debug, error, info, warn};
 
 use coldvox_audio::{
     AudioCaptureThread, AudioChunker, AudioRingBuffer, ChunkerConfig, FrameReader, ResamplerQuality,
 };
-use coldvox_foundation::AudioConfig;
+use coldvox_foundation::{AudioConfig, CaptureMode};
 use coldvox_stt::TranscriptionEvent;
 use coldvox_telemetry::PipelineMetrics;
 use coldvox_vad::config::SileroConfig;
 use coldvox_vad::{UnifiedVadConfig, VadEvent, VadMode, FRAME_SIZE_SAMPLES, SAMPLE_RATE_HZ};
 
 use crate::hotkey::spawn_hotkey_listener;
+use crate::startup::StartupTimer;
 use crate::stt::plugin_manager::SttPluginManager;
 
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
@@ -26,8 +28,19 @@ use crate::stt::processor::PluginSttProcessor;
 use crate::stt::session::{SessionEvent, SessionSource, Settings};
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
 use coldvox_stt::TranscriptionConfig;
+
+/// The VAD must see every frame; ~2 s of slack before it would lose audio.
+const VAD_DELIVERY: Delivery = Delivery::Lossless { capacity: 64 };
+
+/// STT keeps the newest ~32 s of audio until its processor starts and
+/// replays it, then switches to lossless delivery.
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
-use std::time::Instant;
+const STT_STARTUP_DELIVERY: Delivery = Delivery::DropOldest {
+    capacity: crate::stt::processor::STARTUP_FRAME_QUEUE,
+};
+
+/// Frames queued for [`AppHandle::subscribe_audio`] subscribers.
+const MONITOR_FRAME_QUEUE: usize = 64;
 
 /// Activation strategy for push-to-talk vs voice activation
 #[derive(PartialEq, Copy, Clone, Debug)]
@@ -62,6 +75,8 @@ pub struct InjectionOptions {
     pub cooldown_initial_ms: Option<u64>,
     /// If true, exit immediately if all injection methods fail.
     pub fail_fast: bool,
+    /// Type partial transcripts while the user speaks
+    pub incremental_partials: bool,
 }
 
 /// Options for starting the ColdVox runtime
@@ -132,8 +147,10 @@ pub struct AppHandle {
     pub metrics: Arc<PipelineMetrics>,
     vad_tx: broadcast::Sender<VadEvent>,
     raw_vad_tx: mpsc::Sender<VadEvent>,
-    audio_tx: broadcast::Sender<SharedAudioFrame>,
+    audio_tx: FrameBus<SharedAudioFrame>,
     current_mode: std::sync::Arc<RwLock<ActivationMode>>,
+    /// VAD settings the pipeline started with, reused on mode switches.
+    vad_config: UnifiedVadConfig,
     pub stt_rx: Option<mpsc::Receiver<TranscriptionEvent>>,
     pub plugin_manager: Option<Arc<tokio::sync::RwLock<SttPluginManager>>>,
 
@@ -154,9 +171,27 @@ impl AppHandle {
         self.vad_tx.subscribe()
     }
 
-    /// Subscribe to raw audio frames (16kHz mono i16 samples via SharedAudioFrame)
-    pub fn subscribe_audio(&self) -> broadcast::Receiver<SharedAudioFrame> {
-        self.audio_tx.subscribe()
+    /// Subscribe to raw audio frames (16kHz mono i16 samples via SharedAudioFrame).
+    /// Keeps the newest frames and never holds back the pipeline; suited to
+    /// level meters and dashboards.
+    pub fn subscribe_audio(&self) -> FrameSubscriber<SharedAudioFrame> {
+        self.subscribe_audio_with(
+            "audio",
+            Delivery::DropOldest {
+                capacity: MONITOR_FRAME_QUEUE,
+            },
+        )
+    }
+
+    /// Subscribe to raw audio frames with an explicit delivery policy, e.g.
+    /// [`Delivery::Decimate`] for a waveform view. `name` labels the
+    /// subscriber's lag gauge in [`PipelineMetrics::subscriber_lags`].
+    pub fn subscribe_audio_with(
+        &self,
+        name: &str,
+        delivery: Delivery,
+    ) -> FrameSubscriber<SharedAudioFrame> {
+        self.audio_tx.subscribe(name, delivery)
     }
 
     /// Gracefully stop the pipeline and wait for shutdown
@@ -260,41 +295,8 @@ impl AppHandle {
         // Spawn new trigger
         let new_handle = match mode {
             ActivationMode::Vad => {
-                // VAD (Voice Activity Detection) Configuration
-                //
-                // The VAD is configured to detect speech segments from the audio stream.
-                // Key parameters for the Silero VAD engine are set here.
-                //
-                // Of particular note is `min_silence_duration_ms`. This value was
-                // intentionally increased from a default of 100ms to 500ms.
-                //
-                // Rationale for 500ms silence duration (see issue #61):
-                // - **Problem:** Shorter silence durations (e.g., 100-200ms) can cause the
-                //   VAD to split a single logical utterance into multiple speech events
-                //   during natural pauses in speech.
-                // - **Impact:** This fragmentation leads to disjointed transcriptions and
-                //   can prevent the STT engine from understanding the full context of a
-                //   sentence. It also increases overhead from starting and stopping the
-                //   STT process multiple times.
-                // - **Solution:** A longer duration of 500ms acts as a buffer, "stitching"
-                //   together speech segments that are separated by short pauses. This
-                //   results in more coherent, sentence-like chunks being sent to the STT
-                //   engine, significantly improving transcription quality.
-                // - **Trade-off:** The primary trade-off is a slight increase in latency,
-                //   as the system waits longer to confirm the end of an utterance. For
-                //   dictation, this is an acceptable trade-off for the gain in accuracy.
-                let vad_cfg = UnifiedVadConfig {
-                    mode: VadMode::Silero,
-                    frame_size_samples: FRAME_SIZE_SAMPLES,
-                    sample_rate_hz: SAMPLE_RATE_HZ,
-                    silero: SileroConfig {
-                        threshold: 0.1,
-                        min_speech_duration_ms: 100,
-                        min_silence_duration_ms: 500,
-                        window_size_samples: FRAME_SIZE_SAMPLES,
-                    },
-                };
-                let vad_audio_rx = self.audio_tx.subscribe();
+                let vad_cfg = self.vad_config.clone();
+                let vad_audio_rx = self.audio_tx.subscribe("vad", VAD_DELIVERY);
                 crate::audio::vad_processor::VadProcessor::spawn(
                     vad_cfg,
                     vad_audio_rx,
@@ -317,80 +319,180 @@ impl AppHandle {
     }
 }
 
-/// Start the ColdVox pipeline with the given options
-pub async fn start(
-    opts: AppRuntimeOptions,
-) -> Result<AppHandle, Box<dyn std::error::Error + Send + Sync>> {
-    // Metrics shared across components
-    let metrics = Arc::new(PipelineMetrics::default());
+/// VAD settings used when the caller does not override them.
+pub fn default_vad_config() -> UnifiedVadConfig {
+    // VAD (Voice Activity Detection) Configuration
+    //
+    // The VAD is configured to detect speech segments from the audio stream.
+    // Key parameters for the Silero VAD engine are set here.
+    //
+    // Of particular note is `min_silence_duration_ms`. This value was
+    // intentionally increased from a default of 100ms to 500ms.
+    //
+    // Rationale for 500ms silence duration (see issue #61):
+    // - **Problem:** Shorter silence durations (e.g., 100-200ms) can cause the
+    //   VAD to split a single logical utterance into multiple speech events
+    //   during natural pauses in speech.
+    // - **Impact:** This fragmentation leads to disjointed transcriptions and
+    //   can prevent the STT engine from understanding the full context of a
+    //   sentence. It also increases overhead from starting and stopping the
+    //   STT process multiple times.
+    // - **Solution:** A longer duration of 500ms acts as a buffer, "stitching"
+    //   together speech segments that are separated by short pauses. This
+    //   results in more coherent, sentence-like chunks being sent to the STT
+    //   engine, significantly improving transcription quality.
+    // - **Trade-off:** The primary trade-off is a slight increase in latency,
+    //   as the system waits longer to confirm the end of an utterance. For
+    //   dictation, this is an acceptable trade-off for the gain in accuracy.
+    UnifiedVadConfig {
+        mode: VadMode::Silero,
+        frame_size_samples: FRAME_SIZE_SAMPLES,
+        sample_rate_hz: SAMPLE_RATE_HZ,
+        silero: SileroConfig {
+            threshold: 0.1,
+            min_speech_duration_ms: 100,
+            min_silence_duration_ms: 500,
+            window_size_samples: FRAME_SIZE_SAMPLES,
+            speculative_slope: None,
+        },
+        cascade: Default::default(),
+    }
+}
 
-    info!("Starting ColdVox runtime with unified STT architecture");
+type CaptureParts = (
+    AudioCaptureThread,
+    coldvox_audio::DeviceConfig,
+    broadcast::Receiver<coldvox_audio::DeviceConfig>,
+    broadcast::Receiver<coldvox_foundation::DeviceEvent>,
+);
+
+/// Open the capture device, or a no-op stand-in in test dummy mode. Blocking:
+/// device enumeration and stream setup can take hundreds of milliseconds.
+fn spawn_capture(
+    opts: &AppRuntimeOptions,
+    audio_config: AudioConfig,
+    audio_producer: Arc<Mutex<AudioProducer>>,
+) -> Result<CaptureParts, Box<dyn std::error::Error + Send + Sync>> {
+    if !opts.test_capture_to_dummy {
+        return Ok(AudioCaptureThread::spawn(
+            audio_config,
+            audio_producer,
+            opts.device.clone(),
+            opts.enable_device_monitor,
+        )?);
+    }
 
-    // 1) Audio capture
-    let audio_config = AudioConfig {
-        silence_threshold: 100,
-        capture_buffer_samples: opts.capture_buffer_samples,
+    // In test "dummy" mode, avoid opening any real audio device to prevent ALSA spam.
+    // Construct a no-op capture thread and synthesize device config + channels.
+    use std::sync::atomic::{AtomicBool, Ordering};
+    use std::thread;
+    let shutdown = std::sync::Arc::new(AtomicBool::new(true));
+    let shutdown_clone = shutdown.clone();
+    let handle = thread::Builder::new()
+        .name("audio-capture-dummy".to_string())
+        .spawn(move || {
+            while shutdown_clone.load(Ordering::Relaxed) {
+                thread::sleep(std::time::Duration::from_millis(50));
+            }
+        })
+        .map_err(Box::<dyn std::error::Error + Send + Sync>::from)
+        .unwrap();
+
+    // Use provided test device config if available; else fall back to a sane default.
+    let initial_dc = if let Some(dc) = opts.test_device_config.clone() {
+        dc
+    } else {
+        coldvox_audio::DeviceConfig {
+            sample_rate: SAMPLE_RATE_HZ,
+            channels: 1,
+        }
     };
-    let ring_buffer = AudioRingBuffer::new(audio_config.capture_buffer_samples);
-    let (audio_producer, audio_consumer) = ring_buffer.split();
-    let audio_producer = Arc::new(Mutex::new(audio_producer));
 
-    let (audio_capture, device_cfg, device_config_rx, _device_event_rx) = if opts
-        .test_capture_to_dummy
-    {
-        // In test "dummy" mode, avoid opening any real audio device to prevent ALSA spam.
-        // Construct a no-op capture thread and synthesize device config + channels.
-        use std::sync::atomic::{AtomicBool, Ordering};
-        use std::thread;
-        let shutdown = std::sync::Arc::new(AtomicBool::new(true));
-        let shutdown_clone = shutdown.clone();
-        let handle = thread::Builder::new()
-            .name("audio-capture-dummy".to_string())
-            .spawn(move || {
-                while shutdown_clone.load(Ordering::Relaxed) {
-                    thread::sleep(std::time::Duration::from_millis(50));
-                }
-            })
-            .map_err(Box::<dyn std::error::Error + Send + Sync>::from)
-            .unwrap();
-
-        // Use provided test device config if available; else fall back to a sane default.
-        let initial_dc = if let Some(dc) = opts.test_device_config.clone() {
-            dc
-        } else {
-            coldvox_audio::DeviceConfig {
-                sample_rate: SAMPLE_RATE_HZ,
-                channels: 1,
-            }
-        };
+    // Create broadcast channels and emit initial device config
+    let (cfg_tx, cfg_rx) = tokio::sync::broadcast::channel::<coldvox_audio::DeviceConfig>(16);
+    let (dev_evt_tx, dev_evt_rx) =
+        tokio::sync::broadcast::channel::<coldvox_foundation::DeviceEvent>(32);
+    let _ = dev_evt_tx; // not used in tests here
 
-        // Create broadcast channels and emit initial device config
-        let (cfg_tx, cfg_rx) = tokio::sync::broadcast::channel::<coldvox_audio::DeviceConfig>(16);
-        let (dev_evt_tx, dev_evt_rx) =
-            tokio::sync::broadcast::channel::<coldvox_foundation::DeviceEvent>(32);
-        let _ = dev_evt_tx; // not used in tests here
+    // **Crucially, send the initial config immediately.**
+    if let Err(e) = cfg_tx.send(initial_dc.clone()) {
+        tracing::warn!("Failed to send initial dummy device config: {}", e);
+    }
 
-        // **Crucially, send the initial config immediately.**
-        if let Err(e) = cfg_tx.send(initial_dc.clone()) {
-            tracing::warn!("Failed to send initial dummy device config: {}", e);
-        }
+    // Build a dummy AudioCaptureThread
+    let dummy_capture = AudioCaptureThread {
+        handle,
+        shutdown,
+        device_monitor_handle: None,
+        stats: Default::default(),
+    };
 
-        // Build a dummy AudioCaptureThread
-        let dummy_capture = AudioCaptureThread {
-            handle,
-            shutdown,
-            device_monitor_handle: None,
-        };
+    Ok((dummy_capture, initial_dc, cfg_rx, dev_evt_rx))
+}
 
-        (dummy_capture, initial_dc, cfg_rx, dev_evt_rx)
-    } else {
-        AudioCaptureThread::spawn(
-            audio_config,
-            audio_producer.clone(),
-            opts.device.clone(),
-            opts.enable_device_monitor,
-        )?
+/// Capture, chunker and activation trigger, up and running.
+struct AudioStage {
+    audio_capture: AudioCaptureThread,
+    chunker_handle: JoinHandle<()>,
+    trigger_handle: JoinHandle<()>,
+}
+
+impl AudioStage {
+    /// Tear down after a later startup phase failed.
+    fn stop(self) {
+        self.trigger_handle.abort();
+        self.chunker_handle.abort();
+        self.audio_capture.stop();
+    }
+}
+
+/// Bring up capture, chunker and the activation trigger. The device and the
+/// VAD model are opened in parallel on the blocking pool, and the VAD
+/// subscribes before the first frame so none of the startup audio is missed.
+async fn start_audio(
+    opts: AppRuntimeOptions,
+    audio_producer: Arc<Mutex<AudioProducer>>,
+    audio_consumer: AudioConsumer,
+    audio_tx: FrameBus<SharedAudioFrame>,
+    raw_vad_tx: mpsc::Sender<VadEvent>,
+    metrics: Arc<PipelineMetrics>,
+    timer: Arc<StartupTimer>,
+) -> Result<AudioStage, Box<dyn std::error::Error + Send + Sync>> {
+    let vad_init = (opts.activation_mode == ActivationMode::Vad).then(|| {
+        let vad_cfg = opts.vad_config.clone().unwrap_or_else(default_vad_config);
+        let vad_audio_rx = audio_tx.subscribe("vad", VAD_DELIVERY);
+        let event_tx = raw_vad_tx.clone();
+        let metrics = metrics.clone();
+        let timer = timer.clone();
+        tokio::task::spawn_blocking(move || {
+            let began = Instant::now();
+            let processor = crate::audio::vad_processor::VadProcessor::new(
+                vad_cfg,
+                vad_audio_rx,
+                event_tx,
+                Some(metrics),
+            );
+            if processor.is_ok() {
+                timer.record("vad", began);
+            }
+            processor
+        })
+    });
+
+    // 1) Audio capture
+    let audio_config = AudioConfig {
+        silence_threshold: 100,
+        capture_buffer_samples: opts.capture_buffer_samples,
+        capture_mode: CaptureMode::RealTime,
     };
+    let began = Instant::now();
+    let capture_opts = opts.clone();
+    let (audio_capture, device_cfg, device_config_rx, _device_event_rx) =
+        tokio::task::spawn_blocking(move || {
+            spawn_capture(&capture_opts, audio_config, audio_producer)
+        })
+        .await??;
+    timer.record("capture", began);
 
     // 2) Chunker (with resampler)
     let frame_reader = FrameReader::new(
@@ -405,7 +507,6 @@ pub async fn start(
         sample_rate_hz: SAMPLE_RATE_HZ,
         resampler_quality: opts.resampler_quality,
     };
-    let (audio_tx, _) = broadcast::channel::<SharedAudioFrame>(200);
     // In tests, allow overriding the device config to match the injected WAV
     #[cfg(test)]
     let device_config_rx_for_chunker = if let Some(dc) = opts.test_device_config.clone() {
@@ -419,111 +520,234 @@ pub async fn start(
     #[cfg(not(test))]
     let device_config_rx_for_chunker = device_config_rx.resubscribe();
 
-    let chunker = AudioChunker::new(frame_reader, audio_tx.clone(), chunker_cfg)
-        .with_metrics(metrics.clone())
+    let chunker = AudioChunker::new(frame_reader, audio_tx, chunker_cfg)
+        .with_metrics(metrics)
         .with_device_config(device_config_rx_for_chunker);
     let chunker_handle = chunker.spawn();
 
-    // 3) Activation source (VAD or Hotkey) feeding a raw VAD mpsc channel
-    let (raw_vad_tx, raw_vad_rx) = mpsc::channel::<VadEvent>(200);
-    let trigger_handle = match opts.activation_mode {
-        ActivationMode::Vad => {
-            // VAD (Voice Activity Detection) Configuration
-            //
-            // The VAD is configured to detect speech segments from the audio stream.
-            // Key parameters for the Silero VAD engine are set here.
-            //
-            // Of particular note is `min_silence_duration_ms`. This value was
-            // intentionally increased from a default of 100ms to 500ms.
-            //
-            // Rationale for 500ms silence duration (see issue #61):
-            // - **Problem:** Shorter silence durations (e.g., 100-200ms) can cause the
-            //   VAD to split a single logical utterance into multiple speech events
-            //   during natural pauses in speech.
-            // - **Impact:** This fragmentation leads to disjointed transcriptions and
-            //   can prevent the STT engine from understanding the full context of a
-            //   sentence. It also increases overhead from starting and stopping the
-            //   STT process multiple times.
-            // - **Solution:** A longer duration of 500ms acts as a buffer, "stitching"
-            //   together speech segments that are separated by short pauses. This
-            //   results in more coherent, sentence-like chunks being sent to the STT
-            //   engine, significantly improving transcription quality.
-            // - **Trade-off:** The primary trade-off is a slight increase in latency,
-            //   as the system waits longer to confirm the end of an utterance. For
-            //   dictation, this is an acceptable trade-off for the gain in accuracy.
-            let vad_cfg = opts.vad_config.unwrap_or(UnifiedVadConfig {
-                mode: VadMode::Silero,
-                frame_size_samples: FRAME_SIZE_SAMPLES,
-                sample_rate_hz: SAMPLE_RATE_HZ,
-                silero: SileroConfig {
-                    threshold: 0.1,
-                    min_speech_duration_ms: 100,
-                    min_silence_duration_ms: 500,
-                    window_size_samples: FRAME_SIZE_SAMPLES,
-                },
-            });
-            let vad_audio_rx = audio_tx.subscribe();
-            let vad_handle = crate::audio::vad_processor::VadProcessor::spawn(
-                vad_cfg,
-                vad_audio_rx,
-                raw_vad_tx.clone(),
-                Some(metrics.clone()),
-            )
-            .map_err(|e| {
-                tracing::error!("Failed to spawn VAD processor: {}", e);
-                e
-            })?;
-            vad_handle
+    // 3) Activation source (VAD or Hotkey) feeding the raw VAD mpsc channel
+    let trigger_handle = match vad_init {
+        Some(vad_init) => {
+            let processor = match vad_init.await? {
+                Ok(processor) => processor,
+                Err(e) => {
+                    tracing::error!("Failed to spawn VAD processor: {}", e);
+                    chunker_handle.abort();
+                    audio_capture.stop();
+                    return Err(e.into());
+                }
+            };
+            tracing::info!("VAD processor spawned successfully");
+            tokio::spawn(processor.run())
         }
-        ActivationMode::Hotkey | ActivationMode::AlwaysOnPushToTranscribe => {
-            spawn_hotkey_listener(raw_vad_tx.clone())
+        None => spawn_hotkey_listener(raw_vad_tx),
+    };
+
+    Ok(AudioStage {
+        audio_capture,
+        chunker_handle,
+        trigger_handle,
+    })
+}
+
+/// Create and initialize the STT plugin manager (loads the model), if STT is
+/// configured. Startup fails when no STT plugin can be initialized.
+async fn init_stt(
+    selection: Option<coldvox_stt::plugin::PluginSelectionConfig>,
+    metrics: Arc<PipelineMetrics>,
+    timer: Arc<StartupTimer>,
+) -> Result<
+    Option<Arc<tokio::sync::RwLock<SttPluginManager>>>,
+    Box<dyn std::error::Error + Send + Sync>,
+> {
+    let Some(config) = selection else {
+        return Ok(None);
+    };
+    let began = Instant::now();
+    let mut manager = SttPluginManager::new().with_metrics_sink(metrics);
+    manager.set_selection_config(config).await?;
+    // Initialize the plugin manager; enforce fail-fast semantics when no STT plugin is available
+    match manager.initialize().await {
+        Ok(plugin_id) => {
+            info!(
+                "STT plugin manager initialized successfully with plugin: {}",
+                plugin_id
+            );
+            timer.record("stt", began);
+            Ok(Some(Arc::new(tokio::sync::RwLock::new(manager))))
         }
+        Err(e) => {
+            // Fail startup when STT cannot be initialized (no-op/disabled STT not allowed)
+            error!("Failed to initialize STT plugin manager: {}", e);
+            Err(Box::new(e))
+        }
+    }
+}
+
+/// Build the text-injection processor (backend detection, injector setup) if
+/// injection is enabled. Returns it with the sender that keeps it running.
+async fn init_injection(
+    options: Option<InjectionOptions>,
+    text_injection_rx: mpsc::Receiver<TranscriptionEvent>,
+    metrics: Arc<PipelineMetrics>,
+    timer: Arc<StartupTimer>,
+) -> Option<(
+    crate::text_injection::AsyncInjectionProcessor,
+    mpsc::Sender<()>,
+)> {
+    let inj = options.filter(|inj| inj.enable)?;
+    let mut config = crate::text_injection::InjectionConfig {
+        allow_kdotool: inj.allow_kdotool,
+        allow_enigo: inj.allow_enigo,
+        inject_on_unknown_focus: inj.inject_on_unknown_focus,
+        incremental_partials: inj.incremental_partials,
+        // clipboard restore is always enabled by the text-injection crate
+        ..Default::default()
     };
+    if let Some(v) = inj.max_total_latency_ms {
+        config.max_total_latency_ms = v;
+    }
+    if let Some(v) = inj.per_method_timeout_ms {
+        config.per_method_timeout_ms = v;
+    }
+    if let Some(v) = inj.cooldown_initial_ms {
+        config.cooldown_initial_ms = v;
+    }
+    // NOTE: fail_fast is currently not a field on InjectionConfig
+    // This mapping may need to be re-added once the field is available
+    // config.fail_fast = inj.fail_fast
+    //     || std::env::var("COLDVOX_FAIL_FAST")
+    //         .map(|v| v == "1" || v.to_lowercase() == "true")
+    //         .unwrap_or(false);
+
+    let (shutdown_tx, shutdown_rx) = mpsc::channel::<()>(1);
+    let processor = timer
+        .phase(
+            "injection",
+            crate::text_injection::AsyncInjectionProcessor::new(
+                config,
+                text_injection_rx,
+                shutdown_rx,
+                Some(metrics),
+            ),
+        )
+        .await;
+    Some((processor, shutdown_tx))
+}
 
-    // Log successful VAD processor spawn
-    if let ActivationMode::Vad = opts.activation_mode {
-        tracing::info!("VAD processor spawned successfully");
+/// Start the ColdVox pipeline with the given options.
+///
+/// Independent subsystems come up concurrently, each in its own task: capture,
+/// chunker and VAD are usually ready first, so audio is already buffered for
+/// the STT pre-roll while the STT model and the injection backends are still
+/// loading. Per-phase timings are logged under the
+/// `startup` target.
+pub async fn start(
+    opts: AppRuntimeOptions,
+) -> Result<AppHandle, Box<dyn std::error::Error + Send + Sync>> {
+    let timer = Arc::new(StartupTimer::new());
+    // Metrics shared across components
+    let metrics = Arc::new(PipelineMetrics::default());
+    // Set COLDVOX_TRACE_FILE to also write per-utterance timelines as a Chrome trace
+    if let Ok(path) = std::env::var("COLDVOX_TRACE_FILE") {
+        match metrics.utterance_trace.enable_chrome_trace(&path) {
+            Ok(()) => info!("Writing utterance timelines to {}", path),
+            Err(e) => warn!("Failed to open trace file {}: {}", path, e),
+        }
     }
 
-    // 4) Fan-out raw VAD mpsc -> broadcast for UI, and to STT when enabled
-    let (vad_bcast_tx, _) = broadcast::channel::<VadEvent>(256);
+    info!("Starting ColdVox runtime with unified STT architecture");
 
-    // 5) STT Plugin Manager
-    let plugin_manager: Option<Arc<tokio::sync::RwLock<SttPluginManager>>> =
-        if opts.stt_selection.is_some() {
-            let metrics_clone = metrics.clone();
-            let mut manager = SttPluginManager::new().with_metrics_sink(metrics_clone);
-            if let Some(config) = opts.stt_selection.clone() {
-                manager.set_selection_config(config).await?;
-            }
-            // Initialize the plugin manager; enforce fail-fast semantics when no STT plugin is available
-            match manager.initialize().await {
-                Ok(plugin_id) => {
-                    info!(
-                        "STT plugin manager initialized successfully with plugin: {}",
-                        plugin_id
-                    );
-                    Some(Arc::new(tokio::sync::RwLock::new(manager)))
-                }
-                Err(e) => {
-                    // Fail startup when STT cannot be initialized (no-op/disabled STT not allowed)
-                    error!("Failed to initialize STT plugin manager: {}", e);
-                    return Err(Box::new(e));
-                }
-            }
-        } else {
-            None
-        };
+    let ring_buffer = AudioRingBuffer::new(opts.capture_buffer_samples);
+    let (audio_producer, audio_consumer) = ring_buffer.split();
+    let audio_producer = Arc::new(Mutex::new(audio_producer));
+    let audio_tx = FrameBus::<SharedAudioFrame>::with_metrics(metrics.clone());
+    let (raw_vad_tx, raw_vad_rx) = mpsc::channel::<VadEvent>(200);
+
+    // Subscribed before audio flows: frames captured while the STT model
+    // loads become the processor's pre-roll. Until the processor runs it keeps
+    // only the newest frames, so a slow model load never holds back the VAD;
+    // the processor then switches itself to lossless delivery.
+    #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
+    let stt_audio_rx = opts
+        .stt_selection
+        .is_some()
+        .then(|| audio_tx.subscribe("stt", STT_STARTUP_DELIVERY));
+
+    // 1-3) Capture, chunker and activation source in their own task
+    let audio_init = tokio::spawn(start_audio(
+        opts.clone(),
+        audio_producer.clone(),
+        audio_consumer,
+        audio_tx.clone(),
+        raw_vad_tx.clone(),
+        metrics.clone(),
+        timer.clone(),
+    ));
+
+    // Text injection channel
+    let (_text_injection_tx, text_injection_rx) = mpsc::channel::<TranscriptionEvent>(100);
+
+    // 4) STT plugin manager and text-injection backends, each in its own task
+    let stt_init = tokio::spawn(init_stt(
+        opts.stt_selection.clone(),
+        metrics.clone(),
+        timer.clone(),
+    ));
+    let injection_init = tokio::spawn(init_injection(
+        opts.injection.clone(),
+        text_injection_rx,
+        metrics.clone(),
+        timer.clone(),
+    ));
+
+    let audio = match audio_init.await {
+        Ok(Ok(stage)) => stage,
+        Ok(Err(e)) => {
+            stt_init.abort();
+            injection_init.abort();
+            return Err(e);
+        }
+        Err(e) => {
+            stt_init.abort();
+            injection_init.abort();
+            return Err(Box::new(e));
+        }
+    };
+    let plugin_manager = match stt_init.await {
+        Ok(Ok(plugin_manager)) => plugin_manager,
+        Ok(Err(e)) => {
+            injection_init.abort();
+            audio.stop();
+            return Err(e);
+        }
+        Err(e) => {
+            injection_init.abort();
+            audio.stop();
+            return Err(Box::new(e));
+        }
+    };
+    let injection_init = match injection_init.await {
+        Ok(injection) => injection,
+        Err(e) => {
+            audio.stop();
+            return Err(Box::new(e));
+        }
+    };
+    let AudioStage {
+        audio_capture,
+        chunker_handle,
+        trigger_handle,
+    } = audio;
+
+    // 5) Fan-out raw VAD mpsc -> broadcast for UI, and to STT when enabled
+    let (vad_bcast_tx, _) = broadcast::channel::<VadEvent>(256);
 
     // Create transcription event channels
     let (stt_tx, stt_rx) = mpsc::channel::<TranscriptionEvent>(100);
     #[cfg(not(any(feature = "moonshine", feature = "parakeet", feature = "http-remote")))]
     let _ = &stt_tx; // suppress unused warning when no active STT backend
 
-    // Text injection channel
-
-    let (_text_injection_tx, text_injection_rx) = mpsc::channel::<TranscriptionEvent>(100);
-
     // 6) STT Processor and Fanout - Unified Path
     #[allow(unused_mut)]
     let mut stt_forward_handle: Option<JoinHandle<()>> = None;
@@ -533,7 +757,8 @@ pub async fn start(
         let (session_tx, session_rx) = mpsc::channel::<SessionEvent>(100);
 
         #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
-        let stt_audio_rx = audio_tx.subscribe();
+        let stt_audio_rx =
+            stt_audio_rx.unwrap_or_else(|| audio_tx.subscribe("stt", STT_STARTUP_DELIVERY));
 
         #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
         let (stt_pipeline_tx, stt_pipeline_rx) = mpsc::channel::<TranscriptionEvent>(100);
@@ -560,7 +785,7 @@ pub async fn start(
             stt_audio_rx,
             session_rx,
             stt_pipeline_tx.clone(),
-            _pm,
+            _pm.read().await.audio_path(),
             stt_config,
             processor_settings,
         );
@@ -579,31 +804,18 @@ pub async fn start(
                 // Translate to SessionEvent for the STT processor
                 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
                 {
-                    let session_event = match ev {
-                        VadEvent::SpeechStart { .. } => {
-                            let source = match activation_mode {
-                                ActivationMode::Vad => SessionSource::Vad,
-                                ActivationMode::Hotkey
-                                | ActivationMode::AlwaysOnPushToTranscribe => SessionSource::Hotkey,
-                            };
-                            Some(SessionEvent::Start(source, Instant::now()))
-                        }
-                        VadEvent::SpeechEnd { .. } => {
-                            let source = match activation_mode {
-                                ActivationMode::Vad => SessionSource::Vad,
-                                ActivationMode::Hotkey
-                                | ActivationMode::AlwaysOnPushToTranscribe => SessionSource::Hotkey,
-                            };
-                            Some(SessionEvent::End(source, Instant::now()))
+                    let source = match activation_mode {
+                        ActivationMode::Vad => SessionSource::Vad,
+                        ActivationMode::Hotkey | ActivationMode::AlwaysOnPushToTranscribe => {
+                            SessionSource::Hotkey
                         }
                     };
+                    let session_event = SessionEvent::from_vad(&ev, source, Instant::now());
 
-                    if let Some(event) = session_event {
-                        if session_tx.send(event).await.is_err() {
-                            // STT processor channel closed, probably shutting down.
-                            // Continue forwarding VAD events for UI rather than exiting.
-                            continue;
-                        }
+                    if session_tx.send(session_event).await.is_err() {
+                        // STT processor channel closed, probably shutting down.
+                        // Continue forwarding VAD events for UI rather than exiting.
+                        continue;
                     }
                 }
             }
@@ -695,56 +907,14 @@ pub async fn start(
     };
 
     // Optional text-injection
-
-    let injection_handle = {
-        let inj_opts = opts.injection.clone();
-        if let Some(inj) = inj_opts {
-            if inj.enable {
-                let mut config = crate::text_injection::InjectionConfig {
-                    allow_kdotool: inj.allow_kdotool,
-                    allow_enigo: inj.allow_enigo,
-                    inject_on_unknown_focus: inj.inject_on_unknown_focus,
-                    // clipboard restore is always enabled by the text-injection crate
-                    ..Default::default()
-                };
-                if let Some(v) = inj.max_total_latency_ms {
-                    config.max_total_latency_ms = v;
-                }
-                if let Some(v) = inj.per_method_timeout_ms {
-                    config.per_method_timeout_ms = v;
-                }
-                if let Some(v) = inj.cooldown_initial_ms {
-                    config.cooldown_initial_ms = v;
-                }
-                // NOTE: fail_fast is currently not a field on InjectionConfig
-                // This mapping may need to be re-added once the field is available
-                // config.fail_fast = inj.fail_fast
-                //     || std::env::var("COLDVOX_FAIL_FAST")
-                //         .map(|v| v == "1" || v.to_lowercase() == "true")
-                //         .unwrap_or(false);
-
-                let (shutdown_tx, shutdown_rx) = mpsc::channel::<()>(1);
-                let processor = crate::text_injection::AsyncInjectionProcessor::new(
-                    config,
-                    text_injection_rx,
-                    shutdown_rx,
-                    None,
-                )
-                .await;
-
-                Some(tokio::spawn(async move {
-                    if let Err(e) = processor.run().await {
-                        tracing::error!("Injection processor error: {}", e);
-                    }
-                    drop(shutdown_tx);
-                }))
-            } else {
-                None
+    let injection_handle = injection_init.map(|(processor, shutdown_tx)| {
+        tokio::spawn(async move {
+            if let Err(e) = processor.run().await {
+                tracing::error!("Injection processor error: {}", e);
             }
-        } else {
-            None
-        }
-    };
+            drop(shutdown_tx);
+        })
+    });
 
     // Log pipeline component initialization status
     tracing::info!(
@@ -754,6 +924,12 @@ pub async fn start(
         matches!(opts.activation_mode, ActivationMode::Vad),
         opts.stt_selection.is_some()
     );
+    info!(
+        target: "startup",
+        "Runtime ready in {} ms ({})",
+        timer.elapsed().as_millis(),
+        timer.summary()
+    );
 
     Ok(AppHandle {
         metrics,
@@ -761,6 +937,7 @@ pub async fn start(
         raw_vad_tx,
         audio_tx,
         current_mode: std::sync::Arc::new(RwLock::new(opts.activation_mode)),
+        vad_config: opts.vad_config.clone().unwrap_or_else(default_vad_config),
         stt_rx: Some(stt_rx),
         plugin_manager,
         audio_capture,
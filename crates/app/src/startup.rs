@@ -0,0 +1,113 @@
+//! # Startup phase timing
+//!
+//! `runtime::start` brings subsystems up concurrently, so a phase's own
+//! duration and the point at which it became ready both matter. Each phase is
+//! logged as it completes and [`StartupTimer::summary`] gives the whole
+//! picture once the runtime is up.
+
+use parking_lot::Mutex;
+use std::future::Future;
+use std::time::{Duration, Instant};
+use tracing::info;
+
+/// One completed startup phase.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct StartupPhase {
+    pub name: &'static str,
+    /// Time spent in the phase itself.
+    pub took: Duration,
+    /// Time from the start of startup until the phase finished.
+    pub ready_at: Duration,
+}
+
+/// Records startup phases relative to a common start; shareable across tasks.
+#[derive(Debug)]
+pub struct StartupTimer {
+    started: Instant,
+    phases: Mutex<Vec<StartupPhase>>,
+}
+
+impl Default for StartupTimer {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl StartupTimer {
+    pub fn new() -> Self {
+        Self {
+            started: Instant::now(),
+            phases: Mutex::new(Vec::new()),
+        }
+    }
+
+    /// Record that phase `name`, begun at `began`, has just finished.
+    pub fn record(&self, name: &'static str, began: Instant) {
+        let now = Instant::now();
+        let phase = StartupPhase {
+            name,
+            took: now.duration_since(began),
+            ready_at: now.duration_since(self.started),
+        };
+        info!(
+            target: "startup",
+            "{} ready in {} ms (+{} ms since start)",
+            name,
+            phase.took.as_millis(),
+            phase.ready_at.as_millis()
+        );
+        self.phases.lock().push(phase);
+    }
+
+    /// Run `fut` as phase `name`.
+    pub async fn phase<T>(&self, name: &'static str, fut: impl Future<Output = T>) -> T {
+        let began = Instant::now();
+        let out = fut.await;
+        self.record(name, began);
+        out
+    }
+
+    /// Completed phases in the order they finished.
+    pub fn phases(&self) -> Vec<StartupPhase> {
+        self.phases.lock().clone()
+    }
+
+    /// Time since startup began.
+    pub fn elapsed(&self) -> Duration {
+        self.started.elapsed()
+    }
+
+    /// One line listing every phase, e.g. `capture 80 ms, vad 310 ms, stt 2140 ms`.
+    pub fn summary(&self) -> String {
+        self.phases
+            .lock()
+            .iter()
+            .map(|p| format!("{} {} ms", p.name, p.took.as_millis()))
+            .collect::<Vec<_>>()
+            .join(", ")
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[tokio::test]
+    async fn phases_are_recorded_in_completion_order() {
+        let timer = StartupTimer::new();
+        let slow = timer.phase("slow", async {
+            tokio::time::sleep(Duration::from_millis(30)).await;
+            1
+        });
+        let fast = timer.phase("fast", async { 2 });
+        let (a, b) = tokio::join!(slow, fast);
+        assert_eq!((a, b), (1, 2));
+
+        let phases = timer.phases();
+        let names: Vec<_> = phases.iter().map(|p| p.name).collect();
+        assert_eq!(names, ["fast", "slow"]);
+        assert!(phases[1].took >= Duration::from_millis(30));
+        assert!(phases[1].ready_at >= phases[0].ready_at);
+        assert!(timer.summary().starts_with("fast 0 ms, slow "));
+    }
+}
@@ -9,12 +9,14 @@ pub use coldvox_stt::{
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
 pub mod processor;
 
+pub mod preroll;
 pub mod session;
 
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
 pub mod persistence;
 
 pub mod plugin_manager;
+pub mod wer;
 
 #[cfg(test)]
 mod tests;
@@ -1,14 +1,36 @@
+//! Transcript and audio persistence.
+//!
+//! The audio path only converts frames into pooled buffers and hands them to
+//! a dedicated writer thread over a bounded queue; it never touches the disk
+//! or waits on it. The writer thread appends all audio of a session to one
+//! file (`session.wav` or raw `session.pcm`), appends transcripts to a single
+//! log (`transcripts.jsonl`, `transcriptions.csv` or `transcript.txt`), and
+//! flushes in batches with a periodic fsync. Each utterance record points at
+//! its segment of the session audio by sample offset.
+//!
+//! Segments are keyed by the utterance's [`TraceId`] (its VAD speech start).
+//! With a tracer attached, a final finds its segment through the trace its
+//! `utterance_id` was bound to, so an utterance that produced no final cannot
+//! shift later transcripts onto the wrong audio.
+
 use chrono::{DateTime, Local, TimeZone};
 use csv::Writer;
 use hound::{WavSpec, WavWriter};
 use parking_lot::Mutex;
 use serde::{Deserialize, Serialize};
-use std::fs;
+use std::collections::VecDeque;
+use std::fs::{self, File};
+use std::io::{BufWriter, Write};
 use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
+use std::sync::mpsc::{self, Receiver, RecvTimeoutError, Sender, SyncSender, TrySendError};
 use std::sync::Arc;
+use std::thread::JoinHandle;
+use std::time::{Duration, Instant};
 
 use crate::stt::TranscriptionEvent;
 use coldvox_audio::chunker::AudioFrame;
+use coldvox_telemetry::{TraceId, UtteranceTracer};
 use coldvox_vad::types::VadEvent;
 
 /// Configuration for transcription persistence
@@ -28,6 +50,9 @@ pub struct PersistenceConfig {
     pub retention_days: u32,
     /// Sample rate for audio processing
     pub sample_rate: u32,
+    /// How often the writer thread fsyncs the session files (buffers are
+    /// flushed to the OS every second regardless)
+    pub fsync_interval: Duration,
 }
 
 impl Default for PersistenceConfig {
@@ -40,18 +65,32 @@ impl Default for PersistenceConfig {
             transcript_format: TranscriptFormat::Json,
             retention_days: 30,
             sample_rate: 16000,
+            fsync_interval: Duration::from_secs(5),
         }
     }
 }
 
 #[derive(Debug, Clone, Copy)]
 pub enum AudioFormat {
+    /// One `session.wav`; the header is refreshed on every flush.
     Wav,
+    /// One headerless `session.pcm` (16-bit little-endian mono).
+    Raw,
     // Future: Mp3, Opus, etc.
 }
 
+impl AudioFormat {
+    fn file_name(self) -> &'static str {
+        match self {
+            AudioFormat::Wav => "session.wav",
+            AudioFormat::Raw => "session.pcm",
+        }
+    }
+}
+
 #[derive(Debug, Clone, Copy)]
 pub enum TranscriptFormat {
+    /// Append-only `transcripts.jsonl`, one compact record per line.
     Json,
     Csv,
     Text,
@@ -88,8 +127,13 @@ pub struct UtteranceRecord {
     pub text: String,
     /// Confidence score (if available)
     pub confidence: Option<f32>,
-    /// Path to audio file (if saved)
+    /// Path to the session audio file (if saved)
     pub audio_path: Option<PathBuf>,
+    /// The utterance's segment of the session audio, in samples
+    #[serde(default, skip_serializing_if = "Option::is_none")]
+    pub audio_offset_samples: Option<u64>,
+    #[serde(default, skip_serializing_if = "Option::is_none")]
+    pub audio_len_samples: Option<u64>,
     /// Word-level timing (if available)
     pub words: Option<Vec<WordTiming>>,
 }
@@ -116,22 +160,346 @@ pub struct SessionMetadata {
     pub app_version: String,
 }
 
+/// Audio frames queued for the writer thread before the audio path starts
+/// dropping them (~8 s of 32 ms frames).
+const QUEUE_FRAMES: usize = 256;
+
+/// Buffered output is handed to the OS at least this often.
+const FLUSH_INTERVAL: Duration = Duration::from_secs(1);
+
+/// An ended utterance whose final has not arrived within this long is
+/// assumed to have produced none (e.g. silence), so its segment is dropped
+/// rather than attached to a later final.
+const FINAL_WAIT: Duration = Duration::from_secs(30);
+
+/// Ended utterances kept waiting for their finals.
+const MAX_ENDED: usize = 8;
+
+/// VAD timing and session-audio range of one utterance.
+#[derive(Debug, Clone, Copy)]
+struct Segment {
+    trace: TraceId,
+    start_ms: u64,
+    /// Unset while speech is ongoing
+    duration_ms: Option<u64>,
+    start_sample: u64,
+    /// Unset while speech is ongoing
+    end_sample: Option<u64>,
+}
+
+/// Work for the writer thread.
+enum WriterCommand {
+    Audio(Vec<i16>),
+    Transcript(Box<UtteranceRecord>),
+    /// Flush, fsync and exit.
+    Finish,
+}
+
+/// Session audio file, appended to by the writer thread.
+enum AudioSink {
+    /// `sync` is a second handle on the same file, since hound does not
+    /// expose its own for fsync.
+    Wav {
+        writer: WavWriter<BufWriter<File>>,
+        sync: File,
+    },
+    Raw {
+        writer: BufWriter<File>,
+        scratch: Vec<u8>,
+    },
+}
+
+impl AudioSink {
+    fn create(path: &Path, format: AudioFormat, sample_rate: u32) -> Result<Self, String> {
+        match format {
+            AudioFormat::Wav => {
+                let spec = WavSpec {
+                    channels: 1,
+                    sample_rate,
+                    bits_per_sample: 16,
+                    sample_format: hound::SampleFormat::Int,
+                };
+                let writer = WavWriter::create(path, spec)
+                    .map_err(|e| format!("Failed to create WAV file: {}", e))?;
+                let sync = fs::OpenOptions::new()
+                    .write(true)
+                    .open(path)
+                    .map_err(|e| format!("Failed to open WAV file for sync: {}", e))?;
+                Ok(AudioSink::Wav { writer, sync })
+            }
+            AudioFormat::Raw => {
+                let file =
+                    File::create(path).map_err(|e| format!("Failed to create PCM file: {}", e))?;
+                Ok(AudioSink::Raw {
+                    writer: BufWriter::with_capacity(64 * 1024, file),
+                    scratch: Vec::new(),
+                })
+            }
+        }
+    }
+
+    fn append(&mut self, samples: &[i16]) -> Result<(), String> {
+        match self {
+            AudioSink::Wav { writer, .. } => {
+                let mut block = writer.get_i16_writer(samples.len() as u32);
+                for &sample in samples {
+                    block.write_sample(sample);
+                }
+                block
+                    .flush()
+                    .map_err(|e| format!("Failed to write WAV samples: {}", e))
+            }
+            AudioSink::Raw { writer, scratch } => {
+                scratch.clear();
+                scratch.extend(samples.iter().flat_map(|s| s.to_le_bytes()));
+                writer
+                    .write_all(scratch)
+                    .map_err(|e| format!("Failed to write PCM samples: {}", e))
+            }
+        }
+    }
+
+    fn flush(&mut self, sync: bool) -> Result<(), String> {
+        match self {
+            AudioSink::Wav { writer, sync: file } => {
+                // Also rewrites the header, so the file is playable as it stands
+                writer
+                    .flush()
+                    .map_err(|e| format!("Failed to flush WAV file: {}", e))?;
+                if sync {
+                    file.sync_data()
+                        .map_err(|e| format!("Failed to sync WAV file: {}", e))?;
+                }
+            }
+            AudioSink::Raw { writer, .. } => {
+                writer
+                    .flush()
+                    .map_err(|e| format!("Failed to flush PCM file: {}", e))?;
+                if sync {
+                    writer
+                        .get_ref()
+                        .sync_data()
+                        .map_err(|e| format!("Failed to sync PCM file: {}", e))?;
+                }
+            }
+        }
+        Ok(())
+    }
+
+    fn finish(self) -> Result<(), String> {
+        match self {
+            AudioSink::Wav { writer, sync } => {
+                writer
+                    .finalize()
+                    .map_err(|e| format!("Failed to finalize WAV file: {}", e))?;
+                sync.sync_data()
+                    .map_err(|e| format!("Failed to sync WAV file: {}", e))
+            }
+            mut raw @ AudioSink::Raw { .. } => raw.flush(true),
+        }
+    }
+}
+
+/// Append-only transcript log, written by the writer thread.
+enum TranscriptSink {
+    Jsonl(BufWriter<File>),
+    Csv(Writer<File>),
+    Text(BufWriter<File>),
+}
+
+impl TranscriptSink {
+    fn create(session_dir: &Path, format: TranscriptFormat) -> Result<Self, String> {
+        let create = |name: &str| {
+            File::create(session_dir.join(name))
+                .map_err(|e| format!("Failed to create {}: {}", name, e))
+        };
+        Ok(match format {
+            TranscriptFormat::Json => {
+                TranscriptSink::Jsonl(BufWriter::new(create("transcripts.jsonl")?))
+            }
+            TranscriptFormat::Csv => {
+                let mut wtr = Writer::from_writer(create("transcriptions.csv")?);
+                wtr.write_record([
+                    "utterance_id",
+                    "timestamp",
+                    "duration_ms",
+                    "text",
+                    "audio_path",
+                    "audio_offset_samples",
+                    "audio_len_samples",
+                ])
+                .map_err(|e| format!("Failed to write CSV header: {}", e))?;
+                TranscriptSink::Csv(wtr)
+            }
+            TranscriptFormat::Text => {
+                TranscriptSink::Text(BufWriter::new(create("transcript.txt")?))
+            }
+        })
+    }
+
+    fn append(&mut self, utterance: &UtteranceRecord) -> Result<(), String> {
+        match self {
+            TranscriptSink::Jsonl(w) => {
+                serde_json::to_writer(&mut *w, utterance)
+                    .map_err(|e| format!("Failed to serialize utterance: {}", e))?;
+                w.write_all(b"\n")
+                    .map_err(|e| format!("Failed to write transcript log: {}", e))
+            }
+            TranscriptSink::Csv(wtr) => {
+                let optional = |v: Option<u64>| v.map(|v| v.to_string()).unwrap_or_default();
+                // The CSV writer handles escaping and quoting
+                wtr.write_record(&[
+                    utterance.utterance_id.to_string(),
+                    utterance.started_at.clone(),
+                    utterance.duration_ms.to_string(),
+                    utterance.text.clone(),
+                    utterance
+                        .audio_path
+                        .as_ref()
+                        .map(|p| p.to_string_lossy().to_string())
+                        .unwrap_or_default(),
+                    optional(utterance.audio_offset_samples),
+                    optional(utterance.audio_len_samples),
+                ])
+                .map_err(|e| format!("Failed to write CSV record: {}", e))
+            }
+            TranscriptSink::Text(w) => writeln!(w, "[{}] {}", utterance.started_at, utterance.text)
+                .map_err(|e| format!("Failed to write text file: {}", e)),
+        }
+    }
+
+    fn flush(&mut self, sync: bool) -> Result<(), String> {
+        let file = match self {
+            TranscriptSink::Jsonl(w) | TranscriptSink::Text(w) => {
+                w.flush().map_err(|e| e.to_string())?;
+                w.get_ref()
+            }
+            TranscriptSink::Csv(wtr) => {
+                wtr.flush().map_err(|e| e.to_string())?;
+                wtr.get_ref()
+            }
+        };
+        if sync {
+            file.sync_data()
+                .map_err(|e| format!("Failed to sync transcript log: {}", e))?;
+        }
+        Ok(())
+    }
+}
+
+/// State owned by the writer thread.
+struct SessionFiles {
+    audio: Option<AudioSink>,
+    transcripts: Option<TranscriptSink>,
+    /// Returns audio buffers to the audio path for reuse.
+    recycle: Sender<Vec<i16>>,
+    fsync_interval: Duration,
+    /// Written since the last fsync.
+    dirty: bool,
+}
+
+impl SessionFiles {
+    fn run(mut self, rx: Receiver<WriterCommand>) {
+        let mut next_flush = Instant::now() + FLUSH_INTERVAL;
+        let mut last_sync = Instant::now();
+        loop {
+            match rx.recv_timeout(next_flush.saturating_duration_since(Instant::now())) {
+                Ok(WriterCommand::Finish) | Err(RecvTimeoutError::Disconnected) => break,
+                Ok(command) => self.apply(command),
+                Err(RecvTimeoutError::Timeout) => {}
+            }
+            if Instant::now() >= next_flush {
+                let sync = self.dirty && last_sync.elapsed() >= self.fsync_interval;
+                self.flush(sync);
+                if sync {
+                    last_sync = Instant::now();
+                    self.dirty = false;
+                }
+                next_flush = Instant::now() + FLUSH_INTERVAL;
+            }
+        }
+        self.finish();
+    }
+
+    fn apply(&mut self, command: WriterCommand) {
+        match command {
+            WriterCommand::Audio(samples) => {
+                if let Some(audio) = self.audio.as_mut() {
+                    if let Err(e) = audio.append(&samples) {
+                        tracing::error!("Disabling audio persistence: {}", e);
+                        self.audio = None;
+                    }
+                }
+                // The audio path may be gone during shutdown
+                let _ = self.recycle.send(samples);
+            }
+            WriterCommand::Transcript(utterance) => {
+                if let Some(transcripts) = self.transcripts.as_mut() {
+                    if let Err(e) = transcripts.append(&utterance) {
+                        tracing::error!("Failed to persist transcription: {}", e);
+                    }
+                }
+            }
+            WriterCommand::Finish => {}
+        }
+        self.dirty = true;
+    }
+
+    fn flush(&mut self, sync: bool) {
+        if let Some(audio) = self.audio.as_mut() {
+            if let Err(e) = audio.flush(sync) {
+                tracing::error!("Failed to flush session audio: {}", e);
+            }
+        }
+        if let Some(transcripts) = self.transcripts.as_mut() {
+            if let Err(e) = transcripts.flush(sync) {
+                tracing::error!("Failed to flush transcript log: {}", e);
+            }
+        }
+    }
+
+    fn finish(mut self) {
+        if let Some(audio) = self.audio.take() {
+            if let Err(e) = audio.finish() {
+                tracing::error!("Failed to close session audio: {}", e);
+            }
+        }
+        if let Some(transcripts) = self.transcripts.as_mut() {
+            if let Err(e) = transcripts.flush(true) {
+                tracing::error!("Failed to close transcript log: {}", e);
+            }
+        }
+    }
+}
+
 /// Handles persistence of transcriptions and audio
 pub struct TranscriptionWriter {
     config: PersistenceConfig,
     current_session: Arc<Mutex<TranscriptionSession>>,
-    current_utterance_audio: Arc<Mutex<Vec<i16>>>,
     session_dir: PathBuf,
-    utterance_active: Arc<Mutex<bool>>,
-    /// Track timing from VAD events
-    last_speech_start_ms: Arc<Mutex<Option<u64>>>,
-    last_speech_duration_ms: Arc<Mutex<Option<u64>>>,
+    utterance_active: AtomicBool,
+    /// Samples handed to the writer thread, i.e. the session audio length
+    samples_queued: AtomicU64,
+    /// Segment of the utterance being spoken
+    speaking: Mutex<Option<Segment>>,
+    /// Segments captured at speech end, oldest first, each waiting for its
+    /// utterance's final.
+    ended: Mutex<VecDeque<(Instant, Segment)>>,
+    /// Maps a final's `utterance_id` to the trace its segment is keyed by.
+    tracer: Option<Arc<UtteranceTracer>>,
+    dropped_frames: AtomicU64,
+    queue: Option<SyncSender<WriterCommand>>,
+    /// Buffers the writer thread is done with. Only the audio path takes
+    /// this lock, so it is never contended.
+    recycled: Mutex<Receiver<Vec<i16>>>,
+    writer_thread: Mutex<Option<JoinHandle<()>>>,
 }
 
 impl TranscriptionWriter {
     /// Create a new transcription writer
     pub fn new(config: PersistenceConfig, metadata: SessionMetadata) -> Result<Self, String> {
         if !config.enabled {
+            let (_, recycled) = mpsc::channel();
             return Ok(Self {
                 config,
                 current_session: Arc::new(Mutex::new(TranscriptionSession {
@@ -141,11 +509,16 @@ impl TranscriptionWriter {
                     utterances: Vec::new(),
                     metadata,
                 })),
-                current_utterance_audio: Arc::new(Mutex::new(Vec::new())),
                 session_dir: PathBuf::new(),
-                utterance_active: Arc::new(Mutex::new(false)),
-                last_speech_start_ms: Arc::new(Mutex::new(None)),
-                last_speech_duration_ms: Arc::new(Mutex::new(None)),
+                utterance_active: AtomicBool::new(false),
+                samples_queued: AtomicU64::new(0),
+                speaking: Mutex::new(None),
+                ended: Mutex::new(VecDeque::new()),
+                tracer: None,
+                dropped_frames: AtomicU64::new(0),
+                queue: None,
+                recycled: Mutex::new(recycled),
+                writer_thread: Mutex::new(None),
             });
         }
 
@@ -160,12 +533,6 @@ impl TranscriptionWriter {
         fs::create_dir_all(&session_dir)
             .map_err(|e| format!("Failed to create session directory: {}", e))?;
 
-        // Create subdirectories
-        if config.save_audio {
-            fs::create_dir_all(session_dir.join("audio"))
-                .map_err(|e| format!("Failed to create audio directory: {}", e))?;
-        }
-
         let session = TranscriptionSession {
             session_id: session_id.clone(),
             started_at: timestamp.to_rfc3339(),
@@ -181,35 +548,92 @@ impl TranscriptionWriter {
         fs::write(&manifest_path, manifest_json)
             .map_err(|e| format!("Failed to write session manifest: {}", e))?;
 
+        let audio = if config.save_audio {
+            let path = session_dir.join(config.audio_format.file_name());
+            Some(AudioSink::create(
+                &path,
+                config.audio_format,
+                config.sample_rate,
+            )?)
+        } else {
+            None
+        };
+        let (recycle, recycled) = mpsc::channel();
+        let files = SessionFiles {
+            audio,
+            transcripts: Some(TranscriptSink::create(
+                &session_dir,
+                config.transcript_format,
+            )?),
+            recycle,
+            fsync_interval: config.fsync_interval,
+            dirty: false,
+        };
+        let (queue, rx) = mpsc::sync_channel(QUEUE_FRAMES);
+        let writer_thread = std::thread::Builder::new()
+            .name("coldvox-persist".to_string())
+            .spawn(move || files.run(rx))
+            .map_err(|e| format!("Failed to start persistence writer: {}", e))?;
+
         Ok(Self {
             config,
             current_session: Arc::new(Mutex::new(session)),
-            current_utterance_audio: Arc::new(Mutex::new(Vec::with_capacity(16000 * 10))), // 10 second buffer
             session_dir,
-            utterance_active: Arc::new(Mutex::new(false)),
-            last_speech_start_ms: Arc::new(Mutex::new(None)),
-            last_speech_duration_ms: Arc::new(Mutex::new(None)),
+            utterance_active: AtomicBool::new(false),
+            samples_queued: AtomicU64::new(0),
+            speaking: Mutex::new(None),
+            ended: Mutex::new(VecDeque::new()),
+            tracer: None,
+            dropped_frames: AtomicU64::new(0),
+            queue: Some(queue),
+            recycled: Mutex::new(recycled),
+            writer_thread: Mutex::new(Some(writer_thread)),
         })
     }
 
-    /// Handle audio frame for potential saving
+    /// Match finals to segments through `tracer`'s utterance bindings. Without
+    /// one, each final takes the oldest waiting segment.
+    pub fn with_tracer(mut self, tracer: Arc<UtteranceTracer>) -> Self {
+        self.tracer = Some(tracer);
+        self
+    }
+
+    /// Handle audio frame for potential saving. Never blocks: if the writer
+    /// thread falls too far behind, the frame is dropped.
     pub fn handle_audio_frame(&self, frame: &AudioFrame) {
         if !self.config.enabled || !self.config.save_audio {
             return;
         }
+        let Some(queue) = &self.queue else {
+            return;
+        };
+        if !self.utterance_active.load(Ordering::Relaxed) {
+            return;
+        }
 
-        let is_active = *self.utterance_active.lock();
-        if is_active {
-            // Convert f32 samples back to i16
-            let i16_samples: Vec<i16> = frame
-                .samples
-                .iter()
-                .map(|&s| (s * i16::MAX as f32) as i16)
-                .collect();
-
-            // Accumulate audio for current utterance
-            let mut audio = self.current_utterance_audio.lock();
-            audio.extend_from_slice(&i16_samples);
+        let mut samples = self
+            .recycled
+            .lock()
+            .try_recv()
+            .unwrap_or_else(|_| Vec::with_capacity(frame.samples.len()));
+        samples.resize(frame.samples.len(), 0);
+        coldvox_audio::convert::f32_to_i16(&frame.samples, &mut samples);
+
+        let len = samples.len() as u64;
+        match queue.try_send(WriterCommand::Audio(samples)) {
+            Ok(()) => {
+                self.samples_queued.fetch_add(len, Ordering::Relaxed);
+            }
+            Err(TrySendError::Full(_)) => {
+                let dropped = self.dropped_frames.fetch_add(1, Ordering::Relaxed) + 1;
+                if dropped.is_power_of_two() {
+                    tracing::warn!(
+                        "Persistence writer is behind; dropped {} audio frames so far",
+                        dropped
+                    );
+                }
+            }
+            Err(TrySendError::Disconnected(_)) => {}
         }
     }
 
@@ -221,19 +645,34 @@ impl TranscriptionWriter {
 
         match event {
             VadEvent::SpeechStart { timestamp_ms, .. } => {
-                *self.utterance_active.lock() = true;
-                *self.last_speech_start_ms.lock() = Some(*timestamp_ms);
-                if self.config.save_audio {
-                    // Clear buffer for new utterance
-                    self.current_utterance_audio.lock().clear();
-                }
+                // Frames may still be in flight, but the offset only counts
+                // queued ones, so segment bounds always match the file
+                *self.speaking.lock() = Some(Segment {
+                    trace: TraceId(*timestamp_ms),
+                    start_ms: *timestamp_ms,
+                    duration_ms: None,
+                    start_sample: self.samples_queued.load(Ordering::Relaxed),
+                    end_sample: None,
+                });
+                self.utterance_active.store(true, Ordering::Relaxed);
             }
             VadEvent::SpeechEnd { duration_ms, .. } => {
-                *self.utterance_active.lock() = false;
-                *self.last_speech_duration_ms.lock() = Some(*duration_ms);
+                self.utterance_active.store(false, Ordering::Relaxed);
+                let Some(mut segment) = self.speaking.lock().take() else {
+                    return;
+                };
+                segment.duration_ms = Some(*duration_ms);
+                segment.end_sample = Some(self.samples_queued.load(Ordering::Relaxed));
+                let mut ended = self.ended.lock();
+                if ended.len() == MAX_ENDED {
+                    ended.pop_front();
+                }
+                ended.push_back((Instant::now(), segment));
             }
+            VadEvent::SpeculativeStart { .. } | VadEvent::SpeculativeCancel { .. } => {}
         }
     }
+
     /// Handle transcription event
     pub async fn handle_transcription(&self, event: &TranscriptionEvent) -> Result<(), String> {
         if !self.config.enabled {
@@ -247,11 +686,9 @@ impl TranscriptionWriter {
                 words,
             } => {
                 // Get timing information from VAD events
-                let (start_ms, duration_ms) = {
-                    let start_lock = self.last_speech_start_ms.lock();
-                    let duration_lock = self.last_speech_duration_ms.lock();
-                    (*start_lock, *duration_lock)
-                };
+                let segment = self.take_segment(*utterance_id);
+                let start_ms = segment.map(|s| s.start_ms);
+                let duration_ms = segment.and_then(|s| s.duration_ms);
 
                 // Calculate actual timestamps using VAD timing relative to session start
                 let (started_at, ended_at) =
@@ -281,37 +718,24 @@ impl TranscriptionWriter {
                         (now.to_rfc3339(), now.to_rfc3339())
                     };
 
-                let audio_path = if self.config.save_audio {
-                    let audio_data = std::mem::take(&mut *self.current_utterance_audio.lock());
-                    if !audio_data.is_empty() {
-                        let filename = format!("utterance_{:06}.wav", utterance_id);
-                        let path = self.session_dir.join("audio").join(&filename);
-
-                        // Use spawn_blocking for WAV writing to avoid blocking the async runtime
-                        let path_clone = path.clone();
-                        let audio_data_move = audio_data;
-                        let sample_rate = self.config.sample_rate;
-                        match tokio::task::spawn_blocking(move || {
-                            Self::save_wav_file(&path_clone, &audio_data_move, sample_rate)
-                        })
-                        .await
-                        {
-                            Ok(Ok(())) => Some(PathBuf::from(format!("audio/{}", filename))),
-                            Ok(Err(e)) => {
-                                tracing::error!("Failed to save audio: {}", e);
-                                None
-                            }
-                            Err(e) => {
-                                tracing::error!("WAV writing task panicked: {}", e);
-                                None
-                            }
+                let (audio_path, audio_offset_samples, audio_len_samples) =
+                    if let Some(segment) = segment.filter(|_| self.config.save_audio) {
+                        let start = segment.start_sample;
+                        let end = segment
+                            .end_sample
+                            .unwrap_or_else(|| self.samples_queued.load(Ordering::Relaxed));
+                        if end > start {
+                            (
+                                Some(PathBuf::from(self.config.audio_format.file_name())),
+                                Some(start),
+                                Some(end - start),
+                            )
+                        } else {
+                            (None, None, None)
                         }
                     } else {
-                        None
-                    }
-                } else {
-                    None
-                };
+                        (None, None, None)
+                    };
 
                 // Create utterance record with actual timing
                 let utterance = UtteranceRecord {
@@ -322,6 +746,8 @@ impl TranscriptionWriter {
                     text: text.clone(),
                     confidence: None,
                     audio_path,
+                    audio_offset_samples,
+                    audio_len_samples,
                     words: words.as_ref().map(|w| {
                         w.iter()
                             .map(|word| WordTiming {
@@ -334,17 +760,14 @@ impl TranscriptionWriter {
                     }),
                 };
 
-                // Add to session
+                // Add to session; the manifest is rewritten once, at finalize
                 {
                     let mut session = self.current_session.lock();
                     session.utterances.push(utterance.clone());
                 }
 
-                // Save individual utterance file
-                self.save_utterance(&utterance).await?;
-
-                // Update session manifest
-                self.update_session_manifest().await?;
+                self.enqueue(WriterCommand::Transcript(Box::new(utterance)))
+                    .await?;
             }
             _ => {
                 // Handle partial results if needed
@@ -354,87 +777,69 @@ impl TranscriptionWriter {
         Ok(())
     }
 
-    /// Save individual utterance based on format
-    async fn save_utterance(&self, utterance: &UtteranceRecord) -> Result<(), String> {
-        let filename = format!("utterance_{:06}", utterance.utterance_id);
-
-        match self.config.transcript_format {
-            TranscriptFormat::Json => {
-                let path = self.session_dir.join(format!("{}.json", filename));
-                let json = serde_json::to_string_pretty(utterance)
-                    .map_err(|e| format!("Failed to serialize utterance: {}", e))?;
-                tokio::fs::write(&path, json)
-                    .await
-                    .map_err(|e| format!("Failed to write utterance file: {}", e))?;
+    /// Segment of the utterance the final with `utterance_id` belongs to:
+    /// an ended one, or the one being spoken (a final forced mid-speech).
+    /// STT finalizes utterances in order, so segments that ended before the
+    /// matched one never get a final and are dropped. Without a tracer the
+    /// oldest waiting segment is taken.
+    fn take_segment(&self, utterance_id: u64) -> Option<Segment> {
+        let mut ended = self.ended.lock();
+        while let Some((at, _)) = ended.front() {
+            if at.elapsed() <= FINAL_WAIT {
+                break;
             }
-            TranscriptFormat::Text => {
-                let path = self.session_dir.join(format!("{}.txt", filename));
-                let content = format!("[{}] {}\n", utterance.started_at, utterance.text);
-                tokio::fs::write(&path, content)
-                    .await
-                    .map_err(|e| format!("Failed to write text file: {}", e))?;
+            ended.pop_front();
+        }
+        let Some(tracer) = &self.tracer else {
+            return match ended.pop_front() {
+                Some((_, segment)) => Some(segment),
+                None => *self.speaking.lock(),
+            };
+        };
+        let Some(trace) = tracer.trace_of(utterance_id) else {
+            tracing::debug!(
+                "Final {} has no traced utterance; no audio segment",
+                utterance_id
+            );
+            return None;
+        };
+        let skipped = match ended.iter().position(|(_, s)| s.trace == trace) {
+            Some(index) => index,
+            None if self.speaking.lock().is_some_and(|s| s.trace == trace) => ended.len(),
+            None => {
+                tracing::debug!("No audio segment left for final {}", utterance_id);
+                return None;
             }
-            TranscriptFormat::Csv => {
-                // Append to CSV file using proper CSV writer
-                let path = self.session_dir.join("transcriptions.csv");
+        };
+        for (_, segment) in ended.drain(..skipped) {
+            tracing::debug!(
+                "Dropping audio segment at {} ms: its utterance produced no final",
+                segment.start_ms
+            );
+        }
+        match ended.pop_front() {
+            Some((_, segment)) => Some(segment),
+            None => *self.speaking.lock(),
+        }
+    }
 
-                // Check if file exists and is empty to determine if we need headers
-                let needs_header = tokio::fs::metadata(&path)
+    /// Queue a command for the writer thread, waiting off the runtime if
+    /// the queue is full.
+    async fn enqueue(&self, command: WriterCommand) -> Result<(), String> {
+        let Some(queue) = &self.queue else {
+            return Ok(());
+        };
+        match queue.try_send(command) {
+            Ok(()) => Ok(()),
+            Err(TrySendError::Full(command)) => {
+                let queue = queue.clone();
+                tokio::task::spawn_blocking(move || queue.send(command))
                     .await
-                    .map(|m| m.len() == 0)
-                    .unwrap_or(true);
-
-                // Use spawn_blocking for CSV writing to avoid blocking
-                let path_clone = path.clone();
-                let utterance_clone = utterance.clone();
-
-                let csv_join = tokio::task::spawn_blocking(move || {
-                    let file = std::fs::OpenOptions::new()
-                        .create(true)
-                        .append(true)
-                        .open(&path_clone)
-                        .map_err(|e| format!("Failed to open CSV file: {}", e))?;
-
-                    let mut wtr = Writer::from_writer(file);
-
-                    // Write header if file is new
-                    if needs_header {
-                        wtr.write_record([
-                            "utterance_id",
-                            "timestamp",
-                            "duration_ms",
-                            "text",
-                            "audio_path",
-                        ])
-                        .map_err(|e| format!("Failed to write CSV header: {}", e))?;
-                    }
-
-                    // Write the record (CSV writer handles proper escaping and quoting)
-                    wtr.write_record(&[
-                        utterance_clone.utterance_id.to_string(),
-                        utterance_clone.started_at,
-                        utterance_clone.duration_ms.to_string(),
-                        utterance_clone.text,
-                        utterance_clone
-                            .audio_path
-                            .as_ref()
-                            .map(|p| p.to_string_lossy().to_string())
-                            .unwrap_or_default(),
-                    ])
-                    .map_err(|e| format!("Failed to write CSV record: {}", e))?;
-
-                    wtr.flush()
-                        .map_err(|e| format!("Failed to flush CSV writer: {}", e))?;
-
-                    Ok::<(), String>(())
-                })
-                .await
-                .map_err(|e| format!("CSV writing task panicked: {}", e))?;
-                csv_join?;
+                    .map_err(|e| format!("Persistence queue task panicked: {}", e))?
+                    .map_err(|_| "Persistence writer stopped".to_string())
             }
+            Err(TrySendError::Disconnected(_)) => Err("Persistence writer stopped".to_string()),
         }
-
-        Ok(())
     }
 
     /// Update the session manifest file
@@ -449,31 +854,6 @@ impl TranscriptionWriter {
         Ok(())
     }
 
-    /// Save audio data as WAV file
-    fn save_wav_file(path: &Path, samples: &[i16], sample_rate: u32) -> Result<(), String> {
-        let spec = WavSpec {
-            channels: 1,
-            sample_rate,
-            bits_per_sample: 16,
-            sample_format: hound::SampleFormat::Int,
-        };
-
-        let mut writer = WavWriter::create(path, spec)
-            .map_err(|e| format!("Failed to create WAV file: {}", e))?;
-
-        for sample in samples {
-            writer
-                .write_sample(*sample)
-                .map_err(|e| format!("Failed to write WAV sample: {}", e))?;
-        }
-
-        writer
-            .finalize()
-            .map_err(|e| format!("Failed to finalize WAV file: {}", e))?;
-
-        Ok(())
-    }
-
     /// Finalize the session
     pub async fn finalize(&self) -> Result<(), String> {
         if !self.config.enabled {
@@ -485,6 +865,20 @@ impl TranscriptionWriter {
             session.ended_at = Some(Local::now().to_rfc3339());
         }
 
+        // Drain the queue and close the session files
+        let writer_thread = self.writer_thread.lock().take();
+        if let Some(handle) = writer_thread {
+            self.enqueue(WriterCommand::Finish).await?;
+            tokio::task::spawn_blocking(move || handle.join())
+                .await
+                .map_err(|e| format!("Persistence join task panicked: {}", e))?
+                .map_err(|_| "Persistence writer panicked".to_string())?;
+        }
+        let dropped = self.dropped_frames.load(Ordering::Relaxed);
+        if dropped > 0 {
+            tracing::warn!("Persistence dropped {} audio frames this session", dropped);
+        }
+
         self.update_session_manifest().await?;
 
         // Create summary file
@@ -594,13 +988,17 @@ impl TranscriptionWriter {
 pub fn spawn_persistence_handler(
     config: PersistenceConfig,
     metadata: SessionMetadata,
+    tracer: Option<Arc<UtteranceTracer>>,
     mut audio_rx: tokio::sync::broadcast::Receiver<AudioFrame>,
     mut vad_rx: tokio::sync::mpsc::Receiver<VadEvent>,
     mut transcript_rx: tokio::sync::mpsc::Receiver<TranscriptionEvent>,
 ) -> tokio::task::JoinHandle<()> {
     tokio::spawn(async move {
         let writer = match TranscriptionWriter::new(config, metadata) {
-            Ok(w) => w,
+            Ok(w) => match tracer {
+                Some(tracer) => w.with_tracer(tracer),
+                None => w,
+            },
             Err(e) => {
                 tracing::error!("Failed to create transcription writer: {}", e);
                 return;
@@ -639,3 +1037,249 @@ pub fn spawn_persistence_handler(
         }
     })
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn metadata() -> SessionMetadata {
+        SessionMetadata {
+            device_name: "test".to_string(),
+            sample_rate: 16000,
+            vad_mode: "silero".to_string(),
+            stt_model: "mock".to_string(),
+            app_version: "0.0.0".to_string(),
+        }
+    }
+
+    fn frame(value: f32, len: usize) -> AudioFrame {
+        AudioFrame {
+            samples: vec![value; len],
+            sample_rate: 16000,
+            timestamp: std::time::Instant::now(),
+        }
+    }
+
+    fn final_event(utterance_id: u64, text: &str) -> TranscriptionEvent {
+        TranscriptionEvent::Final {
+            utterance_id,
+            text: text.to_string(),
+            words: None,
+        }
+    }
+
+    fn session_dir(root: &Path) -> PathBuf {
+        let date_dir = fs::read_dir(root).unwrap().next().unwrap().unwrap().path();
+        fs::read_dir(date_dir)
+            .unwrap()
+            .next()
+            .unwrap()
+            .unwrap()
+            .path()
+    }
+
+    #[tokio::test]
+    async fn appends_session_audio_and_jsonl_log() {
+        let root = tempfile::tempdir().unwrap();
+        let config = PersistenceConfig {
+            enabled: true,
+            output_dir: root.path().to_path_buf(),
+            save_audio: true,
+            audio_format: AudioFormat::Raw,
+            ..Default::default()
+        };
+        let writer = TranscriptionWriter::new(config, metadata()).unwrap();
+
+        for (i, len) in [(1, 512), (2, 256)] {
+            writer.handle_vad_event(&VadEvent::SpeechStart {
+                timestamp_ms: 0,
+                energy_db: -20.0,
+            });
+            writer.handle_audio_frame(&frame(0.5, len));
+            writer.handle_vad_event(&VadEvent::SpeechEnd {
+                timestamp_ms: 100,
+                duration_ms: 100,
+                energy_db: -20.0,
+            });
+            // Outside speech: not persisted
+            writer.handle_audio_frame(&frame(0.5, 1000));
+            writer
+                .handle_transcription(&final_event(i, "hello"))
+                .await
+                .unwrap();
+        }
+        writer.finalize().await.unwrap();
+        writer.finalize().await.unwrap();
+
+        let dir = session_dir(root.path());
+        let pcm = fs::read(dir.join("session.pcm")).unwrap();
+        assert_eq!(pcm.len(), (512 + 256) * 2);
+        assert_eq!(i16::from_le_bytes([pcm[0], pcm[1]]), 16384);
+
+        let log = fs::read_to_string(dir.join("transcripts.jsonl")).unwrap();
+        let records: Vec<UtteranceRecord> = log
+            .lines()
+            .map(|line| serde_json::from_str(line).unwrap())
+            .collect();
+        assert_eq!(records.len(), 2);
+        assert_eq!(records[0].audio_offset_samples, Some(0));
+        assert_eq!(records[0].audio_len_samples, Some(512));
+        assert_eq!(records[1].audio_offset_samples, Some(512));
+        assert_eq!(records[1].audio_len_samples, Some(256));
+        assert_eq!(
+            records[1].audio_path.as_deref(),
+            Some(Path::new("session.pcm"))
+        );
+
+        let manifest: TranscriptionSession =
+            serde_json::from_str(&fs::read_to_string(dir.join("session.json")).unwrap()).unwrap();
+        assert_eq!(manifest.utterances.len(), 2);
+        assert!(manifest.ended_at.is_some());
+        // No per-utterance files
+        assert_eq!(fs::read_dir(&dir).unwrap().count(), 4);
+    }
+
+    #[tokio::test]
+    async fn late_final_keeps_its_own_segment() {
+        let root = tempfile::tempdir().unwrap();
+        let config = PersistenceConfig {
+            enabled: true,
+            output_dir: root.path().to_path_buf(),
+            save_audio: true,
+            audio_format: AudioFormat::Raw,
+            ..Default::default()
+        };
+        let writer = TranscriptionWriter::new(config, metadata()).unwrap();
+
+        writer.handle_vad_event(&VadEvent::SpeechStart {
+            timestamp_ms: 0,
+            energy_db: -20.0,
+        });
+        writer.handle_audio_frame(&frame(0.5, 512));
+        writer.handle_vad_event(&VadEvent::SpeechEnd {
+            timestamp_ms: 100,
+            duration_ms: 100,
+            energy_db: -20.0,
+        });
+        // The next utterance starts before the first one's final arrives
+        writer.handle_vad_event(&VadEvent::SpeechStart {
+            timestamp_ms: 500,
+            energy_db: -20.0,
+        });
+        writer.handle_audio_frame(&frame(0.5, 256));
+        writer
+            .handle_transcription(&final_event(1, "first"))
+            .await
+            .unwrap();
+        writer.handle_vad_event(&VadEvent::SpeechEnd {
+            timestamp_ms: 700,
+            duration_ms: 200,
+            energy_db: -20.0,
+        });
+        writer
+            .handle_transcription(&final_event(2, "second"))
+            .await
+            .unwrap();
+        writer.finalize().await.unwrap();
+
+        let manifest: TranscriptionSession = serde_json::from_str(
+            &fs::read_to_string(session_dir(root.path()).join("session.json")).unwrap(),
+        )
+        .unwrap();
+        let utterances = &manifest.utterances;
+        assert_eq!(utterances.len(), 2);
+        assert_eq!(utterances[0].duration_ms, 100);
+        assert_eq!(utterances[0].audio_offset_samples, Some(0));
+        assert_eq!(utterances[0].audio_len_samples, Some(512));
+        assert_eq!(utterances[1].duration_ms, 200);
+        assert_eq!(utterances[1].audio_offset_samples, Some(512));
+        assert_eq!(utterances[1].audio_len_samples, Some(256));
+    }
+
+    #[tokio::test]
+    async fn utterance_without_final_does_not_shift_segments() {
+        let root = tempfile::tempdir().unwrap();
+        let config = PersistenceConfig {
+            enabled: true,
+            output_dir: root.path().to_path_buf(),
+            save_audio: true,
+            audio_format: AudioFormat::Raw,
+            ..Default::default()
+        };
+        let tracer = Arc::new(UtteranceTracer::new());
+        let writer = TranscriptionWriter::new(config, metadata())
+            .unwrap()
+            .with_tracer(tracer.clone());
+
+        // A cough: speech that STT turns into no final
+        writer.handle_vad_event(&VadEvent::SpeechStart {
+            timestamp_ms: 0,
+            energy_db: -20.0,
+        });
+        writer.handle_audio_frame(&frame(0.5, 512));
+        writer.handle_vad_event(&VadEvent::SpeechEnd {
+            timestamp_ms: 100,
+            duration_ms: 100,
+            energy_db: -20.0,
+        });
+        writer.handle_vad_event(&VadEvent::SpeechStart {
+            timestamp_ms: 500,
+            energy_db: -20.0,
+        });
+        writer.handle_audio_frame(&frame(0.5, 256));
+        writer.handle_vad_event(&VadEvent::SpeechEnd {
+            timestamp_ms: 700,
+            duration_ms: 200,
+            energy_db: -20.0,
+        });
+        tracer.mark(TraceId(500), coldvox_telemetry::TraceStage::SessionStart);
+        tracer.bind(TraceId(500), 2);
+        writer
+            .handle_transcription(&final_event(2, "second"))
+            .await
+            .unwrap();
+        // A final bound to no trace gets no audio rather than a stale segment
+        writer
+            .handle_transcription(&final_event(3, "unbound"))
+            .await
+            .unwrap();
+        writer.finalize().await.unwrap();
+
+        let manifest: TranscriptionSession = serde_json::from_str(
+            &fs::read_to_string(session_dir(root.path()).join("session.json")).unwrap(),
+        )
+        .unwrap();
+        let utterances = &manifest.utterances;
+        assert_eq!(utterances.len(), 2);
+        assert_eq!(utterances[0].duration_ms, 200);
+        assert_eq!(utterances[0].audio_offset_samples, Some(512));
+        assert_eq!(utterances[0].audio_len_samples, Some(256));
+        assert_eq!(utterances[1].audio_offset_samples, None);
+        assert!(writer.ended.lock().is_empty());
+    }
+
+    #[tokio::test]
+    async fn csv_log_has_one_header() {
+        let root = tempfile::tempdir().unwrap();
+        let config = PersistenceConfig {
+            enabled: true,
+            output_dir: root.path().to_path_buf(),
+            transcript_format: TranscriptFormat::Csv,
+            ..Default::default()
+        };
+        let writer = TranscriptionWriter::new(config, metadata()).unwrap();
+        for i in 0..3 {
+            writer
+                .handle_transcription(&final_event(i, "one, two"))
+                .await
+                .unwrap();
+        }
+        writer.finalize().await.unwrap();
+
+        let csv = fs::read_to_string(session_dir(root.path()).join("transcriptions.csv")).unwrap();
+        let lines: Vec<_> = csv.lines().collect();
+        assert_eq!(lines.len(), 4);
+        assert!(lines[0].starts_with("utterance_id,"));
+        assert!(lines[1].contains("\"one, two\""));
+    }
+}
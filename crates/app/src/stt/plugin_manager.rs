@@ -2,44 +2,1111 @@
 //!
 //! This module manages STT plugin selection and fallback logic
 
-use std::collections::HashMap;
+use std::collections::{HashMap, VecDeque};
 use std::path::PathBuf;
 use std::sync::Arc;
 use std::time::{Duration, Instant};
 
-use std::sync::atomic::Ordering;
+use std::sync::atomic::{AtomicBool, AtomicU32, AtomicU64, Ordering};
 
 use coldvox_foundation::error::{ColdVoxError, ConfigError, PluginError, SttError};
-use coldvox_stt::plugin::{PluginSelectionConfig, SttPlugin, SttPluginRegistry};
+use coldvox_stt::plugin::{PluginSelectionConfig, RaceConfig, SttPlugin, SttPluginRegistry};
 #[cfg(feature = "http-remote")]
 use coldvox_stt::plugins::http_remote::{HttpRemoteConfig, HttpRemotePluginFactory};
+use coldvox_stt::types::TranscriptionEvent;
 use coldvox_stt::TranscriptionConfig;
 use coldvox_telemetry::pipeline_metrics::PipelineMetrics;
+use coldvox_telemetry::stt_metrics::SttPerformanceMetrics;
+use coldvox_telemetry::utterance_trace::{TraceId, TraceStage};
 use serde_json;
 use tokio::fs;
-use tokio::sync::RwLock;
+use tokio::sync::{OwnedMutexGuard, RwLock};
 use tokio::task::JoinHandle;
 use tracing::{debug, error, info, trace, warn};
 
+/// The active plugin plus the bookkeeping the audio path updates per frame.
+///
+/// Only the plugin itself sits behind an async lock, and only calls into the
+/// plugin take it. GC and metrics read the cached id and the atomics, so they
+/// never queue behind (or in front of) a frame.
+struct ActivePlugin {
+    /// Shared so a background failover can hold the lock past the frame
+    /// that started it.
+    plugin: Arc<tokio::sync::Mutex<Option<Box<dyn SttPlugin>>>>,
+    /// Id of the plugin in `plugin`, readable without its lock.
+    id: parking_lot::RwLock<Option<Arc<str>>>,
+    /// Milliseconds after `epoch` that the active plugin last received audio.
+    last_used_ms: AtomicU64,
+    consecutive_errors: AtomicU32,
+    /// Last known use per plugin id, for GC. Refreshed when plugins are
+    /// swapped; the active and standby plugins are never collected.
+    activity: parking_lot::Mutex<HashMap<String, Instant>>,
+    epoch: Instant,
+
+    /// Initialized next failover target when hot standby is enabled.
+    standby: tokio::sync::Mutex<Option<Box<dyn SttPlugin>>>,
+    standby_id: parking_lot::RwLock<Option<Arc<str>>>,
+    standby_loading: AtomicBool,
+    /// Audio of the current utterance, replayed to the plugin failed over to.
+    utterance: parking_lot::Mutex<ReplayBuffer>,
+    /// Frames that arrived while a failover runs; `None` when none is running.
+    failover_backlog: parking_lot::Mutex<Option<ReplayBuffer>>,
+    /// Events the replacement produced while catching up, not yet delivered.
+    caught_up: parking_lot::Mutex<VecDeque<TranscriptionEvent>>,
+    /// Last config applied to the active plugin; standbys are initialized with it.
+    config: parking_lot::Mutex<TranscriptionConfig>,
+    config_generation: AtomicU64,
+
+    /// Second engine fed the same audio in race mode.
+    rival: Arc<tokio::sync::Mutex<Option<Box<dyn SttPlugin>>>>,
+    rival_id: parking_lot::RwLock<Option<Arc<str>>>,
+    /// Utterance audio not yet fed to the rival. Whoever holds the rival
+    /// lock drains it, so the rival sees frames in order.
+    rival_backlog: parking_lot::Mutex<ReplayBuffer>,
+    rival_feeding: AtomicBool,
+}
+
+impl ActivePlugin {
+    fn new() -> Self {
+        Self {
+            plugin: Arc::new(tokio::sync::Mutex::new(None)),
+            id: parking_lot::RwLock::new(None),
+            last_used_ms: AtomicU64::new(0),
+            consecutive_errors: AtomicU32::new(0),
+            activity: parking_lot::Mutex::new(HashMap::new()),
+            epoch: Instant::now(),
+            standby: tokio::sync::Mutex::new(None),
+            standby_id: parking_lot::RwLock::new(None),
+            standby_loading: AtomicBool::new(false),
+            utterance: parking_lot::Mutex::new(ReplayBuffer::default()),
+            failover_backlog: parking_lot::Mutex::new(None),
+            caught_up: parking_lot::Mutex::new(VecDeque::new()),
+            config: parking_lot::Mutex::new(TranscriptionConfig::default()),
+            config_generation: AtomicU64::new(0),
+            rival: Arc::new(tokio::sync::Mutex::new(None)),
+            rival_id: parking_lot::RwLock::new(None),
+            rival_backlog: parking_lot::Mutex::new(ReplayBuffer::default()),
+            rival_feeding: AtomicBool::new(false),
+        }
+    }
+
+    fn id(&self) -> Option<Arc<str>> {
+        self.id.read().clone()
+    }
+
+    fn standby_id(&self) -> Option<Arc<str>> {
+        self.standby_id.read().clone()
+    }
+
+    fn rival_id(&self) -> Option<Arc<str>> {
+        self.rival_id.read().clone()
+    }
+
+    /// Whether GC must leave `plugin_id` alone.
+    fn is_pinned(&self, plugin_id: &str) -> bool {
+        [self.id(), self.standby_id(), self.rival_id()]
+            .iter()
+            .any(|id| id.as_deref() == Some(plugin_id))
+    }
+
+    /// Remove the standby from its locked slot.
+    fn take_standby(&self, slot: &mut Option<Box<dyn SttPlugin>>) -> Option<Box<dyn SttPlugin>> {
+        *self.standby_id.write() = None;
+        slot.take()
+    }
+
+    /// Remove the race rival from its locked slot.
+    fn take_rival(&self, slot: &mut Option<Box<dyn SttPlugin>>) -> Option<Box<dyn SttPlugin>> {
+        *self.rival_id.write() = None;
+        slot.take()
+    }
+
+    fn touch(&self) {
+        let ms = self.epoch.elapsed().as_millis() as u64;
+        self.last_used_ms.store(ms, Ordering::Relaxed);
+    }
+
+    fn last_used(&self) -> Instant {
+        self.epoch + Duration::from_millis(self.last_used_ms.load(Ordering::Relaxed))
+    }
+
+    /// Replace the plugin in the locked `slot`, moving the outgoing plugin's
+    /// last use into the activity map and clearing the error streak.
+    fn install(&self, slot: &mut Option<Box<dyn SttPlugin>>, plugin: Option<Box<dyn SttPlugin>>) {
+        let new_id: Option<Arc<str>> = plugin.as_ref().map(|p| p.info().id.into());
+        {
+            let mut activity = self.activity.lock();
+            if let Some(old_id) = self.id() {
+                activity.insert(old_id.to_string(), self.last_used());
+            }
+            if let Some(ref id) = new_id {
+                activity.insert(id.to_string(), Instant::now());
+            }
+        }
+        *self.id.write() = new_id;
+        self.touch();
+        self.consecutive_errors.store(0, Ordering::Relaxed);
+        *slot = plugin;
+    }
+}
+
+type PluginGuard = OwnedMutexGuard<Option<Box<dyn SttPlugin>>>;
+
+/// Utterance audio kept for replay after failover, up to the same 30 s the
+/// batch buffer allows. Longer utterances are not replayed.
+#[derive(Default)]
+struct ReplayBuffer {
+    samples: Vec<i16>,
+    overflowed: bool,
+}
+
+impl ReplayBuffer {
+    const MAX_SAMPLES: usize = 16_000 * 30;
+
+    fn push(&mut self, samples: &[i16]) {
+        if self.overflowed {
+            return;
+        }
+        if self.samples.len() + samples.len() > Self::MAX_SAMPLES {
+            self.samples = Vec::new();
+            self.overflowed = true;
+            return;
+        }
+        self.samples.extend_from_slice(samples);
+    }
+
+    fn clear(&mut self) {
+        self.samples.clear();
+        self.overflowed = false;
+    }
+}
+
+/// Queue an event for delivery, letting a newer partial replace one that
+/// was never delivered.
+fn queue_caught_up(queue: &mut VecDeque<TranscriptionEvent>, event: TranscriptionEvent) {
+    if matches!(event, TranscriptionEvent::Partial { .. })
+        && matches!(queue.back(), Some(TranscriptionEvent::Partial { .. }))
+    {
+        queue.pop_back();
+    }
+    queue.push_back(event);
+}
+
+type FinalizeResult = Result<Option<TranscriptionEvent>, ColdVoxError>;
+
+/// How a finalize result ranks in a race.
+#[derive(Debug, Clone, Copy, PartialEq)]
+enum RaceScore {
+    /// An error, no final, or a final without text.
+    NoAnswer,
+    /// A final from an engine that does not report confidence
+    /// (`confidence_scores: false`); its word confidences are placeholders.
+    Unscored,
+    /// Mean word confidence of a final from an engine that reports it.
+    Scored(f32),
+}
+
+impl RaceScore {
+    fn of(result: &FinalizeResult, reports_confidence: bool) -> Self {
+        let Ok(Some(TranscriptionEvent::Final { text, words, .. })) = result else {
+            return Self::NoAnswer;
+        };
+        if text.trim().is_empty() {
+            return Self::NoAnswer;
+        }
+        match words.as_deref() {
+            Some(words) if reports_confidence && !words.is_empty() => {
+                Self::Scored(words.iter().map(|word| word.conf).sum::<f32>() / words.len() as f32)
+            }
+            _ => Self::Unscored,
+        }
+    }
+
+    /// Whether this answer ends the race without waiting for the other
+    /// engine. Without a confidence to check, any answer does.
+    fn wins_outright(self, min_confidence: f32) -> bool {
+        match self {
+            Self::NoAnswer => false,
+            Self::Unscored => true,
+            Self::Scored(score) => score >= min_confidence,
+        }
+    }
+
+    /// Whether this answer beats `other`; ties go to `other`.
+    fn beats(self, other: Self) -> bool {
+        match (self, other) {
+            (Self::Scored(a), Self::Scored(b)) => a > b,
+            (Self::NoAnswer, _) => false,
+            (_, Self::NoAnswer) => true,
+            _ => false,
+        }
+    }
+}
+
+/// Finalize the plugin in `slot` on its own task, so a race can stop waiting
+/// for it without cancelling the call mid-flight. A result nobody receives
+/// lost the race; the engine is then reset like a cancelled utterance. The
+/// slot stays locked until that is done.
+fn spawn_race_finalize(mut slot: PluginGuard) -> tokio::sync::oneshot::Receiver<FinalizeResult> {
+    let (tx, rx) = tokio::sync::oneshot::channel();
+    tokio::spawn(async move {
+        let Some(plugin) = slot.as_mut() else {
+            return;
+        };
+        let result = plugin.finalize().await;
+        if tx.send(result).is_err() {
+            if let Err(e) = plugin.reset().await {
+                debug!(target: "coldvox::stt", plugin_id = %plugin.info().id, error = %e, "Failed to cancel race loser");
+            }
+        }
+    });
+    rx
+}
+
+/// Failover and race settings snapshotted from [`PluginSelectionConfig`] so
+/// the audio path can act on them without the manager.
+#[derive(Debug, Clone)]
+struct FailoverPolicy {
+    threshold: u32,
+    cooldown: Duration,
+    fallback_plugins: Vec<String>,
+    hot_standby: bool,
+    /// Budget for active plus standby, from `max_memory_mb`.
+    memory_budget_mb: Option<u32>,
+    race: Option<RaceConfig>,
+}
+
+impl FailoverPolicy {
+    fn from_config(config: &PluginSelectionConfig) -> Self {
+        Self {
+            threshold: config.failover.as_ref().map_or(3, |f| f.failover_threshold),
+            cooldown: Duration::from_secs(
+                config
+                    .failover
+                    .as_ref()
+                    .map_or(30, |f| f.failover_cooldown_secs) as u64,
+            ),
+            fallback_plugins: config.fallback_plugins.clone(),
+            hot_standby: config.failover.as_ref().is_some_and(|f| f.hot_standby),
+            memory_budget_mb: config.max_memory_mb,
+            race: config.race.clone(),
+        }
+    }
+}
+
+/// The per-frame path into the active plugin.
+///
+/// Cloned out of the manager once (see [`SttPluginManager::audio_path`]) and
+/// then used without the manager's lock, so frame delivery never waits on GC,
+/// metrics, config saves or plugin listing. Failover runs in the background:
+/// the frame that trips the threshold hands the plugin lock to a failover task
+/// and later frames are backlogged until the replacement has been fed the
+/// missed audio, so frame delivery never waits on a plugin load either. With
+/// hot standby the replacement is already loaded and is fed the whole
+/// utterance so far instead of just the failed frame.
+///
+/// In race mode a second plugin gets every frame too, fed from its own task so
+/// a slow rival never delays the active plugin, and [`finalize`] returns
+/// whichever answers first with enough confidence. Only the active plugin's
+/// partials are delivered.
+///
+/// [`finalize`]: SttAudioPath::finalize
+#[derive(Clone)]
+pub struct SttAudioPath {
+    active: Arc<ActivePlugin>,
+    registry: Arc<RwLock<SttPluginRegistry>>,
+    policy: Arc<parking_lot::RwLock<FailoverPolicy>>,
+    failed_plugins_cooldown: Arc<parking_lot::Mutex<HashMap<String, Instant>>>,
+    last_failover: Arc<parking_lot::Mutex<Option<Instant>>>,
+    failover_count: Arc<AtomicU64>,
+    total_errors: Arc<AtomicU64>,
+    metrics_sink: Option<Arc<PipelineMetrics>>,
+    stt_metrics: SttPerformanceMetrics,
+    start_instant: Instant,
+}
+
+impl SttAudioPath {
+    /// Id of the active plugin, without waiting on it.
+    pub fn current_plugin(&self) -> Option<String> {
+        self.active.id().map(|id| id.to_string())
+    }
+
+    /// Record how long a session boundary announced at `at` took to reach
+    /// the STT processor.
+    pub fn record_session_handoff(&self, at: Instant) {
+        if let Some(ref metrics) = self.metrics_sink {
+            metrics.record_vad_to_stt_handoff(at.elapsed());
+        }
+    }
+
+    /// Add `stage` to utterance `trace`'s timeline, if metrics are attached.
+    pub fn mark_trace(&self, trace: TraceId, stage: TraceStage) {
+        if let Some(ref metrics) = self.metrics_sink {
+            metrics.utterance_trace.mark(trace, stage);
+        }
+    }
+
+    /// Report utterance `trace` as dropped, if metrics are attached.
+    pub fn abandon_trace(&self, trace: TraceId) {
+        if let Some(ref metrics) = self.metrics_sink {
+            metrics.utterance_trace.abandon(trace);
+        }
+    }
+
+    /// Process audio with the current plugin, handling failover on errors
+    pub async fn process_audio(
+        &self,
+        samples: &[i16],
+    ) -> Result<Option<TranscriptionEvent>, String> {
+        if let Some(ref metrics) = self.metrics_sink {
+            metrics
+                .stt_transcription_requests
+                .fetch_add(1, Ordering::Relaxed);
+        }
+
+        if let Some(ref mut backlog) = *self.active.failover_backlog.lock() {
+            backlog.push(samples);
+            return Ok(None);
+        }
+
+        let mut current = Arc::clone(&self.active.plugin).lock_owned().await;
+        let Some(ref mut plugin) = *current else {
+            return Err("No STT plugin selected".to_string());
+        };
+        let plugin_id = plugin.info().id;
+        tracing::trace!(target: "stt_debug", plugin_id = %plugin_id, sample_count = samples.len(), "plugin_manager.process_audio() called");
+
+        // Update last activity for GC
+        self.active.touch();
+        let hot_standby = self.policy.read().hot_standby;
+        if hot_standby {
+            self.active.utterance.lock().push(samples);
+        }
+
+        self.feed_rival(samples);
+        let started = Instant::now();
+        let result = plugin.process_audio(samples).await;
+        if let Some(ref metrics) = self.metrics_sink {
+            metrics.record_stt_engine_processing(started.elapsed());
+        }
+        let e = match result {
+            Ok(result) => {
+                tracing::trace!(target: "stt_debug", plugin_id = %plugin_id, has_event = %result.is_some(), "plugin_manager.process_audio() ok");
+                // Reset error count on success
+                self.active.consecutive_errors.store(0, Ordering::Relaxed);
+                if let Some(ref metrics) = self.metrics_sink {
+                    metrics
+                        .stt_transcription_success
+                        .fetch_add(1, Ordering::Relaxed);
+                }
+                return Ok(self.with_caught_up(result));
+            }
+            Err(e) => e,
+        };
+
+        tracing::warn!(target: "stt_debug", plugin_id = %plugin_id, error = %e, "plugin_manager.process_audio() error");
+        // Track error and potentially trigger failover
+        self.total_errors.fetch_add(1, Ordering::Relaxed);
+        if let Some(ref sink) = self.metrics_sink {
+            sink.stt_total_errors.fetch_add(1, Ordering::Relaxed);
+            sink.stt_transcription_failures
+                .fetch_add(1, Ordering::Relaxed);
+        }
+
+        let errors_consecutive = self
+            .active
+            .consecutive_errors
+            .fetch_add(1, Ordering::Relaxed)
+            + 1;
+        let policy = self.policy.read().clone();
+        if errors_consecutive < policy.threshold {
+            return Err(e.to_string());
+        }
+
+        warn!(
+            target: "coldvox::stt",
+            plugin_id = %plugin_id,
+            event = "failover_attempt",
+            errors_consecutive = errors_consecutive,
+            error = %e,
+            "Plugin exceeded error threshold, failing over in the background"
+        );
+
+        // Later frames wait in the backlog instead of on the plugin lock,
+        // which the failover keeps until the replacement has caught up
+        *self.active.failover_backlog.lock() = Some(ReplayBuffer::default());
+        let path = self.clone();
+        let failed_frame = samples.to_vec();
+        tokio::spawn(async move {
+            path.run_failover(current, plugin_id, policy, failed_frame)
+                .await;
+        });
+        Ok(None)
+    }
+
+    /// Replace the failed plugin and catch the replacement up on the audio it
+    /// missed: the utterance so far with hot standby (otherwise the frame that
+    /// tripped the threshold), then the frames backlogged during the switch.
+    async fn run_failover(
+        &self,
+        mut current: PluginGuard,
+        failed_plugin_id: String,
+        policy: FailoverPolicy,
+        failed_frame: Vec<i16>,
+    ) {
+        let new_plugin_id = match self
+            .attempt_failover(&mut current, &failed_plugin_id, &policy)
+            .await
+        {
+            Ok(new_plugin_id) => new_plugin_id,
+            Err(failover_err) => {
+                error!("Failover failed: {}", failover_err);
+                // The failing plugin stays; what arrived meanwhile is lost
+                *self.active.failover_backlog.lock() = None;
+                return;
+            }
+        };
+        info!(
+            target: "coldvox::stt",
+            plugin_id = %failed_plugin_id,
+            event = "failover_success",
+            new_plugin_id = %new_plugin_id,
+            "Successfully failed over to new plugin"
+        );
+        self.failover_count.fetch_add(1, Ordering::Relaxed);
+        let failed_at = Instant::now();
+        *self.last_failover.lock() = Some(failed_at);
+        if let Some(ref sink) = self.metrics_sink {
+            sink.stt_failover_count.fetch_add(1, Ordering::Relaxed);
+            let secs = failed_at.duration_since(self.start_instant).as_secs();
+            sink.stt_last_failover_secs.store(secs, Ordering::Relaxed);
+        }
+
+        // Record cooldown for failed plugin
+        self.failed_plugins_cooldown
+            .lock()
+            .insert(failed_plugin_id, failed_at);
+
+        self.refill_standby();
+        self.drop_rival_if_active().await;
+
+        let Some(ref mut new_plugin) = *current else {
+            *self.active.failover_backlog.lock() = None;
+            return;
+        };
+        let replay = {
+            let mut utterance = self.active.utterance.lock();
+            (policy.hot_standby && !utterance.overflowed)
+                .then(|| std::mem::take(&mut utterance.samples))
+        };
+        match replay {
+            Some(audio) => {
+                tracing::debug!(target: "stt_debug", plugin_id = %new_plugin_id, samples = audio.len(), "plugin_manager failover replaying utterance on new plugin");
+                self.catch_up(new_plugin, &audio).await;
+                // Keep it for a further failover within this utterance
+                let mut utterance = self.active.utterance.lock();
+                if utterance.samples.is_empty() && !utterance.overflowed {
+                    utterance.samples = audio;
+                }
+            }
+            None => {
+                tracing::debug!(target: "stt_debug", plugin_id = %new_plugin_id, "plugin_manager failover retrying frame on new plugin");
+                self.catch_up(new_plugin, &failed_frame).await;
+            }
+        }
+
+        // Drain the backlog; frames only go back to the plugin lock once it
+        // is empty, so the replacement sees the audio in order
+        loop {
+            let chunk = {
+                let mut backlog = self.active.failover_backlog.lock();
+                let Some(ref mut buffer) = *backlog else {
+                    break;
+                };
+                if buffer.samples.is_empty() {
+                    if buffer.overflowed {
+                        warn!(target: "coldvox::stt", plugin_id = %new_plugin_id, "Failover backlog overflowed, audio was dropped");
+                    }
+                    *backlog = None;
+                    break;
+                }
+                std::mem::take(&mut buffer.samples)
+            };
+            if policy.hot_standby {
+                self.active.utterance.lock().push(&chunk);
+            }
+            self.feed_rival(&chunk);
+            self.catch_up(new_plugin, &chunk).await;
+        }
+    }
+
+    /// Feed missed audio to a replacement plugin, keeping its events for the
+    /// frames that follow.
+    async fn catch_up(&self, plugin: &mut Box<dyn SttPlugin>, samples: &[i16]) {
+        match plugin.process_audio(samples).await {
+            Ok(Some(event)) => queue_caught_up(&mut self.active.caught_up.lock(), event),
+            Ok(None) => {}
+            Err(e) => {
+                warn!(target: "coldvox::stt", plugin_id = %plugin.info().id, error = %e, "Replacement plugin failed to catch up");
+                self.total_errors.fetch_add(1, Ordering::Relaxed);
+                self.active
+                    .consecutive_errors
+                    .fetch_add(1, Ordering::Relaxed);
+            }
+        }
+    }
+
+    /// Hand out events produced while catching up ahead of `result`.
+    fn with_caught_up(&self, result: Option<TranscriptionEvent>) -> Option<TranscriptionEvent> {
+        let mut queued = self.active.caught_up.lock();
+        if queued.is_empty() {
+            return result;
+        }
+        if let Some(event) = result {
+            queue_caught_up(&mut queued, event);
+        }
+        queued.pop_front()
+    }
+
+    /// Drop queued catch-up events, returning the last final among them.
+    fn take_caught_up_final(&self) -> Option<TranscriptionEvent> {
+        let mut queued = self.active.caught_up.lock();
+        queued
+            .drain(..)
+            .filter(|event| matches!(event, TranscriptionEvent::Final { .. }))
+            .last()
+    }
+
+    /// Queue a frame for the race rival, if any, and make sure a task is
+    /// feeding it. The rival never holds up the active plugin's frames; its
+    /// events and errors stay internal.
+    fn feed_rival(&self, samples: &[i16]) {
+        if self.active.rival_id().is_none() {
+            return;
+        }
+        self.active.rival_backlog.lock().push(samples);
+        if self.active.rival_feeding.swap(true, Ordering::AcqRel) {
+            return;
+        }
+        let path = self.clone();
+        tokio::spawn(async move {
+            loop {
+                {
+                    let mut rival = path.active.rival.lock().await;
+                    path.drain_rival_backlog(&mut rival).await;
+                }
+                path.active.rival_feeding.store(false, Ordering::Release);
+                // A frame queued after the drain but before the flag cleared
+                if path.active.rival_backlog.lock().samples.is_empty()
+                    || path.active.rival_feeding.swap(true, Ordering::AcqRel)
+                {
+                    break;
+                }
+            }
+        });
+    }
+
+    /// Feed the rival in the locked `slot` everything queued for it.
+    async fn drain_rival_backlog(&self, slot: &mut Option<Box<dyn SttPlugin>>) {
+        let Some(ref mut rival) = *slot else {
+            return;
+        };
+        loop {
+            let chunk = std::mem::take(&mut self.active.rival_backlog.lock().samples);
+            if chunk.is_empty() {
+                return;
+            }
+            if let Err(e) = rival.process_audio(&chunk).await {
+                debug!(target: "coldvox::stt", plugin_id = %rival.info().id, error = %e, "Race rival failed to process audio");
+            }
+        }
+    }
+
+    /// Leave race mode if the rival has become the active plugin, which a
+    /// failover or plugin switch can do.
+    async fn drop_rival_if_active(&self) {
+        let Some(rival_id) = self.active.rival_id() else {
+            return;
+        };
+        if self.active.id().as_deref() != Some(&*rival_id) {
+            return;
+        }
+        let rival = {
+            let mut slot = self.active.rival.lock().await;
+            self.active.rival_backlog.lock().clear();
+            self.active.take_rival(&mut slot)
+        };
+        warn!(
+            target: "coldvox::stt",
+            plugin_id = %rival_id,
+            "Race plugin became the active plugin; race mode disabled"
+        );
+        if let Some(mut rival) = rival {
+            if let Err(e) = rival.unload().await {
+                debug!("Failed to unload race rival plugin: {:?}", e);
+            }
+        }
+    }
+
+    /// Replace the failed plugin in `slot` with the first fallback that is not
+    /// cooling down.
+    async fn attempt_failover(
+        &self,
+        slot: &mut Option<Box<dyn SttPlugin>>,
+        failed_plugin_id: &str,
+        policy: &FailoverPolicy,
+    ) -> Result<String, String> {
+        // A warm standby takes over without loading anything
+        let standby = {
+            let mut standby_slot = self.active.standby.lock().await;
+            self.active.take_standby(&mut standby_slot)
+        };
+        if let Some(standby) = standby {
+            let standby_id = standby.info().id;
+            if standby_id != failed_plugin_id && !self.in_cooldown(&standby_id, policy) {
+                info!(
+                    target: "coldvox::stt",
+                    plugin_id = %standby_id,
+                    event = "failover_standby",
+                    "Promoting hot standby plugin"
+                );
+                // Replacing the plugin also resets the error streak
+                self.active.install(slot, Some(standby));
+                return Ok(standby_id);
+            }
+        }
+
+        let registry = self.registry.read().await;
+
+        // Try fallback plugins in order, skipping ones in cooldown
+        for fallback_id in &policy.fallback_plugins {
+            if fallback_id == failed_plugin_id {
+                continue; // Skip the failed plugin
+            }
+
+            // Check if plugin is in cooldown
+            if self.in_cooldown(fallback_id, policy) {
+                debug!("Plugin {} still in cooldown, skipping", fallback_id);
+                continue;
+            }
+
+            match registry.create_plugin(fallback_id) {
+                Ok(mut new_plugin) => {
+                    let new_plugin_id = new_plugin.info().id;
+                    // Bring it up with the processor's config, if one was applied
+                    if self.active.config_generation.load(Ordering::Acquire) > 0 {
+                        let config = self.active.config.lock().clone();
+                        if let Err(e) = new_plugin.initialize(config).await {
+                            debug!(
+                                "Fallback plugin {} failed to initialize: {}",
+                                fallback_id, e
+                            );
+                            continue;
+                        }
+                    }
+                    // Replacing the plugin also resets the error streak
+                    self.active.install(slot, Some(new_plugin));
+                    return Ok(new_plugin_id);
+                }
+                Err(e) => {
+                    debug!("Fallback plugin {} not available: {}", fallback_id, e);
+                }
+            }
+        }
+
+        // No last-resort fallback: fail explicitly so callers/tests never silently use NoOp
+        Err("No available STT plugins for failover".to_string())
+    }
+
+    fn in_cooldown(&self, plugin_id: &str, policy: &FailoverPolicy) -> bool {
+        self.failed_plugins_cooldown
+            .lock()
+            .get(plugin_id)
+            .is_some_and(|failed_at| failed_at.elapsed() < policy.cooldown)
+    }
+
+    /// Start loading the next failover target in the background, if hot
+    /// standby is enabled and no standby is loaded or loading.
+    pub fn refill_standby(&self) {
+        if !self.policy.read().hot_standby || self.active.standby_id().is_some() {
+            return;
+        }
+        if self.active.standby_loading.swap(true, Ordering::AcqRel) {
+            return;
+        }
+        let path = self.clone();
+        tokio::spawn(async move {
+            path.load_standby().await;
+            path.active.standby_loading.store(false, Ordering::Release);
+        });
+    }
+
+    async fn load_standby(&self) {
+        let policy = self.policy.read().clone();
+        let Some(mut plugin) = self.create_standby(&policy).await else {
+            return;
+        };
+        let plugin_id = plugin.info().id;
+        let load_start = Instant::now();
+
+        // Re-initialize if the processor applied a new config meanwhile
+        loop {
+            let generation = self.active.config_generation.load(Ordering::Acquire);
+            let config = self.active.config.lock().clone();
+            if let Err(e) = plugin.initialize(config).await {
+                warn!(
+                    target: "coldvox::stt",
+                    plugin_id = %plugin_id,
+                    event = "standby_load_failed",
+                    error = %e,
+                    "Failed to load hot standby plugin"
+                );
+                if let Some(ref metrics) = self.metrics_sink {
+                    metrics.stt_load_errors.fetch_add(1, Ordering::Relaxed);
+                }
+                return;
+            }
+            if generation == self.active.config_generation.load(Ordering::Acquire) {
+                break;
+            }
+        }
+
+        // The active plugin may have changed while this one was loading
+        if self.active.id().as_deref() == Some(plugin_id.as_str()) {
+            return;
+        }
+        let mut standby = self.active.standby.lock().await;
+        *standby = Some(plugin);
+        *self.active.standby_id.write() = Some(plugin_id.as_str().into());
+        self.active
+            .activity
+            .lock()
+            .insert(plugin_id.clone(), Instant::now());
+        if let Some(ref metrics) = self.metrics_sink {
+            metrics.stt_load_count.fetch_add(1, Ordering::Relaxed);
+        }
+        info!(
+            target: "coldvox::stt",
+            plugin_id = %plugin_id,
+            event = "standby_ready",
+            load_duration_ms = load_start.elapsed().as_millis() as u64,
+            "Hot standby plugin loaded"
+        );
+    }
+
+    /// First fallback that is not active, not cooling down, and fits the
+    /// memory budget next to the active plugin.
+    async fn create_standby(&self, policy: &FailoverPolicy) -> Option<Box<dyn SttPlugin>> {
+        let registry = self.registry.read().await;
+        let active_id = self.active.id();
+        let infos = registry.available_plugins();
+        let memory_mb = |id: &str| {
+            infos
+                .iter()
+                .find(|info| info.id == id)
+                .and_then(|info| info.memory_usage_mb)
+                .unwrap_or(0)
+        };
+        let active_mb = active_id.as_deref().map_or(0, memory_mb);
+
+        for fallback_id in &policy.fallback_plugins {
+            if active_id.as_deref() == Some(fallback_id.as_str())
+                || self.in_cooldown(fallback_id, policy)
+            {
+                continue;
+            }
+            if let Some(budget) = policy.memory_budget_mb {
+                let needed = active_mb + memory_mb(fallback_id);
+                if needed > budget {
+                    debug!(
+                        target: "coldvox::stt",
+                        plugin_id = %fallback_id,
+                        needed_mb = needed,
+                        budget_mb = budget,
+                        "Hot standby candidate exceeds memory budget"
+                    );
+                    continue;
+                }
+            }
+            match registry.create_plugin(fallback_id) {
+                Ok(plugin) => return Some(plugin),
+                Err(e) => debug!("Standby plugin {} not available: {}", fallback_id, e),
+            }
+        }
+        None
+    }
+
+    /// Finalize current utterance with the current plugin, racing it against
+    /// the rival in race mode
+    pub async fn finalize(&self) -> Result<Option<TranscriptionEvent>, String> {
+        self.finalize_traced(None).await
+    }
+
+    /// [`finalize`](Self::finalize), recording it on utterance `trace`'s
+    /// timeline and binding the final's `utterance_id` to it.
+    pub async fn finalize_traced(
+        &self,
+        trace: Option<TraceId>,
+    ) -> Result<Option<TranscriptionEvent>, String> {
+        let mut current = self.active.plugin.clone().lock_owned().await;
+        self.active.utterance.lock().clear();
+        let caught_up = self.take_caught_up_final();
+        if let Some(ref mut plugin) = *current {
+            tracing::debug!(target: "stt_debug", plugin_id = %plugin.info().id, "plugin_manager.finalize() called");
+            let started = Instant::now();
+            if let Some(trace) = trace {
+                self.mark_trace(trace, TraceStage::FinalizeStart);
+            }
+            let result = if self.active.rival_id().is_some() {
+                let mut rival = self.active.rival.clone().lock_owned().await;
+                self.drain_rival_backlog(&mut rival).await;
+                // A rival that fell too far behind missed audio; don't race it
+                let complete = !std::mem::take(&mut *self.active.rival_backlog.lock()).overflowed;
+                if complete && rival.is_some() {
+                    self.race_finalize(current, rival).await
+                } else {
+                    if let Some(ref mut rival) = *rival {
+                        if let Err(e) = rival.reset().await {
+                            debug!(target: "coldvox::stt", plugin_id = %rival.info().id, error = %e, "Failed to reset race rival");
+                        }
+                    }
+                    plugin.finalize().await
+                }
+            } else {
+                plugin.finalize().await
+            };
+            let result = match result {
+                Ok(None) => Ok(caught_up),
+                result => result,
+            };
+            if let Some(ref metrics) = self.metrics_sink {
+                metrics.record_stt_engine_processing(started.elapsed());
+            }
+            if let (Some(metrics), Some(trace)) = (&self.metrics_sink, trace) {
+                let tracer = &metrics.utterance_trace;
+                tracer.mark(trace, TraceStage::FinalizeEnd);
+                match result {
+                    Ok(Some(TranscriptionEvent::Final {
+                        utterance_id,
+                        ref text,
+                        ..
+                    })) if !text.trim().is_empty() => tracer.bind(trace, utterance_id),
+                    // Nothing will reach the injector for this utterance
+                    _ => tracer.abandon(trace),
+                }
+            }
+            match result {
+                Ok(result) => Ok(result),
+                Err(e) => {
+                    self.total_errors.fetch_add(1, Ordering::Relaxed);
+                    Err(e.to_string())
+                }
+            }
+        } else {
+            Ok(None)
+        }
+    }
+
+    /// Finalize both engines at once, each on its own task. The first answer
+    /// that wins outright (see [`RaceScore::wins_outright`]) is returned and
+    /// the other engine finishes and resets in the background; otherwise both
+    /// are awaited and the better result is kept, the active plugin's on a tie.
+    async fn race_finalize(&self, primary: PluginGuard, rival: PluginGuard) -> FinalizeResult {
+        let min_confidence = self
+            .policy
+            .read()
+            .race
+            .as_ref()
+            .map_or(0.0, |race| race.min_confidence);
+        let engine = |slot: &PluginGuard| {
+            slot.as_ref().map_or((String::new(), false), |plugin| {
+                (plugin.info().id, plugin.capabilities().confidence_scores)
+            })
+        };
+        let (primary_id, primary_scored) = engine(&primary);
+        let (rival_id, rival_scored) = engine(&rival);
+        let started = Instant::now();
+
+        let received = |result: Result<FinalizeResult, _>| result.unwrap_or(Ok(None));
+        let mut primary_finalize = spawn_race_finalize(primary);
+        let mut rival_finalize = spawn_race_finalize(rival);
+        let (first, primary_first) = tokio::select! {
+            biased;
+            result = &mut primary_finalize => (received(result), true),
+            result = &mut rival_finalize => (received(result), false),
+        };
+        let first_latency = started.elapsed();
+        let (first_id, second_id, first_scored, second_scored) = if primary_first {
+            (&primary_id, &rival_id, primary_scored, rival_scored)
+        } else {
+            (&rival_id, &primary_id, rival_scored, primary_scored)
+        };
+        let first_score = RaceScore::of(&first, first_scored);
+
+        if first_score.wins_outright(min_confidence) {
+            // Dropping the receiver tells the loser's task to reset it
+            self.record_race(first_id, first_latency, second_id, None);
+            return first;
+        }
+
+        let second = if primary_first {
+            received(rival_finalize.await)
+        } else {
+            received(primary_finalize.await)
+        };
+        let second_latency = started.elapsed();
+        let second_score = RaceScore::of(&second, second_scored);
+
+        // Neither answered: keep the active plugin's result unless it failed
+        let second_wins =
+            if first_score == RaceScore::NoAnswer && second_score == RaceScore::NoAnswer {
+                let primary_failed = if primary_first { &first } else { &second }.is_err();
+                let rival_failed = if primary_first { &second } else { &first }.is_err();
+                (primary_failed && !rival_failed) == primary_first
+            } else if primary_first {
+                second_score.beats(first_score)
+            } else {
+                !first_score.beats(second_score)
+            };
+        if second_wins {
+            self.record_race(second_id, second_latency, first_id, Some(first_latency));
+            second
+        } else {
+            self.record_race(first_id, first_latency, second_id, Some(second_latency));
+            first
+        }
+    }
+
+    fn record_race(
+        &self,
+        winner: &str,
+        winner_latency: Duration,
+        loser: &str,
+        loser_latency: Option<Duration>,
+    ) {
+        debug!(
+            target: "coldvox::stt",
+            winner = %winner,
+            loser = %loser,
+            winner_latency_ms = winner_latency.as_millis() as u64,
+            loser_cancelled = loser_latency.is_none(),
+            "STT race decided"
+        );
+        self.stt_metrics
+            .record_race(winner, winner_latency, loser, loser_latency);
+    }
+
+    /// Prepares the plugin for a new utterance: resets it, then lets it warm
+    /// up (e.g. open a connection) while the user is still speaking.
+    pub async fn begin_utterance(&self) -> Result<(), String> {
+        let mut current = self.active.plugin.lock().await;
+        self.active.utterance.lock().clear();
+        self.active.caught_up.lock().clear();
+        if let Some(ref mut plugin) = *current {
+            plugin.reset().await.map_err(|e| e.to_string())?;
+            let mut rival = self.active.rival.lock().await;
+            self.active.rival_backlog.lock().clear();
+            if let Some(ref mut rival) = *rival {
+                let ready = match rival.reset().await {
+                    Ok(()) => rival.warm_up().await,
+                    Err(e) => Err(e),
+                };
+                if let Err(e) = ready {
+                    debug!(target: "coldvox::stt", plugin_id = %rival.info().id, error = %e, "Race rival failed to begin utterance");
+                }
+            }
+            drop(rival);
+            plugin.warm_up().await.map_err(|e| e.to_string())
+        } else {
+            Ok(())
+        }
+    }
+
+    /// Cancels the current utterance, functionally equivalent to reset.
+    pub async fn cancel_utterance(&self) -> Result<(), String> {
+        self.reset().await
+    }
+
+    /// Reset current plugin state for a new utterance
+    pub async fn reset(&self) -> Result<(), String> {
+        let mut current = self.active.plugin.lock().await;
+        self.active.utterance.lock().clear();
+        self.active.caught_up.lock().clear();
+        if let Some(ref mut plugin) = *current {
+            let mut rival = self.active.rival.lock().await;
+            self.active.rival_backlog.lock().clear();
+            if let Some(ref mut rival) = *rival {
+                if let Err(e) = rival.reset().await {
+                    debug!(target: "coldvox::stt", plugin_id = %rival.info().id, error = %e, "Race rival failed to reset");
+                }
+            }
+            drop(rival);
+            plugin.reset().await.map_err(|e| e.to_string())
+        } else {
+            Ok(())
+        }
+    }
+
+    /// Apply a TranscriptionConfig to the currently loaded plugin, the
+    /// standby and the race rival, if any.
+    pub async fn apply_transcription_config(
+        &self,
+        config: TranscriptionConfig,
+    ) -> Result<(), String> {
+        *self.active.config.lock() = config.clone();
+        self.active.config_generation.fetch_add(1, Ordering::AcqRel);
+
+        let result = {
+            let mut current = self.active.plugin.lock().await;
+            if let Some(ref mut plugin) = *current {
+                plugin
+                    .initialize(config.clone())
+                    .await
+                    .map_err(|e| e.to_string())
+            } else {
+                Err("No STT plugin selected".to_string())
+            }
+        };
+
+        let mut standby = self.active.standby.lock().await;
+        if let Some(ref mut plugin) = *standby {
+            if let Err(e) = plugin.initialize(config.clone()).await {
+                warn!(target: "coldvox::stt", error = %e, "Dropping hot standby that rejected the new config");
+                self.active.take_standby(&mut standby);
+            }
+        }
+        drop(standby);
+
+        let mut rival = self.active.rival.lock().await;
+        if let Some(ref mut plugin) = *rival {
+            if let Err(e) = plugin.initialize(config).await {
+                warn!(target: "coldvox::stt", error = %e, "Leaving race mode: rival rejected the new config");
+                self.active.take_rival(&mut rival);
+            }
+        }
+        result
+    }
+}
+
 /// Manages STT plugin lifecycle and selection
 pub struct SttPluginManager {
     registry: Arc<RwLock<SttPluginRegistry>>,
-    current_plugin: Arc<RwLock<Option<Box<dyn SttPlugin>>>>,
+    active: Arc<ActivePlugin>,
     selection_config: PluginSelectionConfig,
 
-    // Failover tracking
-    consecutive_errors: Arc<RwLock<HashMap<String, u32>>>,
-    last_failover: Arc<RwLock<Option<Instant>>>,
-    failed_plugins_cooldown: Arc<RwLock<HashMap<String, Instant>>>,
+    // Failover tracking, shared with the audio path
+    failover_policy: Arc<parking_lot::RwLock<FailoverPolicy>>,
+    last_failover: Arc<parking_lot::Mutex<Option<Instant>>>,
+    failed_plugins_cooldown: Arc<parking_lot::Mutex<HashMap<String, Instant>>>,
 
     // GC management
     gc_task: Arc<RwLock<Option<JoinHandle<()>>>>,
-    last_activity: Arc<RwLock<HashMap<String, Instant>>>,
 
     // Metrics (internal counters + optional shared pipeline metrics sink)
-    failover_count: Arc<std::sync::atomic::AtomicU64>,
-    total_errors: Arc<std::sync::atomic::AtomicU64>,
+    failover_count: Arc<AtomicU64>,
+    total_errors: Arc<AtomicU64>,
     metrics_sink: Option<Arc<PipelineMetrics>>,
+    stt_metrics: SttPerformanceMetrics,
     start_instant: Instant,
     metrics_task: Arc<RwLock<Option<JoinHandle<()>>>>,
 
@@ -106,16 +1173,18 @@ impl SttPluginManager {
 
         let mut manager = Self {
             registry: Arc::new(RwLock::new(registry)),
-            current_plugin: Arc::new(RwLock::new(None)),
+            active: Arc::new(ActivePlugin::new()),
             selection_config: PluginSelectionConfig::default(),
-            consecutive_errors: Arc::new(RwLock::new(HashMap::new())),
-            last_failover: Arc::new(RwLock::new(None)),
-            failed_plugins_cooldown: Arc::new(RwLock::new(HashMap::new())),
+            failover_policy: Arc::new(parking_lot::RwLock::new(FailoverPolicy::from_config(
+                &PluginSelectionConfig::default(),
+            ))),
+            last_failover: Arc::new(parking_lot::Mutex::new(None)),
+            failed_plugins_cooldown: Arc::new(parking_lot::Mutex::new(HashMap::new())),
             gc_task: Arc::new(RwLock::new(None)),
-            last_activity: Arc::new(RwLock::new(HashMap::new())),
-            failover_count: Arc::new(std::sync::atomic::AtomicU64::new(0)),
-            total_errors: Arc::new(std::sync::atomic::AtomicU64::new(0)),
+            failover_count: Arc::new(AtomicU64::new(0)),
+            total_errors: Arc::new(AtomicU64::new(0)),
             metrics_sink: None,
+            stt_metrics: SttPerformanceMetrics::new(),
             start_instant: Instant::now(),
             metrics_task: Arc::new(RwLock::new(None)),
             config_path,
@@ -130,10 +1199,33 @@ impl SttPluginManager {
                 "Failed to load plugin configuration during startup"
             );
         }
+        manager.sync_failover_policy();
 
         manager
     }
 
+    /// Handle for the per-frame audio path; see [`SttAudioPath`].
+    pub fn audio_path(&self) -> SttAudioPath {
+        self.sync_failover_policy();
+        SttAudioPath {
+            active: self.active.clone(),
+            registry: self.registry.clone(),
+            policy: self.failover_policy.clone(),
+            failed_plugins_cooldown: self.failed_plugins_cooldown.clone(),
+            last_failover: self.last_failover.clone(),
+            failover_count: self.failover_count.clone(),
+            total_errors: self.total_errors.clone(),
+            metrics_sink: self.metrics_sink.clone(),
+            stt_metrics: self.stt_metrics.clone(),
+            start_instant: self.start_instant,
+        }
+    }
+
+    /// Publish the failover settings of `selection_config` to audio paths.
+    fn sync_failover_policy(&self) {
+        *self.failover_policy.write() = FailoverPolicy::from_config(&self.selection_config);
+    }
+
     /// Set custom configuration file path
     pub fn with_config_path(mut self, path: PathBuf) -> Self {
         self.config_path = path;
@@ -151,6 +1243,17 @@ impl SttPluginManager {
         self.metrics_sink = Some(metrics);
     }
 
+    /// Record STT performance (race outcomes) into a shared metrics instance
+    pub fn with_stt_metrics(mut self, metrics: SttPerformanceMetrics) -> Self {
+        self.stt_metrics = metrics;
+        self
+    }
+
+    /// STT performance metrics, including per-engine race statistics
+    pub fn stt_metrics(&self) -> SttPerformanceMetrics {
+        self.stt_metrics.clone()
+    }
+
     /// Update plugin selection configuration at runtime
     pub async fn set_selection_config(
         &mut self,
@@ -161,6 +1264,7 @@ impl SttPluginManager {
         let metrics_enabled = cfg.metrics.is_some();
 
         self.selection_config = cfg;
+        self.sync_failover_policy();
 
         // Save configuration to disk
         if let Err(e) = self.save_config().await {
@@ -311,8 +1415,7 @@ impl SttPluginManager {
             handle.abort();
         }
 
-        let last_activity = self.last_activity.clone();
-        let current_plugin = self.current_plugin.clone();
+        let active = self.active.clone();
         let metrics_sink = self.metrics_sink.clone();
         let ttl_secs = if gc_policy.model_ttl_secs == 0 {
             1
@@ -333,15 +1436,13 @@ impl SttPluginManager {
 
                 // First, collect the IDs of inactive plugins
                 let inactive_plugins: Vec<String> = {
-                    let activity = last_activity.read().await;
-                    let current = current_plugin.read().await;
-                    let current_id = current.as_ref().map(|p| p.info().id.clone());
+                    let activity = active.activity.lock();
 
                     activity
                         .iter()
                         .filter_map(|(plugin_id, last_used)| {
-                            // NEVER GC the actively selected plugin (#284)
-                            if Some(plugin_id.clone()) == current_id {
+                            // NEVER GC the actively selected plugin (#284) or the standby
+                            if active.is_pinned(plugin_id) {
                                 return None;
                             }
                             if now.duration_since(*last_used).as_secs() > ttl_secs as u64 {
@@ -362,8 +1463,11 @@ impl SttPluginManager {
                         "GC: Unloading inactive plugin"
                     );
 
-                    // Check if this is the current plugin and unload it
-                    let mut plugin_guard = current_plugin.write().await;
+                    // Check if this is the current plugin and unload it. A busy
+                    // plugin is in use, so skip it rather than wait on the audio path.
+                    let Ok(mut plugin_guard) = active.plugin.try_lock() else {
+                        continue;
+                    };
                     if let Some(ref mut plugin) = *plugin_guard {
                         if plugin.info().id == plugin_id {
                             match plugin.unload().await {
@@ -375,7 +1479,7 @@ impl SttPluginManager {
                                         "GC: Successfully unloaded plugin"
                                     );
                                     // Clear the current plugin after successful unload
-                                    *plugin_guard = None;
+                                    active.install(&mut plugin_guard, None);
 
                                     // Update metrics if available
                                     if let Some(ref metrics) = metrics_sink {
@@ -392,7 +1496,7 @@ impl SttPluginManager {
                                         event = "gc_already_unloaded",
                                         "GC: Plugin was already unloaded"
                                     );
-                                    *plugin_guard = None;
+                                    active.install(&mut plugin_guard, None);
                                 }
                                 Err(e) => {
                                     warn!(
@@ -415,9 +1519,10 @@ impl SttPluginManager {
                         }
                     }
 
+                    drop(plugin_guard);
+
                     // Remove from activity tracking
-                    let mut activity = last_activity.write().await;
-                    activity.remove(&plugin_id);
+                    active.activity.lock().remove(&plugin_id);
                 }
             }
         });
@@ -483,6 +1588,33 @@ impl SttPluginManager {
                     gc_runs = metrics_sink.stt_gc_runs.load(Ordering::Relaxed),
                     "STT plugin metrics summary"
                 );
+
+                for (stage, latency) in metrics_sink.latency_report() {
+                    if latency.count == 0 {
+                        continue;
+                    }
+                    info!(
+                        target: "coldvox::stt::metrics",
+                        stage,
+                        count = latency.count,
+                        p50_us = latency.p50_us(),
+                        p95_us = latency.p95_us(),
+                        p99_us = latency.p99_us(),
+                        max_us = latency.max_us,
+                        "Pipeline latency"
+                    );
+                }
+
+                for lag in metrics_sink.subscriber_lags() {
+                    info!(
+                        target: "coldvox::stt::metrics",
+                        subscriber = %lag.name,
+                        queued = lag.queued.load(Ordering::Relaxed),
+                        peak_queued = lag.peak_queued.load(Ordering::Relaxed),
+                        dropped = lag.dropped.load(Ordering::Relaxed),
+                        "Audio subscriber lag"
+                    );
+                }
             }
         });
         *metrics_task = Some(handle);
@@ -520,15 +1652,13 @@ impl SttPluginManager {
 
         // First, collect the IDs of inactive plugins
         let inactive_plugins: Vec<String> = {
-            let activity = self.last_activity.read().await;
-            let current = self.current_plugin.read().await;
-            let current_id = current.as_ref().map(|p| p.info().id.clone());
+            let activity = self.active.activity.lock();
 
             activity
                 .iter()
                 .filter_map(|(plugin_id, last_used)| {
-                    // NEVER GC the actively selected plugin (#284)
-                    if Some(plugin_id.clone()) == current_id {
+                    // NEVER GC the actively selected plugin (#284) or the standby
+                    if self.active.is_pinned(plugin_id) {
                         return None;
                     }
                     if time_threshold.duration_since(*last_used).as_secs() > ttl_secs {
@@ -549,8 +1679,11 @@ impl SttPluginManager {
                 "GC: Unloading inactive plugin"
             );
 
-            // Check if this is the current plugin and unload it
-            let mut current_plugin = self.current_plugin.write().await;
+            // Check if this is the current plugin and unload it. A busy
+            // plugin is in use, so skip it rather than wait on the audio path.
+            let Ok(mut current_plugin) = self.active.plugin.try_lock() else {
+                continue;
+            };
             if let Some(ref mut plugin) = *current_plugin {
                 if plugin.info().id == plugin_id {
                     match plugin.unload().await {
@@ -562,7 +1695,7 @@ impl SttPluginManager {
                                 "GC: Successfully unloaded plugin"
                             );
                             // Clear the current plugin after successful unload
-                            *current_plugin = None;
+                            self.active.install(&mut current_plugin, None);
 
                             // Update metrics if available
                             if let Some(ref metrics) = self.metrics_sink {
@@ -579,7 +1712,7 @@ impl SttPluginManager {
                                 event = "gc_already_unloaded",
                                 "GC: Plugin was already unloaded"
                             );
-                            *current_plugin = None;
+                            self.active.install(&mut current_plugin, None);
                         }
                         Err(e) => {
                             warn!(
@@ -602,15 +1735,16 @@ impl SttPluginManager {
                 }
             }
 
+            drop(current_plugin);
+
             // Remove from activity tracking
-            let mut activity = self.last_activity.write().await;
-            activity.remove(&plugin_id);
+            self.active.activity.lock().remove(&plugin_id);
         }
 
-        trace!("GC completed, {} plugins remain active", {
-            let activity = self.last_activity.read().await;
-            activity.len()
-        });
+        trace!(
+            "GC completed, {} plugins remain active",
+            self.active.activity.lock().len()
+        );
     }
 
     fn register_builtin_plugins(_registry: &mut SttPluginRegistry) {
@@ -654,6 +1788,7 @@ impl SttPluginManager {
         // Surface any legacy/duplicate config files to help users consolidate configs
         self.warn_on_duplicate_configs();
         self.selection_config.validate_runtime_policy()?;
+        self.sync_failover_policy();
         let registry = self.registry.read().await;
         let init_start = Instant::now();
 
@@ -804,14 +1939,13 @@ impl SttPluginManager {
             }
         }
 
-        // Store the selected plugin
-        let mut current = self.current_plugin.write().await;
-        *current = Some(plugin);
-
-        // Record initial activity to avoid immediate GC
-        {
-            let mut activity = self.last_activity.write().await;
-            activity.insert(plugin_id.clone(), Instant::now());
+        // Store the selected plugin; this records initial activity to avoid immediate GC
+        let mut current = self.active.plugin.lock().await;
+        self.active.install(&mut current, Some(plugin));
+        drop(current);
+        self.audio_path().refill_standby();
+        if let Some(race) = self.selection_config.race.clone() {
+            self.load_race_rival(&race).await;
         }
 
         tracing::info!(target: "coldvox::stt", selected_plugin = %plugin_id, "STT initialized with plugin");
@@ -875,14 +2009,75 @@ impl SttPluginManager {
 
     /// Get the current plugin
     pub async fn current_plugin(&self) -> Option<String> {
-        let current = self.current_plugin.read().await;
-        current.as_ref().map(|p| p.info().id.clone())
+        self.active.id().map(|id| id.to_string())
+    }
+
+    /// Load the plugin raced against the active one. Race mode stays off if
+    /// it cannot be created or is the active plugin itself.
+    async fn load_race_rival(&self, race: &RaceConfig) {
+        if self.active.id().as_deref() == Some(race.plugin.as_str()) {
+            warn!(
+                target: "coldvox::stt",
+                plugin_id = %race.plugin,
+                "Race plugin is the active plugin; race mode disabled"
+            );
+            return;
+        }
+        let mut rival = match self.registry.read().await.create_plugin(&race.plugin) {
+            Ok(rival) => rival,
+            Err(e) => {
+                warn!(
+                    target: "coldvox::stt",
+                    plugin_id = %race.plugin,
+                    error = %e,
+                    "Race plugin not available; race mode disabled"
+                );
+                return;
+            }
+        };
+        if self.active.config_generation.load(Ordering::Acquire) > 0 {
+            let config = self.active.config.lock().clone();
+            if let Err(e) = rival.initialize(config).await {
+                warn!(
+                    target: "coldvox::stt",
+                    plugin_id = %race.plugin,
+                    error = %e,
+                    "Race plugin failed to initialize; race mode disabled"
+                );
+                return;
+            }
+        }
+
+        let mut slot = self.active.rival.lock().await;
+        *slot = Some(rival);
+        *self.active.rival_id.write() = Some(race.plugin.as_str().into());
+        self.active
+            .activity
+            .lock()
+            .insert(race.plugin.clone(), Instant::now());
+        info!(
+            target: "coldvox::stt",
+            plugin_id = %race.plugin,
+            min_confidence = race.min_confidence,
+            event = "race_enabled",
+            "Racing STT plugin against the active plugin"
+        );
     }
 
     /// Switch to a different plugin
     pub async fn switch_plugin(&mut self, plugin_id: &str) -> Result<(), ColdVoxError> {
-        let registry = self.registry.read().await;
-        let new_plugin = registry.create_plugin(plugin_id)?;
+        let standby = {
+            let mut standby_slot = self.active.standby.lock().await;
+            if self.active.standby_id().as_deref() == Some(plugin_id) {
+                self.active.take_standby(&mut standby_slot)
+            } else {
+                None
+            }
+        };
+        let new_plugin = match standby {
+            Some(plugin) => plugin,
+            None => self.registry.read().await.create_plugin(plugin_id)?,
+        };
 
         info!(
             target: "coldvox::stt",
@@ -891,7 +2086,7 @@ impl SttPluginManager {
             "Switching to STT plugin"
         );
 
-        let mut current = self.current_plugin.write().await;
+        let mut current = self.active.plugin.lock().await;
 
         // Unload the current plugin before switching
         if let Some(ref mut old_plugin) = *current {
@@ -945,12 +2140,16 @@ impl SttPluginManager {
             }
         }
 
-        *current = Some(new_plugin);
-
-        // Update activity tracking
-        {
-            let mut activity = self.last_activity.write().await;
-            activity.insert(plugin_id.to_string(), Instant::now());
+        // Also updates activity tracking
+        self.active.install(&mut current, Some(new_plugin));
+        drop(current);
+        let audio_path = self.audio_path();
+        audio_path.refill_standby();
+        audio_path.drop_rival_if_active().await;
+        if self.active.rival_id().is_none() {
+            if let Some(race) = self.selection_config.race.clone() {
+                self.load_race_rival(&race).await;
+            }
         }
 
         Ok(())
@@ -958,7 +2157,7 @@ impl SttPluginManager {
 
     /// Unload a specific plugin by ID
     pub async fn unload_plugin(&self, plugin_id: &str) -> Result<(), ColdVoxError> {
-        let mut current = self.current_plugin.write().await;
+        let mut current = self.active.plugin.lock().await;
         let mut last_unloaded = self.last_unloaded_plugin_id.write().await;
 
         if let Some(ref mut plugin) = *current {
@@ -972,7 +2171,7 @@ impl SttPluginManager {
                             "Successfully unloaded plugin"
                         );
                         *last_unloaded = Some(plugin_id.to_string());
-                        *current = None;
+                        self.active.install(&mut current, None);
 
                         // Update metrics if available
                         if let Some(ref metrics) = self.metrics_sink {
@@ -991,7 +2190,7 @@ impl SttPluginManager {
                             "Plugin was already unloaded"
                         );
                         *last_unloaded = Some(plugin_id.to_string());
-                        *current = None;
+                        self.active.install(&mut current, None);
                         Ok(())
                     }
                     Err(e) => {
@@ -1044,7 +2243,26 @@ impl SttPluginManager {
 
     /// Unload all plugins (for shutdown cleanup)
     pub async fn unload_all_plugins(&self) -> Result<(), ColdVoxError> {
-        let mut current = self.current_plugin.write().await;
+        let standby = {
+            let mut standby_slot = self.active.standby.lock().await;
+            self.active.take_standby(&mut standby_slot)
+        };
+        if let Some(mut standby) = standby {
+            if let Err(e) = standby.unload().await {
+                debug!("Failed to unload standby plugin: {:?}", e);
+            }
+        }
+        let rival = {
+            let mut rival_slot = self.active.rival.lock().await;
+            self.active.take_rival(&mut rival_slot)
+        };
+        if let Some(mut rival) = rival {
+            if let Err(e) = rival.unload().await {
+                debug!("Failed to unload race rival plugin: {:?}", e);
+            }
+        }
+
+        let mut current = self.active.plugin.lock().await;
 
         if let Some(ref mut plugin) = *current {
             let plugin_id = plugin.info().id.clone();
@@ -1056,7 +2274,7 @@ impl SttPluginManager {
                         event = "unload_all_success",
                         "Successfully unloaded all plugins"
                     );
-                    *current = None;
+                    self.active.install(&mut current, None);
 
                     // Update metrics if available
                     if let Some(ref metrics) = self.metrics_sink {
@@ -1074,7 +2292,7 @@ impl SttPluginManager {
                         event = "plugin_already_unloaded",
                         "Plugin was already unloaded"
                     );
-                    *current = None;
+                    self.active.install(&mut current, None);
                     Ok(())
                 }
                 Err(e) => {
@@ -1107,266 +2325,55 @@ impl SttPluginManager {
         }
     }
 
-    /// Process audio with the current plugin, handling failover on errors
+    /// Process audio with the current plugin, handling failover on errors.
+    /// Long-lived callers should hold an [`audio_path`](Self::audio_path) instead.
     pub async fn process_audio(
-        &mut self,
+        &self,
         samples: &[i16],
-    ) -> Result<Option<coldvox_stt::types::TranscriptionEvent>, String> {
-        if let Some(ref metrics) = self.metrics_sink {
-            metrics
-                .stt_transcription_requests
-                .fetch_add(1, Ordering::Relaxed);
-        }
-
-        let mut current = self.current_plugin.write().await;
-
-        if let Some(ref mut plugin) = *current {
-            tracing::trace!(target: "stt_debug", plugin_id = %plugin.info().id, sample_count = samples.len(), "plugin_manager.process_audio() called");
-            let plugin_id = plugin.info().id.clone();
-
-            // Update last activity for GC
-            {
-                let mut activity = self.last_activity.write().await;
-                activity.insert(plugin_id.clone(), Instant::now());
-            }
-
-            match plugin.process_audio(samples).await {
-                Ok(result) => {
-                    tracing::trace!(target: "stt_debug", plugin_id = %plugin_id, has_event = %result.is_some(), "plugin_manager.process_audio() ok");
-                    // Reset error count on success
-                    {
-                        let mut errors = self.consecutive_errors.write().await;
-                        errors.remove(&plugin_id);
-                    }
-                    // Update transcription success metrics
-                    if let Some(ref metrics) = self.metrics_sink {
-                        metrics
-                            .stt_transcription_success
-                            .fetch_add(1, Ordering::Relaxed);
-                    }
-                    Ok(result)
-                }
-                Err(e) => {
-                    tracing::warn!(target: "stt_debug", plugin_id = %plugin_id, error = %e, "plugin_manager.process_audio() error");
-                    // Track error and potentially trigger failover
-                    self.total_errors.fetch_add(1, Ordering::Relaxed);
-                    if let Some(ref sink) = self.metrics_sink {
-                        sink.stt_total_errors.fetch_add(1, Ordering::Relaxed);
-                        sink.stt_transcription_failures
-                            .fetch_add(1, Ordering::Relaxed);
-                    }
-
-                    let (should_failover, errors_consecutive) = {
-                        let mut errors = self.consecutive_errors.write().await;
-                        let current_errors = errors.entry(plugin_id.clone()).or_insert(0);
-                        *current_errors += 1;
-
-                        let threshold = self
-                            .selection_config
-                            .failover
-                            .as_ref()
-                            .map_or(3, |f| f.failover_threshold);
-
-                        (*current_errors >= threshold, *current_errors)
-                    };
-
-                    if should_failover {
-                        warn!(
-                            target: "coldvox::stt",
-                            plugin_id = %plugin_id,
-                            event = "failover_attempt",
-                            errors_consecutive = errors_consecutive,
-                            "Plugin exceeded error threshold, attempting failover"
-                        );
-                        drop(current); // Release the lock before attempting failover
-
-                        // Attempt failover
-                        match self.attempt_failover(&plugin_id).await {
-                            Ok(new_plugin_id) => {
-                                info!(
-                                    target: "coldvox::stt",
-                                    plugin_id = %plugin_id,
-                                    event = "failover_success",
-                                    new_plugin_id = %new_plugin_id,
-                                    "Successfully failed over to new plugin"
-                                );
-                                self.failover_count
-                                    .fetch_add(1, std::sync::atomic::Ordering::Relaxed);
-                                {
-                                    let mut lf = self.last_failover.write().await;
-                                    *lf = Some(Instant::now());
-                                }
-                                if let Some(ref sink) = self.metrics_sink {
-                                    sink.stt_failover_count
-                                        .fetch_add(1, std::sync::atomic::Ordering::Relaxed);
-                                    if let Some(lf_inst) = *self.last_failover.read().await {
-                                        let secs =
-                                            lf_inst.duration_since(self.start_instant).as_secs();
-                                        sink.stt_last_failover_secs
-                                            .store(secs, std::sync::atomic::Ordering::Relaxed);
-                                    }
-                                }
-
-                                // Record cooldown for failed plugin
-                                {
-                                    let mut cooldown = self.failed_plugins_cooldown.write().await;
-                                    cooldown.insert(plugin_id, Instant::now());
-                                }
-
-                                // Try processing with new plugin
-                                let mut current = self.current_plugin.write().await;
-                                if let Some(ref mut new_plugin) = *current {
-                                    tracing::debug!(target: "stt_debug", plugin_id = %new_plugin.info().id, "plugin_manager.process_audio() retry on new plugin");
-                                    new_plugin
-                                        .process_audio(samples)
-                                        .await
-                                        .map_err(|e| e.to_string())
-                                } else {
-                                    Err("Failover succeeded but no plugin available".to_string())
-                                }
-                            }
-                            Err(failover_err) => {
-                                error!("Failover failed: {}", failover_err);
-                                Err(format!(
-                                    "STT processing failed: {}, failover failed: {}",
-                                    e, failover_err
-                                ))
-                            }
-                        }
-                    } else {
-                        Err(e.to_string())
-                    }
-                }
-            }
-        } else {
-            Err("No STT plugin selected".to_string())
-        }
+    ) -> Result<Option<TranscriptionEvent>, String> {
+        self.audio_path().process_audio(samples).await
     }
 
     /// Finalize current utterance with the current plugin
-    pub async fn finalize(
-        &mut self,
-    ) -> Result<Option<coldvox_stt::types::TranscriptionEvent>, String> {
-        let mut current = self.current_plugin.write().await;
-        if let Some(ref mut plugin) = *current {
-            tracing::debug!(target: "stt_debug", plugin_id = %plugin.info().id, "plugin_manager.finalize() called");
-            match plugin.finalize().await {
-                Ok(result) => Ok(result),
-                Err(e) => {
-                    self.total_errors
-                        .fetch_add(1, std::sync::atomic::Ordering::Relaxed);
-                    Err(e.to_string())
-                }
-            }
-        } else {
-            Ok(None)
-        }
+    pub async fn finalize(&self) -> Result<Option<TranscriptionEvent>, String> {
+        self.audio_path().finalize().await
     }
 
-    /// Prepares the plugin for a new utterance, functionally equivalent to reset.
-    pub async fn begin_utterance(&mut self) -> Result<(), String> {
-        self.reset().await
+    /// Prepares the plugin for a new utterance: resets it, then lets it warm
+    /// up (e.g. open a connection) while the user is still speaking.
+    pub async fn begin_utterance(&self) -> Result<(), String> {
+        self.audio_path().begin_utterance().await
     }
 
     /// Cancels the current utterance, functionally equivalent to reset.
-    pub async fn cancel_utterance(&mut self) -> Result<(), String> {
-        self.reset().await
+    pub async fn cancel_utterance(&self) -> Result<(), String> {
+        self.audio_path().cancel_utterance().await
     }
 
     /// Reset current plugin state for a new utterance
-    pub async fn reset(&mut self) -> Result<(), String> {
-        let mut current = self.current_plugin.write().await;
-        if let Some(ref mut plugin) = *current {
-            plugin.reset().await.map_err(|e| e.to_string())
-        } else {
-            Ok(())
-        }
+    pub async fn reset(&self) -> Result<(), String> {
+        self.audio_path().reset().await
     }
 
     /// Apply a TranscriptionConfig to the currently loaded plugin.
     /// This allows the app/processor to override defaults (e.g., enable=true).
     pub async fn apply_transcription_config(
-        &mut self,
+        &self,
         config: coldvox_stt::TranscriptionConfig,
     ) -> Result<(), String> {
-        let mut current = self.current_plugin.write().await;
-        if let Some(ref mut plugin) = *current {
-            plugin.initialize(config).await.map_err(|e| e.to_string())
-        } else {
-            Err("No STT plugin selected".to_string())
-        }
-    }
-
-    /// Attempt to failover to a different plugin
-    async fn attempt_failover(&mut self, failed_plugin_id: &str) -> Result<String, String> {
-        let registry = self.registry.read().await;
-        let now = Instant::now();
-
-        // Get cooldown period
-        let cooldown_secs = self
-            .selection_config
-            .failover
-            .as_ref()
-            .map_or(30, |f| f.failover_cooldown_secs);
-        let cooldown_duration = std::time::Duration::from_secs(cooldown_secs as u64);
-
-        // Check cooldown for failed plugins
-        let cooldown = self.failed_plugins_cooldown.read().await;
-
-        // Try fallback plugins in order, skipping ones in cooldown
-        for fallback_id in &self.selection_config.fallback_plugins {
-            if fallback_id == failed_plugin_id {
-                continue; // Skip the failed plugin
-            }
-
-            // Check if plugin is in cooldown
-            if let Some(last_failure) = cooldown.get(fallback_id) {
-                if now.duration_since(*last_failure) < cooldown_duration {
-                    debug!("Plugin {} still in cooldown, skipping", fallback_id);
-                    continue;
-                }
-            }
-
-            match registry.create_plugin(fallback_id) {
-                Ok(new_plugin) => {
-                    let new_plugin_id = new_plugin.info().id.clone();
-
-                    // Replace current plugin
-                    {
-                        let mut current = self.current_plugin.write().await;
-                        *current = Some(new_plugin);
-                    }
-
-                    // Reset error count for new plugin
-                    {
-                        let mut errors = self.consecutive_errors.write().await;
-                        errors.remove(&new_plugin_id);
-                    }
-
-                    return Ok(new_plugin_id);
-                }
-                Err(e) => {
-                    debug!("Fallback plugin {} not available: {}", fallback_id, e);
-                }
-            }
-        }
-
-        // No last-resort fallback: fail explicitly so callers/tests never silently use NoOp
-        Err("No available STT plugins for failover".to_string())
+        self.audio_path().apply_transcription_config(config).await
     }
 
     /// Get current failover metrics
     pub fn get_metrics(&self) -> (u64, u64) {
-        let failover_count = self
-            .failover_count
-            .load(std::sync::atomic::Ordering::Relaxed);
-        let total_errors = self.total_errors.load(std::sync::atomic::Ordering::Relaxed);
+        let failover_count = self.failover_count.load(Ordering::Relaxed);
+        let total_errors = self.total_errors.load(Ordering::Relaxed);
         (failover_count, total_errors)
     }
 
     /// Get Instant of last failover (if any)
     pub async fn last_failover_instant(&self) -> Option<Instant> {
-        *self.last_failover.read().await
+        *self.last_failover.lock()
     }
 }
 
@@ -1563,6 +2570,7 @@ mod tests {
                 gc_policy: None,
                 metrics: None,
                 auto_extract_model: true,
+                race: None,
             })
             .await
             .expect_err("canonical http-remote profile must reject mock fallback");
@@ -1588,6 +2596,7 @@ mod tests {
                 gc_policy: None,
                 metrics: None,
                 auto_extract_model: true,
+                race: None,
             })
             .await
             .unwrap();
@@ -1619,6 +2628,7 @@ mod tests {
                 gc_policy: None,
                 metrics: None,
                 auto_extract_model: true,
+                race: None,
             })
             .await
             .unwrap();
@@ -1837,6 +2847,7 @@ mod tests {
                 failover: Some(FailoverConfig {
                     failover_threshold: 3,
                     failover_cooldown_secs: 1,
+                    hot_standby: false,
                 }),
                 gc_policy: Some(GcPolicy {
                     model_ttl_secs: 1, // Very short TTL for testing
@@ -1844,6 +2855,7 @@ mod tests {
                 }),
                 metrics: None,
                 auto_extract_model: false,
+                race: None,
             })
             .await
             .unwrap();
@@ -1895,4 +2907,460 @@ mod tests {
         // Plugin should still be available (GC shouldn't have unloaded it due to recent activity)
         assert!(current.is_some());
     }
+
+    #[tokio::test]
+    async fn test_audio_path_does_not_wait_on_manager_lock() {
+        let mut manager = create_test_manager();
+        manager.initialize().await.unwrap();
+        let audio = manager.audio_path();
+        let manager = Arc::new(RwLock::new(manager));
+
+        // Stand-in for a config save or GC pass holding the manager
+        let _held = manager.write().await;
+        let frame = vec![0i16; 512];
+        let result = tokio::time::timeout(Duration::from_millis(200), audio.process_audio(&frame))
+            .await
+            .expect("frame delivery must not wait on the manager lock");
+        assert!(result.is_ok());
+        assert_eq!(audio.current_plugin().as_deref(), Some("mock"));
+    }
+
+    #[tokio::test]
+    async fn test_gc_skips_plugin_busy_on_audio_path() {
+        let mut manager = create_test_manager();
+        manager.initialize().await.unwrap();
+        manager.selection_config.gc_policy = Some(GcPolicy {
+            model_ttl_secs: 0,
+            enabled: true,
+        });
+        // A stale entry for a plugin that is not active
+        manager
+            .active
+            .activity
+            .lock()
+            .insert("stale".to_string(), Instant::now() - Duration::from_secs(5));
+
+        let _busy = manager.active.plugin.lock().await;
+        tokio::time::timeout(Duration::from_millis(200), manager.gc_inactive_models())
+            .await
+            .expect("GC must not wait on the audio path");
+        assert!(manager.active.activity.lock().contains_key("stale"));
+        assert_eq!(manager.current_plugin().await.as_deref(), Some("mock"));
+    }
+
+    #[test]
+    fn test_replay_buffer_drops_overlong_utterance() {
+        let mut buffer = ReplayBuffer::default();
+        buffer.push(&[1, 2, 3]);
+        assert_eq!(buffer.samples, vec![1, 2, 3]);
+
+        buffer.push(&vec![0i16; ReplayBuffer::MAX_SAMPLES]);
+        assert!(buffer.overflowed);
+        assert!(buffer.samples.is_empty());
+        buffer.push(&[4]);
+        assert!(buffer.samples.is_empty());
+
+        buffer.clear();
+        buffer.push(&[5]);
+        assert!(!buffer.overflowed);
+        assert_eq!(buffer.samples, vec![5]);
+    }
+
+    #[tokio::test]
+    async fn test_gc_keeps_hot_standby() {
+        let mut manager = create_test_manager();
+        manager.initialize().await.unwrap();
+        manager.selection_config.gc_policy = Some(GcPolicy {
+            model_ttl_secs: 0,
+            enabled: true,
+        });
+        *manager.active.standby_id.write() = Some("standby".into());
+        {
+            let mut activity = manager.active.activity.lock();
+            activity.insert(
+                "standby".to_string(),
+                Instant::now() - Duration::from_secs(5),
+            );
+            activity.insert("stale".to_string(), Instant::now() - Duration::from_secs(5));
+        }
+
+        manager.gc_inactive_models().await;
+        let activity = manager.active.activity.lock();
+        assert!(activity.contains_key("standby"));
+        assert!(!activity.contains_key("stale"));
+    }
+
+    /// Finalizes after `delay` with one word at `conf`, or as an engine
+    /// without confidence scores for `None`; counts resets.
+    struct RacePlugin {
+        id: &'static str,
+        delay: Duration,
+        conf: Option<f32>,
+        resets: Arc<AtomicU32>,
+    }
+
+    impl RacePlugin {
+        fn boxed(
+            id: &'static str,
+            delay_ms: u64,
+            conf: impl Into<Option<f32>>,
+        ) -> (Box<dyn SttPlugin>, Arc<AtomicU32>) {
+            let resets = Arc::new(AtomicU32::new(0));
+            let plugin = Self {
+                id,
+                delay: Duration::from_millis(delay_ms),
+                conf: conf.into(),
+                resets: resets.clone(),
+            };
+            (Box::new(plugin), resets)
+        }
+    }
+
+    #[async_trait::async_trait]
+    impl SttPlugin for RacePlugin {
+        fn info(&self) -> coldvox_stt::plugin::PluginInfo {
+            coldvox_stt::plugin::PluginInfo {
+                id: self.id.to_string(),
+                name: self.id.to_string(),
+                description: "Race test plugin".to_string(),
+                requires_network: false,
+                is_local: true,
+                is_available: true,
+                supported_languages: vec!["en".to_string()],
+                memory_usage_mb: None,
+            }
+        }
+
+        fn capabilities(&self) -> coldvox_stt::plugin::PluginCapabilities {
+            coldvox_stt::plugin::PluginCapabilities {
+                streaming: false,
+                batch: true,
+                word_timestamps: false,
+                confidence_scores: self.conf.is_some(),
+                speaker_diarization: false,
+                auto_punctuation: false,
+                custom_vocabulary: false,
+            }
+        }
+
+        async fn is_available(&self) -> Result<bool, ColdVoxError> {
+            Ok(true)
+        }
+
+        async fn initialize(&mut self, _config: TranscriptionConfig) -> Result<(), ColdVoxError> {
+            Ok(())
+        }
+
+        async fn process_audio(
+            &mut self,
+            _samples: &[i16],
+        ) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
+            Ok(None)
+        }
+
+        async fn finalize(&mut self) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
+            tokio::time::sleep(self.delay).await;
+            // Like Parakeet and Moonshine, an unscored engine still sends
+            // words, with placeholder confidence
+            Ok(Some(TranscriptionEvent::Final {
+                utterance_id: 1,
+                text: self.id.to_string(),
+                words: Some(vec![coldvox_stt::types::WordInfo {
+                    start: 0.0,
+                    end: 0.5,
+                    conf: self.conf.unwrap_or(0.0),
+                    text: self.id.to_string(),
+                }]),
+            }))
+        }
+
+        async fn reset(&mut self) -> Result<(), ColdVoxError> {
+            self.resets.fetch_add(1, AtomicOrdering::Relaxed);
+            Ok(())
+        }
+    }
+
+    async fn race_manager(
+        primary: Box<dyn SttPlugin>,
+        rival: Box<dyn SttPlugin>,
+        min_confidence: f32,
+    ) -> SttPluginManager {
+        let mut manager = create_test_manager();
+        manager.selection_config.race = Some(RaceConfig {
+            plugin: rival.info().id,
+            min_confidence,
+        });
+        let mut slot = manager.active.plugin.lock().await;
+        manager.active.install(&mut slot, Some(primary));
+        drop(slot);
+        *manager.active.rival_id.write() = Some(rival.info().id.as_str().into());
+        *manager.active.rival.lock().await = Some(rival);
+        manager
+    }
+
+    fn final_text(event: Option<TranscriptionEvent>) -> String {
+        match event {
+            Some(TranscriptionEvent::Final { text, .. }) => text,
+            other => panic!("expected a final, got {:?}", other),
+        }
+    }
+
+    #[tokio::test]
+    async fn test_race_first_confident_result_wins_and_cancels_loser() {
+        let (primary, primary_resets) = RacePlugin::boxed("slow", 300, 0.9);
+        let (rival, _) = RacePlugin::boxed("fast", 0, 0.9);
+        let manager = race_manager(primary, rival, 0.5).await;
+
+        let started = Instant::now();
+        let event = manager.audio_path().finalize().await.unwrap();
+        assert_eq!(final_text(event), "fast");
+        assert!(started.elapsed() < Duration::from_millis(300));
+
+        // The loser's finalize runs to completion before it is reset, and
+        // holds its plugin until then
+        drop(manager.active.plugin.lock().await);
+        assert!(started.elapsed() >= Duration::from_millis(300));
+        assert_eq!(primary_resets.load(AtomicOrdering::Relaxed), 1);
+
+        let stats = manager.stt_metrics().race_stats();
+        assert_eq!(stats["fast"].wins, 1);
+        assert_eq!(stats["slow"].losses, 1);
+        assert_eq!(stats["slow"].finalize_count, 0);
+    }
+
+    #[tokio::test]
+    async fn test_race_waits_out_low_confidence_result() {
+        let (primary, _) = RacePlugin::boxed("accurate", 50, 0.9);
+        let (rival, rival_resets) = RacePlugin::boxed("unsure", 0, 0.2);
+        let manager = race_manager(primary, rival, 0.5).await;
+
+        let event = manager.audio_path().finalize().await.unwrap();
+        assert_eq!(final_text(event), "accurate");
+        assert_eq!(rival_resets.load(AtomicOrdering::Relaxed), 0);
+
+        let stats = manager.stt_metrics().race_stats();
+        assert_eq!(stats["accurate"].wins, 1);
+        assert_eq!(stats["unsure"].losses, 1);
+        assert_eq!(stats["unsure"].finalize_count, 1);
+    }
+
+    #[tokio::test]
+    async fn test_race_unscored_final_wins_on_arrival() {
+        let (primary, primary_resets) = RacePlugin::boxed("scored", 50, 0.6);
+        let (rival, rival_resets) = RacePlugin::boxed("unscored", 0, None);
+        let manager = race_manager(primary, rival, 0.5).await;
+
+        let event = manager.audio_path().finalize().await.unwrap();
+        assert_eq!(final_text(event), "unscored");
+        drop(manager.active.plugin.lock().await);
+        assert_eq!(primary_resets.load(AtomicOrdering::Relaxed), 1);
+        assert_eq!(rival_resets.load(AtomicOrdering::Relaxed), 0);
+    }
+
+    #[test]
+    fn test_race_score_ignores_placeholder_confidence() {
+        let final_with = |text: &str, conf: f32| -> FinalizeResult {
+            Ok(Some(TranscriptionEvent::Final {
+                utterance_id: 1,
+                text: text.to_string(),
+                words: Some(vec![coldvox_stt::types::WordInfo {
+                    start: 0.0,
+                    end: 0.5,
+                    conf,
+                    text: text.to_string(),
+                }]),
+            }))
+        };
+        assert_eq!(
+            RaceScore::of(&final_with("hi", 0.0), false),
+            RaceScore::Unscored
+        );
+        assert_eq!(
+            RaceScore::of(&final_with("hi", 0.4), true),
+            RaceScore::Scored(0.4)
+        );
+        assert_eq!(
+            RaceScore::of(&final_with(" ", 0.9), true),
+            RaceScore::NoAnswer
+        );
+        assert!(RaceScore::Unscored.wins_outright(0.9));
+        assert!(!RaceScore::Scored(0.4).wins_outright(0.5));
+        assert!(RaceScore::Unscored.beats(RaceScore::NoAnswer));
+        assert!(!RaceScore::Unscored.beats(RaceScore::Scored(0.1)));
+    }
+
+    #[tokio::test]
+    async fn test_slow_rival_does_not_delay_frames() {
+        let (primary, primary_audio) = RecordingPlugin::boxed("primary", false, 0);
+        let (rival, rival_audio) = RecordingPlugin::boxed("rival", false, 200);
+        let manager = race_manager(primary, rival, 0.5).await;
+        let audio = manager.audio_path();
+
+        for frame in [[1i16; 4], [2; 4], [3; 4]] {
+            tokio::time::timeout(Duration::from_millis(100), audio.process_audio(&frame))
+                .await
+                .expect("frames must not wait on the rival")
+                .unwrap();
+        }
+        audio.finalize().await.unwrap();
+
+        // Finalize catches the rival up before racing it
+        let expected: Vec<i16> = [[1i16; 4], [2; 4], [3; 4]].concat();
+        assert_eq!(*primary_audio.lock(), expected);
+        assert_eq!(*rival_audio.lock(), expected);
+    }
+
+    #[tokio::test]
+    async fn test_switching_to_rival_leaves_race_mode() {
+        let (primary, _) = RacePlugin::boxed("primary", 0, 0.9);
+        let (rival, _) = RacePlugin::boxed("mock", 0, 0.9);
+        let mut manager = race_manager(primary, rival, 0.5).await;
+
+        manager.switch_plugin("mock").await.unwrap();
+        assert_eq!(manager.current_plugin().await.as_deref(), Some("mock"));
+        assert!(manager.active.rival_id().is_none());
+        assert!(manager.active.rival.lock().await.is_none());
+    }
+
+    /// Records the audio it is fed, optionally failing every frame or
+    /// taking `delay` per frame.
+    struct RecordingPlugin {
+        id: &'static str,
+        fail: bool,
+        delay: Duration,
+        received: Arc<parking_lot::Mutex<Vec<i16>>>,
+    }
+
+    impl RecordingPlugin {
+        fn boxed(
+            id: &'static str,
+            fail: bool,
+            delay_ms: u64,
+        ) -> (Box<dyn SttPlugin>, Arc<parking_lot::Mutex<Vec<i16>>>) {
+            let received = Arc::new(parking_lot::Mutex::new(Vec::new()));
+            let plugin = Self {
+                id,
+                fail,
+                delay: Duration::from_millis(delay_ms),
+                received: received.clone(),
+            };
+            (Box::new(plugin), received)
+        }
+    }
+
+    #[async_trait::async_trait]
+    impl SttPlugin for RecordingPlugin {
+        fn info(&self) -> coldvox_stt::plugin::PluginInfo {
+            coldvox_stt::plugin::PluginInfo {
+                id: self.id.to_string(),
+                name: self.id.to_string(),
+                description: "Recording test plugin".to_string(),
+                requires_network: false,
+                is_local: true,
+                is_available: true,
+                supported_languages: vec!["en".to_string()],
+                memory_usage_mb: None,
+            }
+        }
+
+        fn capabilities(&self) -> coldvox_stt::plugin::PluginCapabilities {
+            coldvox_stt::plugin::PluginCapabilities {
+                streaming: true,
+                batch: true,
+                word_timestamps: false,
+                confidence_scores: false,
+                speaker_diarization: false,
+                auto_punctuation: false,
+                custom_vocabulary: false,
+            }
+        }
+
+        async fn is_available(&self) -> Result<bool, ColdVoxError> {
+            Ok(true)
+        }
+
+        async fn initialize(&mut self, _config: TranscriptionConfig) -> Result<(), ColdVoxError> {
+            Ok(())
+        }
+
+        async fn process_audio(
+            &mut self,
+            samples: &[i16],
+        ) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
+            if self.fail {
+                return Err(SttError::TranscriptionFailed("failing".to_string()).into());
+            }
+            tokio::time::sleep(self.delay).await;
+            self.received.lock().extend_from_slice(samples);
+            Ok(None)
+        }
+
+        async fn finalize(&mut self) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
+            Ok(None)
+        }
+
+        async fn reset(&mut self) -> Result<(), ColdVoxError> {
+            Ok(())
+        }
+    }
+
+    #[tokio::test]
+    async fn test_failover_runs_in_background_and_backlogs_frames() {
+        let mut manager = create_test_manager();
+        manager.selection_config.failover = Some(FailoverConfig {
+            failover_threshold: 1,
+            failover_cooldown_secs: 30,
+            hot_standby: false,
+        });
+        manager.sync_failover_policy();
+        let (failing, _) = RecordingPlugin::boxed("failing", true, 0);
+        let (standby, received) = RecordingPlugin::boxed("standby", false, 100);
+        let mut slot = manager.active.plugin.lock().await;
+        manager.active.install(&mut slot, Some(failing));
+        drop(slot);
+        *manager.active.standby_id.write() = Some("standby".into());
+        *manager.active.standby.lock().await = Some(standby);
+
+        let audio = manager.audio_path();
+        for frame in [[1i16; 4], [2; 4], [3; 4]] {
+            let result =
+                tokio::time::timeout(Duration::from_millis(50), audio.process_audio(&frame))
+                    .await
+                    .expect("frames must not wait on the failover");
+            assert!(matches!(result, Ok(None)));
+        }
+
+        // Finalize queues behind the failover, by which time the replacement
+        // has the failed frame and the backlog in order
+        audio.finalize().await.unwrap();
+        assert_eq!(audio.current_plugin().as_deref(), Some("standby"));
+        let expected: Vec<i16> = [[1i16; 4], [2; 4], [3; 4]].concat();
+        assert_eq!(*received.lock(), expected);
+        assert_eq!(manager.failover_count.load(Ordering::Relaxed), 1);
+        assert!(manager.active.failover_backlog.lock().is_none());
+    }
+
+    #[test]
+    fn test_caught_up_partials_coalesce() {
+        let partial = |text: &str| TranscriptionEvent::Partial {
+            utterance_id: 1,
+            text: text.to_string(),
+            t0: None,
+            t1: None,
+        };
+        let mut queue = VecDeque::new();
+        queue_caught_up(&mut queue, partial("a"));
+        queue_caught_up(&mut queue, partial("a b"));
+        queue_caught_up(
+            &mut queue,
+            TranscriptionEvent::Final {
+                utterance_id: 1,
+                text: "a b c".to_string(),
+                words: None,
+            },
+        );
+        queue_caught_up(&mut queue, partial("d"));
+        assert_eq!(queue.len(), 3);
+        assert!(matches!(&queue[0], TranscriptionEvent::Partial { text, .. } if text == "a b"));
+    }
 }
@@ -0,0 +1,167 @@
+// Fixed-capacity pre-roll audio for the STT processor.
+//
+// The ring is backed by a linear buffer of twice its capacity: pushes append,
+// and the retained window is moved back to the front only when the buffer
+// fills. Each sample is therefore copied at most once more (amortized), and
+// the window is always one contiguous slice that can be handed to a plugin
+// without gathering.
+
+use std::ops::Deref;
+
+pub struct PreRollRing {
+    samples: Vec<i16>,
+    /// Index of the oldest retained sample in `samples`.
+    start: usize,
+    capacity: usize,
+}
+
+impl PreRollRing {
+    pub fn new(capacity: usize) -> Self {
+        Self {
+            samples: Vec::with_capacity(capacity * 2),
+            start: 0,
+            capacity,
+        }
+    }
+
+    /// Ring sized for `ms` milliseconds of mono audio at `sample_rate` Hz.
+    pub fn with_duration_ms(ms: u32, sample_rate: u32) -> Self {
+        Self::new((ms as u64 * sample_rate as u64 / 1000) as usize)
+    }
+
+    pub fn capacity(&self) -> usize {
+        self.capacity
+    }
+
+    pub fn len(&self) -> usize {
+        self.samples.len() - self.start
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Append `frame`, dropping the oldest samples beyond capacity.
+    pub fn push(&mut self, frame: &[i16]) {
+        if self.capacity == 0 {
+            return;
+        }
+        let frame = &frame[frame.len().saturating_sub(self.capacity)..];
+
+        if self.samples.len() + frame.len() > self.capacity * 2 {
+            // Compact: keep only the part of the window that survives this push
+            let keep = self.len().min(self.capacity - frame.len());
+            self.samples.drain(..self.samples.len() - keep);
+            self.start = 0;
+        }
+        if self.samples.capacity() == 0 {
+            // Storage was handed out by `take` and not recycled
+            self.samples.reserve_exact(self.capacity * 2);
+        }
+        self.samples.extend_from_slice(frame);
+        self.start += self.len().saturating_sub(self.capacity);
+    }
+
+    /// The retained audio, oldest first.
+    pub fn as_slice(&self) -> &[i16] {
+        &self.samples[self.start..]
+    }
+
+    pub fn clear(&mut self) {
+        self.samples.clear();
+        self.start = 0;
+    }
+
+    /// Move the retained audio out without copying. The ring is left empty;
+    /// pass the [`PreRoll`] back to [`recycle`](Self::recycle) to reuse its
+    /// storage.
+    pub fn take(&mut self) -> PreRoll {
+        PreRoll {
+            samples: std::mem::take(&mut self.samples),
+            start: std::mem::replace(&mut self.start, 0),
+        }
+    }
+
+    /// Reclaim storage from an earlier [`take`](Self::take) if the ring has not
+    /// allocated a replacement since.
+    pub fn recycle(&mut self, pre_roll: PreRoll) {
+        if self.samples.capacity() == 0 {
+            let mut samples = pre_roll.samples;
+            samples.clear();
+            self.samples = samples;
+            self.start = 0;
+        }
+    }
+}
+
+/// Owned pre-roll audio taken from a [`PreRollRing`].
+pub struct PreRoll {
+    samples: Vec<i16>,
+    start: usize,
+}
+
+impl Deref for PreRoll {
+    type Target = [i16];
+
+    fn deref(&self) -> &[i16] {
+        &self.samples[self.start..]
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn ramp(from: i16, len: usize) -> Vec<i16> {
+        (0..len as i16).map(|i| from + i).collect()
+    }
+
+    #[test]
+    fn keeps_most_recent_window_contiguous() {
+        let mut ring = PreRollRing::new(10);
+        ring.push(&ramp(0, 4));
+        assert_eq!(ring.as_slice(), &ramp(0, 4)[..]);
+
+        // Enough pushes to force several compactions
+        for i in 1..20 {
+            ring.push(&ramp(i * 4, 4));
+        }
+        assert_eq!(ring.len(), 10);
+        assert_eq!(ring.as_slice(), &ramp(70, 10)[..]);
+    }
+
+    #[test]
+    fn oversized_frame_keeps_its_tail() {
+        let mut ring = PreRollRing::new(8);
+        ring.push(&ramp(0, 3));
+        ring.push(&ramp(100, 20));
+        assert_eq!(ring.as_slice(), &ramp(112, 8)[..]);
+    }
+
+    #[test]
+    fn take_and_recycle_reuse_storage() {
+        let mut ring = PreRollRing::with_duration_ms(1, 16_000);
+        assert_eq!(ring.capacity(), 16);
+        ring.push(&ramp(0, 10));
+        ring.push(&ramp(10, 10));
+
+        let pre_roll = ring.take();
+        assert_eq!(&pre_roll[..], &ramp(4, 16)[..]);
+        assert!(ring.is_empty());
+
+        let ptr = pre_roll.as_ptr();
+        ring.recycle(pre_roll);
+        ring.push(&ramp(0, 2));
+        assert_eq!(ring.as_slice(), &[0, 1]);
+        assert_eq!(ring.samples.as_ptr(), ptr.wrapping_sub(4));
+    }
+
+    #[test]
+    fn push_after_take_without_recycle_reallocates() {
+        let mut ring = PreRollRing::new(4);
+        ring.push(&[1, 2, 3]);
+        let _kept = ring.take();
+        ring.push(&[4, 5, 6, 7, 8]);
+        assert_eq!(ring.as_slice(), &[5, 6, 7, 8]);
+    }
+}
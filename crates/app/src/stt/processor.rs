@@ -8,28 +8,38 @@
 // Key Design Principles:
 // - Single `run` loop using `tokio::select!` for handling multiple event sources.
 // - Abstracted session lifecycle via `SessionEvent` (from VAD or Hotkey).
-// - Non-blocking finalization: When an utterance ends, a background `tokio::task`
-//   is spawned to handle the potentially slow process of finalizing the
-//   transcription with the STT plugin. This prevents the main loop from blocking
-//   and dropping audio frames from a subsequent utterance.
+// - Non-blocking, ordered plugin calls: begin (with pre-roll), cancel and
+//   finalize are queued to a single worker task that runs them one at a time,
+//   so the main loop never waits on a slow finalize yet the plugin always sees
+//   them in the order they were issued. Live frames that arrive while calls are
+//   queued go through the same worker, behind the pre-roll.
 // - State management via a `parking_lot::Mutex` to allow safe concurrent access
 //   from the main loop and spawned tasks.
 // ---
 
 use crate::stt::{
+    plugin_manager::SttAudioPath,
+    preroll::PreRollRing,
     session::{HotkeyBehavior, SessionEvent, Settings},
     TranscriptionConfig, TranscriptionEvent,
 };
-use coldvox_audio::SharedAudioFrame;
+use coldvox_audio::{Delivery, FrameSubscriber, SharedAudioFrame};
+use coldvox_telemetry::{TraceId, TraceStage};
+use futures::future::BoxFuture;
+use std::future::Future;
+use std::sync::atomic::{AtomicUsize, Ordering};
 use std::sync::Arc;
 use std::time::Instant;
-use tokio::sync::{broadcast, mpsc};
+use tokio::sync::{mpsc, Semaphore};
 
 /// Represents the current state of the STT processor's utterance handling.
 #[derive(Debug, Clone, PartialEq, Eq)]
 pub enum UtteranceState {
     /// Waiting for an utterance to begin.
     Idle,
+    /// VAD announced a likely onset; audio is streamed to the plugin but the
+    /// utterance is cancelled unless `Start` confirms it.
+    Speculative,
     /// An utterance is actively being processed (either streaming or buffering).
     SpeechActive,
     /// The last utterance is being finalized. New audio is ignored until this completes.
@@ -50,19 +60,55 @@ pub struct SttMetrics {
 // 30 seconds of 16kHz 16-bit mono audio.
 const BUFFER_CEILING_SAMPLES: usize = 16000 * 30;
 
+// Pre-roll kept while idle in always-on mode: ~2 seconds at 16kHz mono.
+const PRE_ROLL_SAMPLES: usize = 32_000;
+
+/// Frames kept while the plugin loads: the newest ~32 seconds of 512-sample
+/// frames at 16kHz. An utterance begun during a longer load loses its start.
+pub const STARTUP_FRAME_QUEUE: usize = 1024;
+
+/// Frames the running processor may fall behind by before it loses audio:
+/// ~32 seconds of 512-sample frames at 16kHz. A slow plugin call (a long
+/// finalize) only backs up this queue; the chunker and the VAD keep going.
+const LIVE_FRAME_QUEUE: usize = 1024;
+
+/// Frames that may wait in the plugin queue behind a slow call (~4 seconds).
+/// Past that the processor stops reading frames and the backlog stays in the
+/// frame bus subscription, which is bounded by [`LIVE_FRAME_QUEUE`].
+const QUEUED_FRAME_LIMIT: usize = 128;
+
 /// The primary STT processor, designed to be unified and extensible.
-/// It uses the plugin manager to delegate STT work and handles different
+/// It delegates STT work to the active plugin through an [`SttAudioPath`], so
+/// frames never wait on the plugin manager's own lock, and handles different
 /// activation and processing strategies defined by `Settings`.
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
 pub struct PluginSttProcessor {
-    audio_rx: broadcast::Receiver<SharedAudioFrame>,
+    audio_rx: FrameSubscriber<SharedAudioFrame>,
     session_event_rx: mpsc::Receiver<SessionEvent>,
     event_tx: mpsc::Sender<TranscriptionEvent>,
-    plugin_manager: Arc<tokio::sync::RwLock<crate::stt::plugin_manager::SttPluginManager>>,
+    plugin: SttAudioPath,
     state: Arc<parking_lot::Mutex<State>>,
     metrics: Arc<parking_lot::RwLock<SttMetrics>>,
     config: TranscriptionConfig,
     settings: Settings,
+    tasks: PluginQueue,
+}
+
+/// Ordered plugin calls. Each entry runs only after the previous one finished.
+#[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
+enum PluginQueue {
+    /// Awaited by a worker spawned from [`PluginSttProcessor::run`]; `pending`
+    /// counts entries queued but not yet finished. Queued frames each hold one
+    /// of `frame_slots`; control calls (begin, cancel, finalize) are few per
+    /// utterance and never wait.
+    Worker {
+        tx: mpsc::UnboundedSender<BoxFuture<'static, ()>>,
+        rx: parking_lot::Mutex<Option<mpsc::UnboundedReceiver<BoxFuture<'static, ()>>>>,
+        pending: Arc<AtomicUsize>,
+        frame_slots: Arc<Semaphore>,
+    },
+    /// Awaited by the owner; see [`PluginSttProcessor::with_inline_tasks`].
+    Inline(parking_lot::Mutex<Vec<BoxFuture<'static, ()>>>),
 }
 
 /// The internal, mutable state of the processor, protected by a Mutex.
@@ -71,17 +117,19 @@ struct State {
     pub state: UtteranceState,
     pub source: crate::stt::session::SessionSource,
     pub buffer: Vec<i16>,
-    pub rolling_buffer: std::collections::VecDeque<i16>,
+    pub pre_roll: PreRollRing,
+    /// Timeline of the active session, from its start event.
+    pub trace: Option<TraceId>,
 }
 
 #[cfg(any(feature = "moonshine", feature = "parakeet", feature = "http-remote"))]
 impl PluginSttProcessor {
     /// Creates a new instance of the unified STT processor.
     pub fn new(
-        audio_rx: broadcast::Receiver<SharedAudioFrame>,
+        audio_rx: FrameSubscriber<SharedAudioFrame>,
         session_event_rx: mpsc::Receiver<SessionEvent>,
         event_tx: mpsc::Sender<TranscriptionEvent>,
-        plugin_manager: Arc<tokio::sync::RwLock<crate::stt::plugin_manager::SttPluginManager>>,
+        plugin: SttAudioPath,
         config: TranscriptionConfig,
         settings: Settings,
     ) -> Self {
@@ -89,21 +137,118 @@ impl PluginSttProcessor {
             state: UtteranceState::Idle,
             source: crate::stt::session::SessionSource::Vad, // Default
             buffer: Vec::with_capacity(16000 * 10),
-            rolling_buffer: std::collections::VecDeque::with_capacity(32_000), // ~2 seconds at 16kHz
+            pre_roll: PreRollRing::new(PRE_ROLL_SAMPLES),
+            trace: None,
         };
 
+        let (tx, rx) = mpsc::unbounded_channel();
         Self {
             audio_rx,
             session_event_rx,
             event_tx,
-            plugin_manager,
+            plugin,
             state: Arc::new(parking_lot::Mutex::new(internal_state)),
             metrics: Arc::new(parking_lot::RwLock::new(SttMetrics::default())),
             config,
             settings,
+            tasks: PluginQueue::Worker {
+                tx,
+                rx: parking_lot::Mutex::new(Some(rx)),
+                pending: Arc::new(AtomicUsize::new(0)),
+                frame_slots: Arc::new(Semaphore::new(QUEUED_FRAME_LIMIT)),
+            },
+        }
+    }
+
+    /// Leave begin/finalize/cancel plugin calls for the owner instead of a
+    /// worker task, for callers that drive the handlers directly (offline
+    /// processing). The caller runs them with
+    /// [`run_inline_tasks`](Self::run_inline_tasks) after each handler, which
+    /// keeps event and audio order deterministic.
+    pub(crate) fn with_inline_tasks(mut self) -> Self {
+        self.tasks = PluginQueue::Inline(parking_lot::Mutex::new(Vec::new()));
+        self
+    }
+
+    /// Queue a plugin call behind every call queued before it.
+    fn dispatch(&self, task: impl Future<Output = ()> + Send + 'static) {
+        match &self.tasks {
+            PluginQueue::Worker { tx, pending, .. } => {
+                pending.fetch_add(1, Ordering::AcqRel);
+                if tx.send(Box::pin(task)).is_err() {
+                    pending.fetch_sub(1, Ordering::AcqRel);
+                }
+            }
+            PluginQueue::Inline(queue) => queue.lock().push(Box::pin(task)),
+        }
+    }
+
+    /// Queue `frame` for the plugin behind every call queued before it,
+    /// waiting while [`QUEUED_FRAME_LIMIT`] frames are already queued.
+    async fn dispatch_frame(&self, frame: SharedAudioFrame) {
+        let slot = match &self.tasks {
+            PluginQueue::Worker { frame_slots, .. } => {
+                frame_slots.clone().acquire_owned().await.ok()
+            }
+            // Drained by the owner after every handler
+            PluginQueue::Inline(_) => None,
+        };
+        let plugin = self.plugin.clone();
+        let event_tx = self.event_tx.clone();
+        let metrics = self.metrics.clone();
+        self.dispatch(async move {
+            Self::process_frame_static(&plugin, &event_tx, &metrics, &frame.samples).await;
+            drop(slot);
+        });
+    }
+
+    /// Whether queued plugin calls have yet to finish.
+    fn has_pending_tasks(&self) -> bool {
+        match &self.tasks {
+            PluginQueue::Worker { pending, .. } => pending.load(Ordering::Acquire) > 0,
+            PluginQueue::Inline(queue) => !queue.lock().is_empty(),
+        }
+    }
+
+    /// Start the worker that awaits queued plugin calls. Only the first call
+    /// has an effect.
+    fn start_worker(&self) {
+        let PluginQueue::Worker { rx, pending, .. } = &self.tasks else {
+            return;
+        };
+        let Some(mut rx) = rx.lock().take() else {
+            return;
+        };
+        let pending = pending.clone();
+        tokio::spawn(async move {
+            while let Some(task) = rx.recv().await {
+                task.await;
+                pending.fetch_sub(1, Ordering::AcqRel);
+            }
+        });
+    }
+
+    /// Await queued plugin calls in order, including any they queue in turn.
+    pub(crate) async fn run_inline_tasks(&self) {
+        let PluginQueue::Inline(queue) = &self.tasks else {
+            return;
+        };
+        loop {
+            let tasks = std::mem::take(&mut *queue.lock());
+            if tasks.is_empty() {
+                break;
+            }
+            for task in tasks {
+                task.await;
+            }
         }
     }
 
+    /// Current utterance state.
+    pub(crate) fn utterance_state(&self) -> UtteranceState {
+        self.state.lock().state.clone()
+    }
+
     /// The main run loop for the processor. It uses `tokio::select!` to concurrently
     /// listen for session lifecycle events and incoming audio frames.
     pub async fn run(mut self) {
@@ -114,16 +259,17 @@ impl PluginSttProcessor {
             self.config.partial_results,
         );
 
-        // Clear any stale audio frames from the channel before starting.
-        while self.audio_rx.try_recv().is_ok() {}
+        self.apply_transcription_config().await;
+        self.start_worker();
 
-        // Ensure the active plugin is initialized with the desired transcription config
-        {
-            let mut pm = self.plugin_manager.write().await;
-            if let Err(e) = pm.apply_transcription_config(self.config.clone()).await {
-                tracing::warn!(target: "stt", "Failed to apply transcription config to plugin: {}", e);
-            }
-        }
+        // Audio and session events queued while the plugin was loading are
+        // replayed, so an utterance started during startup is not lost.
+        self.absorb_startup_backlog().await;
+
+        // From here on every frame is consumed as it arrives, so ask for all of them
+        self.audio_rx.set_delivery(Delivery::Lossless {
+            capacity: LIVE_FRAME_QUEUE,
+        });
 
         loop {
             tokio::select! {
@@ -141,40 +287,107 @@ impl PluginSttProcessor {
         }
     }
 
+    /// Replay audio and session events queued before the run loop in capture
+    /// order: each event is handled after the frames captured before it. Idle
+    /// frames go to the pre-roll, so a queued start still gets its onset.
+    /// Outside always-on mode the pre-roll is kept only if an utterance began.
+    async fn absorb_startup_backlog(&mut self) {
+        let mut frames = Vec::new();
+        while let Ok(frame) = self.audio_rx.try_recv() {
+            frames.push(frame);
+        }
+        let mut frames = frames.into_iter().peekable();
+        while let Ok(event) = self.session_event_rx.try_recv() {
+            if let SessionEvent::Start(_, at, _)
+            | SessionEvent::End(_, at)
+            | SessionEvent::Speculate(_, at) = event
+            {
+                while let Some(frame) = frames.next_if(|frame| frame.timestamp <= at) {
+                    self.replay_startup_frame(frame).await;
+                }
+            }
+            self.handle_session_event(event).await;
+        }
+        for frame in frames {
+            self.replay_startup_frame(frame).await;
+        }
+        let mut state = self.state.lock();
+        if state.state == UtteranceState::Idle
+            && self.settings.activation_mode
+                != crate::stt::session::ActivationMode::AlwaysOnPushToTranscribe
+        {
+            state.pre_roll.clear();
+        }
+    }
+
+    async fn replay_startup_frame(&self, frame: SharedAudioFrame) {
+        {
+            let mut state = self.state.lock();
+            if state.state == UtteranceState::Idle {
+                state.pre_roll.push(&frame.samples);
+                return;
+            }
+        }
+        self.handle_audio_frame(frame).await;
+    }
+
+    /// Ensure the active plugin is initialized with the desired transcription config.
+    pub(crate) async fn apply_transcription_config(&self) {
+        if let Err(e) = self
+            .plugin
+            .apply_transcription_config(self.config.clone())
+            .await
+        {
+            tracing::warn!(target: "stt", "Failed to apply transcription config to plugin: {}", e);
+        }
+    }
+
     /// Handles session lifecycle events (Start, End, Abort).
-    async fn handle_session_event(&self, event: SessionEvent) {
+    pub(crate) async fn handle_session_event(&self, event: SessionEvent) {
         let mut state = self.state.lock();
         match event {
-            SessionEvent::Start(source, _instant) => {
-                if state.state == UtteranceState::Idle {
+            SessionEvent::Start(_, at, _)
+            | SessionEvent::End(_, at)
+            | SessionEvent::Speculate(_, at) => self.plugin.record_session_handoff(at),
+            _ => {}
+        }
+        match event {
+            SessionEvent::Start(source, _instant, trace) => match state.state {
+                UtteranceState::Idle => {
                     tracing::info!(target: "stt", "Session started via {:?}", source);
                     state.source = source;
                     state.state = UtteranceState::SpeechActive;
                     state.buffer.clear();
-
-                    // Flush the rolling buffer into the main pipeline if we have pre-roll data
-                    let pre_roll: Vec<i16> = state.rolling_buffer.drain(..).collect();
-                    if !pre_roll.is_empty() {
-                        tracing::debug!(target: "stt_debug", "Flushing {} samples of pre-roll audio", pre_roll.len());
-                        if self.settings.hotkey_behavior
-                            != crate::stt::session::HotkeyBehavior::Incremental
-                        {
-                            state.buffer.extend_from_slice(&pre_roll);
-                        }
-                    }
-
-                    let pm = self.plugin_manager.clone();
-                    let incremental = self.settings.hotkey_behavior
-                        == crate::stt::session::HotkeyBehavior::Incremental;
-                    tokio::spawn(async move {
-                        if let Err(e) = pm.write().await.begin_utterance().await {
-                            tracing::error!(target: "stt", "Plugin begin_utterance failed: {}", e);
-                            return;
-                        }
-                        if incremental && !pre_roll.is_empty() {
-                            if let Err(e) = pm.write().await.process_audio(&pre_roll).await {
-                                tracing::error!(target: "stt", "Plugin process_audio failed on pre-roll: {}", e);
-                            }
+                    state.trace = Some(trace);
+                    self.plugin.mark_trace(trace, TraceStage::SessionStart);
+                    self.begin_plugin_utterance(&mut state);
+                }
+                UtteranceState::Speculative => {
+                    tracing::info!(target: "stt", "Speculative session confirmed via {:?}", source);
+                    state.state = UtteranceState::SpeechActive;
+                    state.trace = Some(trace);
+                    self.plugin.mark_trace(trace, TraceStage::SessionStart);
+                }
+                _ => {}
+            },
+            SessionEvent::Speculate(source, _instant) => {
+                if state.state == UtteranceState::Idle
+                    && self.settings.hotkey_behavior == HotkeyBehavior::Incremental
+                {
+                    tracing::debug!(target: "stt", "Speculative session start via {:?}", source);
+                    state.source = source;
+                    state.state = UtteranceState::Speculative;
+                    self.begin_plugin_utterance(&mut state);
+                }
+            }
+            SessionEvent::CancelSpeculation(source) => {
+                if state.state == UtteranceState::Speculative {
+                    tracing::debug!(target: "stt", "Speculative session cancelled via {:?}", source);
+                    state.state = UtteranceState::Idle;
+                    let plugin = self.plugin.clone();
+                    self.dispatch(async move {
+                        if let Err(e) = plugin.cancel_utterance().await {
+                            tracing::error!(target: "stt", "Plugin cancel_utterance failed: {}", e);
                         }
                     });
                 }
@@ -189,9 +402,35 @@ impl PluginSttProcessor {
         }
     }
 
-    /// Handles the end of an utterance. This is a critical path that spawns a
-    /// non-blocking task to finalize the transcription, ensuring the main loop
-    /// can immediately start processing the next utterance.
+    /// Starts a plugin utterance and hands it the pre-roll. The pre-roll storage
+    /// moves into the queued call and is returned to the ring afterwards.
+    fn begin_plugin_utterance(&self, state: &mut State) {
+        let incremental = self.settings.hotkey_behavior == HotkeyBehavior::Incremental;
+        let pre_roll = state.pre_roll.take();
+        if !pre_roll.is_empty() {
+            tracing::debug!(target: "stt_debug", "Flushing {} samples of pre-roll audio", pre_roll.len());
+            if !incremental {
+                state.buffer.extend_from_slice(&pre_roll);
+            }
+        }
+
+        let plugin = self.plugin.clone();
+        let state_arc = self.state.clone();
+        self.dispatch(async move {
+            if let Err(e) = plugin.begin_utterance().await {
+                tracing::error!(target: "stt", "Plugin begin_utterance failed: {}", e);
+            } else if incremental && !pre_roll.is_empty() {
+                if let Err(e) = plugin.process_audio(&pre_roll).await {
+                    tracing::error!(target: "stt", "Plugin process_audio failed on pre-roll: {}", e);
+                }
+            }
+            state_arc.lock().pre_roll.recycle(pre_roll);
+        });
+    }
+
+    /// Handles the end of an utterance. This is a critical path that queues the
+    /// finalization instead of awaiting it, ensuring the main loop can
+    /// immediately start processing the next utterance.
     fn handle_session_end(
         &self,
         _source: crate::stt::session::SessionSource,
@@ -202,12 +441,16 @@ impl PluginSttProcessor {
             return;
         }
 
+        let trace = state.trace.take();
         if is_abort {
             state.state = UtteranceState::Idle;
             state.buffer.clear();
-            let pm = self.plugin_manager.clone();
-            tokio::spawn(async move {
-                if let Err(e) = pm.write().await.cancel_utterance().await {
+            if let Some(trace) = trace {
+                self.plugin.abandon_trace(trace);
+            }
+            let plugin = self.plugin.clone();
+            self.dispatch(async move {
+                if let Err(e) = plugin.cancel_utterance().await {
                     tracing::error!(target: "stt", "Plugin cancel_utterance failed: {}", e);
                 }
             });
@@ -215,26 +458,29 @@ impl PluginSttProcessor {
         }
 
         state.state = UtteranceState::Finalizing;
+        if let Some(trace) = trace {
+            self.plugin.mark_trace(trace, TraceStage::SessionEnd);
+        }
 
-        let pm = self.plugin_manager.clone();
+        let plugin = self.plugin.clone();
         let event_tx = self.event_tx.clone();
         let metrics = self.metrics.clone();
         let behavior = self.settings.hotkey_behavior.clone();
         let buffer = state.buffer.clone();
         let state_arc = self.state.clone();
 
-        tokio::spawn(async move {
+        self.dispatch(async move {
             tracing::debug!(target: "stt_debug", "Finalization task started.");
             // In batch mode, send the entire buffer to the plugin first.
             if behavior != HotkeyBehavior::Incremental && !buffer.is_empty() {
-                if let Err(e) = pm.write().await.process_audio(&buffer).await {
+                if let Err(e) = plugin.process_audio(&buffer).await {
                     tracing::error!(target: "stt", "Plugin batch processing error: {}", e);
                 }
             }
 
             // Finalize the utterance to get the definitive transcription.
             tracing::debug!(target: "stt_debug", "Calling plugin.finalize().");
-            let finalize_result = pm.write().await.finalize().await;
+            let finalize_result = plugin.finalize_traced(trace).await;
             tracing::debug!(target: "stt_debug", "Plugin.finalize() returned.");
 
             match finalize_result {
@@ -263,70 +509,77 @@ impl PluginSttProcessor {
     }
 
     /// Handles an incoming chunk of audio frames.
-    async fn handle_audio_frame(&self, frame: SharedAudioFrame) {
-        let behavior = self.settings.hotkey_behavior.clone();
+    pub(crate) async fn handle_audio_frame(&self, frame: SharedAudioFrame) {
+        let incremental = self.settings.hotkey_behavior == HotkeyBehavior::Incremental;
         // Use i16 samples directly from SharedAudioFrame
         let samples_slice: &[i16] = &frame.samples;
 
         let should_process = {
-            let state = self.state.lock();
-            state.state == UtteranceState::SpeechActive
-        };
-
-        if behavior != HotkeyBehavior::Incremental {
-            // Batch mode: lock, buffer, and return.
-            {
-                let mut state = self.state.lock();
-                if state.state == UtteranceState::SpeechActive {
+            let mut state = self.state.lock();
+            match state.state {
+                UtteranceState::SpeechActive | UtteranceState::Speculative if incremental => true,
+                UtteranceState::SpeechActive => {
+                    // Batch mode: buffer until the session ends.
                     state.buffer.extend_from_slice(samples_slice);
                     if state.buffer.len() > BUFFER_CEILING_SAMPLES {
                         tracing::warn!(target: "stt", "Audio buffer ceiling reached. Defensively finalizing.");
-                        self.handle_session_end(state.source, false, &mut state);
-                    }
-                }
-            }
-            if should_process {
-                tracing::trace!(target: "stt_debug", "Dispatching {} samples to plugin.process_audio()", samples_slice.len());
-                match self
-                    .plugin_manager
-                    .write()
-                    .await
-                    .process_audio(samples_slice)
-                    .await
-                {
-                    Ok(Some(event)) => {
-                        tracing::debug!(target: "stt_debug", "plugin.process_audio() produced event: {:?}", event);
-                        Self::send_event_static(&self.event_tx, &self.metrics, event).await;
-                    }
-                    Ok(None) => {}
-                    Err(e) => {
-                        tracing::warn!(target: "stt_debug", "plugin.process_audio() returned error: {}", e);
-                        let err_event = TranscriptionEvent::Error {
-                            code: "PLUGIN_PROCESS_ERROR".to_string(),
-                            message: e,
-                        };
-                        Self::send_event_static(&self.event_tx, &self.metrics, err_event).await;
+                        let source = state.source;
+                        self.handle_session_end(source, false, &mut state);
                     }
+                    false
                 }
-            } else if self.settings.activation_mode
-                == crate::stt::session::ActivationMode::AlwaysOnPushToTranscribe
-            {
-                let mut state = self.state.lock();
-                if state.state == UtteranceState::Idle {
-                    state.rolling_buffer.extend(samples_slice.iter().copied());
-                    // Keep roughly 2 seconds (32,000 samples at 16kHz mono)
-                    let max_samples = 32_000;
-                    if state.rolling_buffer.len() > max_samples {
-                        let excess = state.rolling_buffer.len() - max_samples;
-                        state.rolling_buffer.drain(0..excess);
+                UtteranceState::Idle => {
+                    if self.settings.activation_mode
+                        == crate::stt::session::ActivationMode::AlwaysOnPushToTranscribe
+                    {
+                        state.pre_roll.push(samples_slice);
                     }
+                    false
                 }
+                _ => false,
+            }
+        };
+
+        if !should_process {
+            return;
+        }
+        if self.has_pending_tasks() {
+            // Begin and pre-roll (or a cancel, or the previous utterance's
+            // finalize) have not reached the plugin yet; the frame must follow them
+            self.dispatch_frame(frame).await;
+        } else {
+            Self::process_frame_static(&self.plugin, &self.event_tx, &self.metrics, samples_slice)
+                .await;
+        }
+    }
+
+    /// Feed live samples to the plugin and forward whatever it produces.
+    async fn process_frame_static(
+        plugin: &SttAudioPath,
+        event_tx: &mpsc::Sender<TranscriptionEvent>,
+        metrics: &Arc<parking_lot::RwLock<SttMetrics>>,
+        samples: &[i16],
+    ) {
+        tracing::trace!(target: "stt_debug", "Dispatching {} samples to plugin.process_audio()", samples.len());
+        match plugin.process_audio(samples).await {
+            Ok(Some(event)) => {
+                tracing::debug!(target: "stt_debug", "plugin.process_audio() produced event: {:?}", event);
+                Self::send_event_static(event_tx, metrics, event).await;
+            }
+            Ok(None) => {}
+            Err(e) => {
+                tracing::warn!(target: "stt_debug", "plugin.process_audio() returned error: {}", e);
+                let err_event = TranscriptionEvent::Error {
+                    code: "PLUGIN_PROCESS_ERROR".to_string(),
+                    message: e,
+                };
+                Self::send_event_static(event_tx, metrics, err_event).await;
             }
         }
     }
 
     /// A static helper to send transcription events and update metrics, callable
-    /// from spawned tasks.
+    /// from queued plugin calls.
     async fn send_event_static(
         event_tx: &mpsc::Sender<TranscriptionEvent>,
         metrics_arc: &Arc<parking_lot::RwLock<SttMetrics>>,
@@ -355,10 +608,10 @@ pub struct PluginSttProcessor;
 #[cfg(not(any(feature = "moonshine", feature = "parakeet", feature = "http-remote")))]
 impl PluginSttProcessor {
     pub fn new(
-        _audio_rx: broadcast::Receiver<SharedAudioFrame>,
+        _audio_rx: FrameSubscriber<SharedAudioFrame>,
         _session_event_rx: mpsc::Receiver<SessionEvent>,
         _event_tx: mpsc::Sender<TranscriptionEvent>,
-        _plugin_manager: Arc<tokio::sync::RwLock<crate::stt::plugin_manager::SttPluginManager>>,
+        _plugin: crate::stt::plugin_manager::SttAudioPath,
         _config: TranscriptionConfig,
         _settings: Settings,
     ) -> Self {
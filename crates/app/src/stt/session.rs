@@ -1,3 +1,5 @@
+use coldvox_telemetry::TraceId;
+use coldvox_vad::VadEvent;
 use std::time::Instant;
 
 /// Source of an STT activation session
@@ -10,16 +12,36 @@ pub enum SessionSource {
 /// Events that define the lifecycle of a transcription session.
 /// This abstracts away the difference between VAD and Hotkey activation.
 pub enum SessionEvent {
-    /// A session has started.
-    Start(SessionSource, Instant),
+    /// A session has started. The trace id names its utterance timeline.
+    Start(SessionSource, Instant, TraceId),
     /// A session has ended cleanly.
     End(SessionSource, Instant),
     /// A session was aborted.
     Abort(SessionSource, &'static str),
+    /// A session is likely about to start; streaming plugins may begin early.
+    /// Followed by `Start` or `CancelSpeculation`.
+    Speculate(SessionSource, Instant),
+    /// The onset announced by `Speculate` did not materialize.
+    CancelSpeculation(SessionSource),
     // Future: A long-running session has been split by a silence detector.
     // SegmentSplit(SessionSource, Instant),
 }
 
+impl SessionEvent {
+    /// The session event for a VAD event. Speech boundaries are attributed to
+    /// `source`; speculative onsets always come from the VAD.
+    pub fn from_vad(event: &VadEvent, source: SessionSource, at: Instant) -> Self {
+        match event {
+            VadEvent::SpeechStart { timestamp_ms, .. } => {
+                Self::Start(source, at, TraceId(*timestamp_ms))
+            }
+            VadEvent::SpeechEnd { .. } => Self::End(source, at),
+            VadEvent::SpeculativeStart { .. } => Self::Speculate(SessionSource::Vad, at),
+            VadEvent::SpeculativeCancel { .. } => Self::CancelSpeculation(SessionSource::Vad),
+        }
+    }
+}
+
 /// Defines the primary activation method for STT.
 #[derive(Clone, Debug, PartialEq, Eq)]
 pub enum ActivationMode {
@@ -1,6 +1,7 @@
-/// Word Error Rate (WER) calculation utilities for STT testing.
-///
-/// Centralized implementation to avoid code duplication between test files.
+//! Word Error Rate (WER) calculation for STT tests and offline evaluation.
+
+/// Word-level edit distance between `reference` and `hypothesis`, divided by
+/// the reference length.
 pub fn calculate_wer(reference: &str, hypothesis: &str) -> f64 {
     let ref_words: Vec<&str> = reference.split_whitespace().collect();
     let hyp_words: Vec<&str> = hypothesis.split_whitespace().collect();
@@ -46,6 +47,21 @@ pub fn calculate_wer(reference: &str, hypothesis: &str) -> f64 {
     dp[ref_len][hyp_len] as f64 / ref_len as f64
 }
 
+/// Lowercase `text`, drop punctuation other than apostrophes and collapse
+/// whitespace, so WER counts words rather than formatting differences.
+pub fn normalize_transcript(text: &str) -> String {
+    text.split_whitespace()
+        .map(|word| {
+            word.chars()
+                .filter(|c| c.is_alphanumeric() || *c == '\'')
+                .flat_map(char::to_lowercase)
+                .collect::<String>()
+        })
+        .filter(|word| !word.is_empty())
+        .collect::<Vec<_>>()
+        .join(" ")
+}
+
 /// Format WER as a percentage string.
 pub fn format_wer_percentage(wer: f64) -> String {
     format!("{:.1}%", wer * 100.0)
@@ -55,6 +71,15 @@ pub fn format_wer_percentage(wer: f64) -> String {
 mod tests {
     use super::*;
 
+    #[test]
+    fn test_normalize_transcript() {
+        assert_eq!(
+            normalize_transcript("Bring me the SIZE of the singer's foot."),
+            "bring me the size of the singer's foot"
+        );
+        assert_eq!(normalize_transcript("  -- Hello,   world! "), "hello world");
+    }
+
     #[test]
     fn test_calculate_wer_basic() {
         assert_eq!(calculate_wer("hello world", "hello world"), 0.0);
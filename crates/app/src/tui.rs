@@ -376,6 +376,12 @@ async fn run_app(
                                 state.last_vad_event = Some(format!("Speech END @ {}ms ({}ms, {:.1}dB)", timestamp_ms, duration_ms, energy_db));
                                 state.log(LogLevel::Info, format!("Speech ended, duration: {}ms", duration_ms));
                             }
+                            VadEvent::SpeculativeStart { timestamp_ms, probability } => {
+                                state.last_vad_event = Some(format!("Speculative START @ {}ms (p={:.2})", timestamp_ms, probability));
+                            }
+                            VadEvent::SpeculativeCancel { timestamp_ms } => {
+                                state.last_vad_event = Some(format!("Speculative CANCEL @ {}ms", timestamp_ms));
+                            }
                         }
                     }
                     AppEvent::AppReplaced(app) => {
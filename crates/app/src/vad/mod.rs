@@ -13,3 +13,5 @@ pub use coldvox_vad::{
 
 #[cfg(feature = "silero")]
 pub use coldvox_vad_silero::SileroEngine;
+
+pub use coldvox_vad_silero::{BatchedVadEngine, BatchedVadStream};
@@ -1,10 +1,9 @@
 use coldvox_audio::{
-    AudioChunker, AudioRingBuffer, ChunkerConfig, FrameReader, ResamplerQuality,
-    SharedAudioFrame as VadFrame,
+    AudioChunker, AudioRingBuffer, ChunkerConfig, Delivery, FrameBus, FrameReader,
+    ResamplerQuality, SharedAudioFrame as VadFrame,
 };
 use coldvox_telemetry::pipeline_metrics::PipelineMetrics;
 use std::sync::Arc;
-use tokio::sync::broadcast;
 
 mod common;
 use common::test_utils::feed_samples_to_ring_buffer;
@@ -22,8 +21,8 @@ async fn chunker_timestamps_are_32ms_apart_at_16k() {
         sample_rate_hz: 16_000,
         resampler_quality: ResamplerQuality::Balanced,
     };
-    let (tx, _) = broadcast::channel::<VadFrame>(64);
-    let mut rx = tx.subscribe();
+    let tx = FrameBus::<VadFrame>::new();
+    let mut rx = tx.subscribe("test", Delivery::Lossless { capacity: 64 });
     let chunker = AudioChunker::new(reader, tx.clone(), cfg).with_metrics(metrics.clone());
     let handle = chunker.spawn();
 
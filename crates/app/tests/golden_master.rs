@@ -145,6 +145,14 @@ mod tests {
                     kind: "SpeechEnd".to_string(),
                     duration_ms: Some(duration_ms),
                 },
+                VadEvent::SpeculativeStart { .. } => Self {
+                    kind: "SpeculativeStart".to_string(),
+                    duration_ms: None,
+                },
+                VadEvent::SpeculativeCancel { .. } => Self {
+                    kind: "SpeculativeCancel".to_string(),
+                    duration_ms: None,
+                },
             }
         }
     }
@@ -205,7 +213,9 @@ mod tests {
                 min_speech_duration_ms: 100, // Reduced from default 250ms
                 min_silence_duration_ms: 300, // Increased from default 100ms for cleaner end detection
                 window_size_samples: 512,
+                speculative_slope: None,
             },
+            cascade: Default::default(),
             frame_size_samples: 512,
             sample_rate_hz: 16000,
         };
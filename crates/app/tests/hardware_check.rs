@@ -39,6 +39,7 @@ mod hardware_tests {
         let config = AudioConfig {
             silence_threshold: 100,
             capture_buffer_samples: 1024,
+            ..Default::default()
         };
 
         // This is a bit tricky because AudioCapture might not expose a simple "check" method
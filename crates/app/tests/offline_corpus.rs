@@ -0,0 +1,123 @@
+//! Offline regression run over `test_data/test_*.wav`.
+//!
+//! Drives every corpus file through chunker → VAD → STT faster than real time
+//! (see `coldvox_app::offline`) and prints per-file and corpus WER plus
+//! per-stage throughput. Needs a real STT backend:
+//!
+//! ```text
+//! cargo test -p coldvox-app --features moonshine --test offline_corpus -- --nocapture
+//! ```
+//!
+//! `COLDVOX_OFFLINE_WORKERS` overrides the worker count and
+//! `COLDVOX_OFFLINE_MAX_WER` (e.g. `0.25`) fails the run above that corpus WER.
+
+#[cfg(any(feature = "moonshine", feature = "parakeet"))]
+mod tests {
+    use coldvox_app::offline::{corpus_files, run_corpus, OfflineConfig};
+    use coldvox_stt::plugin::{FailoverConfig, GcPolicy, PluginSelectionConfig};
+    use coldvox_vad::config::{SileroConfig, UnifiedVadConfig, VadMode};
+    use std::path::PathBuf;
+
+    fn config() -> OfflineConfig {
+        let preferred_plugin = if cfg!(feature = "moonshine") {
+            "moonshine"
+        } else {
+            "parakeet"
+        };
+
+        // Same VAD tuning as the golden master test for the corpus recordings
+        let vad = UnifiedVadConfig {
+            mode: VadMode::Silero,
+            silero: SileroConfig {
+                threshold: 0.5,
+                min_speech_duration_ms: 100,
+                min_silence_duration_ms: 300,
+                window_size_samples: 512,
+                speculative_slope: None,
+            },
+            cascade: Default::default(),
+            frame_size_samples: 512,
+            sample_rate_hz: 16000,
+        };
+        let stt_selection = PluginSelectionConfig {
+            preferred_plugin: Some(preferred_plugin.to_string()),
+            failover: Some(FailoverConfig::default()),
+            gc_policy: Some(GcPolicy {
+                enabled: false,
+                ..Default::default()
+            }),
+            ..Default::default()
+        };
+
+        let mut config = OfflineConfig::new(vad, stt_selection);
+        if let Some(workers) = std::env::var("COLDVOX_OFFLINE_WORKERS")
+            .ok()
+            .and_then(|v| v.parse().ok())
+        {
+            config.workers = workers;
+        }
+        config
+    }
+
+    #[test]
+    fn offline_corpus_wer_and_throughput() {
+        let _ = tracing_subscriber::fmt()
+            .with_env_filter(tracing_subscriber::EnvFilter::from_default_env())
+            .with_test_writer()
+            .try_init();
+
+        let dir = PathBuf::from(env!("CARGO_MANIFEST_DIR")).join("test_data");
+        let files = corpus_files(&dir).expect("corpus directory");
+        assert!(
+            !files.is_empty(),
+            "no test_*.wav files in {}",
+            dir.display()
+        );
+
+        let config = config();
+        let report = run_corpus(&files, &config);
+        println!("{report}");
+
+        assert!(
+            report.failures.is_empty(),
+            "offline processing failed: {:?}",
+            report.failures
+        );
+        assert_eq!(report.files.len(), files.len());
+
+        // Same files, same results: the offline pipeline is deterministic
+        let again = run_corpus(&files, &config);
+        assert_eq!(again.files.len(), report.files.len());
+        for (again, first) in again.files.iter().zip(&report.files) {
+            assert_eq!(again.path, first.path);
+            assert_eq!(
+                again.vad_events,
+                first.vad_events,
+                "{}",
+                first.path.display()
+            );
+            assert_eq!(
+                again.transcript,
+                first.transcript,
+                "{}",
+                first.path.display()
+            );
+        }
+
+        if let Some(max_wer) = std::env::var("COLDVOX_OFFLINE_MAX_WER")
+            .ok()
+            .and_then(|v| v.parse::<f64>().ok())
+        {
+            let wer = report.wer().expect("corpus has reference transcripts");
+            assert!(wer <= max_wer, "corpus WER {wer:.3} above {max_wer}");
+        }
+    }
+}
+
+#[cfg(not(any(feature = "moonshine", feature = "parakeet")))]
+#[test]
+fn offline_corpus_wer_and_throughput() {
+    eprintln!(
+        "Skipping offline corpus run: no real STT backend feature enabled (requires `moonshine` or `parakeet`)."
+    );
+}
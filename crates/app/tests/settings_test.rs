@@ -131,6 +131,42 @@ fn test_settings_from_path_rejects_invalid_remote_values() {
     );
 }
 
+#[test]
+fn test_settings_vad_mode_selects_cascade() {
+    let config_file = write_temp_config(
+        r#"
+            [vad]
+            mode = "cascade"
+
+            [vad.cascade]
+            gate_margin_db = 9.0
+            initial_floor_db = -55.0
+            ema_alpha = 0.05
+        "#,
+    );
+
+    let settings = Settings::from_path(config_file.path()).expect("load cascade config");
+    let vad = settings.runtime_vad_config();
+    assert_eq!(vad.mode, coldvox_vad::VadMode::Cascade);
+    assert_eq!(vad.cascade.gate_margin_db, 9.0);
+    assert_eq!(vad.cascade.initial_floor_db, -55.0);
+    // The runtime's tuned Silero settings are kept
+    assert_eq!(vad.silero.min_silence_duration_ms, 500);
+
+    let default = Settings::from_path(get_test_config_path()).expect("load default config");
+    assert_eq!(
+        default.runtime_vad_config().mode,
+        coldvox_vad::VadMode::Silero
+    );
+
+    let bad = write_temp_config("[vad]\nmode = \"webrtc\"\n");
+    let err = Settings::from_path(bad.path()).expect_err("reject unknown VAD mode");
+    assert!(
+        err.contains("VAD mode 'webrtc' must be one of silero, cascade"),
+        "unexpected error: {err}"
+    );
+}
+
 #[test]
 #[ignore]
 fn test_settings_new_invalid_env_var_deserial() {
@@ -1,6 +1,17 @@
-use coldvox_audio_quality::{AudioQualityMonitor, LevelMonitor, QualityConfig, SpectralAnalyzer};
+use coldvox_audio_quality::{
+    AudioQualityMonitor, FrameFeatures, LevelMonitor, QualityConfig, SpectralAnalyzer,
+};
 use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion};
 use std::hint::black_box;
+use std::time::{Duration, Instant};
+
+/// Required speedup of the single-pass path over the previous implementation.
+const MIN_SPEEDUP: f64 = 4.0;
+
+/// Whether an opt-in switch is set to something other than empty or `0`.
+fn env_flag(name: &str) -> bool {
+    std::env::var(name).is_ok_and(|v| !v.is_empty() && v != "0")
+}
 
 /// Generate test signal at specific amplitude
 fn generate_signal(samples: usize, amplitude: f32) -> Vec<i16> {
@@ -88,12 +99,147 @@ fn bench_frame_budget_compliance(c: &mut Criterion) {
     });
 }
 
+/// The per-frame features as computed before the single-pass rewrite: one
+/// f64 loop per level statistic and a freshly planned, allocating FFT.
+mod baseline {
+    use spectrum_analyzer::scaling::divide_by_N;
+    use spectrum_analyzer::{samples_fft_to_spectrum, FrequencyLimit, FrequencySpectrum};
+
+    pub fn features(samples: &[i16], buffer: &mut Vec<f32>) -> (f32, f32, f32) {
+        let mean_square = (samples
+            .iter()
+            .map(|&s| (s as f64 / 32768.0).powi(2))
+            .sum::<f64>()
+            / samples.len() as f64) as f32;
+        let peak = samples
+            .iter()
+            .map(|&s| s.unsigned_abs() as f32 / 32768.0)
+            .fold(0.0f32, f32::max);
+
+        buffer.clear();
+        buffer.extend(samples.iter().take(2048).map(|&s| s as f32 / 32768.0));
+        let spectrum =
+            samples_fft_to_spectrum(buffer, 16000, FrequencyLimit::All, Some(&divide_by_N))
+                .expect("power-of-two frame");
+        let mid = band(&spectrum, 500.0, 2000.0);
+        let ratio = if mid < 1e-10 {
+            0.0
+        } else {
+            band(&spectrum, 4000.0, 8000.0) / mid
+        };
+        (mean_square, peak, ratio)
+    }
+
+    fn band(spectrum: &FrequencySpectrum, start: f32, end: f32) -> f32 {
+        let (sum, count) = spectrum
+            .data()
+            .iter()
+            .filter(|(f, _)| f.val() >= start && f.val() <= end)
+            .fold((0.0, 0), |(sum, count), (_, v)| {
+                (sum + v.val() * v.val(), count + 1)
+            });
+        if count == 0 {
+            0.0
+        } else {
+            sum / count as f32
+        }
+    }
+}
+
+fn single_pass_features(analyzer: &mut SpectralAnalyzer, samples: &[i16]) -> (f32, f32, f32) {
+    // In the pipeline the chunker measures the features; count it here so
+    // both sides still read the samples for levels and spectrum
+    let features = FrameFeatures::measure(samples);
+    analyzer.load_frame(samples);
+    analyzer.detect_loaded();
+    (
+        (features.mean_square() / (32768.0 * 32768.0)) as f32,
+        features.peak as f32 / 32768.0,
+        analyzer.last_spectral_ratio(),
+    )
+}
+
+fn bench_single_pass_vs_baseline(c: &mut Criterion) {
+    let mut group = c.benchmark_group("single_pass_vs_baseline");
+
+    for size in [512, 1024, 2048].iter() {
+        let samples = generate_signal(*size, 0.5);
+        let mut buffer = Vec::with_capacity(2048);
+        let mut analyzer = SpectralAnalyzer::new(16000, 0.3);
+
+        group.bench_with_input(BenchmarkId::new("baseline", size), &samples, |b, s| {
+            b.iter(|| baseline::features(black_box(s), &mut buffer))
+        });
+        group.bench_with_input(BenchmarkId::new("single_pass", size), &samples, |b, s| {
+            b.iter(|| single_pass_features(&mut analyzer, black_box(s)))
+        });
+    }
+
+    group.finish();
+}
+
+/// Time both paths back to back at every frame size. A result that differs
+/// from the baseline always fails the run; a speedup below `MIN_SPEEDUP`
+/// only with `COLDVOX_BENCH_ENFORCE_SPEEDUP=1`, since wall time on a shared
+/// machine is too noisy to gate by default.
+fn bench_speedup_gate(_c: &mut Criterion) {
+    fn time(mut f: impl FnMut()) -> Duration {
+        for _ in 0..100 {
+            f();
+        }
+        let start = Instant::now();
+        for _ in 0..2000 {
+            f();
+        }
+        start.elapsed()
+    }
+
+    let enforce = env_flag("COLDVOX_BENCH_ENFORCE_SPEEDUP");
+    let mut slow = Vec::new();
+    for size in [512, 1024, 2048] {
+        let samples = generate_signal(size, 0.5);
+        let mut buffer = Vec::with_capacity(2048);
+        let mut analyzer = SpectralAnalyzer::new(16000, 0.3);
+
+        let old = baseline::features(&samples, &mut buffer);
+        let new = single_pass_features(&mut analyzer, &samples);
+        assert!((old.0 - new.0).abs() <= 1e-6 && old.1 == new.1);
+        assert!((old.2 - new.2).abs() <= 1e-3 * old.2.abs().max(1e-6));
+
+        let baseline = time(|| {
+            black_box(baseline::features(black_box(&samples), &mut buffer));
+        });
+        let single_pass = time(|| {
+            black_box(single_pass_features(&mut analyzer, black_box(&samples)));
+        });
+        let speedup = baseline.as_secs_f64() / single_pass.as_secs_f64();
+        println!("speedup_gate/{size}: {speedup:.1}x (baseline {baseline:?}, single pass {single_pass:?} per 2000 frames)");
+        if speedup < MIN_SPEEDUP {
+            slow.push(format!("{speedup:.1}x at {size} samples"));
+        }
+    }
+
+    if slow.is_empty() {
+        return;
+    }
+    let message = format!(
+        "single pass below {MIN_SPEEDUP}x faster than baseline: {}",
+        slow.join(", ")
+    );
+    if enforce {
+        panic!("{message}");
+    }
+    println!("speedup_gate: {message} (set COLDVOX_BENCH_ENFORCE_SPEEDUP=1 to fail)");
+}
+
 criterion_group!(
     benches,
     bench_rms_calculation,
     bench_peak_detection,
     bench_spectral_analysis,
     bench_full_analysis,
-    bench_frame_budget_compliance
+    bench_frame_budget_compliance,
+    bench_single_pass_vs_baseline,
+    bench_speedup_gate
 );
 criterion_main!(benches);
@@ -0,0 +1,56 @@
+//! Per-frame spectral kernels.
+//!
+//! Level statistics are not measured here: they come from
+//! [`FrameFeatures`](coldvox_audio::FrameFeatures), which the chunker computes
+//! once per frame. The loops keep `LANES` independent accumulators so the
+//! compiler turns them into SIMD code on every target without `unsafe` or
+//! runtime dispatch.
+
+use realfft::num_complex::Complex32;
+
+const LANES: usize = 16;
+
+/// Write `samples` to `out` as `[-1.0, 1.0)` floats (the FFT input). `out`
+/// must be `samples.len()` long.
+pub fn to_unit_floats(samples: &[i16], out: &mut [f32]) {
+    debug_assert_eq!(samples.len(), out.len());
+    let scale = 1.0 / 32768.0;
+    for (d, &s) in out.iter_mut().zip(samples) {
+        *d = s as f32 * scale;
+    }
+}
+
+/// Sum of `|X|²` over `bins`.
+pub fn band_energy(bins: &[Complex32]) -> f32 {
+    let mut acc = [0.0f32; LANES];
+    let chunks = bins.chunks_exact(LANES);
+    let tail = chunks.remainder();
+    for chunk in chunks {
+        for i in 0..LANES {
+            acc[i] += chunk[i].re * chunk[i].re + chunk[i].im * chunk[i].im;
+        }
+    }
+    acc.iter().sum::<f32>() + tail.iter().map(|c| c.re * c.re + c.im * c.im).sum::<f32>()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn unit_floats_scale_full_range() {
+        let samples = [i16::MIN, -16384, 0, 16384, i16::MAX];
+        let mut out = [0.0; 5];
+        to_unit_floats(&samples, &mut out);
+        assert_eq!(out[..4], [-1.0, -0.5, 0.0, 0.5]);
+        assert!(out[4] < 1.0);
+    }
+
+    #[test]
+    fn band_energy_sums_power() {
+        let bins: Vec<Complex32> = (0..37).map(|i| Complex32::new(i as f32, 1.0)).collect();
+        let expected: f32 = bins.iter().map(|c| c.norm_sqr()).sum();
+        assert!((band_energy(&bins) - expected).abs() < 1e-3 * expected);
+        assert_eq!(band_energy(&[]), 0.0);
+    }
+}
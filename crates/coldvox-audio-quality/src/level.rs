@@ -1,5 +1,6 @@
 //! Level monitoring: RMS and peak calculation with rolling windows.
 
+use coldvox_audio::FrameFeatures;
 use std::collections::VecDeque;
 
 /// Monitors audio levels (RMS and peak) with rolling windows.
@@ -64,9 +65,28 @@ impl LevelMonitor {
     ///
     /// Returns the current RMS level in dBFS.
     pub fn update_rms(&mut self, samples: &[i16]) -> f32 {
-        // Calculate mean-square for this frame
-        let frame_mean_square = Self::calculate_frame_mean_square(samples);
+        self.push_mean_square(Self::calculate_frame_mean_square(samples))
+    }
 
+    /// Update peak detection with new audio frame.
+    ///
+    /// Returns the current peak level in dBFS.
+    pub fn update_peak(&mut self, samples: &[i16]) -> f32 {
+        self.push_peak(Self::calculate_frame_peak(samples))
+    }
+
+    /// Update RMS and peak from a frame's features (measured once by the
+    /// chunker, see `SharedAudioFrame::features`).
+    ///
+    /// Returns `(rms_dbfs, peak_dbfs)`.
+    pub fn update(&mut self, features: &FrameFeatures) -> (f32, f32) {
+        (
+            self.push_mean_square(Self::mean_square(features)),
+            self.push_peak(Self::peak_linear(features)),
+        )
+    }
+
+    fn push_mean_square(&mut self, frame_mean_square: f32) -> f32 {
         // Add to rolling window
         self.rms_window.push_back(frame_mean_square);
         if self.rms_window.len() > self.rms_window_capacity {
@@ -89,13 +109,7 @@ impl LevelMonitor {
         Self::linear_to_dbfs(avg_rms)
     }
 
-    /// Update peak detection with new audio frame.
-    ///
-    /// Returns the current peak level in dBFS.
-    pub fn update_peak(&mut self, samples: &[i16]) -> f32 {
-        // Find peak in this frame
-        let frame_peak = Self::calculate_frame_peak(samples);
-
+    fn push_peak(&mut self, frame_peak: f32) -> f32 {
         // Update peak with hold
         if frame_peak > self.current_peak_linear {
             // New peak detected
@@ -133,20 +147,7 @@ impl LevelMonitor {
     /// Mean-square = mean(x²)
     /// Used for RMS rolling window calculation (mathematically correct).
     fn calculate_frame_mean_square(samples: &[i16]) -> f32 {
-        if samples.is_empty() {
-            return 0.0;
-        }
-
-        let sum_squares: f64 = samples
-            .iter()
-            .map(|&s| {
-                // Convert to [-1.0, 1.0] range
-                let normalized = s as f64 / 32768.0;
-                normalized * normalized
-            })
-            .sum();
-
-        (sum_squares / samples.len() as f64) as f32
+        Self::mean_square(&FrameFeatures::measure(samples))
     }
 
     /// Calculate RMS for a single frame of samples.
@@ -160,14 +161,17 @@ impl LevelMonitor {
 
     /// Calculate peak for a single frame of samples.
     fn calculate_frame_peak(samples: &[i16]) -> f32 {
-        samples
-            .iter()
-            .map(|&s| {
-                // Convert to [0.0, 1.0] range (absolute value)
-                // Use unsigned_abs() to avoid i16::MIN overflow (-32768)
-                (s.unsigned_abs() as f32) / 32768.0
-            })
-            .fold(0.0f32, f32::max)
+        Self::peak_linear(&FrameFeatures::measure(samples))
+    }
+
+    /// Mean of the squared samples, normalized to full scale.
+    fn mean_square(features: &FrameFeatures) -> f32 {
+        (features.mean_square() / (32768.0 * 32768.0)) as f32
+    }
+
+    /// Peak as a linear amplitude in `[0, 1]`.
+    fn peak_linear(features: &FrameFeatures) -> f32 {
+        features.peak as f32 / 32768.0
     }
 
     /// Convert linear amplitude [0, 1] to dBFS [-∞, 0].
@@ -29,22 +29,27 @@
 //! # Performance
 //!
 //! All analysis is designed to run in < 1ms for typical frame sizes (512 samples @ 16kHz).
-//! - RMS calculation: ~10 microseconds
-//! - Peak detection: ~5 microseconds
-//! - FFT (512-point): ~500 microseconds
-//! - Total overhead: ~0.5ms (1.6% of 32ms frame budget)
+//! In the pipeline, [`AudioQualityMonitor::analyze_frame`] takes RMS and peak
+//! from the [`FrameFeatures`] the chunker already measured, so the samples are
+//! only read again to fill the FFT input. The real-input FFT runs on a plan
+//! and buffers cached per frame size, so steady-state frames do not allocate.
+//! `benches/audio_quality_benchmarks.rs` compares this path against the
+//! previous per-feature loops and per-frame FFT planning.
 
 pub mod config;
+pub mod kernels;
 pub mod level;
 pub mod spectral;
 pub mod types;
 
 // Re-export main types
+pub use coldvox_audio::FrameFeatures;
 pub use config::QualityConfig;
 pub use level::LevelMonitor;
 pub use spectral::SpectralAnalyzer;
 pub use types::{QualityStatus, QualityWarning};
 
+use coldvox_audio::SharedAudioFrame;
 use std::time::Instant;
 
 /// Main audio quality monitor that combines level and spectral analysis.
@@ -87,9 +92,21 @@ impl AudioQualityMonitor {
     ///
     /// Current quality status with optional warning message.
     pub fn analyze(&mut self, samples: &[i16]) -> QualityStatus {
-        // Update level metrics
-        let rms_dbfs = self.level_monitor.update_rms(samples);
-        let peak_dbfs = self.level_monitor.update_peak(samples);
+        self.analyze_with_features(samples, &FrameFeatures::measure(samples))
+    }
+
+    /// [`analyze`](Self::analyze) a pipeline frame, reusing the levels the
+    /// chunker measured instead of rescanning the samples.
+    pub fn analyze_frame(&mut self, frame: &SharedAudioFrame) -> QualityStatus {
+        self.analyze_with_features(&frame.samples, &frame.features)
+    }
+
+    fn analyze_with_features(
+        &mut self,
+        samples: &[i16],
+        features: &FrameFeatures,
+    ) -> QualityStatus {
+        let (rms_dbfs, peak_dbfs) = self.level_monitor.update(features);
 
         // Check level-based conditions
         if peak_dbfs >= self.config.clipping_threshold_dbfs {
@@ -101,14 +118,14 @@ impl AudioQualityMonitor {
         }
 
         // Spectral analysis for off-axis detection (only if level is good)
-        if self.config.enable_off_axis_detection {
-            let is_off_axis = self.spectral_analyzer.detect_off_axis(samples);
-            if is_off_axis {
-                let ratio = self.spectral_analyzer.last_spectral_ratio();
-                return QualityStatus::Warning(QualityWarning::OffAxis {
-                    spectral_ratio: ratio,
-                });
-            }
+        if self.config.enable_off_axis_detection
+            && SpectralAnalyzer::accepts(samples.len())
+            && self.spectral_analyzer.detect_off_axis(samples)
+        {
+            let ratio = self.spectral_analyzer.last_spectral_ratio();
+            return QualityStatus::Warning(QualityWarning::OffAxis {
+                spectral_ratio: ratio,
+            });
         }
 
         // All checks passed
@@ -1,9 +1,103 @@
 //! Spectral analysis for off-axis detection.
-
-use spectrum_analyzer::scaling::divide_by_N;
-use spectrum_analyzer::{samples_fft_to_spectrum, FrequencyLimit, FrequencySpectrum};
+//!
+//! Frames go through a real-input FFT whose plan, input, spectrum and scratch
+//! buffers are created once per frame size and reused, and band energies are
+//! summed over bin ranges precomputed with the plan. After the first frame of
+//! a given size the hot path does not allocate.
+
+use crate::kernels::{band_energy, to_unit_floats};
+use realfft::num_complex::Complex32;
+use realfft::{RealFftPlanner, RealToComplex};
+use std::ops::Range;
+use std::sync::Arc;
 use tracing;
 
+/// Frames shorter than this are too coarse for the band split.
+pub const MIN_FFT_LEN: usize = 512;
+/// Longer frames are analyzed over their first `MAX_FFT_LEN` samples.
+pub const MAX_FFT_LEN: usize = 2048;
+
+/// Frame sizes whose plans are kept. Callers use one or two sizes; the oldest
+/// plan is dropped beyond this.
+const MAX_PLANS: usize = 4;
+
+// Frequency bands for the spectral ratio (inclusive)
+const HIGH_FREQ_START: f32 = 4000.0; // 4 kHz
+const HIGH_FREQ_END: f32 = 8000.0; // 8 kHz
+const MID_FREQ_START: f32 = 500.0; // 500 Hz
+const MID_FREQ_END: f32 = 2000.0; // 2 kHz
+
+/// FFT plan and buffers for one frame size.
+struct FramePlan {
+    fft: Arc<dyn RealToComplex<f32>>,
+    input: Vec<f32>,
+    spectrum: Vec<Complex32>,
+    scratch: Vec<Complex32>,
+    high_band: Range<usize>,
+    mid_band: Range<usize>,
+}
+
+impl FramePlan {
+    fn new(planner: &mut RealFftPlanner<f32>, len: usize, sample_rate: u32) -> Self {
+        let fft = planner.plan_fft_forward(len);
+        let input = fft.make_input_vec();
+        let spectrum = fft.make_output_vec();
+        let scratch = fft.make_scratch_vec();
+        let resolution = sample_rate as f32 / len as f32;
+        let band = |start: f32, end: f32| {
+            let bins = 0..spectrum.len();
+            let first = bins
+                .clone()
+                .find(|&k| k as f32 * resolution >= start)
+                .unwrap_or(spectrum.len());
+            let last = bins
+                .take_while(|&k| k as f32 * resolution <= end)
+                .last()
+                .map_or(0, |k| k + 1);
+            first..last.max(first)
+        };
+        Self {
+            high_band: band(HIGH_FREQ_START, HIGH_FREQ_END),
+            mid_band: band(MID_FREQ_START, MID_FREQ_END),
+            fft,
+            input,
+            spectrum,
+            scratch,
+        }
+    }
+
+    fn len(&self) -> usize {
+        self.input.len()
+    }
+
+    /// Transform `input` into `spectrum`. Clobbers `input`.
+    fn process(&mut self) -> bool {
+        match self
+            .fft
+            .process_with_scratch(&mut self.input, &mut self.spectrum, &mut self.scratch)
+        {
+            Ok(()) => true,
+            Err(e) => {
+                tracing::debug!(
+                    error = ?e,
+                    sample_count = self.input.len(),
+                    "FFT computation failed, skipping off-axis detection for this frame"
+                );
+                false
+            }
+        }
+    }
+
+    /// Average energy of the bins in `band`, with magnitudes scaled by 1/N.
+    fn average_energy(&self, band: &Range<usize>) -> f32 {
+        if band.is_empty() {
+            return 0.0;
+        }
+        let n = self.len() as f32;
+        band_energy(&self.spectrum[band.clone()]) / (n * n) / band.len() as f32
+    }
+}
+
 /// Spectral analyzer for detecting off-axis audio via frequency analysis.
 ///
 /// When a speaker moves off-axis from a cardioid microphone, high frequencies
@@ -13,8 +107,9 @@ pub struct SpectralAnalyzer {
     sample_rate: u32,
     off_axis_threshold: f32,
     last_spectral_ratio: f32,
-    /// Pre-allocated buffer for i16 → f32 conversion (real-time safe, no allocations)
-    conversion_buffer: Vec<f32>,
+    planner: RealFftPlanner<f32>,
+    /// Most recently used first.
+    plans: Vec<FramePlan>,
 }
 
 impl SpectralAnalyzer {
@@ -25,18 +120,20 @@ impl SpectralAnalyzer {
     /// * `sample_rate` - Sample rate in Hz
     /// * `off_axis_threshold` - Spectral ratio threshold for off-axis detection (default: 0.3)
     pub fn new(sample_rate: u32, off_axis_threshold: f32) -> Self {
-        // Pre-allocate conversion buffer (up to 2048 samples)
-        // This avoids allocations in the hot path (detect_off_axis)
-        let conversion_buffer = Vec::with_capacity(2048);
-
         Self {
             sample_rate,
             off_axis_threshold,
             last_spectral_ratio: 1.0, // Start with neutral ratio
-            conversion_buffer,
+            planner: RealFftPlanner::new(),
+            plans: Vec::with_capacity(MAX_PLANS),
         }
     }
 
+    /// Whether a frame of `len` samples is long enough for off-axis detection.
+    pub fn accepts(len: usize) -> bool {
+        len >= MIN_FFT_LEN
+    }
+
     /// Detect if audio is off-axis by analyzing frequency spectrum.
     ///
     /// Returns `true` if speaker appears to be off-axis from the microphone.
@@ -54,18 +151,33 @@ impl SpectralAnalyzer {
     /// 5. If ratio < threshold (0.3), classify as off-axis
     pub fn detect_off_axis(&mut self, samples: &[i16]) -> bool {
         // Need at least 512 samples for meaningful FFT
-        if samples.len() < 512 {
+        if !Self::accepts(samples.len()) {
             return false;
         }
+        self.load_frame(samples);
+        self.detect_loaded()
+    }
 
-        // Compute frequency spectrum
-        let spectrum = match self.compute_spectrum(samples) {
-            Some(s) => s,
-            None => return false,
-        };
+    /// Convert up to [`MAX_FFT_LEN`] samples into the FFT input for
+    /// [`detect_loaded`](Self::detect_loaded). `samples` must satisfy
+    /// [`accepts`](Self::accepts).
+    pub fn load_frame(&mut self, samples: &[i16]) {
+        debug_assert!(Self::accepts(samples.len()));
+        let head = &samples[..samples.len().min(MAX_FFT_LEN)];
+        let plan = self.plan(head.len());
+        to_unit_floats(head, &mut plan.input);
+    }
 
-        // Calculate spectral ratio
-        self.last_spectral_ratio = self.calculate_spectral_ratio(&spectrum);
+    /// Run off-axis detection on the frame passed to the last
+    /// [`load_frame`](Self::load_frame).
+    pub fn detect_loaded(&mut self) -> bool {
+        let Some(plan) = self.plans.first_mut() else {
+            return false;
+        };
+        if !plan.process() {
+            return false;
+        }
+        self.last_spectral_ratio = Self::spectral_ratio(plan);
 
         // Threshold-based classification
         // Ratio below threshold indicates significant high-frequency rolloff (off-axis)
@@ -79,84 +191,47 @@ impl SpectralAnalyzer {
         self.last_spectral_ratio
     }
 
-    /// Compute frequency spectrum from audio samples.
-    ///
-    /// **Real-time safe:** Uses pre-allocated buffer, no allocations on hot path.
-    fn compute_spectrum(&mut self, samples: &[i16]) -> Option<FrequencySpectrum> {
-        // Reuse pre-allocated buffer for conversion (real-time safe, no allocation)
-        self.conversion_buffer.clear();
-
-        // Convert i16 samples to f32 for FFT
-        // Note: If samples.len() > capacity, this will allocate once, then reuse
-        for &sample in samples.iter().take(2048) {
-            self.conversion_buffer.push(sample as f32 / 32768.0);
-        }
-
-        // Compute FFT
-        let samples_for_fft = &self.conversion_buffer[..];
-
-        match samples_fft_to_spectrum(
-            samples_for_fft,
-            self.sample_rate,
-            FrequencyLimit::All,
-            Some(&divide_by_N),
-        ) {
-            Ok(spectrum) => Some(spectrum),
-            Err(e) => {
-                tracing::debug!(
-                    error = ?e,
-                    sample_count = samples_for_fft.len(),
-                    "FFT computation failed, skipping off-axis detection for this frame"
-                );
-                None
+    /// The cached plan for `len`, moved to the front.
+    fn plan(&mut self, len: usize) -> &mut FramePlan {
+        match self.plans.iter().position(|plan| plan.len() == len) {
+            Some(0) => {}
+            Some(i) => self.plans[..=i].rotate_right(1),
+            None => {
+                tracing::debug!(fft_len = len, "Planning FFT for new frame size");
+                self.plans.truncate(MAX_PLANS - 1);
+                let plan = FramePlan::new(&mut self.planner, len, self.sample_rate);
+                self.plans.insert(0, plan);
             }
         }
+        &mut self.plans[0]
     }
 
     /// Calculate spectral ratio: high_freq_energy / mid_freq_energy.
     ///
     /// High-freq band: 4-8kHz (consonants, sibilants)
     /// Mid-freq band: 500Hz-2kHz (fundamental speech frequencies)
-    fn calculate_spectral_ratio(&self, spectrum: &FrequencySpectrum) -> f32 {
-        // Define frequency bands
-        const HIGH_FREQ_START: f32 = 4000.0; // 4 kHz
-        const HIGH_FREQ_END: f32 = 8000.0; // 8 kHz
-        const MID_FREQ_START: f32 = 500.0; // 500 Hz
-        const MID_FREQ_END: f32 = 2000.0; // 2 kHz
-
-        // Calculate average energy in each band
-        let high_freq_energy =
-            Self::average_energy_in_band(spectrum, HIGH_FREQ_START, HIGH_FREQ_END);
-
-        let mid_freq_energy = Self::average_energy_in_band(spectrum, MID_FREQ_START, MID_FREQ_END);
+    fn spectral_ratio(plan: &FramePlan) -> f32 {
+        let high_freq_energy = plan.average_energy(&plan.high_band);
+        let mid_freq_energy = plan.average_energy(&plan.mid_band);
 
         // Avoid division by zero
         if mid_freq_energy < 1e-10 {
             return 0.0; // Silence or very quiet
         }
 
-        // Calculate ratio
         high_freq_energy / mid_freq_energy
     }
 
-    /// Calculate average energy in a frequency band.
-    fn average_energy_in_band(spectrum: &FrequencySpectrum, start_hz: f32, end_hz: f32) -> f32 {
-        let mut sum = 0.0;
-        let mut count = 0;
-
-        for (freq, val) in spectrum.data().iter() {
-            if freq.val() >= start_hz && freq.val() <= end_hz {
-                // Use magnitude squared (energy)
-                sum += val.val() * val.val();
-                count += 1;
-            }
-        }
-
-        if count == 0 {
-            0.0
-        } else {
-            sum / count as f32
-        }
+    /// Frequency of the strongest bin of the last analyzed frame.
+    #[cfg(test)]
+    fn peak_frequency(&self) -> Option<f32> {
+        let plan = self.plans.first()?;
+        let (bin, _) = plan
+            .spectrum
+            .iter()
+            .enumerate()
+            .max_by(|a, b| a.1.norm_sqr().total_cmp(&b.1.norm_sqr()))?;
+        Some(bin as f32 * self.sample_rate as f32 / plan.len() as f32)
     }
 }
 
@@ -203,13 +278,12 @@ mod tests {
         // Generate 1kHz sine wave
         let samples = generate_sine_wave(1000.0, 16000, 1024);
 
-        let spectrum = analyzer.compute_spectrum(&samples);
-        assert!(spectrum.is_some());
+        analyzer.load_frame(&samples);
+        analyzer.detect_loaded();
 
-        let spectrum = spectrum.unwrap();
         // Should have peak around 1kHz
-        let peak_freq = spectrum.max();
-        assert!(peak_freq.0.val() > 900.0 && peak_freq.0.val() < 1100.0);
+        let peak_freq = analyzer.peak_frequency().unwrap();
+        assert!(peak_freq > 900.0 && peak_freq < 1100.0);
     }
 
     #[test]
@@ -285,6 +359,56 @@ mod tests {
         assert!(!is_off_axis);
     }
 
+    #[test]
+    fn test_ratio_matches_reference_dft() {
+        let noise = generate_white_noise(512);
+        let n = noise.len();
+        let band_average = |start: f32, end: f32| {
+            let (mut sum, mut count) = (0.0f64, 0);
+            for k in 0..=n / 2 {
+                let freq = k as f32 * (16000.0 / n as f32);
+                if freq < start || freq > end {
+                    continue;
+                }
+                let (mut re, mut im) = (0.0f64, 0.0f64);
+                for (t, &s) in noise.iter().enumerate() {
+                    let phase = -2.0 * std::f64::consts::PI * (k * t) as f64 / n as f64;
+                    re += s as f64 / 32768.0 * phase.cos();
+                    im += s as f64 / 32768.0 * phase.sin();
+                }
+                sum += (re * re + im * im) / (n * n) as f64;
+                count += 1;
+            }
+            sum / count as f64
+        };
+        let expected = band_average(4000.0, 8000.0) / band_average(500.0, 2000.0);
+
+        let mut analyzer = SpectralAnalyzer::new(16000, 0.3);
+        analyzer.detect_off_axis(&noise);
+        let ratio = analyzer.last_spectral_ratio() as f64;
+        assert!(
+            (ratio - expected).abs() < 1e-3 * expected,
+            "ratio {ratio}, expected {expected}"
+        );
+    }
+
+    #[test]
+    fn test_plans_are_cached_per_frame_size() {
+        let mut analyzer = SpectralAnalyzer::new(16000, 0.3);
+        let noise = generate_white_noise(4096);
+
+        analyzer.detect_off_axis(&noise[..1024]);
+        let input = analyzer.plans[0].input.as_ptr();
+        analyzer.detect_off_axis(&noise[..512]);
+        analyzer.detect_off_axis(&noise[1024..2048]);
+        assert_eq!(analyzer.plans.len(), 2);
+        assert_eq!(analyzer.plans[0].input.as_ptr(), input);
+
+        // Long frames reuse the largest plan
+        analyzer.load_frame(&noise);
+        assert_eq!(analyzer.plans[0].len(), MAX_FFT_LEN);
+    }
+
     #[test]
     fn test_mixed_frequencies() {
         let mut analyzer = SpectralAnalyzer::new(16000, 0.3);
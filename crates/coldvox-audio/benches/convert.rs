@@ -0,0 +1,104 @@
+use coldvox_audio::convert::Kernel;
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use std::hint::black_box;
+
+/// 10 ms at 48 kHz, the typical USB array callback size.
+const FRAMES: usize = 480;
+
+fn test_signal(len: usize) -> Vec<i16> {
+    (0..len)
+        .map(|i| ((i as f32 * 0.05).sin() * 20_000.0) as i16)
+        .collect()
+}
+
+/// The chunker's previous per-frame iterator downmix.
+fn legacy_downmix(input: &[i16], channels: usize) -> Vec<i16> {
+    input
+        .chunks_exact(channels)
+        .map(|chunk| {
+            let sum: i32 = chunk.iter().map(|&s| s as i32).sum();
+            (sum / channels as i32) as i16
+        })
+        .collect()
+}
+
+fn bench_downmix(c: &mut Criterion) {
+    for channels in [2usize, 4, 6, 8] {
+        let mut group = c.benchmark_group(format!("downmix_{channels}ch"));
+        group.throughput(Throughput::Elements(FRAMES as u64));
+        let input = test_signal(FRAMES * channels);
+        let mut out = vec![0i16; FRAMES];
+
+        group.bench_function("legacy", |b| {
+            b.iter(|| legacy_downmix(black_box(&input), channels))
+        });
+        for kernel in Kernel::supported() {
+            group.bench_with_input(
+                BenchmarkId::from_parameter(kernel.name()),
+                &input,
+                |b, i| b.iter(|| kernel.downmix_i16(black_box(i), channels, &mut out)),
+            );
+        }
+        group.finish();
+    }
+}
+
+fn bench_f32_to_i16(c: &mut Criterion) {
+    let mut group = c.benchmark_group("f32_to_i16");
+    let input: Vec<f32> = test_signal(FRAMES * 2)
+        .iter()
+        .map(|&s| s as f32 / 32768.0)
+        .collect();
+    group.throughput(Throughput::Elements(input.len() as u64));
+    let mut out = vec![0i16; input.len()];
+
+    // Previous capture callback: per-sample clamp/round pushed into a reused Vec
+    let mut legacy = Vec::with_capacity(input.len());
+    group.bench_function("legacy", |b| {
+        b.iter(|| {
+            legacy.clear();
+            legacy.extend(
+                black_box(&input)
+                    .iter()
+                    .map(|&s| (s.clamp(-1.0, 1.0) * 32767.0).round() as i16),
+            );
+        })
+    });
+    for kernel in Kernel::supported() {
+        group.bench_with_input(
+            BenchmarkId::from_parameter(kernel.name()),
+            &input,
+            |b, i| b.iter(|| kernel.f32_to_i16(black_box(i), &mut out)),
+        );
+    }
+    group.finish();
+}
+
+fn bench_u16_to_i16(c: &mut Criterion) {
+    let mut group = c.benchmark_group("u16_to_i16");
+    let input: Vec<u16> = test_signal(FRAMES * 2)
+        .iter()
+        .map(|&s| (s as i32 + 32768) as u16)
+        .collect();
+    group.throughput(Throughput::Elements(input.len() as u64));
+    let mut out = vec![0i16; input.len()];
+
+    let mut legacy = Vec::with_capacity(input.len());
+    group.bench_function("legacy", |b| {
+        b.iter(|| {
+            legacy.clear();
+            legacy.extend(black_box(&input).iter().map(|&s| (s as i32 - 32768) as i16));
+        })
+    });
+    for kernel in Kernel::supported() {
+        group.bench_with_input(
+            BenchmarkId::from_parameter(kernel.name()),
+            &input,
+            |b, i| b.iter(|| kernel.u16_to_i16(black_box(i), &mut out)),
+        );
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_downmix, bench_f32_to_i16, bench_u16_to_i16);
+criterion_main!(benches);
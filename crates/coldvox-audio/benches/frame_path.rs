@@ -0,0 +1,172 @@
+use coldvox_audio::capture::AudioFrame;
+use coldvox_audio::{AudioRingBuffer, FramePool, FrameReader};
+use criterion::{criterion_group, criterion_main, Criterion};
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::collections::VecDeque;
+use std::hint::black_box;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::Arc;
+
+/// Counts heap allocations so each path can report allocations per frame.
+struct CountingAlloc;
+
+static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+
+unsafe impl GlobalAlloc for CountingAlloc {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.alloc(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        System.dealloc(ptr, layout)
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+        System.realloc(ptr, layout, new_size)
+    }
+}
+
+#[global_allocator]
+static GLOBAL: CountingAlloc = CountingAlloc;
+
+const FRAME: usize = 512;
+const READ: usize = 4096;
+/// Frames the consumer side keeps alive, like the broadcast channel's backlog.
+const IN_FLIGHT: usize = 16;
+
+fn setup() -> (coldvox_audio::ring_buffer::AudioProducer, FrameReader) {
+    let rb = AudioRingBuffer::new(READ * 2);
+    let (prod, cons) = rb.split();
+    (prod, FrameReader::new(cons, 16_000, 1, READ * 2, None))
+}
+
+/// The pre-pool path: fresh read buffer, VecDeque staging, Vec -> Arc copy.
+fn legacy_path(
+    prod: &mut coldvox_audio::ring_buffer::AudioProducer,
+    reader: &mut FrameReader,
+    staging: &mut VecDeque<i16>,
+    held: &mut VecDeque<Arc<[i16]>>,
+    input: &[i16],
+) {
+    prod.write(input).unwrap();
+    if let Some(frame) = reader.read_frame(READ) {
+        staging.extend(frame.samples);
+    }
+    while staging.len() >= FRAME {
+        let mut out = Vec::with_capacity(FRAME);
+        for _ in 0..FRAME {
+            out.push(staging.pop_front().unwrap());
+        }
+        held.push_back(Arc::from(out));
+        if held.len() > IN_FLIGHT {
+            held.pop_front();
+        }
+    }
+}
+
+/// The pooled path: reused read buffer copied straight into recycled frames.
+fn pooled_path(
+    prod: &mut coldvox_audio::ring_buffer::AudioProducer,
+    reader: &mut FrameReader,
+    read_buf: &mut AudioFrame,
+    pool: &mut FramePool,
+    held: &mut VecDeque<Arc<[i16]>>,
+    input: &[i16],
+) {
+    prod.write(input).unwrap();
+    if reader.read_frame_into(READ, read_buf) {
+        for chunk in read_buf.samples.chunks_exact(FRAME) {
+            let mut slot = pool.acquire();
+            Arc::get_mut(&mut slot).unwrap().copy_from_slice(chunk);
+            pool.release(&slot);
+            held.push_back(slot);
+            if held.len() > IN_FLIGHT {
+                held.pop_front();
+            }
+        }
+    }
+}
+
+fn report(label: &str, mut step: impl FnMut()) {
+    // Warm up pools and buffers before counting
+    for _ in 0..64 {
+        step();
+    }
+    let iters = 1000u64;
+    let before = ALLOCATIONS.load(Ordering::Relaxed);
+    for _ in 0..iters {
+        step();
+    }
+    let allocs = ALLOCATIONS.load(Ordering::Relaxed) - before;
+    let frames = iters * (READ / FRAME) as u64;
+    println!(
+        "{label}: {:.3} allocations per frame",
+        allocs as f64 / frames as f64
+    );
+}
+
+fn bench_frame_path(c: &mut Criterion) {
+    let input = vec![1i16; READ];
+    let mut group = c.benchmark_group("frame_path");
+
+    {
+        let (mut prod, mut reader) = setup();
+        let mut staging = VecDeque::with_capacity(FRAME * 4);
+        let mut held = VecDeque::with_capacity(IN_FLIGHT + 1);
+        report("legacy", || {
+            legacy_path(&mut prod, &mut reader, &mut staging, &mut held, &input)
+        });
+        group.bench_function("legacy", |b| {
+            b.iter(|| {
+                legacy_path(
+                    &mut prod,
+                    &mut reader,
+                    &mut staging,
+                    &mut held,
+                    black_box(&input),
+                )
+            })
+        });
+    }
+
+    {
+        let (mut prod, mut reader) = setup();
+        let mut read_buf = AudioFrame {
+            samples: Vec::with_capacity(READ),
+            timestamp: std::time::Instant::now(),
+            sample_rate: 0,
+            channels: 0,
+        };
+        let mut pool = FramePool::new(FRAME, IN_FLIGHT * 2);
+        let mut held = VecDeque::with_capacity(IN_FLIGHT + 1);
+        report("pooled", || {
+            pooled_path(
+                &mut prod,
+                &mut reader,
+                &mut read_buf,
+                &mut pool,
+                &mut held,
+                &input,
+            )
+        });
+        group.bench_function("pooled", |b| {
+            b.iter(|| {
+                pooled_path(
+                    &mut prod,
+                    &mut reader,
+                    &mut read_buf,
+                    &mut pool,
+                    &mut held,
+                    black_box(&input),
+                )
+            })
+        });
+    }
+
+    group.finish();
+}
+
+criterion_group!(benches, bench_frame_path);
+criterion_main!(benches);
@@ -0,0 +1,61 @@
+use coldvox_audio::{ResamplerQuality, StreamResampler};
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use std::hint::black_box;
+
+/// 10 ms device callbacks, one second of audio per iteration.
+fn stereo_signal(rate: u32) -> Vec<i16> {
+    (0..rate as usize)
+        .flat_map(|i| {
+            let s = ((i as f32 * 0.02).sin() * 12_000.0) as i16;
+            [s, s / 2]
+        })
+        .collect()
+}
+
+fn bench_resample(c: &mut Criterion) {
+    for in_rate in [48_000u32, 44_100] {
+        let mut group = c.benchmark_group(format!("resample_{}k_stereo", in_rate / 1000));
+        group.throughput(Throughput::Elements(in_rate as u64));
+        let input = stereo_signal(in_rate);
+        let chunk = (in_rate / 100) as usize * 2;
+        let mut out = Vec::with_capacity(20_000);
+
+        for (name, q) in [
+            ("fast", ResamplerQuality::Fast),
+            ("balanced", ResamplerQuality::Balanced),
+            ("quality", ResamplerQuality::Quality),
+        ] {
+            // Previous path: separate downmix pass, then Rubato on mono
+            let mut rubato = StreamResampler::new_rubato(in_rate, 16_000, q);
+            let mut mono = Vec::with_capacity(chunk / 2);
+            group.bench_function(BenchmarkId::new("rubato", name), |b| {
+                b.iter(|| {
+                    out.clear();
+                    for c in black_box(&input).chunks(chunk) {
+                        mono.clear();
+                        mono.extend(
+                            c.chunks_exact(2)
+                                .map(|f| ((f[0] as i32 + f[1] as i32) / 2) as i16),
+                        );
+                        rubato.process_into(&mono, &mut out);
+                    }
+                })
+            });
+
+            let mut poly = StreamResampler::new_with_quality(in_rate, 16_000, q);
+            assert!(poly.is_polyphase());
+            group.bench_function(BenchmarkId::new("polyphase_fused", name), |b| {
+                b.iter(|| {
+                    out.clear();
+                    for c in black_box(&input).chunks(chunk) {
+                        poly.process_interleaved_into(c, 2, &mut out);
+                    }
+                })
+            });
+        }
+        group.finish();
+    }
+}
+
+criterion_group!(benches, bench_resample);
+criterion_main!(benches);
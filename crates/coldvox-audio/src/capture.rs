@@ -7,6 +7,7 @@ use std::sync::Arc;
 use std::thread::{self, JoinHandle};
 use std::time::{Duration, Instant};
 
+use super::convert;
 use super::detector::SilenceDetector;
 use super::device::DeviceManager;
 use super::monitor::DeviceMonitor;
@@ -14,7 +15,7 @@ use super::monitor::DeviceMonitor;
 
 use super::ring_buffer::AudioProducer;
 use super::watchdog::WatchdogTimer;
-use coldvox_foundation::{AudioConfig, AudioError, DeviceEvent};
+use coldvox_foundation::{AudioConfig, AudioError, CaptureMode, DeviceEvent};
 
 // This remains the primary data structure for audio data.
 pub struct AudioCapture {
@@ -23,6 +24,8 @@ pub struct AudioCapture {
     audio_producer: Arc<Mutex<AudioProducer>>,
     watchdog: WatchdogTimer,
     silence_detector: SilenceDetector,
+    silence_threshold: i16,
+    capture_mode: CaptureMode,
     stats: Arc<CaptureStats>,
     running: Arc<AtomicBool>,
     restart_needed: Arc<AtomicBool>,
@@ -43,6 +46,7 @@ pub struct AudioCaptureThread {
     pub handle: JoinHandle<()>,
     pub shutdown: Arc<AtomicBool>,
     pub device_monitor_handle: Option<JoinHandle<()>>,
+    pub stats: Arc<CaptureStats>,
 }
 
 impl AudioCaptureThread {
@@ -88,13 +92,17 @@ impl AudioCaptureThread {
             (None, None)
         };
 
+        let stats = Arc::new(CaptureStats::default());
+        let stats_clone = stats.clone();
+
         let handle = thread::Builder::new()
             .name("audio-capture".to_string())
             .spawn(move || {
                 let mut monitor_rx = monitor_rx_opt;
                 let mut capture = match AudioCapture::new(config, audio_producer, running.clone()) {
                     Ok(c) => c.with_config_channel(config_tx_clone)
-                              .with_device_event_channel(device_event_tx_clone),
+                              .with_device_event_channel(device_event_tx_clone)
+                              .with_stats(stats_clone),
                     Err(e) => {
                         tracing::error!("Failed to create AudioCapture: {}", e);
                         return;
@@ -279,6 +287,7 @@ impl AudioCaptureThread {
                 handle,
                 shutdown,
                 device_monitor_handle: monitor_handle,
+                stats,
             },
             cfg,
             config_rx,
@@ -303,7 +312,7 @@ pub struct AudioFrame {
     pub channels: u16,
 }
 
-#[derive(Debug, Default)]
+#[derive(Debug)]
 pub struct CaptureStats {
     pub frames_captured: AtomicU64,
     pub frames_dropped: AtomicU64,
@@ -311,7 +320,130 @@ pub struct CaptureStats {
     pub reconnections: AtomicU64,
     pub active_frames: AtomicU64,
     pub silent_frames: AtomicU64,
-    pub last_frame_time: Arc<RwLock<Option<Instant>>>,
+    /// Callbacks served by the [`CaptureMode::RealTime`] path (no locks, no allocations).
+    pub lock_free_callbacks: AtomicU64,
+    /// Callbacks served by the [`CaptureMode::Shared`] path, each of which takes the
+    /// producer and detector locks. Stays at zero in real-time mode.
+    pub locking_callbacks: AtomicU64,
+    epoch: Instant,
+    /// Nanoseconds since `epoch` of the last callback; 0 = none yet.
+    last_frame_nanos: AtomicU64,
+}
+
+impl Default for CaptureStats {
+    fn default() -> Self {
+        Self {
+            frames_captured: AtomicU64::new(0),
+            frames_dropped: AtomicU64::new(0),
+            disconnections: AtomicU64::new(0),
+            reconnections: AtomicU64::new(0),
+            active_frames: AtomicU64::new(0),
+            silent_frames: AtomicU64::new(0),
+            lock_free_callbacks: AtomicU64::new(0),
+            locking_callbacks: AtomicU64::new(0),
+            epoch: Instant::now(),
+            last_frame_nanos: AtomicU64::new(0),
+        }
+    }
+}
+
+impl CaptureStats {
+    fn mark_frame(&self) {
+        let nanos = self.epoch.elapsed().as_nanos().clamp(1, u64::MAX as u128) as u64;
+        self.last_frame_nanos.store(nanos, Ordering::Relaxed);
+    }
+
+    /// Time of the most recent capture callback, if any.
+    pub fn last_frame_time(&self) -> Option<Instant> {
+        match self.last_frame_nanos.load(Ordering::Relaxed) {
+            0 => None,
+            nanos => Some(self.epoch + Duration::from_nanos(nanos)),
+        }
+    }
+}
+
+/// Exclusive loan of the shared producer to a real-time callback.
+///
+/// Taking and returning the producer each lock the shared slot once, at stream
+/// build and stream drop. While the loan is out the slot holds a detached
+/// producer, so any other writer sees overflow rather than contending with the
+/// audio thread.
+struct ProducerLease {
+    producer: AudioProducer,
+    home: Arc<Mutex<AudioProducer>>,
+}
+
+impl ProducerLease {
+    fn take(home: Arc<Mutex<AudioProducer>>) -> Self {
+        let producer = std::mem::replace(&mut *home.lock(), AudioProducer::detached());
+        Self { producer, home }
+    }
+}
+
+impl Drop for ProducerLease {
+    fn drop(&mut self) {
+        std::mem::swap(&mut *self.home.lock(), &mut self.producer);
+    }
+}
+
+/// Callback state for [`CaptureMode::RealTime`]: owned by the cpal closure,
+/// touches only atomics and the leased producer.
+struct RealtimeSink {
+    lease: ProducerLease,
+    stats: Arc<CaptureStats>,
+    watchdog: WatchdogTimer,
+    running: Arc<AtomicBool>,
+    silence_threshold: i16,
+}
+
+impl RealtimeSink {
+    fn process<T: Copy>(&mut self, data: &[T], convert: impl Fn(&[T], &mut [i16]) -> usize) {
+        if !self.running.load(Ordering::SeqCst) {
+            return;
+        }
+        self.watchdog.feed();
+
+        // Measure energy on the converted (cache-hot) samples for silence detection.
+        let mut sum_sq: i64 = 0;
+        let written = self.lease.producer.write_with(data, |src, dst| {
+            convert(src, dst);
+            sum_sq += sum_squares(dst);
+        });
+        if written.is_ok() {
+            self.stats.frames_captured.fetch_add(1, Ordering::Relaxed);
+        } else {
+            // Nothing was converted; convert through a stack buffer for the stats.
+            let mut scratch = [0i16; 256];
+            sum_sq = data
+                .chunks(scratch.len())
+                .map(|src| {
+                    let n = convert(src, &mut scratch);
+                    sum_squares(&scratch[..n])
+                })
+                .sum();
+            self.stats.frames_dropped.fetch_add(1, Ordering::Relaxed);
+        }
+
+        if SilenceDetector::rms_below(sum_sq, data.len(), self.silence_threshold) {
+            self.stats.silent_frames.fetch_add(1, Ordering::Relaxed);
+        } else {
+            self.stats.active_frames.fetch_add(1, Ordering::Relaxed);
+        }
+        self.stats
+            .lock_free_callbacks
+            .fetch_add(1, Ordering::Relaxed);
+        self.stats.mark_frame();
+    }
+}
+
+#[inline]
+fn sum_squares(samples: &[i16]) -> i64 {
+    samples.iter().map(|&v| v as i64 * v as i64).sum()
+}
+
+fn copy_i16(src: &[i16], dst: &mut [i16]) -> usize {
+    dst.copy_from_slice(src);
+    src.len()
 }
 
 impl AudioCapture {
@@ -326,6 +458,8 @@ impl AudioCapture {
             audio_producer,
             watchdog: WatchdogTimer::new(Duration::from_secs(5)),
             silence_detector: SilenceDetector::new(config.silence_threshold),
+            silence_threshold: config.silence_threshold,
+            capture_mode: config.capture_mode,
             stats: Arc::new(CaptureStats::default()),
             running,
             restart_needed: Arc::new(AtomicBool::new(false)),
@@ -375,6 +509,11 @@ impl AudioCapture {
         self
     }
 
+    pub fn with_stats(mut self, stats: Arc<CaptureStats>) -> Self {
+        self.stats = stats;
+        self
+    }
+
     fn start(&mut self, device_name: Option<&str>) -> Result<DeviceConfig, AudioError> {
         self.running.store(true, Ordering::SeqCst);
 
@@ -412,6 +551,10 @@ impl AudioCapture {
         config: StreamConfig,
         sample_format: SampleFormat,
     ) -> Result<Stream, AudioError> {
+        if self.capture_mode == CaptureMode::RealTime {
+            return self.build_realtime_stream(device, config, sample_format);
+        }
+
         let audio_producer = Arc::clone(&self.audio_producer);
         let stats = Arc::clone(&self.stats);
         let watchdog = self.watchdog.clone();
@@ -431,6 +574,7 @@ impl AudioCapture {
                 return;
             }
             watchdog.feed();
+            stats.locking_callbacks.fetch_add(1, Ordering::Relaxed);
             let mut det = detector.write();
             if det.is_silence(i16_data) {
                 stats.silent_frames.fetch_add(1, Ordering::Relaxed);
@@ -448,7 +592,7 @@ impl AudioCapture {
             } else {
                 stats.frames_dropped.fetch_add(1, Ordering::Relaxed);
             }
-            *stats.last_frame_time.write() = Some(Instant::now());
+            stats.mark_frame();
         };
 
         // Build the CPAL input stream with proper conversion to i16
@@ -472,18 +616,9 @@ impl AudioCapture {
                 move |data: &[f32], _: &_| {
                     CONVERT_BUFFER.with(|buf| {
                         let mut converted = buf.borrow_mut();
-                        converted.clear();
-                        // Ensure sufficient capacity (resize only on first call per thread)
-                        let needed = data.len();
-                        let cap = converted.capacity();
-                        if cap < needed {
-                            converted.reserve(needed - cap);
-                        }
-                        for &s in data {
-                            let clamped = s.clamp(-1.0, 1.0);
-                            let v = (clamped * 32767.0).round() as i16;
-                            converted.push(v);
-                        }
+                        // Grows only on first use per thread (or a larger buffer)
+                        converted.resize(data.len(), 0);
+                        convert::f32_to_i16(data, &mut converted);
                         handle_i16(&converted);
                     });
                 },
@@ -495,17 +630,9 @@ impl AudioCapture {
                 move |data: &[u16], _: &_| {
                     CONVERT_BUFFER.with(|buf| {
                         let mut converted = buf.borrow_mut();
-                        converted.clear();
-                        // Ensure sufficient capacity (resize only on first call per thread)
-                        let needed = data.len();
-                        let cap = converted.capacity();
-                        if cap < needed {
-                            converted.reserve(needed - cap);
-                        }
-                        for &s in data {
-                            let v = (s as i32 - 32768) as i16;
-                            converted.push(v);
-                        }
+                        // Grows only on first use per thread (or a larger buffer)
+                        converted.resize(data.len(), 0);
+                        convert::u16_to_i16(data, &mut converted);
                         handle_i16(&converted);
                     });
                 },
@@ -517,18 +644,9 @@ impl AudioCapture {
                 move |data: &[u32], _: &_| {
                     CONVERT_BUFFER.with(|buf| {
                         let mut converted = buf.borrow_mut();
-                        converted.clear();
-                        // Ensure sufficient capacity (resize only on first call per thread)
-                        let needed = data.len();
-                        let cap = converted.capacity();
-                        if cap < needed {
-                            converted.reserve(needed - cap);
-                        }
-                        for &s in data {
-                            let centered = s as i64 - 2_147_483_648i64;
-                            let v = (centered >> 16) as i16;
-                            converted.push(v);
-                        }
+                        // Grows only on first use per thread (or a larger buffer)
+                        converted.resize(data.len(), 0);
+                        convert::u32_to_i16(data, &mut converted);
                         handle_i16(&converted);
                     });
                 },
@@ -540,18 +658,9 @@ impl AudioCapture {
                 move |data: &[f64], _: &_| {
                     CONVERT_BUFFER.with(|buf| {
                         let mut converted = buf.borrow_mut();
-                        converted.clear();
-                        // Ensure sufficient capacity (resize only on first call per thread)
-                        let needed = data.len();
-                        let cap = converted.capacity();
-                        if cap < needed {
-                            converted.reserve(needed - cap);
-                        }
-                        for &s in data {
-                            let clamped = s.clamp(-1.0, 1.0);
-                            let v = (clamped * 32767.0).round() as i16;
-                            converted.push(v);
-                        }
+                        // Grows only on first use per thread (or a larger buffer)
+                        converted.resize(data.len(), 0);
+                        convert::f64_to_i16(data, &mut converted);
                         handle_i16(&converted);
                     });
                 },
@@ -568,6 +677,70 @@ impl AudioCapture {
         Ok(stream)
     }
 
+    /// Build a stream for [`CaptureMode::RealTime`]. The callback owns the producer
+    /// for the stream's lifetime and converts each device buffer directly into
+    /// the ring buffer's write chunk.
+    fn build_realtime_stream(
+        &mut self,
+        device: cpal::Device,
+        config: StreamConfig,
+        sample_format: SampleFormat,
+    ) -> Result<Stream, AudioError> {
+        let mut sink = RealtimeSink {
+            lease: ProducerLease::take(Arc::clone(&self.audio_producer)),
+            stats: Arc::clone(&self.stats),
+            watchdog: self.watchdog.clone(),
+            running: Arc::clone(&self.running),
+            silence_threshold: self.silence_threshold,
+        };
+        let restart_needed = Arc::clone(&self.restart_needed);
+
+        let err_fn = move |err: cpal::StreamError| {
+            tracing::error!("Audio stream error: {}", err);
+            restart_needed.store(true, Ordering::SeqCst);
+        };
+
+        let stream = match sample_format {
+            SampleFormat::I16 => device.build_input_stream(
+                &config,
+                move |data: &[i16], _: &_| sink.process(data, copy_i16),
+                err_fn,
+                None,
+            )?,
+            SampleFormat::F32 => device.build_input_stream(
+                &config,
+                move |data: &[f32], _: &_| sink.process(data, convert::f32_to_i16),
+                err_fn,
+                None,
+            )?,
+            SampleFormat::U16 => device.build_input_stream(
+                &config,
+                move |data: &[u16], _: &_| sink.process(data, convert::u16_to_i16),
+                err_fn,
+                None,
+            )?,
+            SampleFormat::U32 => device.build_input_stream(
+                &config,
+                move |data: &[u32], _: &_| sink.process(data, convert::u32_to_i16),
+                err_fn,
+                None,
+            )?,
+            SampleFormat::F64 => device.build_input_stream(
+                &config,
+                move |data: &[f64], _: &_| sink.process(data, convert::f64_to_i16),
+                err_fn,
+                None,
+            )?,
+            other => {
+                return Err(AudioError::FormatNotSupported {
+                    format: format!("{:?}", other),
+                });
+            }
+        };
+
+        Ok(stream)
+    }
+
     fn negotiate_config(
         &self,
         device: &cpal::Device,
@@ -605,6 +778,71 @@ impl AudioCapture {
     }
 }
 
+#[cfg(test)]
+mod realtime_tests {
+    use super::*;
+    use crate::ring_buffer::AudioRingBuffer;
+
+    fn sink_for(home: &Arc<Mutex<AudioProducer>>, stats: &Arc<CaptureStats>) -> RealtimeSink {
+        RealtimeSink {
+            lease: ProducerLease::take(Arc::clone(home)),
+            stats: Arc::clone(stats),
+            watchdog: WatchdogTimer::new(Duration::from_secs(5)),
+            running: Arc::new(AtomicBool::new(true)),
+            silence_threshold: 100,
+        }
+    }
+
+    #[test]
+    fn realtime_sink_converts_into_ring() {
+        let (producer, mut consumer) = AudioRingBuffer::new(64).split();
+        let home = Arc::new(Mutex::new(producer));
+        let stats = Arc::new(CaptureStats::default());
+        let mut sink = sink_for(&home, &stats);
+
+        sink.process(&[0.5f32, -0.5, 1.0, -1.0], convert::f32_to_i16);
+        sink.process(&[0.0f32; 4], convert::f32_to_i16);
+
+        let mut out = [0i16; 8];
+        assert_eq!(consumer.read(&mut out), 8);
+        assert_eq!(&out[..4], &[16384, -16384, 32767, -32767]);
+        assert_eq!(stats.frames_captured.load(Ordering::Relaxed), 2);
+        assert_eq!(stats.active_frames.load(Ordering::Relaxed), 1);
+        assert_eq!(stats.silent_frames.load(Ordering::Relaxed), 1);
+        assert_eq!(stats.lock_free_callbacks.load(Ordering::Relaxed), 2);
+        assert_eq!(stats.locking_callbacks.load(Ordering::Relaxed), 0);
+        assert!(stats.last_frame_time().is_some());
+    }
+
+    #[test]
+    fn realtime_sink_counts_overflow() {
+        let (producer, _consumer) = AudioRingBuffer::new(4).split();
+        let home = Arc::new(Mutex::new(producer));
+        let stats = Arc::new(CaptureStats::default());
+        let mut sink = sink_for(&home, &stats);
+
+        sink.process(&[i16::MAX; 8], copy_i16);
+        assert_eq!(stats.frames_dropped.load(Ordering::Relaxed), 1);
+        assert_eq!(stats.active_frames.load(Ordering::Relaxed), 1);
+    }
+
+    #[test]
+    fn lease_returns_producer_on_drop() {
+        let (producer, mut consumer) = AudioRingBuffer::new(16).split();
+        let home = Arc::new(Mutex::new(producer));
+        let stats = Arc::new(CaptureStats::default());
+
+        let sink = sink_for(&home, &stats);
+        // While leased the shared slot is detached
+        assert!(home.lock().write(&[1, 2]).is_err());
+        drop(sink);
+
+        assert!(home.lock().write(&[1, 2]).is_ok());
+        let mut out = [0i16; 2];
+        assert_eq!(consumer.read(&mut out), 2);
+    }
+}
+
 #[cfg(test)]
 mod convert_tests {
     // unit tests for sample format conversions
@@ -1,11 +1,14 @@
-use std::collections::VecDeque;
 use std::sync::atomic::{AtomicBool, Ordering};
 use std::sync::Arc;
 use tokio::sync::broadcast;
 use tokio::task::JoinHandle;
-use tokio::time::{self, Duration};
+use tokio::time::Duration;
 
-use super::capture::DeviceConfig;
+use super::capture::{AudioFrame as CaptureFrame, DeviceConfig};
+use super::convert;
+use super::features::FrameFeatures;
+use super::frame_bus::FrameBus;
+use super::frame_pool::FramePool;
 use super::frame_reader::FrameReader;
 use super::resampler::StreamResampler;
 use crate::SharedAudioFrame;
@@ -32,6 +35,16 @@ pub struct ChunkerConfig {
     pub resampler_quality: ResamplerQuality,
 }
 
+/// Upper bound on one idle wait, so device config updates and the running flag
+/// are still observed when no audio arrives.
+const MAX_IDLE_WAIT: Duration = Duration::from_millis(100);
+
+/// Most device samples taken from the ring per read.
+const READ_CHUNK_SAMPLES: usize = 4096;
+
+/// Output frames the pool tracks for reuse; covers what subscribers queue.
+const FRAME_POOL_SLOTS: usize = 256;
+
 impl Default for ChunkerConfig {
     fn default() -> Self {
         Self {
@@ -44,17 +57,18 @@ impl Default for ChunkerConfig {
 
 pub struct AudioChunker {
     frame_reader: FrameReader,
-    output_tx: broadcast::Sender<SharedAudioFrame>,
+    output_tx: FrameBus<SharedAudioFrame>,
     cfg: ChunkerConfig,
     running: Arc<AtomicBool>,
     metrics: Option<Arc<PipelineMetrics>>,
     device_cfg_rx: Option<broadcast::Receiver<DeviceConfig>>,
+    wake_watermark: Option<usize>,
 }
 
 impl AudioChunker {
     pub fn new(
         frame_reader: FrameReader,
-        output_tx: broadcast::Sender<SharedAudioFrame>,
+        output_tx: FrameBus<SharedAudioFrame>,
         cfg: ChunkerConfig,
     ) -> Self {
         Self {
@@ -64,6 +78,7 @@ impl AudioChunker {
             running: Arc::new(AtomicBool::new(false)),
             metrics: None,
             device_cfg_rx: None,
+            wake_watermark: None,
         }
     }
 
@@ -77,6 +92,33 @@ impl AudioChunker {
         self
     }
 
+    /// Wake the chunker once this many device samples (interleaved) are buffered.
+    ///
+    /// By default the watermark tracks frame boundaries: the chunker sleeps until
+    /// the ring holds enough input to complete its next output frame.
+    pub fn with_wake_watermark(mut self, samples: usize) -> Self {
+        self.wake_watermark = Some(samples);
+        self
+    }
+
+    /// Drive the chunker from the caller instead of a task, e.g. to process
+    /// recorded audio faster than real time. No device config updates are
+    /// applied; the reader's initial config is used.
+    pub fn into_inline(self) -> InlineChunker {
+        let mut worker = ChunkerWorker::new(
+            self.frame_reader,
+            self.output_tx,
+            self.cfg,
+            self.metrics,
+            None,
+        );
+        worker.wake_watermark = self.wake_watermark;
+        InlineChunker {
+            worker,
+            frame: empty_read_frame(),
+        }
+    }
+
     pub fn spawn(self) -> JoinHandle<()> {
         let mut worker = ChunkerWorker::new(
             self.frame_reader,
@@ -85,6 +127,7 @@ impl AudioChunker {
             self.metrics,
             self.device_cfg_rx,
         );
+        worker.wake_watermark = self.wake_watermark;
         self.running.store(true, Ordering::SeqCst);
         let running = self.running.clone();
 
@@ -94,11 +137,49 @@ impl AudioChunker {
     }
 }
 
+/// A chunker run synchronously by its owner. See [`AudioChunker::into_inline`].
+pub struct InlineChunker {
+    worker: ChunkerWorker,
+    frame: CaptureFrame,
+}
+
+impl InlineChunker {
+    /// Drain everything currently in the ring, sending each completed frame
+    /// before returning; never waits on subscribers. Returns the number of
+    /// frames emitted; a partial frame stays pending until the next call.
+    pub fn pump(&mut self) -> usize {
+        let fs = self.worker.cfg.frame_size_samples as u64;
+        let before = self.worker.samples_emitted / fs;
+        while self
+            .worker
+            .frame_reader
+            .read_frame_into(READ_CHUNK_SAMPLES, &mut self.frame)
+        {
+            self.worker.handle_read(&self.frame);
+        }
+        (self.worker.samples_emitted / fs - before) as usize
+    }
+}
+
+fn empty_read_frame() -> CaptureFrame {
+    CaptureFrame {
+        samples: Vec::with_capacity(READ_CHUNK_SAMPLES),
+        timestamp: std::time::Instant::now(),
+        sample_rate: 0,
+        channels: 0,
+    }
+}
+
 struct ChunkerWorker {
     frame_reader: FrameReader,
-    output_tx: broadcast::Sender<SharedAudioFrame>,
+    output_tx: FrameBus<SharedAudioFrame>,
     cfg: ChunkerConfig,
-    buffer: VecDeque<i16>,
+    // Output frames are filled in place in pooled buffers
+    pool: FramePool,
+    pending: Option<Arc<[i16]>>,
+    pending_len: usize,
+    // Reused per-read buffer for downmixed/resampled output
+    scratch: Vec<i16>,
     samples_emitted: u64,
     metrics: Option<Arc<PipelineMetrics>>,
     capture_fps_tracker: FpsTracker,
@@ -109,12 +190,15 @@ struct ChunkerWorker {
     current_input_channels: Option<u16>,
     device_cfg_rx: Option<broadcast::Receiver<DeviceConfig>>,
     start_time: std::time::Instant,
+    // When the last capture read happened, stamped on the frames it completes
+    last_read_at: std::time::Instant,
+    wake_watermark: Option<usize>,
 }
 
 impl ChunkerWorker {
     fn new(
         frame_reader: FrameReader,
-        output_tx: broadcast::Sender<SharedAudioFrame>,
+        output_tx: FrameBus<SharedAudioFrame>,
         cfg: ChunkerConfig,
         metrics: Option<Arc<PipelineMetrics>>,
         device_cfg_rx: Option<broadcast::Receiver<DeviceConfig>>,
@@ -123,8 +207,11 @@ impl ChunkerWorker {
         Self {
             frame_reader,
             output_tx,
+            pool: FramePool::new(cfg.frame_size_samples, FRAME_POOL_SLOTS),
             cfg,
-            buffer: VecDeque::with_capacity(cap),
+            pending: None,
+            pending_len: 0,
+            scratch: Vec::with_capacity(cap),
             samples_emitted: 0,
             metrics,
             capture_fps_tracker: FpsTracker::new(),
@@ -134,11 +221,14 @@ impl ChunkerWorker {
             current_input_channels: None,
             device_cfg_rx,
             start_time: std::time::Instant::now(),
+            last_read_at: std::time::Instant::now(),
+            wake_watermark: None,
         }
     }
 
     async fn run(&mut self, running: Arc<AtomicBool>) {
         tracing::info!("Audio chunker started");
+        let mut frame = empty_read_frame();
 
         while running.load(Ordering::SeqCst) {
             // Apply device config updates if any
@@ -148,84 +238,140 @@ impl ChunkerWorker {
                         .update_device_config(cfg.sample_rate, cfg.channels);
                 }
             }
-            if let Some(frame) = self.frame_reader.read_frame(4096) {
-                if let Some(m) = &self.metrics {
-                    m.increment_capture_frames();
-                    if let Some(fps) = self.capture_fps_tracker.tick() {
-                        m.update_capture_fps(fps);
-                    }
-                    m.update_audio_level(&frame.samples);
-                    m.mark_stage_active(PipelineStage::Capture);
+            if self
+                .frame_reader
+                .read_frame_into(READ_CHUNK_SAMPLES, &mut frame)
+            {
+                self.handle_read(&frame);
+            } else {
+                // Park until the capture side crosses the fill watermark instead of
+                // polling, so a frame is picked up as soon as it is complete.
+                let watermark = self.next_wake_watermark();
+                let signaled = self
+                    .frame_reader
+                    .wait_for_samples(watermark, MAX_IDLE_WAIT)
+                    .await;
+                if let (Some(at), Some(m)) = (signaled, &self.metrics) {
+                    m.record_capture_to_chunker_handoff(at.elapsed());
                 }
+            }
+        }
 
-                // Check if device configuration has changed
-                if self.current_input_rate != Some(frame.sample_rate)
-                    || self.current_input_channels != Some(frame.channels)
-                {
-                    self.reconfigure_for_device(&frame);
-                }
+        tracing::info!("Audio chunker stopped");
+    }
 
-                // Process the frame (resampling and channel conversion)
-                let processed_samples = self.process_frame(&frame);
-                self.buffer.extend(processed_samples);
-                self.flush_ready_frames().await;
-            } else {
-                // Sleep for 25ms when no data available. At 16kHz with 512-sample chunks,
-                // new chunks arrive every 32ms. Polling at 40Hz (25ms) ensures we check
-                // at least once per chunk period while reducing CPU usage by ~96% compared
-                // to 1ms polling. Could use event-driven design in future, but this works well.
-                time::sleep(Duration::from_millis(25)).await;
+    /// Account for one capture read and turn it into output frames.
+    fn handle_read(&mut self, frame: &CaptureFrame) {
+        self.last_read_at = std::time::Instant::now();
+        if let Some(m) = &self.metrics {
+            m.increment_capture_frames();
+            if let Some(fps) = self.capture_fps_tracker.tick() {
+                m.update_capture_fps(fps);
             }
+            m.mark_stage_active(PipelineStage::Capture);
         }
 
-        tracing::info!("Audio chunker stopped");
+        // Check if device configuration has changed
+        if self.current_input_rate != Some(frame.sample_rate)
+            || self.current_input_channels != Some(frame.channels)
+        {
+            self.reconfigure_for_device(frame);
+        }
+
+        self.ingest(frame);
+    }
+
+    /// Downmix/resample one capture read and copy it into pooled output frames.
+    fn ingest(&mut self, frame: &CaptureFrame) {
+        if frame.channels == 1 && self.resampler.is_none() {
+            self.push_samples(&frame.samples);
+            return;
+        }
+        let mut out = std::mem::take(&mut self.scratch);
+        out.clear();
+        self.process_frame_into(frame, &mut out);
+        self.push_samples(&out);
+        self.scratch = out;
     }
 
-    async fn flush_ready_frames(&mut self) {
+    fn push_samples(&mut self, mut samples: &[i16]) {
         let fs = self.cfg.frame_size_samples;
-        while self.buffer.len() >= fs {
-            let mut out = Vec::with_capacity(fs);
-            for _ in 0..fs {
-                out.push(self.buffer.pop_front().unwrap());
+        while !samples.is_empty() {
+            let mut slot = match self.pending.take() {
+                Some(slot) => slot,
+                None => self.pool.acquire(),
+            };
+            let n = (fs - self.pending_len).min(samples.len());
+            // Freshly acquired or still pending, so never shared
+            let buf = Arc::get_mut(&mut slot).expect("pending frame is uniquely owned");
+            buf[self.pending_len..self.pending_len + n].copy_from_slice(&samples[..n]);
+            self.pending_len += n;
+            samples = &samples[n..];
+
+            if self.pending_len == fs {
+                self.pending_len = 0;
+                self.emit_frame(slot);
+            } else {
+                self.pending = Some(slot);
             }
+        }
+    }
 
-            // Calculate timestamp based on samples emitted
-            let timestamp_ms =
-                (self.samples_emitted as u128 * 1000 / self.cfg.sample_rate_hz as u128) as u64;
-            let timestamp = self.start_time + std::time::Duration::from_millis(timestamp_ms);
-
-            // Convert Vec<i16> to Arc<[i16]> without extra copying
-            let samples_arc: Arc<[i16]> = Arc::from(out);
-            let vf = SharedAudioFrame {
-                samples: samples_arc,
-                sample_rate: self.cfg.sample_rate_hz,
-                timestamp,
-            };
+    fn emit_frame(&mut self, samples: Arc<[i16]>) {
+        let fs = samples.len();
+        self.pool.release(&samples);
+        let features = FrameFeatures::measure(&samples);
 
-            // A send on a broadcast channel can fail if there are no receivers.
-            // This is not a critical error for us; it just means no one is listening.
-            match self.output_tx.send(vf) {
-                Ok(num_receivers) => {
-                    tracing::trace!("Chunker: Frame sent to {} receivers", num_receivers);
-                }
-                Err(_) => {
-                    tracing::warn!("No active listeners for audio frames.");
-                }
-            }
+        // Calculate timestamp based on samples emitted
+        let timestamp_ms =
+            (self.samples_emitted as u128 * 1000 / self.cfg.sample_rate_hz as u128) as u64;
+        let timestamp = self.start_time + std::time::Duration::from_millis(timestamp_ms);
 
-            self.samples_emitted += fs as u64;
+        let vf = SharedAudioFrame {
+            samples,
+            sample_rate: self.cfg.sample_rate_hz,
+            timestamp,
+            read_at: self.last_read_at,
+            emitted_at: std::time::Instant::now(),
+            features,
+        };
 
-            if let Some(m) = &self.metrics {
-                m.increment_chunker_frames();
-                if let Some(fps) = self.chunker_fps_tracker.tick() {
-                    m.update_chunker_fps(fps);
-                }
-                m.mark_stage_active(PipelineStage::Chunker);
+        // No subscribers is not a critical error; it just means no one is listening
+        match self.output_tx.send(vf) {
+            0 => tracing::warn!("No active listeners for audio frames."),
+            n => tracing::trace!("Chunker: Frame sent to {} subscribers", n),
+        }
+
+        self.samples_emitted += fs as u64;
+
+        if let Some(m) = &self.metrics {
+            m.increment_chunker_frames();
+            m.record_audio_level(features.peak, features.mean_square());
+            if let Some(fps) = self.chunker_fps_tracker.tick() {
+                m.update_chunker_fps(fps);
             }
+            m.mark_stage_active(PipelineStage::Chunker);
         }
     }
 
-    fn reconfigure_for_device(&mut self, frame: &super::capture::AudioFrame) {
+    /// Device samples (interleaved) needed before the next output frame can be
+    /// completed, or the configured fixed watermark.
+    fn next_wake_watermark(&self) -> usize {
+        if let Some(fixed) = self.wake_watermark {
+            return fixed.max(1);
+        }
+        let missing = self
+            .cfg
+            .frame_size_samples
+            .saturating_sub(self.pending_len)
+            .max(1) as u64;
+        let in_rate = self.frame_reader.device_sample_rate().max(1) as u64;
+        let out_rate = self.cfg.sample_rate_hz.max(1) as u64;
+        let channels = self.frame_reader.device_channels().max(1) as u64;
+        ((missing * in_rate).div_ceil(out_rate) * channels) as usize
+    }
+
+    fn reconfigure_for_device(&mut self, frame: &CaptureFrame) {
         let needs_resampling = frame.sample_rate != self.cfg.sample_rate_hz;
 
         if needs_resampling {
@@ -255,28 +401,21 @@ impl ChunkerWorker {
         self.current_input_channels = Some(frame.channels);
     }
 
-    fn process_frame(&mut self, frame: &super::capture::AudioFrame) -> Vec<i16> {
-        // First, handle channel conversion if needed
-        let mono_samples = if frame.channels == 1 {
-            frame.samples.clone()
-        } else {
-            // Convert multi-channel to mono by averaging
-            let channels = frame.channels as usize;
-            frame
-                .samples
-                .chunks_exact(channels)
-                .map(|chunk| {
-                    let sum: i32 = chunk.iter().map(|&s| s as i32).sum();
-                    (sum / channels as i32) as i16
-                })
-                .collect()
-        };
-
-        // Then, apply resampling if needed
+    /// Downmix to mono and resample if needed, appending the result to `out`.
+    fn process_frame_into(&mut self, frame: &CaptureFrame, out: &mut Vec<i16>) {
+        let channels = frame.channels.max(1) as usize;
         if let Some(resampler) = &self.resampler {
-            resampler.lock().process(&mono_samples)
+            // Downmix happens inside the resampler's input staging
+            resampler
+                .lock()
+                .process_interleaved_into(&frame.samples, channels, out);
+        } else if channels == 1 {
+            out.extend_from_slice(&frame.samples);
         } else {
-            mono_samples
+            // Convert multi-channel to mono by averaging
+            let start = out.len();
+            out.resize(start + frame.samples.len() / channels, 0);
+            convert::downmix_i16(&frame.samples, channels, &mut out[start..]);
         }
     }
 }
@@ -285,6 +424,7 @@ impl ChunkerWorker {
 mod tests {
     use super::*;
     use crate::capture::AudioFrame as CapFrame;
+    use crate::frame_bus::Delivery;
     use crate::ring_buffer::AudioRingBuffer;
     use std::time::Instant;
 
@@ -293,7 +433,7 @@ mod tests {
         let rb = AudioRingBuffer::new(1024);
         let (_prod, cons) = rb.split();
         let reader = FrameReader::new(cons, 48_000, 2, 1024, None);
-        let (tx, _rx) = broadcast::channel::<SharedAudioFrame>(8);
+        let tx = FrameBus::<SharedAudioFrame>::new();
         let cfg = ChunkerConfig {
             frame_size_samples: 512,
             sample_rate_hz: 16_000,
@@ -327,7 +467,7 @@ mod tests {
         let rb = AudioRingBuffer::new(1024);
         let (_prod, cons) = rb.split();
         let reader = FrameReader::new(cons, 16_000, 2, 1024, None);
-        let (tx, _rx) = broadcast::channel::<SharedAudioFrame>(8);
+        let tx = FrameBus::<SharedAudioFrame>::new();
         let cfg = ChunkerConfig {
             frame_size_samples: 512,
             sample_rate_hz: 16_000,
@@ -343,8 +483,127 @@ mod tests {
             channels: 2,
         };
         worker.reconfigure_for_device(&frame);
-        let out = worker.process_frame(&frame);
+        let mut out = Vec::new();
+        worker.process_frame_into(&frame, &mut out);
         // Each pair averaged -> zeros
         assert_eq!(out, vec![0, 0, 0, 0]);
     }
+
+    #[test]
+    fn wake_watermark_tracks_frame_boundary() {
+        let rb = AudioRingBuffer::new(16_384);
+        let (_prod, cons) = rb.split();
+        let reader = FrameReader::new(cons, 48_000, 2, 16_384, None);
+        let tx = FrameBus::<SharedAudioFrame>::new();
+        let mut worker = ChunkerWorker::new(reader, tx, ChunkerConfig::default(), None, None);
+
+        // Empty buffer: a full 512-sample frame at 16k = 1536 frames of 48k stereo
+        assert_eq!(worker.next_wake_watermark(), 3072);
+
+        // Partially filled frame only waits for the remainder
+        worker.pending_len = 500;
+        assert_eq!(worker.next_wake_watermark(), 72);
+
+        worker.wake_watermark = Some(256);
+        assert_eq!(worker.next_wake_watermark(), 256);
+    }
+
+    #[test]
+    fn pooled_frames_are_recycled() {
+        let rb = AudioRingBuffer::new(1024);
+        let (_prod, cons) = rb.split();
+        let reader = FrameReader::new(cons, 16_000, 1, 1024, None);
+        let tx = FrameBus::<SharedAudioFrame>::new();
+        let mut rx = tx.subscribe("test", Delivery::DropOldest { capacity: 8 });
+        let mut worker = ChunkerWorker::new(reader, tx, ChunkerConfig::default(), None, None);
+
+        // Odd-sized reads straddle frame boundaries
+        let chunk = vec![3i16; 700];
+        for _ in 0..200 {
+            worker.push_samples(&chunk);
+            while let Ok(frame) = rx.try_recv() {
+                assert_eq!(frame.samples.len(), 512);
+                assert!(frame.samples.iter().all(|&s| s == 3));
+                assert_eq!(frame.features, FrameFeatures::measure(&frame.samples));
+            }
+        }
+        assert_eq!(worker.samples_emitted, (200 * 700 / 512 * 512) as u64);
+        // Bounded by what the subscriber queue retains, not by frames emitted
+        assert!(
+            worker.pool.allocations() <= 10,
+            "allocated {}",
+            worker.pool.allocations()
+        );
+    }
+
+    #[test]
+    fn inline_chunker_emits_only_complete_frames() {
+        let rb = AudioRingBuffer::new(8192);
+        let (mut prod, cons) = rb.split();
+        let reader = FrameReader::new(cons, 16_000, 2, 8192, None);
+        let tx = FrameBus::<SharedAudioFrame>::new();
+        let mut rx = tx.subscribe("test", Delivery::DropOldest { capacity: 16 });
+        let mut chunker = AudioChunker::new(reader, tx, ChunkerConfig::default()).into_inline();
+
+        // 1.5 output frames of stereo: one frame now, the rest stays pending
+        prod.write(&[100i16; 1536]).unwrap();
+        assert_eq!(chunker.pump(), 1);
+        assert_eq!(rx.try_recv().unwrap().samples.len(), 512);
+        assert!(rx.try_recv().is_err());
+
+        prod.write(&[100i16; 1536]).unwrap();
+        assert_eq!(chunker.pump(), 2);
+        assert_eq!(chunker.pump(), 0);
+    }
+
+    #[tokio::test]
+    async fn chunker_wakes_on_write_and_records_handoff() {
+        let rb = AudioRingBuffer::new(4096);
+        let (mut prod, cons) = rb.split();
+        let metrics = Arc::new(PipelineMetrics::default());
+        let reader = FrameReader::new(cons, 16_000, 1, 4096, Some(metrics.clone()));
+        let tx = FrameBus::<SharedAudioFrame>::new();
+        let mut rx = tx.subscribe("test", Delivery::DropOldest { capacity: 8 });
+        let handle = AudioChunker::new(reader, tx, ChunkerConfig::default())
+            .with_metrics(metrics.clone())
+            .spawn();
+
+        // Let the chunker park on the empty ring first
+        tokio::time::sleep(Duration::from_millis(20)).await;
+        prod.write(&[7i16; 512]).unwrap();
+
+        let frame = tokio::time::timeout(Duration::from_secs(1), rx.recv())
+            .await
+            .expect("frame within timeout")
+            .unwrap();
+        assert_eq!(frame.samples.len(), 512);
+        assert_eq!(metrics.capture_to_chunker_handoff.snapshot().count, 1);
+        handle.abort();
+    }
+
+    #[tokio::test]
+    async fn stalled_subscriber_does_not_hold_back_vad() {
+        let rb = AudioRingBuffer::new(16_384);
+        let (mut prod, cons) = rb.split();
+        let reader = FrameReader::new(cons, 16_000, 1, 16_384, None);
+        let tx = FrameBus::<SharedAudioFrame>::new();
+        // STT is never drained, as if stuck in a long finalize
+        let stt = tx.subscribe("stt", Delivery::Lossless { capacity: 8 });
+        let mut vad = tx.subscribe("vad", Delivery::Lossless { capacity: 64 });
+        let handle = AudioChunker::new(reader, tx, ChunkerConfig::default()).spawn();
+
+        for _ in 0..20 {
+            prod.write(&[5i16; 512]).unwrap();
+            let frame = tokio::time::timeout(Duration::from_millis(200), vad.recv())
+                .await
+                .expect("VAD frame while STT is stalled")
+                .unwrap();
+            assert_eq!(frame.samples.len(), 512);
+        }
+        assert_eq!(vad.dropped(), 0);
+        // The stalled subscriber only loses its own oldest frames
+        assert_eq!(stt.len(), 8);
+        assert_eq!(stt.dropped(), 12);
+        handle.abort();
+    }
 }
@@ -0,0 +1,580 @@
+//! Sample-format conversion and channel downmix kernels.
+//!
+//! The free functions run on the best [`Kernel`] for the current CPU, detected
+//! once: AVX2 then SSE4.1 on x86_64, NEON on aarch64, otherwise the scalar
+//! reference. Every kernel produces output bit-identical to [`scalar`]. All
+//! functions write into caller-provided slices and never allocate, so they are
+//! safe to call from the audio callback.
+
+use std::sync::OnceLock;
+
+/// Instruction-set variant used for conversion.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Kernel {
+    Scalar,
+    Sse41,
+    Avx2,
+    Neon,
+}
+
+impl Kernel {
+    /// Best kernel supported by this CPU (cached after the first call).
+    pub fn active() -> Self {
+        static ACTIVE: OnceLock<Kernel> = OnceLock::new();
+        *ACTIVE.get_or_init(Self::detect)
+    }
+
+    fn detect() -> Self {
+        [Kernel::Avx2, Kernel::Sse41, Kernel::Neon]
+            .into_iter()
+            .find(|k| k.is_supported())
+            .unwrap_or(Kernel::Scalar)
+    }
+
+    pub fn is_supported(self) -> bool {
+        match self {
+            Kernel::Scalar => true,
+            #[cfg(target_arch = "x86_64")]
+            Kernel::Avx2 => is_x86_feature_detected!("avx2"),
+            #[cfg(target_arch = "x86_64")]
+            Kernel::Sse41 => is_x86_feature_detected!("sse4.1"),
+            #[cfg(target_arch = "aarch64")]
+            Kernel::Neon => std::arch::is_aarch64_feature_detected!("neon"),
+            #[allow(unreachable_patterns)]
+            _ => false,
+        }
+    }
+
+    /// Kernels usable on this CPU, scalar first.
+    pub fn supported() -> impl Iterator<Item = Kernel> {
+        [Kernel::Scalar, Kernel::Sse41, Kernel::Avx2, Kernel::Neon]
+            .into_iter()
+            .filter(|k| k.is_supported())
+    }
+
+    pub fn name(self) -> &'static str {
+        match self {
+            Kernel::Scalar => "scalar",
+            Kernel::Sse41 => "sse4.1",
+            Kernel::Avx2 => "avx2",
+            Kernel::Neon => "neon",
+        }
+    }
+
+    /// Average interleaved `channels`-channel audio to mono. Returns frames written,
+    /// `min(input.len() / channels, out.len())`.
+    pub fn downmix_i16(self, input: &[i16], channels: usize, out: &mut [i16]) -> usize {
+        let channels = channels.max(1);
+        let frames = (input.len() / channels).min(out.len());
+        let (input, out) = (&input[..frames * channels], &mut out[..frames]);
+        match self {
+            #[cfg(target_arch = "x86_64")]
+            // SAFETY: only reached when the CPU reports AVX2.
+            Kernel::Avx2 if self.is_supported() => unsafe {
+                x86::downmix_avx2(input, channels, out)
+            },
+            #[cfg(target_arch = "x86_64")]
+            // SAFETY: only reached when the CPU reports SSE4.1.
+            Kernel::Sse41 if self.is_supported() => unsafe {
+                x86::downmix_sse41(input, channels, out)
+            },
+            #[cfg(target_arch = "aarch64")]
+            // SAFETY: only reached when the CPU reports NEON.
+            Kernel::Neon if self.is_supported() => unsafe { neon::downmix(input, channels, out) },
+            _ => scalar::downmix_i16(input, channels, out),
+        }
+        frames
+    }
+
+    /// Convert `[-1.0, 1.0]` float samples to i16. Returns samples written.
+    pub fn f32_to_i16(self, input: &[f32], out: &mut [i16]) -> usize {
+        let n = input.len().min(out.len());
+        let (input, out) = (&input[..n], &mut out[..n]);
+        match self {
+            #[cfg(target_arch = "x86_64")]
+            // SAFETY: only reached when the CPU reports AVX2.
+            Kernel::Avx2 if self.is_supported() => unsafe { x86::f32_to_i16_avx2(input, out) },
+            #[cfg(target_arch = "x86_64")]
+            // SAFETY: only reached when the CPU reports SSE4.1.
+            Kernel::Sse41 if self.is_supported() => unsafe { x86::f32_to_i16_sse41(input, out) },
+            #[cfg(target_arch = "aarch64")]
+            // SAFETY: only reached when the CPU reports NEON.
+            Kernel::Neon if self.is_supported() => unsafe { neon::f32_to_i16(input, out) },
+            _ => scalar::f32_to_i16(input, out),
+        }
+        n
+    }
+
+    /// Convert offset-binary u16 samples to i16. Returns samples written.
+    pub fn u16_to_i16(self, input: &[u16], out: &mut [i16]) -> usize {
+        let n = input.len().min(out.len());
+        let (input, out) = (&input[..n], &mut out[..n]);
+        match self {
+            #[cfg(target_arch = "x86_64")]
+            // SAFETY: only reached when the CPU reports AVX2.
+            Kernel::Avx2 if self.is_supported() => unsafe { x86::u16_to_i16_avx2(input, out) },
+            #[cfg(target_arch = "x86_64")]
+            // SAFETY: only reached when the CPU reports SSE4.1.
+            Kernel::Sse41 if self.is_supported() => unsafe { x86::u16_to_i16_sse41(input, out) },
+            #[cfg(target_arch = "aarch64")]
+            // SAFETY: only reached when the CPU reports NEON.
+            Kernel::Neon if self.is_supported() => unsafe { neon::u16_to_i16(input, out) },
+            _ => scalar::u16_to_i16(input, out),
+        }
+        n
+    }
+}
+
+/// [`Kernel::downmix_i16`] on the active kernel.
+pub fn downmix_i16(input: &[i16], channels: usize, out: &mut [i16]) -> usize {
+    Kernel::active().downmix_i16(input, channels, out)
+}
+
+/// [`Kernel::f32_to_i16`] on the active kernel.
+pub fn f32_to_i16(input: &[f32], out: &mut [i16]) -> usize {
+    Kernel::active().f32_to_i16(input, out)
+}
+
+/// [`Kernel::u16_to_i16`] on the active kernel.
+pub fn u16_to_i16(input: &[u16], out: &mut [i16]) -> usize {
+    Kernel::active().u16_to_i16(input, out)
+}
+
+/// Convert `[-1.0, 1.0]` f64 samples to i16. Returns samples written.
+pub fn f64_to_i16(input: &[f64], out: &mut [i16]) -> usize {
+    let n = input.len().min(out.len());
+    for (d, &s) in out.iter_mut().zip(input) {
+        *d = (s.clamp(-1.0, 1.0) * 32767.0).round() as i16;
+    }
+    n
+}
+
+/// Convert offset-binary u32 samples to i16 (top 16 bits). Returns samples written.
+pub fn u32_to_i16(input: &[u32], out: &mut [i16]) -> usize {
+    let n = input.len().min(out.len());
+    for (d, &s) in out.iter_mut().zip(input) {
+        *d = ((s as i64 - 2_147_483_648i64) >> 16) as i16;
+    }
+    n
+}
+
+/// Reference implementations. Inputs must already be trimmed to matching lengths.
+pub mod scalar {
+    pub fn downmix_i16(input: &[i16], channels: usize, out: &mut [i16]) {
+        match channels {
+            1 => out.copy_from_slice(input),
+            2 => super::downmix_fixed::<2>(input, out),
+            4 => super::downmix_fixed::<4>(input, out),
+            6 => super::downmix_fixed::<6>(input, out),
+            8 => super::downmix_fixed::<8>(input, out),
+            _ => {
+                for (d, frame) in out.iter_mut().zip(input.chunks_exact(channels)) {
+                    let sum: i32 = frame.iter().map(|&s| s as i32).sum();
+                    *d = (sum / channels as i32) as i16;
+                }
+            }
+        }
+    }
+
+    pub fn f32_to_i16(input: &[f32], out: &mut [i16]) {
+        for (d, &s) in out.iter_mut().zip(input) {
+            *d = (s.clamp(-1.0, 1.0) * 32767.0).round() as i16;
+        }
+    }
+
+    pub fn u16_to_i16(input: &[u16], out: &mut [i16]) {
+        for (d, &s) in out.iter_mut().zip(input) {
+            *d = (s as i32 - 32768) as i16;
+        }
+    }
+}
+
+/// Fixed channel count body. Inlined into each `target_feature` kernel so the
+/// compiler vectorizes it for that instruction set.
+#[inline(always)]
+fn downmix_fixed<const CH: usize>(input: &[i16], out: &mut [i16]) {
+    for (d, frame) in out.iter_mut().zip(input.chunks_exact(CH)) {
+        let mut sum = 0i32;
+        for &s in frame {
+            sum += s as i32;
+        }
+        *d = (sum / CH as i32) as i16;
+    }
+}
+
+#[cfg(target_arch = "x86_64")]
+mod x86 {
+    use super::{downmix_fixed, scalar};
+    use std::arch::x86_64::*;
+
+    #[target_feature(enable = "avx2")]
+    pub unsafe fn downmix_avx2(input: &[i16], channels: usize, out: &mut [i16]) {
+        let done = match channels {
+            2 => downmix_blocks_avx2::<2>(input, out),
+            4 => downmix_blocks_avx2::<4>(input, out),
+            8 => downmix_blocks_avx2::<8>(input, out),
+            6 => {
+                downmix_fixed::<6>(input, out);
+                out.len()
+            }
+            _ => 0,
+        };
+        scalar::downmix_i16(&input[done * channels..], channels, &mut out[done..]);
+    }
+
+    /// Downmix whole 16-frame blocks; returns frames written.
+    #[inline(always)]
+    unsafe fn downmix_blocks_avx2<const CH: usize>(input: &[i16], out: &mut [i16]) -> usize {
+        let shift = _mm_cvtsi32_si128(CH.trailing_zeros() as i32);
+        let blocks = out.len() / 16;
+        for i in 0..blocks {
+            let src = input.as_ptr().add(i * 16 * CH);
+            let a = div_trunc_256(sum_frames_256::<CH>(src), shift);
+            let b = div_trunc_256(sum_frames_256::<CH>(src.add(8 * CH)), shift);
+            let packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0b11_01_10_00);
+            _mm256_storeu_si256(out.as_mut_ptr().add(i * 16) as *mut __m256i, packed);
+        }
+        blocks * 16
+    }
+
+    /// Per-frame i32 sums of 8 consecutive frames, in frame order. `madd` adds
+    /// adjacent channel pairs; `hadd` folds the pair sums within each lane.
+    #[inline(always)]
+    unsafe fn sum_frames_256<const CH: usize>(src: *const i16) -> __m256i {
+        let ones = _mm256_set1_epi16(1);
+        let pairs = |k: usize| {
+            _mm256_madd_epi16(_mm256_loadu_si256(src.add(k * 16) as *const __m256i), ones)
+        };
+        match CH {
+            2 => pairs(0),
+            4 => _mm256_permute4x64_epi64(_mm256_hadd_epi32(pairs(0), pairs(1)), 0b11_01_10_00),
+            _ => {
+                let quads = _mm256_hadd_epi32(
+                    _mm256_hadd_epi32(pairs(0), pairs(1)),
+                    _mm256_hadd_epi32(pairs(2), pairs(3)),
+                );
+                _mm256_permutevar8x32_epi32(quads, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7))
+            }
+        }
+    }
+
+    /// `sum >> shift` rounding toward zero, matching integer division by `1 << shift`.
+    #[inline(always)]
+    unsafe fn div_trunc_256(sum: __m256i, shift: __m128i) -> __m256i {
+        let bias = _mm256_srl_epi32(
+            _mm256_srai_epi32(sum, 31),
+            _mm_sub_epi32(_mm_cvtsi32_si128(32), shift),
+        );
+        _mm256_sra_epi32(_mm256_add_epi32(sum, bias), shift)
+    }
+
+    #[target_feature(enable = "sse4.1")]
+    pub unsafe fn downmix_sse41(input: &[i16], channels: usize, out: &mut [i16]) {
+        let done = match channels {
+            2 => downmix_blocks_sse41::<2>(input, out),
+            4 => downmix_blocks_sse41::<4>(input, out),
+            8 => downmix_blocks_sse41::<8>(input, out),
+            6 => {
+                downmix_fixed::<6>(input, out);
+                out.len()
+            }
+            _ => 0,
+        };
+        scalar::downmix_i16(&input[done * channels..], channels, &mut out[done..]);
+    }
+
+    /// Downmix whole 8-frame blocks; returns frames written.
+    #[inline(always)]
+    unsafe fn downmix_blocks_sse41<const CH: usize>(input: &[i16], out: &mut [i16]) -> usize {
+        let shift = _mm_cvtsi32_si128(CH.trailing_zeros() as i32);
+        let blocks = out.len() / 8;
+        for i in 0..blocks {
+            let src = input.as_ptr().add(i * 8 * CH);
+            let a = div_trunc_128(sum_frames_128::<CH>(src), shift);
+            let b = div_trunc_128(sum_frames_128::<CH>(src.add(4 * CH)), shift);
+            _mm_storeu_si128(
+                out.as_mut_ptr().add(i * 8) as *mut __m128i,
+                _mm_packs_epi32(a, b),
+            );
+        }
+        blocks * 8
+    }
+
+    /// Per-frame i32 sums of 4 consecutive frames.
+    #[inline(always)]
+    unsafe fn sum_frames_128<const CH: usize>(src: *const i16) -> __m128i {
+        let ones = _mm_set1_epi16(1);
+        let pairs =
+            |k: usize| _mm_madd_epi16(_mm_loadu_si128(src.add(k * 8) as *const __m128i), ones);
+        match CH {
+            2 => pairs(0),
+            4 => _mm_hadd_epi32(pairs(0), pairs(1)),
+            _ => _mm_hadd_epi32(
+                _mm_hadd_epi32(pairs(0), pairs(1)),
+                _mm_hadd_epi32(pairs(2), pairs(3)),
+            ),
+        }
+    }
+
+    #[inline(always)]
+    unsafe fn div_trunc_128(sum: __m128i, shift: __m128i) -> __m128i {
+        let bias = _mm_srl_epi32(
+            _mm_srai_epi32(sum, 31),
+            _mm_sub_epi32(_mm_cvtsi32_si128(32), shift),
+        );
+        _mm_sra_epi32(_mm_add_epi32(sum, bias), shift)
+    }
+
+    #[target_feature(enable = "avx2")]
+    pub unsafe fn f32_to_i16_avx2(input: &[f32], out: &mut [i16]) {
+        let blocks = out.len() / 16;
+        for i in 0..blocks {
+            let src = input.as_ptr().add(i * 16);
+            let a = _mm256_cvttps_epi32(scale_round_256(_mm256_loadu_ps(src)));
+            let b = _mm256_cvttps_epi32(scale_round_256(_mm256_loadu_ps(src.add(8))));
+            let packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0b11_01_10_00);
+            _mm256_storeu_si256(out.as_mut_ptr().add(i * 16) as *mut __m256i, packed);
+        }
+        let done = blocks * 16;
+        scalar::f32_to_i16(&input[done..], &mut out[done..]);
+    }
+
+    /// Clamp, scale by 32767 and round half away from zero like `f32::round`.
+    /// NaN maps to 0, as `NaN as i16` does.
+    #[inline(always)]
+    unsafe fn scale_round_256(x: __m256) -> __m256 {
+        let x = _mm256_and_ps(x, _mm256_cmp_ps(x, x, _CMP_ORD_Q));
+        let x = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(-1.0)), _mm256_set1_ps(1.0));
+        let x = _mm256_mul_ps(x, _mm256_set1_ps(32767.0));
+        let t = _mm256_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        let sign_bit = _mm256_set1_ps(-0.0);
+        let frac = _mm256_andnot_ps(sign_bit, _mm256_sub_ps(x, t));
+        let away = _mm256_cmp_ps(frac, _mm256_set1_ps(0.5), _CMP_GE_OQ);
+        let step = _mm256_or_ps(_mm256_and_ps(x, sign_bit), _mm256_set1_ps(1.0));
+        _mm256_add_ps(t, _mm256_and_ps(away, step))
+    }
+
+    #[target_feature(enable = "sse4.1")]
+    pub unsafe fn f32_to_i16_sse41(input: &[f32], out: &mut [i16]) {
+        let blocks = out.len() / 8;
+        for i in 0..blocks {
+            let src = input.as_ptr().add(i * 8);
+            let a = _mm_cvttps_epi32(scale_round_128(_mm_loadu_ps(src)));
+            let b = _mm_cvttps_epi32(scale_round_128(_mm_loadu_ps(src.add(4))));
+            _mm_storeu_si128(
+                out.as_mut_ptr().add(i * 8) as *mut __m128i,
+                _mm_packs_epi32(a, b),
+            );
+        }
+        let done = blocks * 8;
+        scalar::f32_to_i16(&input[done..], &mut out[done..]);
+    }
+
+    #[inline(always)]
+    unsafe fn scale_round_128(x: __m128) -> __m128 {
+        let x = _mm_and_ps(x, _mm_cmpord_ps(x, x));
+        let x = _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.0)), _mm_set1_ps(1.0));
+        let x = _mm_mul_ps(x, _mm_set1_ps(32767.0));
+        let t = _mm_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        let sign_bit = _mm_set1_ps(-0.0);
+        let frac = _mm_andnot_ps(sign_bit, _mm_sub_ps(x, t));
+        let away = _mm_cmpge_ps(frac, _mm_set1_ps(0.5));
+        let step = _mm_or_ps(_mm_and_ps(x, sign_bit), _mm_set1_ps(1.0));
+        _mm_add_ps(t, _mm_and_ps(away, step))
+    }
+
+    #[target_feature(enable = "avx2")]
+    pub unsafe fn u16_to_i16_avx2(input: &[u16], out: &mut [i16]) {
+        let bias = _mm256_set1_epi16(i16::MIN);
+        let blocks = out.len() / 16;
+        for i in 0..blocks {
+            let v = _mm256_loadu_si256(input.as_ptr().add(i * 16) as *const __m256i);
+            _mm256_storeu_si256(
+                out.as_mut_ptr().add(i * 16) as *mut __m256i,
+                _mm256_xor_si256(v, bias),
+            );
+        }
+        let done = blocks * 16;
+        scalar::u16_to_i16(&input[done..], &mut out[done..]);
+    }
+
+    #[target_feature(enable = "sse4.1")]
+    pub unsafe fn u16_to_i16_sse41(input: &[u16], out: &mut [i16]) {
+        let bias = _mm_set1_epi16(i16::MIN);
+        let blocks = out.len() / 8;
+        for i in 0..blocks {
+            let v = _mm_loadu_si128(input.as_ptr().add(i * 8) as *const __m128i);
+            _mm_storeu_si128(
+                out.as_mut_ptr().add(i * 8) as *mut __m128i,
+                _mm_xor_si128(v, bias),
+            );
+        }
+        let done = blocks * 8;
+        scalar::u16_to_i16(&input[done..], &mut out[done..]);
+    }
+}
+
+#[cfg(target_arch = "aarch64")]
+mod neon {
+    use super::{downmix_fixed, scalar};
+    use std::arch::aarch64::*;
+
+    #[target_feature(enable = "neon")]
+    pub unsafe fn downmix(input: &[i16], channels: usize, out: &mut [i16]) {
+        match channels {
+            2 => {
+                // vld2 de-interleaves L and R; widen, add and halve toward zero.
+                let blocks = out.len() / 8;
+                for i in 0..blocks {
+                    let lr = vld2q_s16(input.as_ptr().add(i * 16));
+                    let lo = halve_trunc(vaddl_s16(vget_low_s16(lr.0), vget_low_s16(lr.1)));
+                    let hi = halve_trunc(vaddl_high_s16(lr.0, lr.1));
+                    vst1q_s16(
+                        out.as_mut_ptr().add(i * 8),
+                        vcombine_s16(vmovn_s32(lo), vmovn_s32(hi)),
+                    );
+                }
+                let done = blocks * 8;
+                scalar::downmix_i16(&input[done * 2..], 2, &mut out[done..]);
+            }
+            4 => downmix_fixed::<4>(input, out),
+            6 => downmix_fixed::<6>(input, out),
+            8 => downmix_fixed::<8>(input, out),
+            _ => scalar::downmix_i16(input, channels, out),
+        }
+    }
+
+    #[inline(always)]
+    unsafe fn halve_trunc(sum: int32x4_t) -> int32x4_t {
+        let bias = vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(sum), 31));
+        vshrq_n_s32(vaddq_s32(sum, bias), 1)
+    }
+
+    #[target_feature(enable = "neon")]
+    pub unsafe fn f32_to_i16(input: &[f32], out: &mut [i16]) {
+        // FCVTAS rounds half away from zero and maps NaN to 0, like the scalar path.
+        let lo_lim = vdupq_n_f32(-1.0);
+        let hi_lim = vdupq_n_f32(1.0);
+        let scale = vdupq_n_f32(32767.0);
+        let blocks = out.len() / 8;
+        for i in 0..blocks {
+            let src = input.as_ptr().add(i * 8);
+            let a = vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(src), lo_lim), hi_lim), scale);
+            let b = vmulq_f32(
+                vminq_f32(vmaxq_f32(vld1q_f32(src.add(4)), lo_lim), hi_lim),
+                scale,
+            );
+            let packed = vcombine_s16(vqmovn_s32(vcvtaq_s32_f32(a)), vqmovn_s32(vcvtaq_s32_f32(b)));
+            vst1q_s16(out.as_mut_ptr().add(i * 8), packed);
+        }
+        let done = blocks * 8;
+        scalar::f32_to_i16(&input[done..], &mut out[done..]);
+    }
+
+    #[target_feature(enable = "neon")]
+    pub unsafe fn u16_to_i16(input: &[u16], out: &mut [i16]) {
+        let bias = vdupq_n_u16(0x8000);
+        let blocks = out.len() / 8;
+        for i in 0..blocks {
+            let v = veorq_u16(vld1q_u16(input.as_ptr().add(i * 8)), bias);
+            vst1q_s16(out.as_mut_ptr().add(i * 8), vreinterpretq_s16_u16(v));
+        }
+        let done = blocks * 8;
+        scalar::u16_to_i16(&input[done..], &mut out[done..]);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Deterministic pseudo-random samples, including the extremes.
+    fn samples(n: usize) -> Vec<i16> {
+        let mut x = 0x1234_5678u32;
+        let mut v: Vec<i16> = (0..n)
+            .map(|_| {
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                x as i16
+            })
+            .collect();
+        v[..4].copy_from_slice(&[i16::MIN, i16::MIN, i16::MAX, -1]);
+        v
+    }
+
+    #[test]
+    fn downmix_kernels_match_scalar() {
+        for channels in [1usize, 2, 3, 4, 6, 8] {
+            // Odd frame count exercises the scalar tail
+            let input = samples(channels * 203);
+            let mut expected = vec![0i16; 203];
+            scalar::downmix_i16(&input, channels, &mut expected);
+            for kernel in Kernel::supported() {
+                let mut out = vec![0i16; 203];
+                assert_eq!(kernel.downmix_i16(&input, channels, &mut out), 203);
+                assert_eq!(out, expected, "{} with {channels} channels", kernel.name());
+            }
+        }
+    }
+
+    #[test]
+    fn downmix_truncates_toward_zero() {
+        let mut out = [0i16; 4];
+        downmix_i16(
+            &[1, 2, -1, -2, i16::MIN, i16::MIN, 1000, -1000],
+            2,
+            &mut out,
+        );
+        assert_eq!(out, [1, -1, i16::MIN, 0]);
+    }
+
+    #[test]
+    fn f32_kernels_match_scalar() {
+        let mut input: Vec<f32> = samples(517).iter().map(|&s| s as f32 / 30000.0).collect();
+        // Exact ties, out-of-range values and NaN
+        input[..8].copy_from_slice(&[
+            0.5 / 32767.0,
+            -1.5 / 32767.0,
+            2.0,
+            -7.0,
+            f32::NAN,
+            -0.0,
+            1.0,
+            -1.0,
+        ]);
+        let mut expected = vec![0i16; input.len()];
+        scalar::f32_to_i16(&input, &mut expected);
+        assert_eq!(&expected[..8], &[1, -2, 32767, -32767, 0, 0, 32767, -32767]);
+        for kernel in Kernel::supported() {
+            let mut out = vec![0i16; input.len()];
+            kernel.f32_to_i16(&input, &mut out);
+            assert_eq!(out, expected, "{}", kernel.name());
+        }
+    }
+
+    #[test]
+    fn u16_kernels_match_scalar() {
+        let input: Vec<u16> = samples(333).iter().map(|&s| s as u16).collect();
+        let mut expected = vec![0i16; input.len()];
+        scalar::u16_to_i16(&input, &mut expected);
+        for kernel in Kernel::supported() {
+            let mut out = vec![0i16; input.len()];
+            kernel.u16_to_i16(&input, &mut out);
+            assert_eq!(out, expected, "{}", kernel.name());
+        }
+    }
+
+    #[test]
+    fn output_is_bounded_by_shorter_slice() {
+        let mut out = [0i16; 2];
+        assert_eq!(f32_to_i16(&[0.5; 5], &mut out), 2);
+        assert_eq!(downmix_i16(&[1; 9], 2, &mut out), 2);
+        let mut wide = [0i16; 8];
+        assert_eq!(downmix_i16(&[1; 9], 2, &mut wide), 4);
+        assert_eq!(f64_to_i16(&[1.0, -1.0], &mut wide), 2);
+        assert_eq!(&wide[..2], &[32767, -32767]);
+        assert_eq!(u32_to_i16(&[0, u32::MAX], &mut wide), 2);
+        assert_eq!(&wide[..2], &[i16::MIN, i16::MAX]);
+    }
+}
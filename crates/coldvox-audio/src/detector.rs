@@ -21,7 +21,7 @@ impl SilenceDetector {
 
         // Calculate RMS
         let sum: i64 = samples.iter().map(|&s| s as i64 * s as i64).sum();
-        let rms = ((sum / samples.len() as i64) as f64).sqrt() as i16;
+        let rms = Self::rms_from_sum_sq(sum, samples.len());
 
         // Log RMS every time to see actual audio levels (use trace level to avoid spam)
         tracing::trace!(
@@ -56,6 +56,21 @@ impl SilenceDetector {
         }
     }
 
+    /// Stateless silence check from a precomputed sum of squares.
+    ///
+    /// Used by the real-time capture callback, which accumulates energy while
+    /// converting samples and cannot touch the detector's timing state.
+    pub fn rms_below(sum_sq: i64, len: usize, threshold: i16) -> bool {
+        Self::rms_from_sum_sq(sum_sq, len) < threshold
+    }
+
+    fn rms_from_sum_sq(sum_sq: i64, len: usize) -> i16 {
+        if len == 0 {
+            return 0;
+        }
+        ((sum_sq / len as i64) as f64).sqrt() as i16
+    }
+
     pub fn silence_duration(&self) -> Duration {
         self.silence_start
             .map(|start| Instant::now().duration_since(start))
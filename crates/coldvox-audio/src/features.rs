@@ -0,0 +1,184 @@
+//! Per-frame features computed once by the chunker.
+//!
+//! Every [`SharedAudioFrame`](crate::SharedAudioFrame) carries a
+//! [`FrameFeatures`] measured in a single pass over its samples, so VAD,
+//! telemetry and quality monitoring read levels from the frame instead of
+//! rescanning it. Sums are exact integers and independent of summation order.
+
+/// Independent accumulators per pass; lets the compiler vectorize the loop.
+const LANES: usize = 16;
+
+/// Level and shape statistics for one frame of i16 samples.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct FrameFeatures {
+    /// Sum of squared samples.
+    pub sum_squares: u64,
+    /// Sum of squared first differences, `(x[n] - x[n-1])²`: energy of the
+    /// pre-emphasized signal, weighted toward high frequencies.
+    pub diff_sum_squares: u64,
+    /// Largest absolute sample value (`32768` for `i16::MIN`).
+    pub peak: u16,
+    /// Sign changes between consecutive samples.
+    pub zero_crossings: u32,
+    /// Number of samples measured.
+    pub len: u32,
+}
+
+impl FrameFeatures {
+    /// Measure `samples` in one pass.
+    pub fn measure(samples: &[i16]) -> Self {
+        let Some((&first, _)) = samples.split_first() else {
+            return Self::default();
+        };
+        let prev = &samples[..samples.len() - 1];
+        let next = &samples[1..];
+
+        let mut squares = [0u64; LANES];
+        let mut diffs = [0u64; LANES];
+        let mut peaks = [0u16; LANES];
+        let mut crossings = [0u32; LANES];
+        let prev_chunks = prev.chunks_exact(LANES);
+        let next_chunks = next.chunks_exact(LANES);
+        let (prev_tail, next_tail) = (prev_chunks.remainder(), next_chunks.remainder());
+        for (p, n) in prev_chunks.zip(next_chunks) {
+            for i in 0..LANES {
+                let s = n[i] as i32;
+                squares[i] += (s * s) as u64;
+                peaks[i] = peaks[i].max(n[i].unsigned_abs());
+                let d = (s - p[i] as i32).unsigned_abs() as u64;
+                diffs[i] += d * d;
+                crossings[i] += ((n[i] ^ p[i]) < 0) as u32;
+            }
+        }
+
+        let s = first as i32;
+        let mut features = Self {
+            sum_squares: squares.iter().sum::<u64>() + (s * s) as u64,
+            diff_sum_squares: diffs.iter().sum(),
+            peak: peaks.iter().copied().fold(first.unsigned_abs(), u16::max),
+            zero_crossings: crossings.iter().sum(),
+            len: samples.len() as u32,
+        };
+        for (&p, &n) in prev_tail.iter().zip(next_tail) {
+            let s = n as i32;
+            features.sum_squares += (s * s) as u64;
+            features.peak = features.peak.max(n.unsigned_abs());
+            let d = (s - p as i32).unsigned_abs() as u64;
+            features.diff_sum_squares += d * d;
+            features.zero_crossings += ((n ^ p) < 0) as u32;
+        }
+        features
+    }
+
+    /// Mean of the squared samples, in raw sample units.
+    pub fn mean_square(&self) -> f64 {
+        if self.len == 0 {
+            return 0.0;
+        }
+        self.sum_squares as f64 / self.len as f64
+    }
+
+    /// RMS normalized to full scale, `[0, 1]`.
+    pub fn rms(&self) -> f32 {
+        (self.mean_square().sqrt() / 32768.0) as f32
+    }
+
+    /// RMS level in dBFS, floored at -100 like the VAD energy calculator.
+    pub fn dbfs(&self) -> f32 {
+        let rms = self.rms();
+        if rms <= 1e-10 {
+            return -100.0;
+        }
+        20.0 * rms.log10()
+    }
+
+    /// Peak level in dBFS, floored at -100.
+    pub fn peak_dbfs(&self) -> f32 {
+        if self.peak == 0 {
+            return -100.0;
+        }
+        20.0 * (self.peak as f32 / 32768.0).log10()
+    }
+
+    /// Sign changes per sample pair, `[0, 1]`.
+    pub fn zero_crossing_rate(&self) -> f32 {
+        if self.len < 2 {
+            return 0.0;
+        }
+        self.zero_crossings as f32 / (self.len - 1) as f32
+    }
+
+    /// Share of energy above the middle of the band, estimated from the
+    /// first difference: about 0 for DC, 0.5 for white noise and 1 at Nyquist.
+    pub fn high_band_ratio(&self) -> f32 {
+        if self.sum_squares == 0 {
+            return 0.0;
+        }
+        (self.diff_sum_squares as f64 / (4.0 * self.sum_squares as f64)).min(1.0) as f32
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn reference(samples: &[i16]) -> FrameFeatures {
+        let mut f = FrameFeatures {
+            len: samples.len() as u32,
+            ..Default::default()
+        };
+        for (i, &s) in samples.iter().enumerate() {
+            f.sum_squares += (s as i64 * s as i64) as u64;
+            f.peak = f.peak.max(s.unsigned_abs());
+            if i > 0 {
+                let p = samples[i - 1];
+                let d = s as i64 - p as i64;
+                f.diff_sum_squares += (d * d) as u64;
+                f.zero_crossings += ((s < 0) != (p < 0)) as u32;
+            }
+        }
+        f
+    }
+
+    #[test]
+    fn measure_matches_reference_for_all_lengths() {
+        let samples: Vec<i16> = (0..100)
+            .map(|i| ((i * 7919) % 65536) as u16 as i16)
+            .collect();
+        for len in 0..samples.len() {
+            let frame = &samples[..len];
+            assert_eq!(FrameFeatures::measure(frame), reference(frame), "len {len}");
+        }
+    }
+
+    #[test]
+    fn extremes_do_not_overflow() {
+        let frame: Vec<i16> = (0..4096)
+            .map(|i| if i % 2 == 0 { i16::MIN } else { i16::MAX })
+            .collect();
+        let f = FrameFeatures::measure(&frame);
+        assert_eq!(f, reference(&frame));
+        assert_eq!(f.peak, 32768);
+        assert_eq!(f.zero_crossing_rate(), 1.0);
+        assert!(f.high_band_ratio() > 0.99);
+        assert!(f.dbfs().abs() < 0.01);
+    }
+
+    #[test]
+    fn levels_and_shape() {
+        let silence = FrameFeatures::measure(&[0i16; 512]);
+        assert_eq!(silence.dbfs(), -100.0);
+        assert_eq!(silence.peak_dbfs(), -100.0);
+        assert_eq!(silence.high_band_ratio(), 0.0);
+
+        // 250 Hz at 16 kHz: low band, one crossing every 32 samples
+        let tone: Vec<i16> = (0..512)
+            .map(|i| ((i as f32 * 2.0 * std::f32::consts::PI / 64.0).sin() * 16384.0) as i16)
+            .collect();
+        let f = FrameFeatures::measure(&tone);
+        assert!((f.rms() - 0.354).abs() < 0.01);
+        assert!((f.peak_dbfs() + 6.02).abs() < 0.05);
+        assert!((f.zero_crossing_rate() - 1.0 / 32.0).abs() < 0.01);
+        assert!(f.high_band_ratio() < 0.01);
+    }
+}
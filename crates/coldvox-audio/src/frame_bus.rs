@@ -0,0 +1,418 @@
+//! # Audio frame bus
+//!
+//! Fans the chunker's frames out to every consumer, each with its own queue
+//! and [`Delivery`] policy. A slow consumer only affects itself: STT can ask
+//! for every frame while a level meter keeps just the newest ones, instead of
+//! all of them sharing one broadcast ring where the slowest reader lags and
+//! loses whatever the ring overwrote.
+//!
+//! Sending never waits on a subscriber. A subscriber that falls behind only
+//! fills its own bounded queue and, once that is full, loses its own oldest
+//! frames; everyone else keeps receiving at the capture rate. Frames are
+//! shared `Arc`s, so a deep queue for a consumer with long stalls (STT during
+//! a finalize) costs a pointer per frame. Queue depth and drops per
+//! subscriber are published as [`SubscriberLag`] gauges when the bus has
+//! metrics.
+
+use parking_lot::Mutex;
+use std::collections::VecDeque;
+use std::sync::atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering};
+use std::sync::Arc;
+use tokio::sync::Notify;
+
+use coldvox_telemetry::{PipelineMetrics, SubscriberLag};
+
+/// How a subscriber's queue behaves when it falls behind.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Delivery {
+    /// Every frame is delivered as long as the subscriber stays within
+    /// `capacity` queued frames; size it for the longest stall the consumer
+    /// must ride out. Beyond that the oldest frame is dropped, counted and
+    /// logged, so a stalled consumer cannot grow without bound.
+    Lossless { capacity: usize },
+    /// Keep the newest `capacity` frames, dropping the oldest. For level
+    /// meters, dashboards and metrics that only care about recent audio.
+    DropOldest { capacity: usize },
+    /// Deliver one frame in `every`, keeping the newest `capacity` of those.
+    /// For visualizers that do not need the full frame rate.
+    Decimate { every: u32, capacity: usize },
+}
+
+impl Delivery {
+    /// Frames queued before the oldest is dropped.
+    fn limit(&self) -> usize {
+        match *self {
+            Delivery::Lossless { capacity }
+            | Delivery::DropOldest { capacity }
+            | Delivery::Decimate { capacity, .. } => capacity.max(1),
+        }
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, thiserror::Error)]
+pub enum RecvError {
+    #[error("frame bus closed")]
+    Closed,
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq, thiserror::Error)]
+pub enum TryRecvError {
+    #[error("no frame queued")]
+    Empty,
+    #[error("frame bus closed")]
+    Closed,
+}
+
+struct Queue<T> {
+    items: VecDeque<T>,
+    delivery: Delivery,
+    /// Frames offered to this subscriber, for decimation.
+    offered: u64,
+}
+
+struct Slot<T> {
+    name: String,
+    queue: Mutex<Queue<T>>,
+    ready: Notify,
+    detached: AtomicBool,
+    dropped: AtomicU64,
+    lag: Option<Arc<SubscriberLag>>,
+}
+
+impl<T: Clone> Slot<T> {
+    fn offer(&self, item: &T) {
+        let mut queue = self.queue.lock();
+        let index = queue.offered;
+        queue.offered += 1;
+        let delivery = queue.delivery;
+        if let Delivery::Decimate { every, .. } = delivery {
+            if index % every.max(1) as u64 != 0 {
+                return;
+            }
+        }
+
+        // More than one pop only after a switch to a smaller policy
+        while queue.items.len() >= delivery.limit() {
+            queue.items.pop_front();
+            let dropped = self.dropped.fetch_add(1, Ordering::Relaxed) + 1;
+            if let Some(lag) = &self.lag {
+                lag.record_drop();
+            }
+            if matches!(delivery, Delivery::Lossless { .. })
+                && (dropped == 1 || dropped.is_multiple_of(100))
+            {
+                tracing::warn!(
+                    "Frame bus: lossless subscriber '{}' overflowed, {} frames dropped",
+                    self.name,
+                    dropped
+                );
+            }
+        }
+        queue.items.push_back(item.clone());
+        let depth = queue.items.len();
+        drop(queue);
+
+        if let Some(lag) = &self.lag {
+            lag.record_depth(depth);
+        }
+        self.ready.notify_one();
+    }
+}
+
+struct Shared<T> {
+    slots: Mutex<Vec<Arc<Slot<T>>>>,
+    senders: AtomicUsize,
+    closed: AtomicBool,
+    metrics: Option<Arc<PipelineMetrics>>,
+}
+
+/// Sending half of the bus. Cloning adds a sender; subscribers see
+/// [`RecvError::Closed`] once every sender is dropped and their queue is empty.
+pub struct FrameBus<T> {
+    shared: Arc<Shared<T>>,
+}
+
+impl<T: Clone + Send> FrameBus<T> {
+    pub fn new() -> Self {
+        Self::build(None)
+    }
+
+    /// A bus that publishes per-subscriber lag gauges to `metrics`.
+    pub fn with_metrics(metrics: Arc<PipelineMetrics>) -> Self {
+        Self::build(Some(metrics))
+    }
+
+    fn build(metrics: Option<Arc<PipelineMetrics>>) -> Self {
+        Self {
+            shared: Arc::new(Shared {
+                slots: Mutex::new(Vec::new()),
+                senders: AtomicUsize::new(1),
+                closed: AtomicBool::new(false),
+                metrics,
+            }),
+        }
+    }
+
+    /// Add a subscriber receiving frames sent from now on. `name` labels its
+    /// lag gauge and log lines.
+    pub fn subscribe(&self, name: &str, delivery: Delivery) -> FrameSubscriber<T> {
+        let slot = Arc::new(Slot {
+            name: name.to_string(),
+            queue: Mutex::new(Queue {
+                items: VecDeque::with_capacity(delivery.limit()),
+                delivery,
+                offered: 0,
+            }),
+            ready: Notify::new(),
+            detached: AtomicBool::new(false),
+            dropped: AtomicU64::new(0),
+            lag: self.shared.metrics.as_ref().map(|m| m.subscriber_lag(name)),
+        });
+        self.shared.slots.lock().push(slot.clone());
+        FrameSubscriber {
+            shared: self.shared.clone(),
+            slot,
+        }
+    }
+
+    /// Offer `item` to every subscriber according to its policy. Never blocks.
+    /// Returns the number of live subscribers.
+    pub fn send(&self, item: T) -> usize {
+        let mut slots = self.shared.slots.lock();
+        slots.retain(|s| !s.detached.load(Ordering::Acquire));
+        for slot in slots.iter() {
+            slot.offer(&item);
+        }
+        slots.len()
+    }
+
+    pub fn subscriber_count(&self) -> usize {
+        self.shared
+            .slots
+            .lock()
+            .iter()
+            .filter(|s| !s.detached.load(Ordering::Acquire))
+            .count()
+    }
+}
+
+impl<T: Clone + Send> Default for FrameBus<T> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<T> Clone for FrameBus<T> {
+    fn clone(&self) -> Self {
+        self.shared.senders.fetch_add(1, Ordering::Relaxed);
+        Self {
+            shared: self.shared.clone(),
+        }
+    }
+}
+
+impl<T> Drop for FrameBus<T> {
+    fn drop(&mut self) {
+        if self.shared.senders.fetch_sub(1, Ordering::AcqRel) == 1 {
+            self.shared.closed.store(true, Ordering::SeqCst);
+            for slot in self.shared.slots.lock().iter() {
+                slot.ready.notify_one();
+            }
+        }
+    }
+}
+
+/// Receiving half of the bus with its own queue. Dropping it unsubscribes.
+pub struct FrameSubscriber<T> {
+    shared: Arc<Shared<T>>,
+    slot: Arc<Slot<T>>,
+}
+
+impl<T> FrameSubscriber<T> {
+    pub fn try_recv(&mut self) -> Result<T, TryRecvError> {
+        let mut queue = self.slot.queue.lock();
+        let Some(item) = queue.items.pop_front() else {
+            return Err(if self.shared.closed.load(Ordering::SeqCst) {
+                TryRecvError::Closed
+            } else {
+                TryRecvError::Empty
+            });
+        };
+        let depth = queue.items.len();
+        drop(queue);
+
+        if let Some(lag) = &self.slot.lag {
+            lag.record_depth(depth);
+        }
+        Ok(item)
+    }
+
+    /// Wait for the next frame. Cancel safe: a frame is only taken from the
+    /// queue when the future completes.
+    pub async fn recv(&mut self) -> Result<T, RecvError> {
+        loop {
+            match self.try_recv() {
+                Ok(item) => return Ok(item),
+                Err(TryRecvError::Closed) => return Err(RecvError::Closed),
+                Err(TryRecvError::Empty) => self.slot.ready.notified().await,
+            }
+        }
+    }
+
+    /// Frames currently queued.
+    pub fn len(&self) -> usize {
+        self.slot.queue.lock().items.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Frames this subscriber's policy has discarded.
+    pub fn dropped(&self) -> u64 {
+        self.slot.dropped.load(Ordering::Relaxed)
+    }
+
+    pub fn name(&self) -> &str {
+        &self.slot.name
+    }
+
+    pub fn delivery(&self) -> Delivery {
+        self.slot.queue.lock().delivery
+    }
+
+    /// Change the policy for frames sent from now on; queued frames are kept.
+    /// E.g. a consumer that subscribes before it can keep up starts out
+    /// dropping the oldest frames and turns lossless once it is running.
+    pub fn set_delivery(&mut self, delivery: Delivery) {
+        self.slot.queue.lock().delivery = delivery;
+    }
+}
+
+impl<T> Drop for FrameSubscriber<T> {
+    fn drop(&mut self) {
+        self.slot.detached.store(true, Ordering::Release);
+        if let Some(lag) = &self.slot.lag {
+            lag.record_depth(0);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::time::Duration;
+
+    #[test]
+    fn lossless_drops_only_past_capacity() {
+        let bus = FrameBus::new();
+        let mut stt = bus.subscribe("stt", Delivery::Lossless { capacity: 4 });
+        for i in 0..4 {
+            bus.send(i);
+        }
+        assert_eq!(stt.dropped(), 0);
+
+        bus.send(4);
+        assert_eq!(stt.len(), 4);
+        assert_eq!(stt.dropped(), 1);
+        let got: Vec<_> = std::iter::from_fn(|| stt.try_recv().ok()).collect();
+        assert_eq!(got, [1, 2, 3, 4]);
+    }
+
+    #[test]
+    fn drop_oldest_keeps_newest_frames_without_backpressure() {
+        let metrics = Arc::new(PipelineMetrics::default());
+        let bus = FrameBus::with_metrics(metrics.clone());
+        let mut ui = bus.subscribe("ui", Delivery::DropOldest { capacity: 3 });
+        for i in 0..10 {
+            bus.send(i);
+        }
+        let got: Vec<_> = std::iter::from_fn(|| ui.try_recv().ok()).collect();
+        assert_eq!(got, [7, 8, 9]);
+
+        let lag = metrics.subscriber_lag("ui");
+        assert_eq!(lag.dropped.load(Ordering::Relaxed), 7);
+        assert_eq!(lag.peak_queued.load(Ordering::Relaxed), 3);
+        assert_eq!(lag.queued.load(Ordering::Relaxed), 0);
+    }
+
+    #[test]
+    fn decimate_delivers_every_nth_frame() {
+        let bus = FrameBus::new();
+        let mut viz = bus.subscribe(
+            "viz",
+            Delivery::Decimate {
+                every: 3,
+                capacity: 8,
+            },
+        );
+        for i in 0..10 {
+            bus.send(i);
+        }
+        let got: Vec<_> = std::iter::from_fn(|| viz.try_recv().ok()).collect();
+        assert_eq!(got, [0, 3, 6, 9]);
+        assert_eq!(viz.dropped(), 0);
+    }
+
+    #[test]
+    fn slow_subscriber_does_not_affect_others() {
+        let bus = FrameBus::new();
+        let mut fast = bus.subscribe("fast", Delivery::Lossless { capacity: 64 });
+        let slow = bus.subscribe("slow", Delivery::DropOldest { capacity: 2 });
+        let stalled = bus.subscribe("stalled", Delivery::Lossless { capacity: 8 });
+        for i in 0..32 {
+            bus.send(i);
+            assert_eq!(fast.try_recv(), Ok(i));
+        }
+        assert_eq!(slow.len(), 2);
+        assert_eq!(stalled.len(), 8);
+        assert_eq!(stalled.dropped(), 24);
+        assert_eq!(fast.dropped(), 0);
+    }
+
+    #[test]
+    fn dropped_subscriber_is_removed() {
+        let bus = FrameBus::new();
+        let stt = bus.subscribe("stt", Delivery::Lossless { capacity: 1 });
+        assert_eq!(bus.send(0), 1);
+        drop(stt);
+        assert_eq!(bus.send(1), 0);
+    }
+
+    #[test]
+    fn switching_to_lossless_keeps_backlog() {
+        let bus = FrameBus::new();
+        let mut stt = bus.subscribe("stt", Delivery::DropOldest { capacity: 2 });
+        for i in 0..5 {
+            bus.send(i);
+        }
+        stt.set_delivery(Delivery::Lossless { capacity: 8 });
+        for i in 5..8 {
+            bus.send(i);
+        }
+        let got: Vec<_> = std::iter::from_fn(|| stt.try_recv().ok()).collect();
+        assert_eq!(got, [3, 4, 5, 6, 7]);
+        assert_eq!(stt.dropped(), 3);
+    }
+
+    #[tokio::test]
+    async fn recv_drains_then_reports_closed() {
+        let bus = FrameBus::new();
+        let mut rx = bus.subscribe("vad", Delivery::Lossless { capacity: 8 });
+        let tx = bus.clone();
+        bus.send(1);
+        drop(bus);
+        tx.send(2);
+        let waiter = tokio::spawn(async move {
+            let mut got = Vec::new();
+            while let Ok(v) = rx.recv().await {
+                got.push(v);
+            }
+            got
+        });
+        tokio::time::sleep(Duration::from_millis(10)).await;
+        tx.send(3);
+        drop(tx);
+        assert_eq!(waiter.await.unwrap(), [1, 2, 3]);
+    }
+}
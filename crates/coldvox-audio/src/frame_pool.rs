@@ -0,0 +1,127 @@
+use std::collections::VecDeque;
+use std::sync::Arc;
+
+/// Recycling pool of fixed-size `Arc<[i16]>` frame buffers.
+///
+/// The chunker fills a frame obtained from [`acquire`](Self::acquire) in place,
+/// hands it to [`release`](Self::release) when it is broadcast, and the pool keeps
+/// one clone. Once every consumer has dropped theirs (strong count back to one)
+/// the buffer is reused. Consumers drop frames roughly in emission order, so the
+/// oldest tracked slot is almost always the free one and `acquire` is O(1) in
+/// steady state, with no heap allocation.
+pub struct FramePool {
+    frame_len: usize,
+    slots: VecDeque<Arc<[i16]>>,
+    max_slots: usize,
+    allocations: u64,
+}
+
+impl FramePool {
+    /// Create a pool of `frame_len`-sample frames tracking at most `max_slots`
+    /// buffers. Size `max_slots` to the number of frames consumers may hold at
+    /// once (e.g. the broadcast channel capacity); frames released beyond that
+    /// are simply freed.
+    pub fn new(frame_len: usize, max_slots: usize) -> Self {
+        Self {
+            frame_len,
+            slots: VecDeque::with_capacity(max_slots),
+            max_slots,
+            allocations: 0,
+        }
+    }
+
+    /// Samples per frame.
+    pub fn frame_len(&self) -> usize {
+        self.frame_len
+    }
+
+    /// Get a uniquely owned frame buffer; `Arc::get_mut` on it always succeeds.
+    ///
+    /// Contents are whatever the previous user left; callers overwrite all of it.
+    pub fn acquire(&mut self) -> Arc<[i16]> {
+        if let Some(idx) = self.slots.iter().position(Self::is_free) {
+            if let Some(frame) = self.slots.remove(idx) {
+                return frame;
+            }
+        }
+        self.allocations += 1;
+        std::iter::repeat(0i16).take(self.frame_len).collect()
+    }
+
+    /// Track an emitted frame so its buffer can be reused once consumers drop it.
+    pub fn release(&mut self, frame: &Arc<[i16]>) {
+        if frame.len() == self.frame_len && self.slots.len() < self.max_slots {
+            self.slots.push_back(Arc::clone(frame));
+        }
+    }
+
+    /// Number of buffers allocated over the pool's lifetime. Flat in steady state.
+    pub fn allocations(&self) -> u64 {
+        self.allocations
+    }
+
+    /// Buffers currently tracked (in use downstream or free for reuse).
+    pub fn tracked(&self) -> usize {
+        self.slots.len()
+    }
+
+    fn is_free(frame: &Arc<[i16]>) -> bool {
+        Arc::strong_count(frame) == 1 && Arc::weak_count(frame) == 0
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn reuses_buffers_once_consumers_drop_them() {
+        let mut pool = FramePool::new(4, 8);
+
+        let mut a = pool.acquire();
+        Arc::get_mut(&mut a).unwrap().copy_from_slice(&[1, 2, 3, 4]);
+        pool.release(&a);
+        assert_eq!(pool.allocations(), 1);
+
+        // Still held downstream: a second frame needs a new buffer
+        let b = pool.acquire();
+        assert_eq!(pool.allocations(), 2);
+        pool.release(&b);
+        drop(b);
+
+        // Consumer drops `a`; its buffer comes back
+        let ptr = a.as_ptr();
+        drop(a);
+        let mut c = pool.acquire();
+        assert_eq!(c.as_ptr(), ptr);
+        assert!(Arc::get_mut(&mut c).is_some());
+    }
+
+    #[test]
+    fn steady_state_does_not_allocate() {
+        let mut pool = FramePool::new(512, 16);
+        let mut in_flight = VecDeque::new();
+
+        // Consumers hold the last 4 frames
+        for i in 0..1000 {
+            let mut frame = pool.acquire();
+            Arc::get_mut(&mut frame).unwrap().fill(i as i16);
+            pool.release(&frame);
+            in_flight.push_back(frame);
+            if in_flight.len() > 4 {
+                in_flight.pop_front();
+            }
+        }
+        assert!(pool.allocations() <= 6, "allocated {}", pool.allocations());
+    }
+
+    #[test]
+    fn release_is_bounded() {
+        let mut pool = FramePool::new(2, 1);
+        let a = pool.acquire();
+        let b = pool.acquire();
+        pool.release(&a);
+        pool.release(&b);
+        assert_eq!(pool.tracked(), 1);
+    }
+}
@@ -1,5 +1,6 @@
+use std::future::Future;
 use std::sync::Arc;
-use std::time::Instant;
+use std::time::{Duration, Instant};
 
 use coldvox_telemetry::{BufferType, PipelineMetrics};
 
@@ -39,22 +40,33 @@ impl FrameReader {
 
     /// Read next audio frame, reconstructing timestamp from sample count
     pub fn read_frame(&mut self, max_samples: usize) -> Option<AudioFrame> {
+        let mut frame = AudioFrame {
+            samples: Vec::new(),
+            timestamp: self.start_time,
+            sample_rate: self.device_sample_rate,
+            channels: self.device_channels,
+        };
+        self.read_frame_into(max_samples, &mut frame)
+            .then_some(frame)
+    }
+
+    /// Like [`read_frame`](Self::read_frame) but reuses `frame`'s sample buffer,
+    /// so a caller that keeps one frame around reads without allocating.
+    ///
+    /// Returns `false` (leaving `frame.samples` empty) when nothing is available.
+    pub fn read_frame_into(&mut self, max_samples: usize, frame: &mut AudioFrame) -> bool {
         if let Some(metrics) = &self.metrics {
-            let available = self.consumer.slots();
-            let fill_percent = if self.capacity > 0 {
-                (available * 100) / self.capacity
-            } else {
-                0
-            };
-            metrics.update_buffer_fill(BufferType::Capture, fill_percent);
+            metrics.update_buffer_fill(BufferType::Capture, self.fill_percent());
         }
 
-        let mut buffer = vec![0i16; max_samples];
-        let samples_read = self.consumer.read(&mut buffer);
+        let buffer = &mut frame.samples;
+        buffer.resize(max_samples, 0);
+        let samples_read = self.consumer.read(buffer);
 
         if samples_read == 0 {
+            buffer.clear();
             tracing::trace!("FrameReader: No samples available to read");
-            return None;
+            return false;
         }
 
         buffer.truncate(samples_read);
@@ -74,12 +86,10 @@ impl FrameReader {
             timestamp
         );
 
-        Some(AudioFrame {
-            samples: buffer,
-            timestamp,
-            sample_rate: self.device_sample_rate,
-            channels: self.device_channels,
-        })
+        frame.timestamp = timestamp;
+        frame.sample_rate = self.device_sample_rate;
+        frame.channels = self.device_channels;
+        true
     }
 
     /// Check how many samples are available to read
@@ -87,6 +97,40 @@ impl FrameReader {
         self.consumer.slots()
     }
 
+    /// How full the ring is, in percent of its capacity.
+    pub fn fill_percent(&self) -> usize {
+        if self.capacity > 0 {
+            (self.consumer.slots() * 100) / self.capacity
+        } else {
+            0
+        }
+    }
+
+    /// Wait until `min_samples` (interleaved, at the device rate) are buffered.
+    ///
+    /// See [`AudioConsumer::wait_for_fill`]; the watermark is capped at the ring
+    /// capacity so a large request cannot wait forever.
+    pub fn wait_for_samples(
+        &self,
+        min_samples: usize,
+        timeout: Duration,
+    ) -> impl Future<Output = Option<Instant>> + Send + 'static {
+        let watermark = if self.capacity > 0 {
+            min_samples.min(self.capacity)
+        } else {
+            min_samples
+        };
+        self.consumer.wait_for_fill(watermark, timeout)
+    }
+
+    pub fn device_sample_rate(&self) -> u32 {
+        self.device_sample_rate
+    }
+
+    pub fn device_channels(&self) -> u16 {
+        self.device_channels
+    }
+
     /// Update device configuration when it changes
     pub fn update_device_config(&mut self, sample_rate: u32, channels: u16) {
         if self.device_sample_rate != sample_rate || self.device_channels != channels {
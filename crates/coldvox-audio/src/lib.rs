@@ -1,9 +1,14 @@
 pub mod capture;
 pub mod chunker;
+pub mod convert;
 pub mod detector;
 pub mod device;
+pub mod features;
+pub mod frame_bus;
+pub mod frame_pool;
 pub mod frame_reader;
 pub mod monitor;
+pub mod polyphase;
 pub mod resampler;
 pub mod ring_buffer;
 #[cfg(unix)]
@@ -11,9 +16,12 @@ pub mod stderr_suppressor;
 pub mod watchdog;
 
 // Public API
-pub use capture::{AudioCaptureThread, DeviceConfig};
-pub use chunker::{AudioChunker, AudioFrame, ChunkerConfig, ResamplerQuality};
+pub use capture::{AudioCaptureThread, CaptureStats, DeviceConfig};
+pub use chunker::{AudioChunker, AudioFrame, ChunkerConfig, InlineChunker, ResamplerQuality};
 pub use device::{DeviceInfo, DeviceManager};
+pub use features::FrameFeatures;
+pub use frame_bus::{Delivery, FrameBus, FrameSubscriber};
+pub use frame_pool::FramePool;
 pub use frame_reader::FrameReader;
 pub use monitor::DeviceMonitor;
 pub use resampler::StreamResampler;
@@ -23,14 +31,22 @@ pub use watchdog::WatchdogTimer;
 use std::sync::Arc;
 use std::time::Instant;
 
-/// Zero-copy shared audio frame used for broadcasting to multiple consumers.
+/// Zero-copy shared audio frame fanned out to consumers over a [`FrameBus`].
 ///
 /// - samples: i16 PCM at the configured sample rate (typically 16kHz mono)
 /// - timestamp: monotonic Instant approximating capture time
 /// - sample_rate: sample rate in Hz for the samples buffer
+/// - read_at: when the frame reader pulled the newest of these samples off
+///   the capture ring
+/// - emitted_at: when the chunker broadcast the frame, for handoff latency
+/// - features: levels measured once by the chunker; consumers read these
+///   instead of rescanning `samples`
 #[derive(Debug, Clone)]
 pub struct SharedAudioFrame {
     pub samples: Arc<[i16]>,
     pub timestamp: Instant,
     pub sample_rate: u32,
+    pub read_at: Instant,
+    pub emitted_at: Instant,
+    pub features: FrameFeatures,
 }
@@ -0,0 +1,302 @@
+//! Polyphase FIR resampler for rational rate ratios.
+//!
+//! For `out/in = L/M` (reduced), output sample `n` sits at position `n*M` on the
+//! virtual `L*in` grid, so it needs only the `K` taps of phase `(n*M) mod L`
+//! against the last `K` input samples. Taps are designed once at construction
+//! (Kaiser-windowed sinc), stored phase-major and reversed so each output is one
+//! contiguous dot product. Channel downmix is fused into the input staging.
+
+use super::chunker::ResamplerQuality;
+
+/// Largest tap table (coefficients) built before deferring to the generic resampler.
+const MAX_TABLE_LEN: usize = 1 << 16;
+
+/// Dot-product width; taps per phase are padded to a multiple of this.
+const LANES: usize = 8;
+
+pub struct PolyphaseResampler {
+    up: usize,
+    down: usize,
+    taps_per_phase: usize,
+    /// `taps[p * K..(p + 1) * K]` is phase `p`, reversed, scaled for unity DC gain.
+    taps: Vec<f32>,
+    /// Mono input (i16 units) not yet consumed, led by `K - 1` samples of history.
+    history: Vec<f32>,
+    /// Index in `history` of the newest sample under the next output's window.
+    pos: usize,
+    phase: usize,
+}
+
+impl PolyphaseResampler {
+    /// Build a resampler for `in_rate -> out_rate`, or `None` when the reduced
+    /// ratio would need a tap table larger than [`MAX_TABLE_LEN`].
+    pub fn new(in_rate: u32, out_rate: u32, quality: ResamplerQuality) -> Option<Self> {
+        if in_rate == 0 || out_rate == 0 {
+            return None;
+        }
+        let g = gcd(in_rate as usize, out_rate as usize);
+        let (up, down) = (out_rate as usize / g, in_rate as usize / g);
+
+        let (zero_crossings, cutoff, beta) = match quality {
+            ResamplerQuality::Fast => (8.0, 0.85, 5.0),
+            ResamplerQuality::Balanced => (16.0, 0.90, 7.0),
+            ResamplerQuality::Quality => (32.0, 0.95, 9.0),
+        };
+        // Span `zero_crossings` periods of the lower of the two rates, in input samples.
+        let span = zero_crossings * (down as f64 / up as f64).max(1.0);
+        let taps_per_phase = (span.ceil() as usize).div_ceil(LANES) * LANES;
+        if up.checked_mul(taps_per_phase)? > MAX_TABLE_LEN {
+            return None;
+        }
+
+        let taps = design_taps(up, down, taps_per_phase, cutoff, beta);
+        let mut resampler = Self {
+            up,
+            down,
+            taps_per_phase,
+            taps,
+            history: Vec::with_capacity(taps_per_phase * 4),
+            pos: 0,
+            phase: 0,
+        };
+        resampler.reset();
+        Some(resampler)
+    }
+
+    /// Reduced `(up, down)` ratio.
+    pub fn ratio(&self) -> (usize, usize) {
+        (self.up, self.down)
+    }
+
+    pub fn taps_per_phase(&self) -> usize {
+        self.taps_per_phase
+    }
+
+    /// Resample interleaved `channels`-channel input, averaging channels to mono on
+    /// the way in, and append the output to `out`.
+    pub fn process_into(&mut self, input: &[i16], channels: usize, out: &mut Vec<i16>) {
+        let channels = channels.max(1);
+        if channels == 1 {
+            self.history.extend(input.iter().map(|&s| s as f32));
+        } else {
+            let scale = 1.0 / channels as f32;
+            self.history.extend(
+                input
+                    .chunks_exact(channels)
+                    .map(|f| f.iter().map(|&s| s as i32).sum::<i32>() as f32 * scale),
+            );
+        }
+
+        let k = self.taps_per_phase;
+        // When decimating, `pos` may already sit past the buffered input
+        let produced = self.history.len().saturating_sub(self.pos) * self.up / self.down + 1;
+        out.reserve(produced);
+        while self.pos < self.history.len() {
+            let window = &self.history[self.pos + 1 - k..=self.pos];
+            let taps = &self.taps[self.phase * k..(self.phase + 1) * k];
+            // Saturating float-to-int cast clamps to the i16 range
+            out.push(dot(window, taps).round() as i16);
+
+            self.phase += self.down;
+            self.pos += self.phase / self.up;
+            self.phase %= self.up;
+        }
+
+        // Keep only the history the next output's window still reaches
+        let consumed = (self.pos + 1 - k).min(self.history.len());
+        self.history.drain(..consumed);
+        self.pos -= consumed;
+    }
+
+    pub fn reset(&mut self) {
+        self.history.clear();
+        self.history.resize(self.taps_per_phase - 1, 0.0);
+        self.pos = self.taps_per_phase - 1;
+        self.phase = 0;
+    }
+}
+
+/// Kaiser-windowed sinc low-pass on the `up * in_rate` grid, split into phases.
+fn design_taps(up: usize, down: usize, k: usize, cutoff: f64, beta: f64) -> Vec<f32> {
+    let n = up * k;
+    // Cutoff in cycles per sample of the upsampled grid
+    let fc = 0.5 * cutoff / up.max(down) as f64;
+    let center = (n - 1) as f64 / 2.0;
+    let i0_beta = bessel_i0(beta);
+    let proto: Vec<f64> = (0..n)
+        .map(|i| {
+            let t = i as f64 - center;
+            let sinc = if t == 0.0 {
+                2.0 * fc
+            } else {
+                (2.0 * std::f64::consts::PI * fc * t).sin() / (std::f64::consts::PI * t)
+            };
+            let r = t / (center + 0.5);
+            sinc * bessel_i0(beta * (1.0 - r * r).max(0.0).sqrt()) / i0_beta
+        })
+        .collect();
+
+    let mut taps = vec![0.0f32; n];
+    for p in 0..up {
+        // Normalize each phase separately so a constant input stays constant
+        let sum: f64 = (0..k).map(|j| proto[p + j * up]).sum();
+        for j in 0..k {
+            taps[p * k + (k - 1 - j)] = (proto[p + j * up] / sum) as f32;
+        }
+    }
+    taps
+}
+
+fn bessel_i0(x: f64) -> f64 {
+    let mut sum = 1.0;
+    let mut term = 1.0;
+    let half = x / 2.0;
+    for k in 1..64 {
+        term *= half / k as f64;
+        sum += term * term;
+        if term * term < sum * 1e-16 {
+            break;
+        }
+    }
+    sum
+}
+
+fn gcd(mut a: usize, mut b: usize) -> usize {
+    while b != 0 {
+        (a, b) = (b, a % b);
+    }
+    a
+}
+
+/// Dot product with independent accumulators so it vectorizes.
+#[inline]
+fn dot(a: &[f32], b: &[f32]) -> f32 {
+    let mut acc = [0.0f32; LANES];
+    for (x, y) in a.chunks_exact(LANES).zip(b.chunks_exact(LANES)) {
+        for i in 0..LANES {
+            acc[i] += x[i] * y[i];
+        }
+    }
+    acc.iter().sum()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn tone(freq: f64, rate: u32, len: usize, amp: f64) -> Vec<i16> {
+        (0..len)
+            .map(|i| {
+                (amp * (2.0 * std::f64::consts::PI * freq * i as f64 / rate as f64).sin()) as i16
+            })
+            .collect()
+    }
+
+    fn rms(samples: &[i16]) -> f64 {
+        let sum: f64 = samples.iter().map(|&s| (s as f64).powi(2)).sum();
+        (sum / samples.len() as f64).sqrt()
+    }
+
+    #[test]
+    fn reduces_common_ratios() {
+        let rs = PolyphaseResampler::new(48_000, 16_000, ResamplerQuality::Balanced).unwrap();
+        assert_eq!(rs.ratio(), (1, 3));
+        assert_eq!(rs.taps_per_phase() % LANES, 0);
+        let rs = PolyphaseResampler::new(44_100, 16_000, ResamplerQuality::Balanced).unwrap();
+        assert_eq!(rs.ratio(), (160, 441));
+        // Coprime rates with a huge table are left to the generic resampler
+        assert!(PolyphaseResampler::new(48_000, 16_001, ResamplerQuality::Balanced).is_none());
+    }
+
+    #[test]
+    fn output_count_follows_ratio_across_chunks() {
+        for (in_rate, out_rate) in [(48_000, 16_000), (44_100, 16_000), (16_000, 48_000)] {
+            let mut rs =
+                PolyphaseResampler::new(in_rate, out_rate, ResamplerQuality::Balanced).unwrap();
+            let input = tone(440.0, in_rate, in_rate as usize, 8000.0);
+            let mut chunked = Vec::new();
+            for chunk in input.chunks(471) {
+                rs.process_into(chunk, 1, &mut chunked);
+            }
+            assert_eq!(chunked.len(), out_rate as usize, "{in_rate} -> {out_rate}");
+
+            // Chunking must not change the result
+            rs.reset();
+            let mut whole = Vec::new();
+            rs.process_into(&input, 1, &mut whole);
+            assert_eq!(whole, chunked);
+        }
+    }
+
+    #[test]
+    fn tiny_chunks_match_whole_input() {
+        for (in_rate, out_rate) in [(48_000, 16_000), (44_100, 16_000), (16_000, 48_000)] {
+            let input = tone(440.0, in_rate, 4800, 8000.0);
+            let mut rs =
+                PolyphaseResampler::new(in_rate, out_rate, ResamplerQuality::Balanced).unwrap();
+            let mut whole = Vec::new();
+            rs.process_into(&input, 1, &mut whole);
+
+            // 100 samples then 1-3 at a time leaves `pos` past the buffered input
+            rs.reset();
+            let mut chunked = Vec::new();
+            rs.process_into(&input[..100], 1, &mut chunked);
+            let mut rest = &input[100..];
+            let mut step = 1;
+            while !rest.is_empty() {
+                let n = step.min(rest.len());
+                rs.process_into(&rest[..n], 1, &mut chunked);
+                rest = &rest[n..];
+                step = step % 3 + 1;
+            }
+            assert_eq!(chunked, whole, "{in_rate} -> {out_rate}");
+        }
+    }
+
+    #[test]
+    fn passes_speech_band_and_rejects_alias() {
+        for q in [
+            ResamplerQuality::Fast,
+            ResamplerQuality::Balanced,
+            ResamplerQuality::Quality,
+        ] {
+            for in_rate in [48_000, 44_100] {
+                let mut rs = PolyphaseResampler::new(in_rate, 16_000, q).unwrap();
+                let mut pass = Vec::new();
+                rs.process_into(&tone(1000.0, in_rate, 9600, 10_000.0), 1, &mut pass);
+                let gain = rms(&pass[200..]) / (10_000.0 / 2f64.sqrt());
+                assert!((0.97..1.03).contains(&gain), "{q:?} {in_rate}: gain {gain}");
+
+                // 11 kHz would fold to 5 kHz at 16 kHz output
+                rs.reset();
+                let mut alias = Vec::new();
+                rs.process_into(&tone(11_000.0, in_rate, 9600, 10_000.0), 1, &mut alias);
+                let leak = rms(&alias[200..]) / (10_000.0 / 2f64.sqrt());
+                assert!(leak < 0.01, "{q:?} {in_rate}: alias leak {leak}");
+            }
+        }
+    }
+
+    #[test]
+    fn fused_downmix_matches_mono_input() {
+        let mono = tone(700.0, 48_000, 4800, 9000.0);
+        let stereo: Vec<i16> = mono.iter().flat_map(|&s| [s, s]).collect();
+        let mut a = PolyphaseResampler::new(48_000, 16_000, ResamplerQuality::Fast).unwrap();
+        let mut b = PolyphaseResampler::new(48_000, 16_000, ResamplerQuality::Fast).unwrap();
+        let (mut out_a, mut out_b) = (Vec::new(), Vec::new());
+        a.process_into(&mono, 1, &mut out_a);
+        b.process_into(&stereo, 2, &mut out_b);
+        assert_eq!(out_a, out_b);
+    }
+
+    #[test]
+    fn constant_input_stays_constant() {
+        let mut rs = PolyphaseResampler::new(16_000, 48_000, ResamplerQuality::Balanced).unwrap();
+        let mut out = Vec::new();
+        rs.process_into(&[1000i16; 1600], 1, &mut out);
+        assert_eq!(out.len(), 4800);
+        for &s in &out[60..] {
+            assert!((999..=1001).contains(&s), "sample {s}");
+        }
+    }
+}
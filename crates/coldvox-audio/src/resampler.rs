@@ -6,21 +6,36 @@ use rubato::{
 };
 
 use super::chunker::ResamplerQuality;
+use super::convert;
+use super::polyphase::PolyphaseResampler;
 
-/// Streaming resampler for mono i16 audio using Rubato's high-quality resampling.
+/// Streaming resampler for i16 audio, producing mono at the output rate.
 ///
-/// - Maintains internal buffers to handle arbitrary-sized input chunks
-/// - Uses Rubato's Async resampler for high-quality, configurable resampling
-/// - Automatically handles buffering for Rubato's fixed chunk requirements
+/// - Integer and rational ratios with a modest tap table (48k, 44.1k -> 16k) use a
+///   [`PolyphaseResampler`] with channel downmix fused into its input staging
+/// - Other ratios fall back to Rubato's Async resampler
+/// - Handles arbitrary-sized input chunks; internal buffers are reused
 pub struct StreamResampler {
     in_rate: u32,
     out_rate: u32,
-    /// Rubato resampler instance
+    backend: Backend,
+}
+
+enum Backend {
+    Passthrough,
+    Polyphase(PolyphaseResampler),
+    Rubato(RubatoResampler),
+}
+
+/// Rubato state for ratios the polyphase path does not cover.
+struct RubatoResampler {
     resampler: Async<f32>,
     /// Input buffer for accumulating samples
     input_buffer: Vec<f32>,
     /// Output buffer for accumulating resampled samples
     output_buffer: Vec<f32>,
+    /// Downmixed input when fed interleaved audio
+    mono_buffer: Vec<i16>,
     /// Chunk size required by Rubato
     chunk_size: usize,
 }
@@ -33,12 +48,117 @@ impl StreamResampler {
 
     /// Create a new mono resampler with specified quality preset.
     pub fn new_with_quality(in_rate: u32, out_rate: u32, quality: ResamplerQuality) -> Self {
+        let backend = if in_rate == out_rate {
+            Backend::Passthrough
+        } else if let Some(poly) = PolyphaseResampler::new(in_rate, out_rate, quality) {
+            Backend::Polyphase(poly)
+        } else {
+            Backend::Rubato(RubatoResampler::new(in_rate, out_rate, quality))
+        };
         tracing::debug!(
-            "Creating resampler: {}Hz -> {}Hz with quality {:?}",
+            "Creating resampler: {}Hz -> {}Hz with quality {:?} ({})",
             in_rate,
             out_rate,
-            quality
+            quality,
+            match &backend {
+                Backend::Passthrough => "passthrough",
+                Backend::Polyphase(_) => "polyphase",
+                Backend::Rubato(_) => "rubato",
+            }
         );
+
+        Self {
+            in_rate,
+            out_rate,
+            backend,
+        }
+    }
+
+    /// Always use the Rubato backend, e.g. for A/B comparison with the polyphase path.
+    pub fn new_rubato(in_rate: u32, out_rate: u32, quality: ResamplerQuality) -> Self {
+        Self {
+            in_rate,
+            out_rate,
+            backend: Backend::Rubato(RubatoResampler::new(in_rate, out_rate, quality)),
+        }
+    }
+
+    /// Process an arbitrary chunk of mono i16 samples.
+    /// Returns a freshly allocated Vec with resampled i16 at out_rate.
+    pub fn process(&mut self, input: &[i16]) -> Vec<i16> {
+        let mut result = Vec::new();
+        self.process_into(input, &mut result);
+        result
+    }
+
+    /// Like [`process`](Self::process) but appends the resampled samples to `out`,
+    /// so callers can reuse one output buffer across calls.
+    pub fn process_into(&mut self, input: &[i16], out: &mut Vec<i16>) {
+        self.process_interleaved_into(input, 1, out);
+    }
+
+    /// Downmix interleaved `channels`-channel input to mono and resample it,
+    /// appending to `out`. The polyphase path does both in a single pass.
+    pub fn process_interleaved_into(&mut self, input: &[i16], channels: usize, out: &mut Vec<i16>) {
+        let start = out.len();
+        match &mut self.backend {
+            Backend::Passthrough => {
+                // Fast path: just copy (or downmix) input
+                tracing::trace!(
+                    "Resampler: Passthrough {} samples (no rate change)",
+                    input.len()
+                );
+                if channels <= 1 {
+                    out.extend_from_slice(input);
+                } else {
+                    out.resize(start + input.len() / channels, 0);
+                    convert::downmix_i16(input, channels, &mut out[start..]);
+                }
+                return;
+            }
+            Backend::Polyphase(poly) => poly.process_into(input, channels, out),
+            Backend::Rubato(rubato) => rubato.process_interleaved_into(input, channels, out),
+        }
+
+        let produced = out.len() - start;
+        if produced > 0 {
+            tracing::trace!(
+                "Resampler: Processed {} input samples -> {} output samples ({}Hz -> {}Hz)",
+                input.len(),
+                produced,
+                self.in_rate,
+                self.out_rate
+            );
+        }
+    }
+
+    /// Reset internal state, clearing buffers and resetting the resampler.
+    pub fn reset(&mut self) {
+        match &mut self.backend {
+            Backend::Passthrough => {}
+            Backend::Polyphase(poly) => poly.reset(),
+            Backend::Rubato(rubato) => rubato.reset(),
+        }
+    }
+
+    /// Current input rate.
+    pub fn input_rate(&self) -> u32 {
+        self.in_rate
+    }
+
+    /// Current output rate.
+    pub fn output_rate(&self) -> u32 {
+        self.out_rate
+    }
+
+    /// Whether the polyphase fast path is in use for this ratio.
+    pub fn is_polyphase(&self) -> bool {
+        matches!(self.backend, Backend::Polyphase(_))
+    }
+}
+
+impl RubatoResampler {
+    fn new(in_rate: u32, out_rate: u32, quality: ResamplerQuality) -> Self {
         // For VAD, we want low latency, so use a relatively small chunk size
         // 512 samples at 16kHz = 32ms, which aligns well with typical VAD frame sizes
         let chunk_size = 512;
@@ -91,27 +211,27 @@ impl StreamResampler {
         };
 
         Self {
-            in_rate,
-            out_rate,
             resampler,
             input_buffer: Vec::with_capacity(chunk_size * 2),
             output_buffer: Vec::new(),
+            mono_buffer: Vec::new(),
             chunk_size,
         }
     }
 
-    /// Process an arbitrary chunk of mono i16 samples.
-    /// Returns a freshly allocated Vec with resampled i16 at out_rate.
-    pub fn process(&mut self, input: &[i16]) -> Vec<i16> {
-        if self.in_rate == self.out_rate {
-            // Fast path: just clone input
-            tracing::trace!(
-                "Resampler: Passthrough {} samples (no rate change)",
-                input.len()
-            );
-            return input.to_vec();
+    fn process_interleaved_into(&mut self, input: &[i16], channels: usize, out: &mut Vec<i16>) {
+        if channels <= 1 {
+            self.process_into(input, out);
+        } else {
+            let mut mono = std::mem::take(&mut self.mono_buffer);
+            mono.resize(input.len() / channels, 0);
+            convert::downmix_i16(input, channels, &mut mono);
+            self.process_into(&mono, out);
+            self.mono_buffer = mono;
         }
+    }
 
+    fn process_into(&mut self, input: &[i16], out: &mut Vec<i16>) {
         // Convert i16 to f32 and append to input buffer
         for &sample in input {
             self.input_buffer.push(sample as f32 / 32768.0);
@@ -140,54 +260,29 @@ impl StreamResampler {
                 }
                 Err(e) => {
                     tracing::error!("Resampler error: {}", e);
-                    // Return empty on error to maintain stream continuity
-                    return Vec::new();
+                    // Drop this chunk's output on error to maintain stream continuity
+                    self.output_buffer.clear();
+                    return;
                 }
             }
         }
 
         // Convert accumulated f32 samples back to i16
-        let mut result = Vec::with_capacity(self.output_buffer.len());
-        for &sample in &self.output_buffer {
+        out.extend(self.output_buffer.iter().map(|&sample| {
             // Clamp to [-1.0, 1.0] and convert to i16
-            let clamped = sample.clamp(-1.0, 1.0);
-            let i16_sample = (clamped * 32767.0).round() as i16;
-            result.push(i16_sample);
-        }
+            (sample.clamp(-1.0, 1.0) * 32767.0).round() as i16
+        }));
 
         // Clear the output buffer for next time
         self.output_buffer.clear();
-
-        if !result.is_empty() {
-            tracing::trace!(
-                "Resampler: Processed {} input samples -> {} output samples ({}Hz -> {}Hz)",
-                input.len(),
-                result.len(),
-                self.in_rate,
-                self.out_rate
-            );
-        }
-
-        result
     }
 
-    /// Reset internal state, clearing buffers and resetting the resampler.
-    pub fn reset(&mut self) {
+    fn reset(&mut self) {
         self.input_buffer.clear();
         self.output_buffer.clear();
         // Reset the resampler's internal state
         self.resampler.reset();
     }
-
-    /// Current input rate.
-    pub fn input_rate(&self) -> u32 {
-        self.in_rate
-    }
-
-    /// Current output rate.
-    pub fn output_rate(&self) -> u32 {
-        self.out_rate
-    }
 }
 
 #[cfg(test)]
@@ -271,6 +366,27 @@ mod tests {
         }
     }
 
+    #[test]
+    fn common_ratios_use_polyphase() {
+        assert!(StreamResampler::new(48_000, 16_000).is_polyphase());
+        assert!(StreamResampler::new(44_100, 16_000).is_polyphase());
+        assert!(!StreamResampler::new(48_000, 16_001).is_polyphase());
+        assert!(!StreamResampler::new(16_000, 16_000).is_polyphase());
+    }
+
+    #[test]
+    fn rubato_fallback_downmixes_interleaved() {
+        let mut rs = StreamResampler::new(48_000, 16_001);
+        let stereo: Vec<i16> = (0..9600)
+            .map(|i| if i % 2 == 0 { 1000 } else { -1000 })
+            .collect();
+        let mut out = Vec::new();
+        rs.process_interleaved_into(&stereo, 2, &mut out);
+        rs.process_interleaved_into(&stereo, 2, &mut out);
+        assert!(!out.is_empty());
+        assert!(out.iter().all(|&s| s.abs() <= 1), "L/R cancel to silence");
+    }
+
     #[test]
     fn passthrough_same_rate() {
         let mut rs = StreamResampler::new(16_000, 16_000);
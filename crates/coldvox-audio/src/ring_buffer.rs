@@ -1,4 +1,8 @@
 use rtrb::{Consumer, Producer, RingBuffer};
+use std::future::Future;
+use std::sync::atomic::{fence, AtomicBool, AtomicU64, AtomicUsize, Ordering};
+use std::sync::Arc;
+use std::time::{Duration, Instant};
 use tracing::{trace, warn};
 
 use coldvox_foundation::error::{AudioError, ColdVoxError};
@@ -7,13 +11,20 @@ use coldvox_foundation::error::{AudioError, ColdVoxError};
 pub struct AudioRingBuffer {
     producer: Producer<i16>,
     consumer: Consumer<i16>,
+    capacity: usize,
+    notifier: Arc<FillNotifier>,
 }
 
 impl AudioRingBuffer {
     /// Create a new ring buffer with the specified capacity
     pub fn new(capacity: usize) -> Self {
         let (producer, consumer) = RingBuffer::new(capacity);
-        Self { producer, consumer }
+        Self {
+            producer,
+            consumer,
+            capacity,
+            notifier: Arc::new(FillNotifier::new()),
+        }
     }
 
     /// Split into producer and consumer for separate threads
@@ -21,20 +32,208 @@ impl AudioRingBuffer {
         (
             AudioProducer {
                 producer: self.producer,
+                capacity: self.capacity,
+                notifier: Arc::clone(&self.notifier),
             },
             AudioConsumer {
                 consumer: self.consumer,
+                notifier: self.notifier,
             },
         )
     }
 }
 
+/// Wakes the consumer task when the ring buffer fill crosses a watermark.
+///
+/// The consumer sets the watermark and arms the notifier before parking. On each
+/// write the producer checks the armed flag and the fill level; only the write
+/// that crosses the watermark while armed signals, so the audio thread wakes the
+/// consumer at most once per wait. Nothing on the producer side takes a lock
+/// (see [`Wake`]).
+///
+/// Arming and writing follow the store-then-load pattern on both sides (the
+/// consumer stores `armed` then loads the fill; the producer commits samples
+/// then loads `armed`), so both are separated by a `SeqCst` fence: at least one
+/// side always sees the other's store, and a crossing cannot go unnoticed.
+#[derive(Debug)]
+struct FillNotifier {
+    watermark: AtomicUsize,
+    armed: AtomicBool,
+    epoch: Instant,
+    /// Nanoseconds since `epoch` when the crossing was signalled; 0 = not signalled.
+    signaled_at_nanos: AtomicU64,
+    wake: Wake,
+}
+
+impl FillNotifier {
+    fn new() -> Self {
+        Self {
+            watermark: AtomicUsize::new(1),
+            armed: AtomicBool::new(false),
+            epoch: Instant::now(),
+            signaled_at_nanos: AtomicU64::new(0),
+            wake: Wake::new(),
+        }
+    }
+
+    /// Producer side, called after each commit with the resulting fill.
+    #[inline]
+    fn on_fill(&self, filled: usize) {
+        fence(Ordering::SeqCst);
+        if self.armed.load(Ordering::Acquire)
+            && filled >= self.watermark.load(Ordering::Relaxed)
+            && self.armed.swap(false, Ordering::AcqRel)
+        {
+            let nanos = self.epoch.elapsed().as_nanos().clamp(1, u64::MAX as u128) as u64;
+            self.signaled_at_nanos.store(nanos, Ordering::Release);
+            self.wake.signal();
+        }
+    }
+
+    /// Consumer side: arm for `watermark`, then report whether `filled()`
+    /// already reaches it (no wakeup will come in that case).
+    fn arm(&self, watermark: usize, filled: impl FnOnce() -> usize) -> bool {
+        self.wake.take();
+        self.watermark.store(watermark, Ordering::Relaxed);
+        self.signaled_at_nanos.store(0, Ordering::Relaxed);
+        self.armed.store(true, Ordering::Release);
+        fence(Ordering::SeqCst);
+        filled() >= watermark
+    }
+
+    fn signaled_at(&self) -> Option<Instant> {
+        match self.signaled_at_nanos.load(Ordering::Acquire) {
+            0 => None,
+            nanos => Some(self.epoch + Duration::from_nanos(nanos)),
+        }
+    }
+}
+
+/// Poll period of the flag fallback in [`Wake`].
+const WAKE_POLL_INTERVAL: Duration = Duration::from_millis(1);
+
+/// Lock-free wakeup from the audio thread to an async task.
+///
+/// On Linux this is an eventfd: signalling is one non-blocking `write(2)` with
+/// no user-space lock (how PipeWire wakes its non-real-time threads), and the
+/// consumer awaits readability on the tokio reactor. Elsewhere, or if the
+/// eventfd cannot be created, the producer only sets a flag and the consumer
+/// polls it every [`WAKE_POLL_INTERVAL`].
+#[derive(Debug)]
+enum Wake {
+    #[cfg(target_os = "linux")]
+    EventFd(std::os::fd::OwnedFd),
+    Flag(AtomicBool),
+}
+
+impl Wake {
+    fn new() -> Self {
+        #[cfg(target_os = "linux")]
+        {
+            use std::os::fd::FromRawFd;
+            // SAFETY: eventfd returns a new descriptor we own, or -1.
+            let fd = unsafe { libc::eventfd(0, libc::EFD_NONBLOCK | libc::EFD_CLOEXEC) };
+            if fd >= 0 {
+                // SAFETY: fd is valid and owned by nobody else.
+                return Wake::EventFd(unsafe { std::os::fd::OwnedFd::from_raw_fd(fd) });
+            }
+            warn!("eventfd unavailable, ring buffer wakeups fall back to polling");
+        }
+        Wake::Flag(AtomicBool::new(false))
+    }
+
+    /// Real-time safe: never blocks or allocates.
+    #[inline]
+    fn signal(&self) {
+        match self {
+            #[cfg(target_os = "linux")]
+            Wake::EventFd(fd) => {
+                use std::os::fd::AsRawFd;
+                let one: u64 = 1;
+                // SAFETY: writes 8 bytes from a live u64 to our eventfd. A full
+                // counter (EAGAIN) still leaves the fd readable, so the result
+                // can be ignored.
+                unsafe {
+                    libc::write(fd.as_raw_fd(), (&one as *const u64).cast(), 8);
+                }
+            }
+            Wake::Flag(flag) => flag.store(true, Ordering::Release),
+        }
+    }
+
+    /// Consume a pending signal; returns whether there was one.
+    fn take(&self) -> bool {
+        match self {
+            #[cfg(target_os = "linux")]
+            Wake::EventFd(fd) => {
+                use std::os::fd::AsRawFd;
+                let mut count: u64 = 0;
+                // SAFETY: reads 8 bytes into a live u64 from our non-blocking eventfd.
+                let n = unsafe { libc::read(fd.as_raw_fd(), (&mut count as *mut u64).cast(), 8) };
+                n == 8
+            }
+            Wake::Flag(flag) => flag.swap(false, Ordering::Acquire),
+        }
+    }
+
+    /// Resolve once a signal is pending (it is left for [`take`](Self::take)).
+    async fn wait(&self) {
+        #[cfg(target_os = "linux")]
+        if let Wake::EventFd(fd) = self {
+            use std::os::fd::AsRawFd;
+            use tokio::io::unix::AsyncFd;
+            use tokio::io::Interest;
+            // Registered per wait so the future works on whichever runtime
+            // polls it; fails only without an I/O driver, then we poll.
+            if let Ok(async_fd) = AsyncFd::with_interest(fd.as_raw_fd(), Interest::READABLE) {
+                let _ = async_fd.readable().await;
+                return;
+            }
+        }
+        while !self.pending() {
+            tokio::time::sleep(WAKE_POLL_INTERVAL).await;
+        }
+    }
+
+    fn pending(&self) -> bool {
+        match self {
+            #[cfg(target_os = "linux")]
+            Wake::EventFd(fd) => {
+                use std::os::fd::AsRawFd;
+                let mut pfd = libc::pollfd {
+                    fd: fd.as_raw_fd(),
+                    events: libc::POLLIN,
+                    revents: 0,
+                };
+                // SAFETY: polls one live descriptor without blocking.
+                unsafe { libc::poll(&mut pfd, 1, 0) > 0 }
+            }
+            Wake::Flag(flag) => flag.load(Ordering::Acquire),
+        }
+    }
+}
+
 /// Producer half of the ring buffer (for audio callback thread)
 pub struct AudioProducer {
     producer: Producer<i16>,
+    capacity: usize,
+    notifier: Arc<FillNotifier>,
 }
 
 impl AudioProducer {
+    /// A producer with no backing storage; every non-empty write reports overflow.
+    ///
+    /// Left in a shared producer slot while the real producer is leased to a
+    /// real-time capture callback.
+    pub fn detached() -> Self {
+        let (producer, _) = RingBuffer::new(0);
+        Self {
+            producer,
+            capacity: 0,
+            notifier: Arc::new(FillNotifier::new()),
+        }
+    }
+
     /// Write samples from audio callback (non-blocking)
     pub fn write(&mut self, samples: &[i16]) -> Result<usize, ColdVoxError> {
         let mut chunk = match self.producer.write_chunk(samples.len()) {
@@ -61,10 +260,71 @@ impl AudioProducer {
             second.copy_from_slice(&samples[split..]);
         }
         chunk.commit_all();
+        self.signal_fill();
         trace!("Ring buffer: wrote {} samples", samples.len());
         Ok(samples.len())
     }
 
+    /// Convert and write samples straight into the ring's write chunk.
+    ///
+    /// Real-time safe: no intermediate buffer and no logging. Like [`write`](Self::write)
+    /// this is all-or-nothing; if the whole slice does not fit nothing is written.
+    pub fn write_map<T: Copy>(
+        &mut self,
+        samples: &[T],
+        mut convert: impl FnMut(T) -> i16,
+    ) -> Result<usize, ColdVoxError> {
+        let mut chunk =
+            self.producer
+                .write_chunk(samples.len())
+                .map_err(|_| AudioError::BufferOverflow {
+                    count: samples.len(),
+                })?;
+
+        let (first, second) = chunk.as_mut_slices();
+        let (head, tail) = samples.split_at(first.len());
+        for (dst, &src) in first.iter_mut().zip(head) {
+            *dst = convert(src);
+        }
+        for (dst, &src) in second.iter_mut().zip(tail) {
+            *dst = convert(src);
+        }
+        chunk.commit_all();
+        self.signal_fill();
+        Ok(samples.len())
+    }
+
+    /// Like [`write_map`](Self::write_map) but converts slice-wise, so `convert`
+    /// can use a vectorized kernel. It is called once per contiguous region of the
+    /// write chunk (twice when the ring wraps) with equal-length slices.
+    pub fn write_with<T: Copy>(
+        &mut self,
+        samples: &[T],
+        mut convert: impl FnMut(&[T], &mut [i16]),
+    ) -> Result<usize, ColdVoxError> {
+        let mut chunk =
+            self.producer
+                .write_chunk(samples.len())
+                .map_err(|_| AudioError::BufferOverflow {
+                    count: samples.len(),
+                })?;
+
+        let (first, second) = chunk.as_mut_slices();
+        let (head, tail) = samples.split_at(first.len());
+        convert(head, first);
+        if !second.is_empty() {
+            convert(tail, second);
+        }
+        chunk.commit_all();
+        self.signal_fill();
+        Ok(samples.len())
+    }
+
+    #[inline]
+    fn signal_fill(&self) {
+        self.notifier.on_fill(self.capacity - self.producer.slots());
+    }
+
     /// Check available space
     pub fn slots(&self) -> usize {
         self.producer.slots()
@@ -74,6 +334,7 @@ impl AudioProducer {
 /// Consumer half of the ring buffer (for processing thread)
 pub struct AudioConsumer {
     consumer: Consumer<i16>,
+    notifier: Arc<FillNotifier>,
 }
 
 impl AudioConsumer {
@@ -111,6 +372,37 @@ impl AudioConsumer {
     pub fn slots(&self) -> usize {
         self.consumer.slots()
     }
+
+    /// Wait until at least `watermark` samples are buffered or `timeout` elapses.
+    ///
+    /// Resolves to the instant at which the producer signalled the crossing, or
+    /// `None` if the data was already there, the wait timed out, or the wakeup was
+    /// stale. Callers should always re-check [`slots`](Self::slots) afterwards.
+    ///
+    /// The returned future does not borrow the consumer, so it can be awaited
+    /// from a `Send` task while the consumer half stays `!Sync`.
+    pub fn wait_for_fill(
+        &self,
+        watermark: usize,
+        timeout: Duration,
+    ) -> impl Future<Output = Option<Instant>> + Send + 'static {
+        let watermark = watermark.max(1);
+        let notifier = Arc::clone(&self.notifier);
+        // Checked after arming so a write that landed in between is not missed
+        let ready = notifier.arm(watermark, || self.consumer.slots());
+
+        async move {
+            if !ready {
+                let _ = tokio::time::timeout(timeout, notifier.wake.wait()).await;
+            }
+            notifier.armed.store(false, Ordering::Relaxed);
+            if ready {
+                None
+            } else {
+                notifier.signaled_at()
+            }
+        }
+    }
 }
 
 #[cfg(test)]
@@ -146,4 +438,115 @@ mod tests {
         let samples = vec![2i16; 1];
         assert!(producer.write(&samples).is_err());
     }
+
+    #[test]
+    fn test_write_map_wraps() {
+        let rb = AudioRingBuffer::new(8);
+        let (mut producer, mut consumer) = rb.split();
+
+        // Advance the indices so the next write straddles the wrap point
+        producer.write(&[0i16; 6]).unwrap();
+        let mut sink = vec![0i16; 6];
+        assert_eq!(consumer.read(&mut sink), 6);
+
+        let src = [1.0f32, -1.0, 0.5, -0.5];
+        let written = producer.write_map(&src, |s| (s * 100.0) as i16).unwrap();
+        assert_eq!(written, 4);
+
+        let mut buffer = vec![0i16; 8];
+        assert_eq!(consumer.read(&mut buffer), 4);
+        assert_eq!(&buffer[..4], &[100, -100, 50, -50]);
+
+        assert!(producer.write_map(&[0u16; 9], |s| s as i16).is_err());
+    }
+
+    #[test]
+    fn test_write_with_splits_at_wrap() {
+        let rb = AudioRingBuffer::new(8);
+        let (mut producer, mut consumer) = rb.split();
+        producer.write(&[0i16; 6]).unwrap();
+        let mut sink = vec![0i16; 6];
+        assert_eq!(consumer.read(&mut sink), 6);
+
+        let mut calls = Vec::new();
+        let src = [1u16, 2, 3, 4];
+        producer
+            .write_with(&src, |s, d| {
+                calls.push(s.len());
+                for (d, &s) in d.iter_mut().zip(s) {
+                    *d = s as i16 * 10;
+                }
+            })
+            .unwrap();
+        assert_eq!(calls, vec![2, 2]);
+
+        let mut buffer = vec![0i16; 4];
+        assert_eq!(consumer.read(&mut buffer), 4);
+        assert_eq!(buffer, vec![10, 20, 30, 40]);
+    }
+
+    #[tokio::test]
+    async fn test_wait_for_fill_wakes_on_watermark() {
+        let rb = AudioRingBuffer::new(64);
+        let (mut producer, consumer) = rb.split();
+
+        let writer = std::thread::spawn(move || {
+            std::thread::sleep(Duration::from_millis(20));
+            producer.write(&[0i16; 8]).unwrap();
+            std::thread::sleep(Duration::from_millis(20));
+            producer.write(&[0i16; 8]).unwrap();
+        });
+
+        let signaled = consumer.wait_for_fill(16, Duration::from_secs(5)).await;
+        assert!(signaled.is_some(), "should be woken by the crossing write");
+        assert!(consumer.slots() >= 16);
+        writer.join().unwrap();
+
+        // Already above the watermark: returns immediately without a signal
+        assert!(consumer
+            .wait_for_fill(16, Duration::from_secs(5))
+            .await
+            .is_none());
+    }
+
+    #[tokio::test]
+    async fn test_wait_for_fill_never_misses_a_crossing() {
+        let rb = AudioRingBuffer::new(1024);
+        let (mut producer, mut consumer) = rb.split();
+        let (go_tx, go_rx) = std::sync::mpsc::channel::<u64>();
+        let writer = std::thread::spawn(move || {
+            // Race each write against the consumer arming its wait
+            while let Ok(spin) = go_rx.recv() {
+                for _ in 0..spin {
+                    std::hint::spin_loop();
+                }
+                producer.write(&[1i16; 16]).unwrap();
+            }
+        });
+
+        let mut sink = [0i16; 16];
+        for round in 0..500u64 {
+            go_tx.send(round % 50 * 20).unwrap();
+            let started = Instant::now();
+            consumer.wait_for_fill(16, Duration::from_secs(5)).await;
+            assert!(
+                started.elapsed() < Duration::from_secs(1),
+                "round {round}: wakeup missed"
+            );
+            while consumer.slots() < 16 {
+                tokio::task::yield_now().await;
+            }
+            assert_eq!(consumer.read(&mut sink), 16);
+        }
+        drop(go_tx);
+        writer.join().unwrap();
+    }
+
+    #[test]
+    fn test_detached_rejects_writes() {
+        let mut producer = AudioProducer::detached();
+        assert_eq!(producer.slots(), 0);
+        assert!(producer.write(&[1, 2, 3]).is_err());
+        assert!(producer.write_map(&[1i16], |s| s).is_err());
+    }
 }
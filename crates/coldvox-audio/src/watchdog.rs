@@ -1,15 +1,21 @@
 use parking_lot::RwLock;
-use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::atomic::{AtomicBool, AtomicU64, Ordering};
 use std::sync::Arc;
 use std::thread::{self, JoinHandle};
 use std::time::{Duration, Instant};
 
 use coldvox_foundation::clock::SharedClock;
 
+/// Sentinel for "never fed" in `last_feed_nanos`.
+const NOT_FED: u64 = u64::MAX;
+
 #[derive(Clone)]
 pub struct WatchdogTimer {
     timeout: Duration,
-    last_feed: Arc<RwLock<Option<Instant>>>,
+    // Feed time as nanoseconds since `epoch`, so `feed()` is a single atomic
+    // store and safe to call from the real-time audio callback.
+    epoch: Instant,
+    last_feed_nanos: Arc<AtomicU64>,
     triggered: Arc<AtomicBool>,
     handle: Arc<RwLock<Option<JoinHandle<()>>>>,
     clock: SharedClock,
@@ -23,7 +29,8 @@ impl WatchdogTimer {
     pub fn new_with_clock(timeout: Duration, clock: SharedClock) -> Self {
         Self {
             timeout,
-            last_feed: Arc::new(RwLock::new(None)),
+            epoch: clock.now(),
+            last_feed_nanos: Arc::new(AtomicU64::new(NOT_FED)),
             triggered: Arc::new(AtomicBool::new(false)),
             handle: Arc::new(RwLock::new(None)),
             clock,
@@ -32,35 +39,28 @@ impl WatchdogTimer {
 
     pub fn start(&mut self, running: Arc<AtomicBool>) {
         let timeout = self.timeout;
-        let last_feed = Arc::clone(&self.last_feed);
+        let epoch = self.epoch;
+        let last_feed_nanos = Arc::clone(&self.last_feed_nanos);
         let triggered = Arc::clone(&self.triggered);
         let clock = Arc::clone(&self.clock);
 
         // Initialize the last feed time
-        *last_feed.write() = Some(clock.now());
+        self.last_feed_nanos
+            .store(self.nanos_since_epoch(), Ordering::Release);
 
         let handle = thread::spawn(move || {
             while running.load(Ordering::SeqCst) {
                 clock.sleep(Duration::from_secs(1));
 
                 let now = clock.now();
-                let should_trigger = {
-                    let guard = last_feed.read();
-                    if let Some(last_time) = *guard {
-                        let elapsed = now.duration_since(last_time);
-                        elapsed > timeout && !triggered.load(Ordering::SeqCst)
-                    } else {
-                        false
-                    }
-                };
+                let nanos = last_feed_nanos.load(Ordering::Acquire);
+                if nanos == NOT_FED {
+                    continue;
+                }
+                let last_time = epoch + Duration::from_nanos(nanos);
+                let elapsed = now.saturating_duration_since(last_time);
 
-                if should_trigger {
-                    let elapsed = {
-                        let guard = last_feed.read();
-                        guard
-                            .map(|last_time| now.duration_since(last_time))
-                            .unwrap_or(Duration::ZERO)
-                    };
+                if elapsed > timeout && !triggered.load(Ordering::SeqCst) {
                     tracing::error!("Watchdog timeout! No audio data for {:?}", elapsed);
                     triggered.store(true, Ordering::SeqCst);
                 }
@@ -70,11 +70,21 @@ impl WatchdogTimer {
         *self.handle.write() = Some(handle);
     }
 
+    /// Record audio activity. Lock-free; called from the capture callback.
     pub fn feed(&self) {
-        *self.last_feed.write() = Some(self.clock.now());
+        self.last_feed_nanos
+            .store(self.nanos_since_epoch(), Ordering::Release);
         self.triggered.store(false, Ordering::SeqCst);
     }
 
+    fn nanos_since_epoch(&self) -> u64 {
+        self.clock
+            .now()
+            .saturating_duration_since(self.epoch)
+            .as_nanos()
+            .min((NOT_FED - 1) as u128) as u64
+    }
+
     pub fn is_triggered(&self) -> bool {
         self.triggered.load(Ordering::SeqCst)
     }
@@ -85,6 +95,6 @@ impl WatchdogTimer {
             let _ = handle.join();
         }
         self.triggered.store(false, Ordering::SeqCst);
-        *self.last_feed.write() = None;
+        self.last_feed_nanos.store(NOT_FED, Ordering::Release);
     }
 }
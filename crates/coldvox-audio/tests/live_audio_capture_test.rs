@@ -27,6 +27,7 @@ mod live_audio_tests {
         let config = AudioConfig {
             silence_threshold: 100,
             capture_buffer_samples: 65536,
+            ..Default::default()
         };
 
         // Create ring buffer for audio data
@@ -243,6 +243,19 @@ impl ColdVoxError {
     }
 }
 
+/// How the cpal input callback hands samples to the capture ring buffer.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum CaptureMode {
+    /// The callback locks the shared producer (and silence detector) on every
+    /// buffer. Other writers, such as WAV injection in tests, may share the producer.
+    #[default]
+    Shared,
+    /// The producer is leased to the callback for the lifetime of the stream.
+    /// Conversion writes straight into the ring buffer and all bookkeeping is
+    /// atomic: no locks and no allocations on the audio thread.
+    RealTime,
+}
+
 #[derive(Debug, Clone, Copy)]
 pub struct AudioConfig {
     pub silence_threshold: i16,
@@ -251,6 +264,7 @@ pub struct AudioConfig {
     /// worst-case latency. The default (65536) is sized to prevent overflows during
     /// typical STT/VAD/text-injection processing.
     pub capture_buffer_samples: usize,
+    pub capture_mode: CaptureMode,
 }
 
 impl Default for AudioConfig {
@@ -258,6 +272,7 @@ impl Default for AudioConfig {
         Self {
             silence_threshold: 100,
             capture_buffer_samples: 65_536, // 16_384 * 4, ~4.1s at 16kHz
+            capture_mode: CaptureMode::default(),
         }
     }
 }
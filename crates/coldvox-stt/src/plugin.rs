@@ -91,6 +91,12 @@ pub trait SttPlugin: Send + Sync + Debug {
     /// Reset the plugin state for a new session
     async fn reset(&mut self) -> Result<(), ColdVoxError>;
 
+    /// Called when speech starts, before any audio arrives. Remote plugins
+    /// open connections here; must not block on the network.
+    async fn warm_up(&mut self) -> Result<(), ColdVoxError> {
+        Ok(())
+    }
+
     /// Load a model or connect to service
     async fn load_model(&mut self, _model_path: Option<&Path>) -> Result<(), ColdVoxError> {
         // Default implementation for plugins that don't need models
@@ -225,6 +231,10 @@ pub struct PluginSelectionConfig {
 
     /// Automatically extract model from a zip archive if not found
     pub auto_extract_model: bool,
+
+    /// Race a second engine against the active one on every utterance
+    #[serde(default)]
+    pub race: Option<RaceConfig>,
 }
 
 impl Default for PluginSelectionConfig {
@@ -239,6 +249,7 @@ impl Default for PluginSelectionConfig {
             gc_policy: Some(GcPolicy::default()),
             metrics: Some(MetricsConfig::default()),
             auto_extract_model: true,
+            race: None,
         }
     }
 }
@@ -282,6 +293,11 @@ pub struct FailoverConfig {
 
     /// Cooldown period in seconds before retrying a failed plugin
     pub failover_cooldown_secs: u32,
+
+    /// Keep the next fallback plugin initialized so failover skips the model
+    /// load; active plus standby must fit `max_memory_mb`
+    #[serde(default)]
+    pub hot_standby: bool,
 }
 
 impl Default for FailoverConfig {
@@ -289,10 +305,25 @@ impl Default for FailoverConfig {
         Self {
             failover_threshold: 3,
             failover_cooldown_secs: 30,
+            hot_standby: false,
         }
     }
 }
 
+/// Configuration for racing two engines on the same utterance
+#[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
+pub struct RaceConfig {
+    /// Plugin ID run alongside the active plugin
+    pub plugin: String,
+
+    /// Mean word confidence a final result needs to win before the other
+    /// engine answers. Applies only to engines that report confidence
+    /// (`confidence_scores`); a non-empty final from one that does not wins
+    /// on arrival
+    #[serde(default)]
+    pub min_confidence: f32,
+}
+
 /// Configuration for garbage collection of inactive models
 #[derive(Debug, Clone, serde::Serialize, serde::Deserialize)]
 pub struct GcPolicy {
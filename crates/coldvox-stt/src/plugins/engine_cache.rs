@@ -0,0 +1,286 @@
+//! On-disk cache for GPU inference engines compiled from ONNX models.
+//!
+//! TensorRT builds an engine per model, GPU and option set, which can take
+//! minutes. Each combination gets its own directory under
+//! `~/.coldvox/engine-cache/<backend>/<key>`, so later loads (process start
+//! or a reload after GC) deserialize the engine instead of rebuilding it.
+//!
+//! The key hashes the model files' names, sizes and modification times rather
+//! than their contents, so computing it never reads multi-GB weights. It uses
+//! FNV-1a over explicitly encoded fields, so the same inputs map to the same
+//! directory across Rust releases and platforms.
+
+use std::ffi::OsString;
+use std::io;
+use std::path::{Path, PathBuf};
+use std::time::{SystemTime, UNIX_EPOCH};
+
+/// Entries kept per backend; older ones (e.g. for a replaced GPU driver) are pruned.
+pub const MAX_ENTRIES: usize = 4;
+
+/// One cache entry: the directory holding engines for a single model, GPU
+/// and option set.
+#[derive(Debug, Clone)]
+pub struct EngineCache {
+    dir: PathBuf,
+    key: String,
+}
+
+impl EngineCache {
+    /// `~/.coldvox/engine-cache`, if there is a home directory.
+    pub fn default_root() -> Option<PathBuf> {
+        dirs::home_dir().map(|home| home.join(".coldvox").join("engine-cache"))
+    }
+
+    /// Open (creating if needed) the entry for `model_path` on `gpu` with
+    /// `options`, under `root/backend`, and prune old entries.
+    pub fn open(
+        root: &Path,
+        backend: &str,
+        model_path: &Path,
+        gpu: &str,
+        options: &[(&str, &str)],
+    ) -> io::Result<Self> {
+        let key = cache_key(model_path, gpu, options)?;
+        let backend_dir = root.join(backend);
+        let dir = backend_dir.join(&key);
+        std::fs::create_dir_all(&dir)?;
+        // Bump the entry so pruning treats it as most recently used
+        std::fs::write(dir.join(".last-used"), gpu)?;
+        prune(&backend_dir, MAX_ENTRIES)?;
+        Ok(Self { dir, key })
+    }
+
+    pub fn dir(&self) -> &Path {
+        &self.dir
+    }
+
+    pub fn key(&self) -> &str {
+        &self.key
+    }
+
+    /// Whether an earlier load left engines here.
+    pub fn is_warm(&self) -> bool {
+        !self.snapshot().is_empty()
+    }
+
+    /// Engine and timing-cache files in this entry with their modification
+    /// times, sorted by name. A load that reused the entry leaves the
+    /// snapshot unchanged; one that rebuilt writes or rewrites files.
+    pub fn snapshot(&self) -> Vec<(OsString, Option<SystemTime>)> {
+        let mut files: Vec<_> = std::fs::read_dir(&self.dir)
+            .map(|entries| {
+                entries
+                    .flatten()
+                    .filter(|entry| entry.file_name() != ".last-used")
+                    .map(|entry| {
+                        let modified = entry.metadata().and_then(|m| m.modified()).ok();
+                        (entry.file_name(), modified)
+                    })
+                    .collect()
+            })
+            .unwrap_or_default();
+        files.sort();
+        files
+    }
+}
+
+/// 64-bit FNV-1a. Unlike `DefaultHasher` its output is fixed, which an
+/// on-disk key needs.
+struct Fnv1a(u64);
+
+impl Fnv1a {
+    const OFFSET_BASIS: u64 = 0xcbf2_9ce4_8422_2325;
+    const PRIME: u64 = 0x0000_0100_0000_01b3;
+
+    fn new() -> Self {
+        Self(Self::OFFSET_BASIS)
+    }
+
+    fn write(&mut self, bytes: &[u8]) {
+        for &byte in bytes {
+            self.0 ^= u64::from(byte);
+            self.0 = self.0.wrapping_mul(Self::PRIME);
+        }
+    }
+
+    /// Length-prefixed, so adjacent fields can't run into each other.
+    fn write_field(&mut self, bytes: &[u8]) {
+        self.write(&(bytes.len() as u64).to_le_bytes());
+        self.write(bytes);
+    }
+}
+
+/// Hex key over the model fingerprint, GPU descriptor and provider options.
+pub fn cache_key(model_path: &Path, gpu: &str, options: &[(&str, &str)]) -> io::Result<String> {
+    let mut hasher = Fnv1a::new();
+    model_fingerprint(model_path, &mut hasher)?;
+    hasher.write_field(gpu.as_bytes());
+    let mut options = options.to_vec();
+    options.sort_unstable();
+    for (name, value) in options {
+        hasher.write_field(name.as_bytes());
+        hasher.write_field(value.as_bytes());
+    }
+    Ok(format!("{:016x}", hasher.0))
+}
+
+/// Hash name, size and mtime of `path`, or of every file in it (sorted, one
+/// level deep, which is how model directories are laid out).
+fn model_fingerprint(path: &Path, hasher: &mut Fnv1a) -> io::Result<()> {
+    let mut files = if path.is_dir() {
+        std::fs::read_dir(path)?
+            .flatten()
+            .map(|entry| entry.path())
+            .filter(|file| file.is_file())
+            .collect()
+    } else {
+        vec![path.to_path_buf()]
+    };
+    files.sort();
+
+    for file in files {
+        let metadata = std::fs::metadata(&file)?;
+        let name = file.file_name().unwrap_or_default();
+        hasher.write_field(name.to_string_lossy().as_bytes());
+        hasher.write(&metadata.len().to_le_bytes());
+        let mtime = metadata
+            .modified()
+            .ok()
+            .and_then(|mtime| mtime.duration_since(UNIX_EPOCH).ok())
+            .map_or(0, |mtime| mtime.as_nanos());
+        hasher.write(&mtime.to_le_bytes());
+    }
+    Ok(())
+}
+
+/// Remove all but the `keep` most recently used entries in `backend_dir`.
+fn prune(backend_dir: &Path, keep: usize) -> io::Result<()> {
+    let mut entries: Vec<_> = std::fs::read_dir(backend_dir)?
+        .flatten()
+        .filter(|entry| entry.path().is_dir())
+        .map(|entry| {
+            let used = std::fs::metadata(entry.path().join(".last-used"))
+                .and_then(|meta| meta.modified())
+                .unwrap_or(UNIX_EPOCH);
+            (used, entry.path())
+        })
+        .collect();
+    if entries.len() <= keep {
+        return Ok(());
+    }
+    entries.sort_by(|a, b| b.0.cmp(&a.0));
+    for (_, stale) in entries.into_iter().skip(keep) {
+        tracing::debug!(target: "coldvox::stt", path = %stale.display(), "Pruning stale engine cache entry");
+        std::fs::remove_dir_all(stale)?;
+    }
+    Ok(())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::time::Duration;
+
+    fn scratch_dir(name: &str) -> PathBuf {
+        let dir = std::env::temp_dir().join(format!(
+            "coldvox-engine-cache-{}-{}",
+            name,
+            std::process::id()
+        ));
+        let _ = std::fs::remove_dir_all(&dir);
+        std::fs::create_dir_all(&dir).unwrap();
+        dir
+    }
+
+    #[test]
+    fn key_tracks_model_gpu_and_options() {
+        let dir = scratch_dir("key");
+        let model = dir.join("model");
+        std::fs::create_dir_all(&model).unwrap();
+        std::fs::write(model.join("encoder.onnx"), b"weights").unwrap();
+
+        let opts = [("provider", "tensorrt"), ("variant", "tdt")];
+        let key = cache_key(&model, "RTX 4090, 8.9, 550.54", &opts).unwrap();
+        let reordered = [("variant", "tdt"), ("provider", "tensorrt")];
+        assert_eq!(
+            key,
+            cache_key(&model, "RTX 4090, 8.9, 550.54", &reordered).unwrap()
+        );
+        assert_ne!(
+            key,
+            cache_key(&model, "RTX 3060, 8.6, 550.54", &opts).unwrap()
+        );
+        assert_ne!(
+            key,
+            cache_key(&model, "RTX 4090, 8.9, 550.54", &[("provider", "cuda")]).unwrap()
+        );
+
+        std::fs::write(model.join("encoder.onnx"), b"new weights").unwrap();
+        assert_ne!(
+            key,
+            cache_key(&model, "RTX 4090, 8.9, 550.54", &opts).unwrap()
+        );
+
+        let _ = std::fs::remove_dir_all(&dir);
+    }
+
+    #[test]
+    fn fnv1a_matches_reference_vectors() {
+        let hash = |bytes: &[u8]| {
+            let mut hasher = Fnv1a::new();
+            hasher.write(bytes);
+            hasher.0
+        };
+        assert_eq!(hash(b""), 0xcbf2_9ce4_8422_2325);
+        assert_eq!(hash(b"a"), 0xaf63_dc4c_8601_ec8c);
+        assert_eq!(hash(b"foobar"), 0x8594_4171_f739_67e8);
+    }
+
+    #[test]
+    fn open_reports_warm_after_engines_are_written() {
+        let dir = scratch_dir("warm");
+        let model = dir.join("model.onnx");
+        std::fs::write(&model, b"weights").unwrap();
+        let root = dir.join("cache");
+
+        let cache = EngineCache::open(&root, "parakeet", &model, "gpu", &[]).unwrap();
+        assert!(cache.dir().starts_with(root.join("parakeet")));
+        assert!(!cache.is_warm());
+        std::fs::write(cache.dir().join("engine.trt"), b"plan").unwrap();
+
+        let reopened = EngineCache::open(&root, "parakeet", &model, "gpu", &[]).unwrap();
+        assert_eq!(reopened.key(), cache.key());
+        assert!(reopened.is_warm());
+        let snapshot = reopened.snapshot();
+        assert_eq!(snapshot.len(), 1);
+        assert_eq!(snapshot[0].0, "engine.trt");
+        assert_eq!(reopened.snapshot(), snapshot);
+
+        let _ = std::fs::remove_dir_all(&dir);
+    }
+
+    #[test]
+    fn prune_keeps_most_recently_used_entries() {
+        let dir = scratch_dir("prune");
+        let model = dir.join("model.onnx");
+        std::fs::write(&model, b"weights").unwrap();
+        let root = dir.join("cache");
+
+        let mut keys = Vec::new();
+        for gpu in 0..MAX_ENTRIES + 1 {
+            let cache =
+                EngineCache::open(&root, "parakeet", &model, &format!("gpu{gpu}"), &[]).unwrap();
+            keys.push(cache.key().to_string());
+            // Distinct mtimes on coarse-grained filesystems
+            std::thread::sleep(Duration::from_millis(20));
+        }
+
+        let backend = root.join("parakeet");
+        assert_eq!(std::fs::read_dir(&backend).unwrap().count(), MAX_ENTRIES);
+        assert!(!backend.join(&keys[0]).exists());
+        assert!(backend.join(keys.last().unwrap()).exists());
+
+        let _ = std::fs::remove_dir_all(&dir);
+    }
+}
@@ -0,0 +1,581 @@
+//! Minimal incremental FLAC encoder for 16-bit mono PCM.
+//!
+//! Audio is cut into fixed 4096-sample blocks as it arrives; each block is
+//! encoded with the best FIXED predictor (order 0-4) and partitioned Rice
+//! residuals, or as CONSTANT/VERBATIM when that is smaller. Only the final
+//! short block and the STREAMINFO sample count are left for [`finish`].
+//!
+//! [`finish`]: FlacEncoder::finish
+
+const BLOCK_SIZE: usize = 4096;
+const MAX_FIXED_ORDER: usize = 4;
+const MAX_PARTITION_ORDER: u32 = 6;
+/// 4-bit Rice parameters; 15 is the escape code.
+const MAX_RICE_PARAM: u32 = 14;
+/// "fLaC" + STREAMINFO block header; the 36-bit total sample count sits in
+/// STREAMINFO bytes 13..18.
+const STREAMINFO_OFFSET: usize = 8;
+
+pub struct FlacEncoder {
+    out: Vec<u8>,
+    pending: Vec<i16>,
+    frame_number: u64,
+    total_samples: u64,
+    /// Scratch reused between blocks.
+    residual: Vec<i32>,
+    frame: BitWriter,
+}
+
+impl FlacEncoder {
+    pub fn new(sample_rate: u32) -> Self {
+        let mut out = Vec::with_capacity(64 * 1024);
+        out.extend_from_slice(b"fLaC");
+        // Last-metadata-block flag + STREAMINFO type, 34-byte length
+        out.extend_from_slice(&[0x80, 0x00, 0x00, 34]);
+
+        let mut info = BitWriter::default();
+        info.write(BLOCK_SIZE as u64, 16); // min block size
+        info.write(BLOCK_SIZE as u64, 16); // max block size
+        info.write(0, 24); // min frame size (unknown)
+        info.write(0, 24); // max frame size (unknown)
+        info.write(sample_rate as u64, 20);
+        info.write(0, 3); // channels - 1
+        info.write(15, 5); // bits per sample - 1
+        info.write(0, 36); // total samples, patched in finish()
+        for _ in 0..4 {
+            info.write(0, 32); // MD5 (unset)
+        }
+        out.extend_from_slice(&info.bytes);
+
+        Self {
+            out,
+            pending: Vec::with_capacity(BLOCK_SIZE),
+            frame_number: 0,
+            total_samples: 0,
+            residual: Vec::with_capacity(BLOCK_SIZE),
+            frame: BitWriter::default(),
+        }
+    }
+
+    /// Buffer `samples`, encoding every completed block.
+    pub fn push(&mut self, mut samples: &[i16]) {
+        self.total_samples += samples.len() as u64;
+        while !samples.is_empty() {
+            let take = (BLOCK_SIZE - self.pending.len()).min(samples.len());
+            self.pending.extend_from_slice(&samples[..take]);
+            samples = &samples[take..];
+            if self.pending.len() == BLOCK_SIZE {
+                self.encode_pending();
+            }
+        }
+    }
+
+    /// Bytes of encoded output so far (excluding the buffered partial block).
+    pub fn encoded_len(&self) -> usize {
+        self.out.len()
+    }
+
+    pub fn total_samples(&self) -> u64 {
+        self.total_samples
+    }
+
+    /// Encode the trailing partial block and return the complete stream.
+    pub fn finish(mut self) -> Vec<u8> {
+        if !self.pending.is_empty() {
+            self.encode_pending();
+        }
+        // 4 low bits of byte 13 + bytes 14..18 hold the 36-bit count
+        let at = STREAMINFO_OFFSET + 13;
+        let total = self.total_samples & ((1 << 36) - 1);
+        self.out[at] = (self.out[at] & 0xF0) | (total >> 32) as u8;
+        self.out[at + 1..at + 5].copy_from_slice(&(total as u32).to_be_bytes());
+        self.out
+    }
+
+    fn encode_pending(&mut self) {
+        let block = std::mem::take(&mut self.pending);
+        let mut frame = std::mem::take(&mut self.frame);
+        frame.clear();
+
+        write_frame_header(&mut frame, block.len(), self.frame_number);
+        self.write_subframe(&mut frame, &block);
+        frame.align();
+        let crc = crc16(&frame.bytes);
+        frame.write(crc as u64, 16);
+        self.out.extend_from_slice(&frame.bytes);
+
+        self.frame_number += 1;
+        self.frame = frame;
+        self.pending = block;
+        self.pending.clear();
+    }
+
+    fn write_subframe(&mut self, w: &mut BitWriter, block: &[i16]) {
+        let n = block.len();
+        if block.iter().all(|&s| s == block[0]) {
+            w.write(0b0000_0000, 8); // CONSTANT
+            w.write_signed(block[0] as i32, 16);
+            return;
+        }
+
+        let verbatim_bits = 8 + 16 * n as u64;
+        let best = if n > MAX_FIXED_ORDER {
+            (0..=MAX_FIXED_ORDER)
+                .map(|order| (order, fixed_residual_sum(block, order)))
+                .min_by_key(|&(_, sum)| sum)
+                .map(|(order, _)| order)
+        } else {
+            None
+        };
+
+        if let Some(order) = best {
+            fixed_residual(block, order, &mut self.residual);
+            let (partition_order, params, residual_bits) =
+                choose_rice_partitions(&self.residual, n);
+            let bits = 8 + 16 * order as u64 + 6 + residual_bits;
+            if bits < verbatim_bits {
+                w.write(0b0001_0000 | (order as u64) << 1, 8); // FIXED, order in type bits
+                for &s in &block[..order] {
+                    w.write_signed(s as i32, 16);
+                }
+                w.write(0, 2); // Rice coding with 4-bit parameters
+                w.write(partition_order as u64, 4);
+                write_partitions(w, &self.residual, n, order, partition_order, &params);
+                return;
+            }
+        }
+
+        w.write(0b0000_0010, 8); // VERBATIM
+        for &s in block {
+            w.write_signed(s as i32, 16);
+        }
+    }
+}
+
+fn write_frame_header(w: &mut BitWriter, block_len: usize, frame_number: u64) {
+    w.write(0b1111_1111_1111_1000, 16); // sync, reserved, fixed blocking
+    let size_code = if block_len == BLOCK_SIZE {
+        0b1100
+    } else {
+        0b0111
+    };
+    w.write(size_code, 4);
+    w.write(0b0000, 4); // sample rate from STREAMINFO
+    w.write(0b0000, 4); // mono
+    w.write(0b100, 3); // 16 bits per sample
+    w.write(0, 1);
+    write_utf8_number(w, frame_number);
+    if size_code == 0b0111 {
+        w.write(block_len as u64 - 1, 16);
+    }
+    let crc = crc8(&w.bytes);
+    w.write(crc as u64, 8);
+}
+
+/// FLAC's frame-number coding (UTF-8 style, up to 36 bits).
+fn write_utf8_number(w: &mut BitWriter, value: u64) {
+    if value < 0x80 {
+        w.write(value, 8);
+        return;
+    }
+    let mut bytes = 2;
+    while bytes < 7 && value >= 1 << (5 * bytes + 1) {
+        bytes += 1;
+    }
+    let lead_bits = 7 - bytes;
+    let prefix = (0xFF00u64 >> bytes) & 0xFF;
+    w.write(
+        prefix | (value >> (6 * (bytes - 1))) & ((1 << lead_bits) - 1),
+        8,
+    );
+    for i in (0..bytes - 1).rev() {
+        w.write(0x80 | (value >> (6 * i)) & 0x3F, 8);
+    }
+}
+
+fn fixed_prediction_error(block: &[i16], i: usize, order: usize) -> i32 {
+    let x = |k: usize| block[i - k] as i32;
+    match order {
+        0 => x(0),
+        1 => x(0) - x(1),
+        2 => x(0) - 2 * x(1) + x(2),
+        3 => x(0) - 3 * x(1) + 3 * x(2) - x(3),
+        _ => x(0) - 4 * x(1) + 6 * x(2) - 4 * x(3) + x(4),
+    }
+}
+
+/// Sum of |residual| over the samples every order can predict.
+fn fixed_residual_sum(block: &[i16], order: usize) -> u64 {
+    (MAX_FIXED_ORDER..block.len())
+        .map(|i| fixed_prediction_error(block, i, order).unsigned_abs() as u64)
+        .sum()
+}
+
+fn fixed_residual(block: &[i16], order: usize, out: &mut Vec<i32>) {
+    out.clear();
+    out.extend((order..block.len()).map(|i| fixed_prediction_error(block, i, order)));
+}
+
+fn zigzag(r: i32) -> u32 {
+    ((r << 1) ^ (r >> 31)) as u32
+}
+
+/// Cheapest Rice parameter for a partition whose zigzagged residuals sum to
+/// `sum`, using the usual `n * (k + 1) + sum >> k` estimate.
+fn best_rice_param(sum: u64, n: u64) -> (u32, u64) {
+    (0..=MAX_RICE_PARAM)
+        .map(|k| (k, 4 + n * (k as u64 + 1) + (sum >> k)))
+        .min_by_key(|&(_, bits)| bits)
+        .unwrap()
+}
+
+/// Pick the partition order and per-partition parameters. Returns the order,
+/// the parameters and the estimated residual size in bits.
+fn choose_rice_partitions(residual: &[i32], block_len: usize) -> (u32, Vec<u32>, u64) {
+    let order = block_len - residual.len();
+    let mut best: Option<(u32, Vec<u32>, u64)> = None;
+    let max_order = (0..=MAX_PARTITION_ORDER)
+        .take_while(|&p| block_len.is_multiple_of(1 << p) && (block_len >> p) > order)
+        .last()
+        .unwrap_or(0);
+
+    for p in 0..=max_order {
+        let part_len = block_len >> p;
+        let mut params = Vec::with_capacity(1 << p);
+        let mut bits = 0;
+        let mut start = 0;
+        for part in 0..1usize << p {
+            let len = if part == 0 {
+                part_len - order
+            } else {
+                part_len
+            };
+            let slice = &residual[start..start + len];
+            start += len;
+            let sum = slice.iter().map(|&r| zigzag(r) as u64).sum();
+            let (k, part_bits) = best_rice_param(sum, len as u64);
+            params.push(k);
+            bits += part_bits;
+        }
+        if best.as_ref().is_none_or(|b| bits < b.2) {
+            best = Some((p, params, bits));
+        }
+    }
+    best.unwrap()
+}
+
+fn write_partitions(
+    w: &mut BitWriter,
+    residual: &[i32],
+    block_len: usize,
+    order: usize,
+    partition_order: u32,
+    params: &[u32],
+) {
+    let part_len = block_len >> partition_order;
+    let mut start = 0;
+    for (part, &k) in params.iter().enumerate() {
+        let len = if part == 0 {
+            part_len - order
+        } else {
+            part_len
+        };
+        w.write(k as u64, 4);
+        for &r in &residual[start..start + len] {
+            let u = zigzag(r);
+            w.write_unary(u >> k);
+            w.write((u & ((1 << k) - 1)) as u64, k);
+        }
+        start += len;
+    }
+}
+
+fn crc8(data: &[u8]) -> u8 {
+    data.iter().fold(0u8, |mut crc, &byte| {
+        crc ^= byte;
+        for _ in 0..8 {
+            crc = if crc & 0x80 != 0 {
+                (crc << 1) ^ 0x07
+            } else {
+                crc << 1
+            };
+        }
+        crc
+    })
+}
+
+fn crc16(data: &[u8]) -> u16 {
+    data.iter().fold(0u16, |mut crc, &byte| {
+        crc ^= (byte as u16) << 8;
+        for _ in 0..8 {
+            crc = if crc & 0x8000 != 0 {
+                (crc << 1) ^ 0x8005
+            } else {
+                crc << 1
+            };
+        }
+        crc
+    })
+}
+
+/// MSB-first bit writer.
+#[derive(Default)]
+struct BitWriter {
+    bytes: Vec<u8>,
+    acc: u64,
+    bits: u32,
+}
+
+impl BitWriter {
+    fn clear(&mut self) {
+        self.bytes.clear();
+        self.acc = 0;
+        self.bits = 0;
+    }
+
+    /// Append the low `n` bits of `value` (`n <= 32`).
+    fn write(&mut self, value: u64, n: u32) {
+        if n == 0 {
+            return;
+        }
+        if n > 32 {
+            self.write(value >> 32, n - 32);
+            self.write(value & 0xFFFF_FFFF, 32);
+            return;
+        }
+        self.acc = (self.acc << n) | (value & ((1 << n) - 1));
+        self.bits += n;
+        while self.bits >= 8 {
+            self.bits -= 8;
+            self.bytes.push((self.acc >> self.bits) as u8);
+        }
+    }
+
+    fn write_signed(&mut self, value: i32, n: u32) {
+        self.write(value as u32 as u64, n);
+    }
+
+    /// `q` zeros followed by a one.
+    fn write_unary(&mut self, mut q: u32) {
+        while q >= 32 {
+            self.write(0, 32);
+            q -= 32;
+        }
+        self.write(1, q + 1);
+    }
+
+    fn align(&mut self) {
+        if self.bits > 0 {
+            self.write(0, 8 - self.bits);
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Decoder for exactly the subset the encoder emits, checking both CRCs.
+    fn decode(data: &[u8]) -> (u32, u64, Vec<i16>) {
+        struct Reader<'a> {
+            data: &'a [u8],
+            pos: usize,
+        }
+        impl Reader<'_> {
+            fn bits(&mut self, n: u32) -> u64 {
+                (0..n).fold(0, |v, _| {
+                    let bit = (self.data[self.pos / 8] >> (7 - self.pos % 8)) & 1;
+                    self.pos += 1;
+                    (v << 1) | bit as u64
+                })
+            }
+            fn signed(&mut self, n: u32) -> i32 {
+                let v = self.bits(n) as i64;
+                (if v >= 1 << (n - 1) { v - (1 << n) } else { v }) as i32
+            }
+            fn align(&mut self) {
+                self.pos = self.pos.div_ceil(8) * 8;
+            }
+        }
+
+        assert_eq!(&data[..4], b"fLaC");
+        let mut r = Reader { data, pos: 32 };
+        assert_eq!(r.bits(1), 1, "single metadata block");
+        assert_eq!(r.bits(7), 0);
+        assert_eq!(r.bits(24), 34);
+        assert_eq!(r.bits(16), BLOCK_SIZE as u64);
+        r.bits(16 + 48);
+        let sample_rate = r.bits(20) as u32;
+        assert_eq!(r.bits(3), 0);
+        assert_eq!(r.bits(5), 15);
+        let total = r.bits(36);
+        r.bits(128);
+
+        let mut out = Vec::new();
+        let mut frame_number = 0;
+        while r.pos / 8 < data.len() {
+            let frame_start = r.pos / 8;
+            assert_eq!(r.bits(16), 0xFFF8);
+            let size_code = r.bits(4);
+            assert_eq!(r.bits(4), 0);
+            assert_eq!(r.bits(4), 0);
+            assert_eq!(r.bits(3), 0b100);
+            r.bits(1);
+            let first = r.bits(8);
+            let extra = (first as u8).leading_ones().saturating_sub(1);
+            let mut number = first & (0x7F >> extra);
+            for _ in 0..extra {
+                number = (number << 6) | (r.bits(8) & 0x3F);
+            }
+            assert_eq!(number, frame_number);
+            let n = match size_code {
+                0b1100 => BLOCK_SIZE,
+                0b0111 => r.bits(16) as usize + 1,
+                other => panic!("unexpected block size code {other}"),
+            };
+            let expected = crc8(&data[frame_start..r.pos / 8]);
+            assert_eq!(r.bits(8) as u8, expected);
+
+            assert_eq!(r.bits(1), 0);
+            let kind = r.bits(6);
+            assert_eq!(r.bits(1), 0);
+            let start = out.len();
+            match kind {
+                0 => {
+                    let v = r.signed(16) as i16;
+                    out.extend(std::iter::repeat_n(v, n));
+                }
+                1 => out.extend((0..n).map(|_| r.signed(16) as i16)),
+                8..=12 => {
+                    let order = (kind - 8) as usize;
+                    let mut x: Vec<i32> = (0..order).map(|_| r.signed(16)).collect();
+                    assert_eq!(r.bits(2), 0);
+                    let p = r.bits(4) as u32;
+                    for part in 0..1usize << p {
+                        let k = r.bits(4) as u32;
+                        let len = (n >> p) - if part == 0 { order } else { 0 };
+                        for _ in 0..len {
+                            let mut q = 0;
+                            while r.bits(1) == 0 {
+                                q += 1;
+                            }
+                            let u = (q << k) | r.bits(k) as u32;
+                            let res = ((u >> 1) as i32) ^ -((u & 1) as i32);
+                            let i = x.len();
+                            let p = |k: usize| x[i - k];
+                            let pred = match order {
+                                0 => 0,
+                                1 => p(1),
+                                2 => 2 * p(1) - p(2),
+                                3 => 3 * p(1) - 3 * p(2) + p(3),
+                                _ => 4 * p(1) - 6 * p(2) + 4 * p(3) - p(4),
+                            };
+                            x.push(pred + res);
+                        }
+                    }
+                    out.extend(x.into_iter().map(|v| v as i16));
+                }
+                other => panic!("unexpected subframe type {other}"),
+            }
+            assert_eq!(out.len() - start, n);
+            r.align();
+            let crc = crc16(&data[frame_start..r.pos / 8]);
+            assert_eq!(r.bits(16) as u16, crc);
+            frame_number += 1;
+        }
+        (sample_rate, total, out)
+    }
+
+    fn speechlike(len: usize) -> Vec<i16> {
+        // Two tones with a slow envelope plus a little deterministic noise
+        let mut seed = 0x1234_5678u32;
+        (0..len)
+            .map(|i| {
+                seed = seed.wrapping_mul(1_664_525).wrapping_add(1_013_904_223);
+                let t = i as f32 / 16_000.0;
+                let env = 0.5 + 0.5 * (t * 3.0).sin();
+                let v = env
+                    * (6000.0 * (t * 220.0 * std::f32::consts::TAU).sin()
+                        + 2000.0 * (t * 1250.0 * std::f32::consts::TAU).sin())
+                    + ((seed >> 28) as f32 - 8.0);
+                v as i16
+            })
+            .collect()
+    }
+
+    #[test]
+    fn roundtrips_losslessly_across_chunk_boundaries() {
+        let samples = speechlike(3 * BLOCK_SIZE + 1234);
+        let mut enc = FlacEncoder::new(16_000);
+        for chunk in samples.chunks(512) {
+            enc.push(chunk);
+        }
+        let data = enc.finish();
+
+        let (rate, total, decoded) = decode(&data);
+        assert_eq!(rate, 16_000);
+        assert_eq!(total, samples.len() as u64);
+        assert_eq!(decoded, samples);
+        assert!(
+            data.len() * 4 < samples.len() * 2 * 3,
+            "{} bytes for {} samples",
+            data.len(),
+            samples.len()
+        );
+    }
+
+    #[test]
+    fn encodes_complete_blocks_as_they_arrive() {
+        let mut enc = FlacEncoder::new(16_000);
+        let header = enc.encoded_len();
+        enc.push(&speechlike(BLOCK_SIZE - 1));
+        assert_eq!(enc.encoded_len(), header);
+        enc.push(&[0]);
+        assert!(enc.encoded_len() > header);
+    }
+
+    #[test]
+    fn handles_silence_extremes_and_tiny_tails() {
+        let mut samples = vec![0i16; BLOCK_SIZE];
+        samples.extend((0..BLOCK_SIZE).map(|i| if i % 2 == 0 { i16::MAX } else { i16::MIN }));
+        samples.extend_from_slice(&[7, -3, 12]);
+        let mut enc = FlacEncoder::new(16_000);
+        enc.push(&samples);
+        let (_, _, decoded) = decode(&enc.finish());
+        assert_eq!(decoded, samples);
+    }
+
+    #[test]
+    fn output_decodes_with_claxon() {
+        // The in-module decoder shares the encoder's reading of the spec;
+        // claxon is an independent implementation.
+        let mut samples = speechlike(2 * BLOCK_SIZE + 777);
+        samples.extend_from_slice(&[i16::MAX, i16::MIN, 0, 0, 0, -1]);
+        let mut enc = FlacEncoder::new(16_000);
+        for chunk in samples.chunks(320) {
+            enc.push(chunk);
+        }
+        let data = enc.finish();
+
+        let mut reader = claxon::FlacReader::new(&data[..]).expect("valid FLAC stream");
+        let info = reader.streaminfo();
+        assert_eq!(info.sample_rate, 16_000);
+        assert_eq!(info.channels, 1);
+        assert_eq!(info.bits_per_sample, 16);
+        assert_eq!(info.samples, Some(samples.len() as u64));
+        let decoded: Vec<i16> = reader
+            .samples()
+            .map(|s| s.expect("valid frame") as i16)
+            .collect();
+        assert_eq!(decoded, samples);
+    }
+
+    #[test]
+    fn frame_numbers_use_multibyte_coding() {
+        let mut w = BitWriter::default();
+        write_utf8_number(&mut w, 0x7F);
+        write_utf8_number(&mut w, 0x80);
+        write_utf8_number(&mut w, 0x800);
+        assert_eq!(w.bytes, [0x7F, 0xC2, 0x80, 0xE0, 0xA0, 0x80]);
+    }
+}
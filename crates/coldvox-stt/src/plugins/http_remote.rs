@@ -1,19 +1,42 @@
 //! HTTP Remote STT Plugin
 //!
 //! Sends audio to an OpenAI-compatible `/v1/audio/transcriptions` endpoint.
-//! Buffers PCM frames during speech, encodes to WAV on finalize, and POSTs to the service.
+//! Encodes PCM frames as they arrive (FLAC by default, see [`PayloadCodec`]) and
+//! POSTs the finished file to the service on finalize.
+//!
+//! When `stream_api_path` is set, audio is instead uploaded while the user is
+//! still speaking: the first frame opens a chunked `POST` of raw 16-bit
+//! little-endian mono PCM, and each later frame is forwarded as it arrives.
+//! The service may answer with newline-delimited JSON
+//! (`{"text": "...", "is_final": false}`) before the upload ends; those lines
+//! become partial results. `finalize` only has to flush the tail and wait for
+//! the final line (or a single plain `{"text": "..."}` body). If the upload
+//! cannot be opened or the utterance outgrows the guardrails, streaming stops
+//! for the rest of that utterance and `finalize` sends the audio kept so far
+//! (up to the guardrails) as an ordinary batch request.
+//!
+//! All requests share one pooled client, so the connection opened by the
+//! warm-up probe on speech start is the one `finalize` reuses. With
+//! `hedge_base_url` set, a batch request that has not answered within the
+//! recent p95 latency is duplicated to that endpoint and the first success wins.
 
+pub use super::payload::PayloadCodec;
+use super::payload::PayloadEncoder;
 use crate::plugin::{PluginCapabilities, PluginInfo, SttPlugin, SttPluginFactory};
 use crate::types::{TranscriptionConfig, TranscriptionEvent};
 use async_trait::async_trait;
+use bytes::Bytes;
 use coldvox_foundation::error::{ColdVoxError, SttError};
+use parking_lot::Mutex;
 use reqwest::{multipart, Client, Url};
 use serde::{Deserialize, Serialize};
-use std::collections::HashMap;
+use std::collections::{HashMap, VecDeque};
 use std::fmt::Debug;
-use std::io::Cursor;
 use std::net::IpAddr;
-use std::time::Duration;
+use std::sync::OnceLock;
+use std::time::{Duration, Instant};
+use tokio::sync::mpsc;
+use tokio::task::JoinHandle;
 
 /// Configuration for the HTTP remote plugin.
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -42,7 +65,7 @@ pub struct HttpRemoteConfig {
     /// Optional bearer-token environment variable name
     #[serde(default)]
     pub bearer_token_env_var: Option<String>,
-    /// Maximum encoded WAV bytes allowed before request send
+    /// Maximum encoded audio bytes allowed before request send
     #[serde(default = "default_max_audio_bytes")]
     pub max_audio_bytes: u64,
     /// Maximum utterance duration in seconds allowed before request send
@@ -51,6 +74,28 @@ pub struct HttpRemoteConfig {
     /// Maximum estimated multipart payload bytes allowed before request send
     #[serde(default = "default_max_payload_bytes")]
     pub max_payload_bytes: u64,
+    /// Chunked-upload endpoint path (e.g., "/v1/audio/stream"). When set,
+    /// audio is streamed during speech instead of posted as one WAV.
+    #[serde(default)]
+    pub stream_api_path: Option<String>,
+    /// Audio coalesced into each upload chunk in streaming mode
+    #[serde(default = "default_stream_chunk_ms")]
+    pub stream_chunk_ms: u32,
+    /// Upload file format for batch requests
+    #[serde(default)]
+    pub codec: PayloadCodec,
+    /// Secondary service (same paths) for hedged batch requests
+    #[serde(default)]
+    pub hedge_base_url: Option<String>,
+    /// Hedge delay used until enough latencies are recorded for a p95
+    #[serde(default = "default_hedge_initial_delay_ms")]
+    pub hedge_initial_delay_ms: u64,
+    /// Lower bound on the p95-derived hedge delay
+    #[serde(default = "default_hedge_min_delay_ms")]
+    pub hedge_min_delay_ms: u64,
+    /// Speak HTTP/2 without negotiation (h2c), multiplexing requests on one connection
+    #[serde(default)]
+    pub http2_prior_knowledge: bool,
 }
 
 fn default_health_path() -> String {
@@ -69,6 +114,18 @@ fn default_max_payload_bytes() -> u64 {
     2_621_440
 }
 
+fn default_stream_chunk_ms() -> u32 {
+    100
+}
+
+fn default_hedge_initial_delay_ms() -> u64 {
+    500
+}
+
+fn default_hedge_min_delay_ms() -> u64 {
+    50
+}
+
 impl Default for HttpRemoteConfig {
     fn default() -> Self {
         Self {
@@ -85,6 +142,13 @@ impl Default for HttpRemoteConfig {
             max_audio_bytes: default_max_audio_bytes(),
             max_audio_seconds: default_max_audio_seconds(),
             max_payload_bytes: default_max_payload_bytes(),
+            stream_api_path: None,
+            stream_chunk_ms: default_stream_chunk_ms(),
+            codec: PayloadCodec::default(),
+            hedge_base_url: None,
+            hedge_initial_delay_ms: default_hedge_initial_delay_ms(),
+            hedge_min_delay_ms: default_hedge_min_delay_ms(),
+            http2_prior_knowledge: false,
         }
     }
 }
@@ -105,6 +169,13 @@ impl HttpRemoteConfig {
             max_audio_bytes: default_max_audio_bytes(),
             max_audio_seconds: default_max_audio_seconds(),
             max_payload_bytes: default_max_payload_bytes(),
+            stream_api_path: None,
+            stream_chunk_ms: default_stream_chunk_ms(),
+            codec: PayloadCodec::default(),
+            hedge_base_url: None,
+            hedge_initial_delay_ms: default_hedge_initial_delay_ms(),
+            hedge_min_delay_ms: default_hedge_min_delay_ms(),
+            http2_prior_knowledge: false,
         }
     }
 }
@@ -115,20 +186,119 @@ struct SttResponse {
     text: String,
 }
 
+/// One line of a streaming endpoint's NDJSON response.
+#[derive(Debug, Deserialize)]
+struct StreamResponseLine {
+    text: String,
+    #[serde(default)]
+    is_final: bool,
+}
+
 const PLUGIN_ID_PREFIX: &str = "http-remote";
+/// Idle pooled connections are kept this long between utterances.
+const POOL_IDLE_TIMEOUT: Duration = Duration::from_secs(90);
+const TCP_KEEPALIVE: Duration = Duration::from_secs(30);
+
+/// Latencies of recent successful batch requests, for the hedge delay.
+#[derive(Debug, Default)]
+struct LatencyWindow {
+    samples: VecDeque<Duration>,
+}
+
+impl LatencyWindow {
+    const CAPACITY: usize = 64;
+    /// Samples needed before the p95 is trusted over the initial delay.
+    const MIN_SAMPLES: usize = 8;
+
+    fn record(&mut self, latency: Duration) {
+        if self.samples.len() == Self::CAPACITY {
+            self.samples.pop_front();
+        }
+        self.samples.push_back(latency);
+    }
+
+    fn p95(&self) -> Option<Duration> {
+        if self.samples.len() < Self::MIN_SAMPLES {
+            return None;
+        }
+        let mut sorted: Vec<Duration> = self.samples.iter().copied().collect();
+        sorted.sort_unstable();
+        let rank = (sorted.len() * 95).div_ceil(100);
+        Some(sorted[rank - 1])
+    }
+}
+
+/// Chunked upload in flight for the current utterance.
+struct StreamingUpload {
+    /// Upload body; dropping it ends the request.
+    chunks: Option<mpsc::UnboundedSender<Vec<u8>>>,
+    /// PCM bytes not yet sent, coalesced up to `chunk_bytes`.
+    pending: Vec<u8>,
+    chunk_bytes: usize,
+    samples_sent: u64,
+    partials: mpsc::UnboundedReceiver<String>,
+    response: JoinHandle<Result<String, ColdVoxError>>,
+}
+
+impl StreamingUpload {
+    fn flush(&mut self) {
+        if self.pending.is_empty() {
+            return;
+        }
+        let chunk = std::mem::replace(&mut self.pending, Vec::with_capacity(self.chunk_bytes));
+        if let Some(chunks) = &self.chunks {
+            // A closed channel means the request already ended; finalize reports why
+            let _ = chunks.send(chunk);
+        }
+    }
+
+    fn latest_partial(&mut self) -> Option<String> {
+        let mut latest = None;
+        while let Ok(text) = self.partials.try_recv() {
+            latest = Some(text);
+        }
+        latest
+    }
+}
+
+impl Drop for StreamingUpload {
+    fn drop(&mut self) {
+        self.response.abort();
+    }
+}
 
 pub struct HttpRemotePlugin {
     config: HttpRemoteConfig,
-    audio_buffer: Vec<i16>,
+    /// Encoder for the current utterance, created on its first frame.
+    payload: Option<PayloadEncoder>,
     utterance_id: u64,
+    upload: Option<StreamingUpload>,
+    /// Audio of the current streamed utterance, up to the guardrails, kept for
+    /// a batch fallback.
+    stream_audio: Vec<i16>,
+    /// Streaming failed for the current utterance: no new upload is opened
+    /// and `finalize` uses the batch path. Cleared only by finalize and reset.
+    stream_failed: bool,
+    emit_partials: bool,
+    /// Shared by every request so keep-alive connections are reused.
+    client: OnceLock<Client>,
+    latencies: Mutex<LatencyWindow>,
 }
 
 impl Debug for HttpRemotePlugin {
     fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
         f.debug_struct("HttpRemotePlugin")
             .field("config", &self.config)
-            .field("buffer_size", &self.audio_buffer.len())
+            .field("codec", &self.config.codec)
+            .field(
+                "buffered_samples",
+                &self
+                    .payload
+                    .as_ref()
+                    .map_or(0, PayloadEncoder::total_samples),
+            )
             .field("utterance_id", &self.utterance_id)
+            .field("streaming", &self.upload.is_some())
             .finish()
     }
 }
@@ -254,6 +424,76 @@ fn map_http_client_error(context: &str, error: reqwest::Error) -> ColdVoxError {
     SttError::TranscriptionFailed(message).into()
 }
 
+fn parse_stream_line(line: &[u8], url: &Url) -> Result<Option<StreamResponseLine>, ColdVoxError> {
+    let line = line.trim_ascii();
+    if line.is_empty() {
+        return Ok(None);
+    }
+    serde_json::from_slice(line).map(Some).map_err(|e| {
+        SttError::TranscriptionFailed(format!(
+            "Failed to parse streaming STT response from {url}: {e}; {}",
+            response_body_summary(line)
+        ))
+        .into()
+    })
+}
+
+/// Send the chunked upload and read its NDJSON response, forwarding partial
+/// lines as they arrive. Returns the final transcript.
+async fn run_stream_request(
+    request: reqwest::RequestBuilder,
+    url: Url,
+    partials: mpsc::UnboundedSender<String>,
+) -> Result<String, ColdVoxError> {
+    let mut response = request
+        .send()
+        .await
+        .map_err(|e| map_http_client_error("HTTP streaming request failed", e))?;
+
+    let status = response.status();
+    if !status.is_success() {
+        let body = response.bytes().await.unwrap_or_default();
+        return Err(SttError::TranscriptionFailed(format!(
+            "Service returned error {status} from {url}: {}",
+            response_body_summary(&body)
+        ))
+        .into());
+    }
+
+    let mut buffer = Vec::new();
+    let mut last_text = None;
+    while let Some(chunk) = response
+        .chunk()
+        .await
+        .map_err(|e| map_http_client_error("HTTP streaming response read failed", e))?
+    {
+        buffer.extend_from_slice(&chunk);
+        while let Some(newline) = buffer.iter().position(|&b| b == b'\n') {
+            let line = parse_stream_line(&buffer[..newline], &url)?;
+            buffer.drain(..=newline);
+            match line {
+                Some(line) if line.is_final => return Ok(line.text),
+                Some(line) => {
+                    let _ = partials.send(line.text.clone());
+                    last_text = Some(line.text);
+                }
+                None => {}
+            }
+        }
+    }
+
+    // A trailing line without a newline (or a plain JSON body) is the result
+    if let Some(line) = parse_stream_line(&buffer, &url)? {
+        return Ok(line.text);
+    }
+    last_text.ok_or_else(|| {
+        SttError::TranscriptionFailed(format!(
+            "Streaming response from {url} ended without a transcript"
+        ))
+        .into()
+    })
+}
+
 fn canonicalize_profile_id_fragment(input: &str) -> String {
     let mut normalized = String::new();
     let mut last_was_separator = false;
@@ -325,8 +565,14 @@ impl HttpRemotePlugin {
     pub fn new(config: HttpRemoteConfig) -> Self {
         Self {
             config,
-            audio_buffer: Vec::new(),
+            payload: None,
             utterance_id: 0,
+            upload: None,
+            stream_audio: Vec::new(),
+            stream_failed: false,
+            emit_partials: false,
+            client: OnceLock::new(),
+            latencies: Mutex::new(LatencyWindow::default()),
         }
     }
 
@@ -334,30 +580,41 @@ impl HttpRemotePlugin {
         Duration::from_millis(self.config.timeout_ms)
     }
 
-    fn estimated_audio_duration_secs(&self) -> f64 {
+    fn estimated_audio_duration_secs(&self, samples: u64) -> f64 {
         if self.config.sample_rate == 0 {
             return 0.0;
         }
 
-        self.audio_buffer.len() as f64 / self.config.sample_rate as f64
+        samples as f64 / self.config.sample_rate as f64
     }
 
-    fn estimate_payload_bytes(&self, wav_data: &[u8]) -> u64 {
+    /// Multipart size: the encoded file plus boundaries, part headers (which
+    /// name the codec's file name and MIME type) and the text fields.
+    fn estimate_payload_bytes(&self, audio_data: &[u8]) -> u64 {
         let static_overhead = 768_u64;
-        wav_data.len() as u64 + self.config.model_name.len() as u64 + static_overhead
+        let codec = self.config.codec;
+        audio_data.len() as u64
+            + self.config.model_name.len() as u64
+            + (codec.file_name().len() + codec.mime_type().len()) as u64
+            + static_overhead
     }
 
-    fn validate_request_guardrails(&self, wav_data: &[u8]) -> Result<(), ColdVoxError> {
-        if wav_data.len() as u64 > self.config.max_audio_bytes {
+    fn validate_request_guardrails(
+        &self,
+        audio_data: &[u8],
+        samples: u64,
+    ) -> Result<(), ColdVoxError> {
+        if audio_data.len() as u64 > self.config.max_audio_bytes {
             return Err(SttError::TranscriptionFailed(format!(
-                "Encoded WAV size {} exceeds configured max_audio_bytes {}",
-                wav_data.len(),
+                "Encoded {} size {} exceeds configured max_audio_bytes {}",
+                self.config.codec,
+                audio_data.len(),
                 self.config.max_audio_bytes
             ))
             .into());
         }
 
-        let duration_secs = self.estimated_audio_duration_secs();
+        let duration_secs = self.estimated_audio_duration_secs(samples);
         if duration_secs > self.config.max_audio_seconds as f64 {
             return Err(SttError::TranscriptionFailed(format!(
                 "Utterance duration {:.2}s exceeds configured max_audio_seconds {}",
@@ -366,7 +623,7 @@ impl HttpRemotePlugin {
             .into());
         }
 
-        let estimated_payload_bytes = self.estimate_payload_bytes(wav_data);
+        let estimated_payload_bytes = self.estimate_payload_bytes(audio_data);
         if estimated_payload_bytes > self.config.max_payload_bytes {
             return Err(SttError::TranscriptionFailed(format!(
                 "Estimated multipart payload {} exceeds configured max_payload_bytes {}",
@@ -378,14 +635,29 @@ impl HttpRemotePlugin {
         Ok(())
     }
 
-    fn build_http_client(&self) -> Result<Client, ColdVoxError> {
-        Client::builder()
+    /// The plugin's pooled client, built on first use. Timeouts are set per
+    /// request because streaming uploads must outlive `timeout_ms`.
+    fn http_client(&self) -> Result<&Client, ColdVoxError> {
+        if let Some(client) = self.client.get() {
+            return Ok(client);
+        }
+        let mut builder = Client::builder()
             .connect_timeout(self.request_timeout())
-            .timeout(self.request_timeout())
-            .build()
-            .map_err(|e| {
-                SttError::TranscriptionFailed(format!("Failed to build HTTP client: {e}")).into()
-            })
+            .pool_idle_timeout(POOL_IDLE_TIMEOUT)
+            .tcp_keepalive(TCP_KEEPALIVE)
+            .tcp_nodelay(true);
+        if self.config.http2_prior_knowledge {
+            builder = builder
+                .http2_prior_knowledge()
+                .http2_keep_alive_interval(TCP_KEEPALIVE)
+                .http2_keep_alive_while_idle(true);
+        }
+        let client = builder.build().map_err(|e| {
+            ColdVoxError::from(SttError::TranscriptionFailed(format!(
+                "Failed to build HTTP client: {e}"
+            )))
+        })?;
+        Ok(self.client.get_or_init(|| client))
     }
 
     fn build_service_url(
@@ -396,6 +668,95 @@ impl HttpRemotePlugin {
         build_endpoint_url(&self.config.base_url, field_name, endpoint_path)
     }
 
+    /// Fire-and-forget health probes so a pooled connection to each endpoint
+    /// is open before the utterance's request needs it.
+    fn spawn_warm_connections(&self) {
+        let Ok(client) = self.http_client() else {
+            return;
+        };
+        let bases = std::iter::once(self.config.base_url.as_str())
+            .chain(self.config.hedge_base_url.as_deref());
+        for base in bases {
+            let Ok(url) = build_endpoint_url(base, "health_path", &self.config.health_path) else {
+                continue;
+            };
+            let Ok(request) = self.apply_common_headers(client.get(url)) else {
+                return;
+            };
+            let request = request.timeout(self.request_timeout());
+            tokio::spawn(async move {
+                // Drain the body so the connection goes back to the pool
+                if let Ok(response) = request.send().await {
+                    let _ = response.bytes().await;
+                }
+            });
+        }
+    }
+
+    fn hedge_delay(&self) -> Duration {
+        let floor = Duration::from_millis(self.config.hedge_min_delay_ms);
+        self.latencies
+            .lock()
+            .p95()
+            .unwrap_or(Duration::from_millis(self.config.hedge_initial_delay_ms))
+            .max(floor)
+    }
+
+    /// Send to the primary endpoint and, if it is slower than the hedge delay,
+    /// also to `hedge_base_url`. The first success wins; an error from one
+    /// side waits for the other.
+    async fn transcribe_batch(
+        &self,
+        audio_data: Vec<u8>,
+        samples: u64,
+    ) -> Result<SttResponse, ColdVoxError> {
+        self.validate_request_guardrails(&audio_data, samples)?;
+        let audio = Bytes::from(audio_data);
+        let started = Instant::now();
+
+        let primary = self.send_transcription_request(&self.config.base_url, audio.clone());
+        let Some(hedge_base_url) = self.config.hedge_base_url.as_deref() else {
+            let response = primary.await?;
+            self.latencies.lock().record(started.elapsed());
+            return Ok(response);
+        };
+        tokio::pin!(primary);
+
+        tokio::select! {
+            result = &mut primary => {
+                if result.is_ok() {
+                    self.latencies.lock().record(started.elapsed());
+                }
+                return result;
+            }
+            _ = tokio::time::sleep(self.hedge_delay()) => {}
+        }
+
+        tracing::debug!(
+            target: "coldvox::stt::http_remote",
+            hedge = hedge_base_url,
+            after_ms = started.elapsed().as_millis() as u64,
+            "Primary STT request slow; hedging"
+        );
+        let hedge = self.send_transcription_request(hedge_base_url, audio);
+        tokio::pin!(hedge);
+
+        let result = tokio::select! {
+            result = &mut primary => match result {
+                Ok(response) => Ok(response),
+                Err(primary_err) => hedge.await.map_err(|_| primary_err),
+            },
+            result = &mut hedge => match result {
+                Ok(response) => Ok(response),
+                Err(_) => primary.await,
+            },
+        };
+        if result.is_ok() {
+            self.latencies.lock().record(started.elapsed());
+        }
+        result
+    }
+
     fn apply_common_headers(
         &self,
         request: reqwest::RequestBuilder,
@@ -419,56 +780,33 @@ impl HttpRemotePlugin {
         Ok(request)
     }
 
-    fn encode_wav(&self) -> Result<Vec<u8>, ColdVoxError> {
-        let mut cursor = Cursor::new(Vec::new());
-        let spec = hound::WavSpec {
-            channels: 1,
-            sample_rate: self.config.sample_rate,
-            bits_per_sample: 16,
-            sample_format: hound::SampleFormat::Int,
-        };
-
-        let mut writer = hound::WavWriter::new(&mut cursor, spec).map_err(|e| {
-            SttError::TranscriptionFailed(format!("Failed to create WAV writer: {e}"))
-        })?;
-
-        for &sample in &self.audio_buffer {
-            writer.write_sample(sample).map_err(|e| {
-                SttError::TranscriptionFailed(format!("Failed to write WAV sample: {e}"))
-            })?;
-        }
-
-        writer
-            .finalize()
-            .map_err(|e| SttError::TranscriptionFailed(format!("Failed to finalize WAV: {e}")))?;
-
-        Ok(cursor.into_inner())
-    }
-
     async fn send_transcription_request(
         &self,
-        wav_data: &[u8],
+        base_url: &str,
+        audio: Bytes,
     ) -> Result<SttResponse, ColdVoxError> {
-        self.validate_request_guardrails(wav_data)?;
-        let client = self.build_http_client()?;
-        let url = self.build_service_url("api_path", &self.config.api_path)?;
-        let wav_part = multipart::Part::bytes(wav_data.to_vec())
-            .file_name("audio.wav")
-            .mime_str("audio/wav")
+        let client = self.http_client()?;
+        let url = build_endpoint_url(base_url, "api_path", &self.config.api_path)?;
+        let codec = self.config.codec;
+        let audio_len = audio.len() as u64;
+        let audio_part = multipart::Part::stream_with_length(audio, audio_len)
+            .file_name(codec.file_name())
+            .mime_str(codec.mime_type())
             .map_err(|e| {
                 SttError::TranscriptionFailed(format!(
-                    "Failed to build HTTP multipart WAV part: {e}"
+                    "Failed to build HTTP multipart {codec} part: {e}"
                 ))
             })?;
         let form = multipart::Form::new()
             .text("model", self.config.model_name.clone())
             .text("response_format", "json")
-            .part("file", wav_part);
+            .part("file", audio_part);
 
         let response = self
             .apply_common_headers(
                 client
                     .post(url.clone())
+                    .timeout(self.request_timeout())
                     .header(reqwest::header::ACCEPT, "application/json"),
             )?
             .multipart(form)
@@ -499,8 +837,158 @@ impl HttpRemotePlugin {
         })
     }
 
+    /// Open the chunked upload for a new utterance.
+    fn start_stream(&self) -> Result<StreamingUpload, ColdVoxError> {
+        let stream_api_path = self.config.stream_api_path.as_deref().unwrap_or_default();
+        // No request timeout: the upload lasts as long as the utterance.
+        // finalize bounds the wait for the result with `timeout_ms` instead.
+        let client = self.http_client()?;
+        let mut url = self.build_service_url("stream_api_path", stream_api_path)?;
+        url.query_pairs_mut()
+            .append_pair("model", &self.config.model_name)
+            .append_pair("sample_rate", &self.config.sample_rate.to_string());
+
+        let (chunks_tx, mut chunks_rx) = mpsc::unbounded_channel::<Vec<u8>>();
+        let body = reqwest::Body::wrap_stream(futures_util::stream::poll_fn(move |cx| {
+            chunks_rx
+                .poll_recv(cx)
+                .map(|chunk| chunk.map(Ok::<_, std::io::Error>))
+        }));
+        let request = self
+            .apply_common_headers(
+                client
+                    .post(url.clone())
+                    .header(
+                        reqwest::header::ACCEPT,
+                        "application/x-ndjson, application/json",
+                    )
+                    .header(reqwest::header::CONTENT_TYPE, "audio/pcm"),
+            )?
+            .body(body);
+
+        let (partials_tx, partials_rx) = mpsc::unbounded_channel();
+        let chunk_bytes =
+            (self.config.sample_rate as usize * self.config.stream_chunk_ms as usize / 1000 * 2)
+                .max(2);
+        Ok(StreamingUpload {
+            chunks: Some(chunks_tx),
+            pending: Vec::with_capacity(chunk_bytes),
+            chunk_bytes,
+            samples_sent: 0,
+            partials: partials_rx,
+            response: tokio::spawn(run_stream_request(request, url, partials_tx)),
+        })
+    }
+
+    /// Most samples a streamed utterance may carry under the guardrails.
+    fn max_stream_samples(&self) -> u64 {
+        let max_samples = self.config.max_audio_seconds as u64 * self.config.sample_rate as u64;
+        let max_bytes = self
+            .config
+            .max_audio_bytes
+            .min(self.config.max_payload_bytes);
+        max_samples.min(max_bytes / 2)
+    }
+
+    /// Keep `samples` for the batch fallback, up to the guardrails.
+    fn retain_stream_audio(&mut self, samples: &[i16]) {
+        let room = (self.max_stream_samples() as usize).saturating_sub(self.stream_audio.len());
+        self.stream_audio
+            .extend_from_slice(&samples[..samples.len().min(room)]);
+    }
+
+    fn stream_audio(
+        &mut self,
+        samples: &[i16],
+    ) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
+        if self.stream_failed {
+            self.retain_stream_audio(samples);
+            return Ok(None);
+        }
+        if self.upload.is_none() {
+            match self.start_stream() {
+                Ok(upload) => self.upload = Some(upload),
+                Err(e) => {
+                    self.stream_failed = true;
+                    self.retain_stream_audio(samples);
+                    return Err(e);
+                }
+            }
+        }
+        let max_samples = self.max_stream_samples();
+        let upload = self.upload.as_mut().expect("upload started above");
+
+        upload.samples_sent += samples.len() as u64;
+        if upload.samples_sent > max_samples {
+            self.upload = None;
+            self.stream_failed = true;
+            self.retain_stream_audio(samples);
+            return Err(SttError::TranscriptionFailed(format!(
+                "Streamed utterance exceeds configured max_audio_seconds {} or max_audio_bytes {}",
+                self.config.max_audio_seconds,
+                self.config
+                    .max_audio_bytes
+                    .min(self.config.max_payload_bytes)
+            ))
+            .into());
+        }
+        self.stream_audio.extend_from_slice(samples);
+
+        for &sample in samples {
+            upload.pending.extend_from_slice(&sample.to_le_bytes());
+        }
+        if upload.pending.len() >= upload.chunk_bytes {
+            upload.flush();
+        }
+
+        match upload.latest_partial() {
+            Some(text) if self.emit_partials => Ok(Some(TranscriptionEvent::Partial {
+                utterance_id: self.utterance_id,
+                text,
+                t0: None,
+                t1: None,
+            })),
+            _ => Ok(None),
+        }
+    }
+
+    /// Flush the tail of the upload, close the body, and wait for the result.
+    async fn finish_stream(&mut self) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
+        self.stream_audio.clear();
+        let Some(mut upload) = self.upload.take() else {
+            return Ok(None);
+        };
+        upload.flush();
+        upload.chunks = None;
+
+        let text = match tokio::time::timeout(self.request_timeout(), &mut upload.response).await {
+            Ok(Ok(result)) => result?,
+            Ok(Err(e)) => {
+                return Err(SttError::TranscriptionFailed(format!(
+                    "HTTP streaming request task failed: {e}"
+                ))
+                .into())
+            }
+            Err(_) => {
+                return Err(SttError::TranscriptionFailed(format!(
+                    "HTTP streaming response timed out after {}ms",
+                    self.config.timeout_ms
+                ))
+                .into())
+            }
+        };
+
+        let event = TranscriptionEvent::Final {
+            utterance_id: self.utterance_id,
+            text,
+            words: None,
+        };
+        self.utterance_id += 1;
+        Ok(Some(event))
+    }
+
     async fn probe_health(&self) -> Result<bool, ColdVoxError> {
-        let client = match self.build_http_client() {
+        let client = match self.http_client() {
             Ok(client) => client,
             Err(_) => return Ok(false),
         };
@@ -509,7 +997,7 @@ impl HttpRemotePlugin {
             Err(_) => return Ok(false),
         };
 
-        match self.apply_common_headers(client.get(url)) {
+        match self.apply_common_headers(client.get(url).timeout(self.request_timeout())) {
             Ok(request) => match request.send().await {
                 Ok(response) => Ok(response.status().is_success()),
                 Err(_) => Ok(false),
@@ -527,7 +1015,7 @@ impl SttPlugin for HttpRemotePlugin {
 
     fn capabilities(&self) -> PluginCapabilities {
         PluginCapabilities {
-            streaming: false,
+            streaming: self.config.stream_api_path.is_some(),
             batch: true,
             word_timestamps: false,
             confidence_scores: false,
@@ -541,8 +1029,12 @@ impl SttPlugin for HttpRemotePlugin {
         self.probe_health().await
     }
 
-    async fn initialize(&mut self, _config: TranscriptionConfig) -> Result<(), ColdVoxError> {
-        self.audio_buffer.clear();
+    async fn initialize(&mut self, config: TranscriptionConfig) -> Result<(), ColdVoxError> {
+        self.payload = None;
+        self.upload = None;
+        self.stream_audio.clear();
+        self.stream_failed = false;
+        self.emit_partials = config.partial_results;
         Ok(())
     }
 
@@ -550,17 +1042,43 @@ impl SttPlugin for HttpRemotePlugin {
         &mut self,
         samples: &[i16],
     ) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
-        self.audio_buffer.extend_from_slice(samples);
+        if self.config.stream_api_path.is_some() {
+            return self.stream_audio(samples);
+        }
+        if self.payload.is_none() {
+            self.payload = Some(PayloadEncoder::new(
+                self.config.codec,
+                self.config.sample_rate,
+            )?);
+        }
+        self.payload
+            .as_mut()
+            .expect("payload created above")
+            .push(samples)?;
         Ok(None)
     }
 
     async fn finalize(&mut self) -> Result<Option<TranscriptionEvent>, ColdVoxError> {
-        if self.audio_buffer.is_empty() {
+        if self.config.stream_api_path.is_some() {
+            if !std::mem::take(&mut self.stream_failed) {
+                return self.finish_stream().await;
+            }
+            // Streaming gave up on this utterance; send what was kept instead
+            let audio = std::mem::take(&mut self.stream_audio);
+            let mut payload = PayloadEncoder::new(self.config.codec, self.config.sample_rate)?;
+            payload.push(&audio)?;
+            self.payload = Some(payload);
+        }
+        let Some(payload) = self.payload.take() else {
+            return Ok(None);
+        };
+        let samples = payload.total_samples();
+        if samples == 0 {
             return Ok(None);
         }
 
-        let wav_data = self.encode_wav()?;
-        let stt_res = self.send_transcription_request(&wav_data).await?;
+        let audio_data = payload.finish()?;
+        let stt_res = self.transcribe_batch(audio_data, samples).await?;
 
         let event = TranscriptionEvent::Final {
             utterance_id: self.utterance_id,
@@ -568,20 +1086,30 @@ impl SttPlugin for HttpRemotePlugin {
             words: None,
         };
 
-        self.audio_buffer.clear();
         self.utterance_id += 1;
 
         Ok(Some(event))
     }
 
+    async fn warm_up(&mut self) -> Result<(), ColdVoxError> {
+        self.spawn_warm_connections();
+        Ok(())
+    }
+
     async fn reset(&mut self) -> Result<(), ColdVoxError> {
-        self.audio_buffer.clear();
+        self.payload = None;
+        self.upload = None;
+        self.stream_audio.clear();
+        self.stream_failed = false;
         self.utterance_id += 1;
         Ok(())
     }
 
     async fn unload(&mut self) -> Result<(), ColdVoxError> {
-        self.audio_buffer.clear();
+        self.payload = None;
+        self.upload = None;
+        self.stream_audio = Vec::new();
+        self.stream_failed = false;
         Ok(())
     }
 }
@@ -618,6 +1146,13 @@ impl HttpRemotePluginFactory {
             max_audio_bytes: default_max_audio_bytes(),
             max_audio_seconds: default_max_audio_seconds(),
             max_payload_bytes: default_max_payload_bytes(),
+            stream_api_path: None,
+            stream_chunk_ms: default_stream_chunk_ms(),
+            codec: PayloadCodec::default(),
+            hedge_base_url: None,
+            hedge_initial_delay_ms: default_hedge_initial_delay_ms(),
+            hedge_min_delay_ms: default_hedge_min_delay_ms(),
+            http2_prior_knowledge: false,
         })
     }
 }
@@ -642,6 +1177,7 @@ mod tests {
     use crate::plugin::SttPlugin;
     use crate::types::{TranscriptionConfig, TranscriptionEvent};
     use std::future::Future;
+    use std::io::Cursor;
     use std::sync::mpsc;
     use tokio::io::{AsyncReadExt, AsyncWriteExt};
     use tokio::net::{TcpListener, TcpStream as TestStream};
@@ -661,6 +1197,7 @@ mod tests {
             display_name: "HTTP Remote Test".into(),
             timeout_ms: 100,
             sample_rate: 16_000,
+            codec: PayloadCodec::Wav,
             ..Default::default()
         }
     }
@@ -760,19 +1297,64 @@ mod tests {
         (format!("http://127.0.0.1:{}", addr.port()), handle)
     }
 
+    /// Read a chunked request through its terminating zero-length chunk and
+    /// return the head and the de-chunked body.
+    async fn read_chunked_request(stream: &mut TestStream, head: Vec<u8>) -> (String, Vec<u8>) {
+        let mut request = head;
+        let mut chunk = [0_u8; 4096];
+        while !request.ends_with(b"\r\n0\r\n\r\n") {
+            let read = timeout(Duration::from_millis(500), stream.read(&mut chunk))
+                .await
+                .expect("timed out reading chunked request")
+                .expect("read chunked request");
+            if read == 0 {
+                break;
+            }
+            request.extend_from_slice(&chunk[..read]);
+        }
+
+        let header_end = find_bytes(&request, b"\r\n\r\n").expect("request head") + 4;
+        let head = String::from_utf8_lossy(&request[..header_end]).to_string();
+        let mut body = Vec::new();
+        let mut rest = &request[header_end..];
+        while let Some(line_end) = find_bytes(rest, b"\r\n") {
+            let size = usize::from_str_radix(std::str::from_utf8(&rest[..line_end]).unwrap(), 16)
+                .expect("chunk size");
+            if size == 0 {
+                break;
+            }
+            body.extend_from_slice(&rest[line_end + 2..line_end + 2 + size]);
+            rest = &rest[line_end + 2 + size + 2..];
+        }
+        (head, body)
+    }
+
+    async fn read_request_head(stream: &mut TestStream) -> Vec<u8> {
+        let mut request = Vec::new();
+        let mut chunk = [0_u8; 4096];
+        while find_bytes(&request, b"\r\n\r\n").is_none() {
+            let read = timeout(Duration::from_millis(500), stream.read(&mut chunk))
+                .await
+                .expect("timed out reading request head")
+                .expect("read request head");
+            assert!(read > 0, "connection closed before request head");
+            request.extend_from_slice(&chunk[..read]);
+        }
+        request
+    }
+
     #[test]
     fn test_wav_encoding() {
-        let config = HttpRemoteConfig::default();
-        let mut plugin = HttpRemotePlugin::new(config);
-
         let samples: Vec<i16> = (0..16000)
             .map(|i| (i as f32 * 440.0 * 2.0 * std::f32::consts::PI / 16000.0).sin() * 32767.0)
             .map(|s| s as i16)
             .collect();
 
-        plugin.audio_buffer.extend_from_slice(&samples);
+        let mut payload =
+            PayloadEncoder::new(PayloadCodec::Wav, 16_000).expect("create WAV encoder");
+        payload.push(&samples).expect("encode samples");
 
-        let wav_data = plugin.encode_wav().expect("Should encode WAV");
+        let wav_data = payload.finish().expect("Should encode WAV");
         assert!(wav_data.len() > 32000);
 
         let mut reader = hound::WavReader::new(Cursor::new(wav_data)).expect("Should read WAV");
@@ -1195,4 +1777,349 @@ mod tests {
             Some("Bearer secret-token")
         );
     }
+
+    #[tokio::test]
+    async fn test_streaming_uploads_during_speech_and_reports_partials() {
+        let (tx, rx) = mpsc::channel();
+        let (base_url, handle) = spawn_stub_server(move |mut stream| async move {
+            // Answer with a partial as soon as the upload starts, before the body ends
+            let head = read_request_head(&mut stream).await;
+            stream
+                .write_all(
+                    b"HTTP/1.1 200 OK\r\nContent-Type: application/x-ndjson\r\nConnection: close\r\n\r\n{\"text\":\"stub\",\"is_final\":false}\n",
+                )
+                .await
+                .expect("write partial");
+
+            let request = read_chunked_request(&mut stream, head).await;
+            tx.send(request).expect("capture streamed request");
+            stream
+                .write_all(b"{\"text\":\"stub transcript\",\"is_final\":true}\n")
+                .await
+                .expect("write final");
+        })
+        .await;
+
+        let mut config = test_config(base_url);
+        config.stream_api_path = Some("/v1/audio/stream".into());
+        config.stream_chunk_ms = 0;
+        config.timeout_ms = 500;
+        let mut plugin = HttpRemotePlugin::new(config);
+        assert!(plugin.capabilities().streaming);
+
+        plugin
+            .initialize(TranscriptionConfig::default())
+            .await
+            .expect("initialize plugin");
+        let mut sent = Vec::new();
+        let mut partial = None;
+        for _ in 0..50 {
+            sent.extend_from_slice(&test_samples());
+            match plugin.process_audio(&test_samples()).await {
+                Ok(Some(TranscriptionEvent::Partial { text, .. })) => {
+                    partial = Some(text);
+                    break;
+                }
+                Ok(_) => sleep(Duration::from_millis(10)).await,
+                Err(e) => panic!("streaming process_audio failed: {e}"),
+            }
+        }
+        assert_eq!(partial.as_deref(), Some("stub"));
+
+        match plugin.finalize().await.expect("finalize succeeds") {
+            Some(TranscriptionEvent::Final {
+                utterance_id, text, ..
+            }) => {
+                assert_eq!(utterance_id, 0);
+                assert_eq!(text, "stub transcript");
+            }
+            other => panic!("expected final transcription event, got {other:?}"),
+        }
+        handle.await.expect("join stub server");
+
+        let (head, body) = rx.recv().expect("captured request");
+        assert!(head.starts_with(
+            "POST /v1/audio/stream?model=moonshine%2Ftest&sample_rate=16000 HTTP/1.1\r\n"
+        ));
+        assert_eq!(
+            header_value(&head, "transfer-encoding").as_deref(),
+            Some("chunked")
+        );
+        assert_eq!(
+            header_value(&head, "content-type").as_deref(),
+            Some("audio/pcm")
+        );
+        let streamed: Vec<i16> = body
+            .chunks_exact(2)
+            .map(|b| i16::from_le_bytes([b[0], b[1]]))
+            .collect();
+        assert_eq!(streamed, sent);
+    }
+
+    #[tokio::test]
+    async fn test_streaming_past_guardrail_falls_back_to_batch_for_the_final() {
+        let listener = TcpListener::bind("127.0.0.1:0")
+            .await
+            .expect("bind stub server");
+        let base_url = format!(
+            "http://127.0.0.1:{}",
+            listener.local_addr().expect("stub server address").port()
+        );
+        let (tx, rx) = mpsc::channel();
+        let server = tokio::spawn(async move {
+            loop {
+                let (mut stream, _) = listener.accept().await.expect("accept stub connection");
+                let head = read_request_head(&mut stream).await;
+                let head_text = String::from_utf8_lossy(&head).to_string();
+                if head_text.starts_with("POST /v1/audio/stream") {
+                    tx.send(head_text).expect("record upload");
+                    // Leave the upload open; the plugin abandons it
+                    tokio::spawn(async move {
+                        let mut sink = [0_u8; 4096];
+                        while matches!(stream.read(&mut sink).await, Ok(n) if n > 0) {}
+                    });
+                    continue;
+                }
+                let mut request = head;
+                let mut chunk = [0_u8; 4096];
+                while extract_http_body(&request).map_or(true, |body| {
+                    let wanted = header_value(&head_text, "content-length")
+                        .and_then(|v| v.parse::<usize>().ok())
+                        .unwrap_or(0);
+                    body.len() < wanted
+                }) {
+                    let read = stream.read(&mut chunk).await.expect("read batch request");
+                    assert!(read > 0, "batch request truncated");
+                    request.extend_from_slice(&chunk[..read]);
+                }
+                tx.send(head_text).expect("record batch request");
+                let body = r#"{"text":"batch transcript"}"#;
+                let response = format!(
+                    "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                    body.len(),
+                    body,
+                );
+                stream
+                    .write_all(response.as_bytes())
+                    .await
+                    .expect("write response");
+                break;
+            }
+        });
+
+        let mut config = test_config(base_url);
+        config.stream_api_path = Some("/v1/audio/stream".into());
+        config.max_audio_seconds = 1;
+        config.timeout_ms = 2_000;
+        let mut plugin = HttpRemotePlugin::new(config);
+
+        plugin
+            .initialize(TranscriptionConfig::default())
+            .await
+            .expect("initialize plugin");
+        plugin
+            .process_audio(&vec![1_i16; 16_000])
+            .await
+            .expect("first second fits");
+        let error = plugin
+            .process_audio(&[1_i16; 1])
+            .await
+            .expect_err("second past the limit should fail");
+        assert!(error.to_string().contains("max_audio_seconds"));
+        // The rest of the utterance opens no new upload
+        for _ in 0..10 {
+            assert!(plugin
+                .process_audio(&[1_i16; 512])
+                .await
+                .expect("latched frames are kept quietly")
+                .is_none());
+        }
+
+        match plugin.finalize().await.expect("batch fallback succeeds") {
+            Some(TranscriptionEvent::Final { text, .. }) => assert_eq!(text, "batch transcript"),
+            other => panic!("expected final transcription event, got {other:?}"),
+        }
+        server.await.expect("join stub server");
+
+        // The abandoned upload may or may not have connected, but no second
+        // one was opened
+        let requests: Vec<String> = rx.try_iter().collect();
+        let (uploads, batch): (Vec<_>, Vec<_>) = requests
+            .iter()
+            .partition(|head| head.starts_with("POST /v1/audio/stream"));
+        assert!(uploads.len() <= 1, "reopened upload: {uploads:?}");
+        assert_eq!(batch.len(), 1);
+        assert!(batch[0].starts_with("POST /v1/audio/transcriptions"));
+    }
+
+    #[tokio::test]
+    async fn test_finalize_posts_flac_by_default() {
+        let (tx, rx) = mpsc::channel();
+        let (base_url, handle) = spawn_stub_server(move |mut stream| async move {
+            let request = read_http_request(&mut stream).await;
+            tx.send(request).expect("capture HTTP request");
+
+            let body = r#"{"text":"stub transcript"}"#;
+            let response = format!(
+                "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                body.len(),
+                body,
+            );
+            stream
+                .write_all(response.as_bytes())
+                .await
+                .expect("write HTTP response");
+        })
+        .await;
+
+        let mut config = test_config(base_url);
+        config.codec = HttpRemoteConfig::default().codec;
+        let mut plugin = HttpRemotePlugin::new(config);
+        let samples: Vec<i16> = (0..16_000)
+            .map(|i| ((i as f32 * 0.05).sin() * 8000.0) as i16)
+            .collect();
+
+        plugin
+            .initialize(TranscriptionConfig::default())
+            .await
+            .expect("initialize plugin");
+        for frame in samples.chunks(512) {
+            plugin.process_audio(frame).await.expect("encode frame");
+        }
+        let _ = plugin.finalize().await.expect("finalize succeeds");
+        handle.await.expect("join stub server");
+
+        let request = rx.recv().expect("captured request");
+        let body = extract_http_body(&request).expect("extract request body");
+        let body_text = String::from_utf8_lossy(body);
+        assert!(body_text.contains("filename=\"audio.flac\""));
+        let flac_start = find_bytes(body, b"Content-Type: audio/flac\r\n\r\n")
+            .expect("locate FLAC part start")
+            + b"Content-Type: audio/flac\r\n\r\n".len();
+        assert_eq!(&body[flac_start..flac_start + 4], b"fLaC");
+        assert!(
+            body.len() < samples.len(),
+            "FLAC body {} bytes should be well under the {}-byte WAV",
+            body.len(),
+            samples.len() * 2
+        );
+    }
+
+    fn json_response(text: &str) -> String {
+        let body = format!(r#"{{"text":"{text}"}}"#);
+        format!(
+            "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: {}\r\n\r\n{}",
+            body.len(),
+            body,
+        )
+    }
+
+    #[tokio::test]
+    async fn test_warm_up_connection_is_reused_by_finalize() {
+        let (warmed_tx, warmed_rx) = tokio::sync::oneshot::channel();
+        // The stub accepts a single connection, so the POST only succeeds if it
+        // rides the connection the warm-up probe opened.
+        let (base_url, handle) = spawn_stub_server(move |mut stream| async move {
+            let probe = read_http_request(&mut stream).await;
+            assert!(String::from_utf8_lossy(&probe).starts_with("GET /health HTTP/1.1\r\n"));
+            stream
+                .write_all(b"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n")
+                .await
+                .expect("write health response");
+            warmed_tx.send(()).expect("signal warm-up");
+
+            let request = read_http_request(&mut stream).await;
+            assert!(String::from_utf8_lossy(&request).starts_with("POST "));
+            stream
+                .write_all(json_response("warm transcript").as_bytes())
+                .await
+                .expect("write HTTP response");
+        })
+        .await;
+
+        let mut config = test_config(base_url);
+        config.timeout_ms = 1000;
+        let mut plugin = HttpRemotePlugin::new(config);
+        plugin
+            .initialize(TranscriptionConfig::default())
+            .await
+            .expect("initialize plugin");
+        plugin.warm_up().await.expect("warm up");
+        timeout(Duration::from_secs(1), warmed_rx)
+            .await
+            .expect("warm-up probe reached the stub")
+            .expect("warm-up signal");
+        // Let the client return the drained connection to its pool
+        sleep(Duration::from_millis(20)).await;
+
+        plugin
+            .process_audio(&test_samples())
+            .await
+            .expect("buffer audio samples");
+        let event = plugin.finalize().await.expect("finalize succeeds");
+        handle.await.expect("join stub server");
+        assert!(matches!(
+            event,
+            Some(TranscriptionEvent::Final { ref text, .. }) if text == "warm transcript"
+        ));
+    }
+
+    #[tokio::test]
+    async fn test_slow_primary_is_hedged_to_secondary() {
+        let (primary_url, _primary) = spawn_stub_server(|mut stream| async move {
+            read_http_request(&mut stream).await;
+            sleep(Duration::from_millis(300)).await;
+            let _ = stream
+                .write_all(json_response("primary transcript").as_bytes())
+                .await;
+        })
+        .await;
+        let (hedge_url, hedge) = spawn_stub_server(|mut stream| async move {
+            read_http_request(&mut stream).await;
+            stream
+                .write_all(json_response("hedged transcript").as_bytes())
+                .await
+                .expect("write HTTP response");
+        })
+        .await;
+
+        let mut config = test_config(primary_url);
+        config.timeout_ms = 1000;
+        config.hedge_base_url = Some(hedge_url);
+        config.hedge_initial_delay_ms = 50;
+        config.hedge_min_delay_ms = 10;
+        let mut plugin = HttpRemotePlugin::new(config);
+        plugin
+            .initialize(TranscriptionConfig::default())
+            .await
+            .expect("initialize plugin");
+        plugin
+            .process_audio(&test_samples())
+            .await
+            .expect("buffer audio samples");
+
+        let started = Instant::now();
+        let event = plugin.finalize().await.expect("finalize succeeds");
+        hedge.await.expect("join hedge stub");
+        assert!(started.elapsed() < Duration::from_millis(300));
+        assert!(matches!(
+            event,
+            Some(TranscriptionEvent::Final { ref text, .. }) if text == "hedged transcript"
+        ));
+    }
+
+    #[test]
+    fn test_latency_window_p95_needs_enough_samples() {
+        let mut window = LatencyWindow::default();
+        for ms in 1..LatencyWindow::MIN_SAMPLES as u64 {
+            window.record(Duration::from_millis(ms));
+        }
+        assert_eq!(window.p95(), None);
+
+        for ms in 1..=100 {
+            window.record(Duration::from_millis(ms));
+        }
+        // Only the last 64 samples (37..=100 ms) are retained
+        assert_eq!(window.p95(), Some(Duration::from_millis(97)));
+    }
 }
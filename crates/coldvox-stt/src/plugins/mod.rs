@@ -1,7 +1,10 @@
 //! Built-in STT plugin implementations
 
+pub mod engine_cache;
+pub mod flac;
 pub mod mock;
 pub mod noop;
+pub mod windowed;
 // whisper backend temporarily removed; will be reintroduced as pure Rust implementation
 // pub mod whisper_plugin;
 
@@ -14,6 +17,9 @@ pub mod moonshine;
 #[cfg(feature = "http-remote")]
 pub mod http_remote;
 
+#[cfg(feature = "http-remote")]
+pub mod payload;
+
 // Re-export commonly used plugins
 pub use mock::MockPlugin;
 pub use noop::NoOpPlugin;
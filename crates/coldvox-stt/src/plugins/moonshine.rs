@@ -18,8 +18,8 @@ use tracing::{debug, info, warn};
 
 #[cfg(feature = "moonshine")]
 use pyo3::{
-    types::{PyAnyMethods, PyDict, PyDictMethods, PyModule},
-    Py, PyAny, Python,
+    types::{PyAnyMethods, PyBytes, PyDict, PyDictMethods, PyModule},
+    Bound, Py, PyAny, Python,
 };
 #[cfg(feature = "moonshine")]
 use tempfile::NamedTempFile;
@@ -78,6 +78,10 @@ pub struct MoonshinePlugin {
     /// All methods that access `cached_processor` must use `Python::with_gil()`.
     #[cfg(feature = "moonshine")]
     cached_processor: Option<Py<PyAny>>,
+    /// NumPy is importable, so audio can be handed over in memory instead of
+    /// through a temp WAV file.
+    #[cfg(feature = "moonshine")]
+    in_memory_audio: bool,
 }
 
 // Manual Debug impl because Py<PyAny> doesn't implement Debug
@@ -105,6 +109,8 @@ impl MoonshinePlugin {
             cached_model: None,
             #[cfg(feature = "moonshine")]
             cached_processor: None,
+            #[cfg(feature = "moonshine")]
+            in_memory_audio: false,
         }
     }
 
@@ -158,18 +164,12 @@ impl MoonshinePlugin {
         })
     }
 
-    /// Load model and processor into Python, caching them for reuse.
+    /// Load model and processor into Python and return them for caching.
     /// This is called once during initialize() to avoid the 5-10 second
-    /// model loading delay on every transcription.
+    /// model loading delay on every transcription. Blocks; run it on the
+    /// blocking pool.
     #[cfg(feature = "moonshine")]
-    fn load_model_and_processor(&mut self) -> Result<(), ColdVoxError> {
-        // Use custom model path if provided, otherwise use HuggingFace model identifier
-        let model_id = self
-            .model_path
-            .as_ref()
-            .and_then(|p| p.to_str())
-            .unwrap_or_else(|| self.model_size.model_identifier());
-
+    fn load_model_and_processor(model_id: &str) -> Result<(Py<PyAny>, Py<PyAny>), ColdVoxError> {
         Python::with_gil(|py| {
             let locals = PyDict::new_bound(py);
             locals
@@ -209,25 +209,14 @@ _processor = AutoProcessor.from_pretrained(model_id)
                 .map_err(|e| SttError::LoadFailed(format!("Failed to get processor: {}", e)))?
                 .ok_or_else(|| SttError::LoadFailed("Processor not found in locals".to_string()))?;
 
-            // Store as Py<PyAny> for later use (increments reference count)
-            self.cached_model = Some(model.unbind());
-            self.cached_processor = Some(processor.unbind());
-
-            info!(
-                target: "coldvox::stt::moonshine",
-                model = %self.model_size.model_identifier(),
-                "Model and processor cached successfully"
-            );
-
-            Ok(())
+            // Keep as Py<PyAny> for later use (increments reference count)
+            Ok((model.unbind(), processor.unbind()))
         })
     }
 
-    /// Transcribe audio using the cached model and processor.
-    /// SECURITY: Uses PyO3's locals dict to pass the audio path safely,
-    /// preventing code injection attacks via malicious file paths.
+    /// Locals dict holding the cached model and processor.
     #[cfg(feature = "moonshine")]
-    fn transcribe_via_python(&self, audio_path: &Path) -> Result<String, ColdVoxError> {
+    fn inference_locals<'py>(&self, py: Python<'py>) -> Result<Bound<'py, PyDict>, ColdVoxError> {
         let model = self
             .cached_model
             .as_ref()
@@ -237,33 +226,24 @@ _processor = AutoProcessor.from_pretrained(model_id)
             .as_ref()
             .ok_or_else(|| SttError::TranscriptionFailed("Processor not loaded".to_string()))?;
 
-        Python::with_gil(|py| {
-            let locals = PyDict::new_bound(py);
-
-            // SECURITY: Pass variables via locals dict, not string interpolation
-            // This prevents code injection via malicious file paths
-            locals.set_item("model", model.bind(py)).map_err(|e| {
-                SttError::TranscriptionFailed(format!("Failed to set model: {}", e))
-            })?;
-            locals
-                .set_item("processor", processor.bind(py))
-                .map_err(|e| {
-                    SttError::TranscriptionFailed(format!("Failed to set processor: {}", e))
-                })?;
-
-            // Convert path to string safely (use forward slashes on all platforms)
-            let path_str = audio_path.to_string_lossy().replace('\\', "/");
-            locals.set_item("audio_path", path_str).map_err(|e| {
-                SttError::TranscriptionFailed(format!("Failed to set audio_path: {}", e))
+        let locals = PyDict::new_bound(py);
+        locals
+            .set_item("model", model.bind(py))
+            .map_err(|e| SttError::TranscriptionFailed(format!("Failed to set model: {}", e)))?;
+        locals
+            .set_item("processor", processor.bind(py))
+            .map_err(|e| {
+                SttError::TranscriptionFailed(format!("Failed to set processor: {}", e))
             })?;
+        Ok(locals)
+    }
 
-            // NOTE: Must use run_bound (not eval_bound) because this contains statements
-            let transcribe_code = r#"
+    /// Run the model on the `audio_array` already placed in `locals`.
+    #[cfg(feature = "moonshine")]
+    fn run_inference(py: Python<'_>, locals: &Bound<'_, PyDict>) -> Result<String, ColdVoxError> {
+        // NOTE: Must use run_bound (not eval_bound) because this contains statements
+        let inference_code = r#"
 import torch
-import librosa
-
-# Load audio using the safely-passed path variable
-audio_array, sampling_rate = librosa.load(audio_path, sr=16000, mono=True)
 
 # Process with cached model and processor
 inputs = processor(audio_array, sampling_rate=16000, return_tensors="pt")
@@ -275,21 +255,85 @@ with torch.no_grad():
 _transcription = processor.batch_decode(generated_ids, skip_special_tokens=True)[0]
 "#;
 
-            py.run_bound(transcribe_code, None, Some(&locals))
-                .map_err(|e| SttError::TranscriptionFailed(format!("Python error: {}", e)))?;
+        py.run_bound(inference_code, None, Some(locals))
+            .map_err(|e| SttError::TranscriptionFailed(format!("Python error: {}", e)))?;
+
+        let result = locals
+            .get_item("_transcription")
+            .map_err(|e| SttError::TranscriptionFailed(format!("Failed to get result: {}", e)))?
+            .ok_or_else(|| {
+                SttError::TranscriptionFailed("Transcription not found in locals".to_string())
+            })?;
+
+        result
+            .extract()
+            .map_err(|e| SttError::TranscriptionFailed(format!("Failed to extract text: {}", e)))
+    }
+
+    /// Transcribe 16kHz mono PCM without leaving memory. The samples are written
+    /// straight into a Python `bytes` object and viewed as a NumPy array, so there
+    /// is no WAV encoding, file I/O, or librosa decode/resample.
+    #[cfg(feature = "moonshine")]
+    fn transcribe_samples_via_python(&self, samples: &[i16]) -> Result<String, ColdVoxError> {
+        Python::with_gil(|py| {
+            let locals = self.inference_locals(py)?;
 
-            let result = locals
-                .get_item("_transcription")
-                .map_err(|e| SttError::TranscriptionFailed(format!("Failed to get result: {}", e)))?
-                .ok_or_else(|| {
-                    SttError::TranscriptionFailed("Transcription not found in locals".to_string())
-                })?;
+            let pcm = PyBytes::new_bound_with(py, samples.len() * 2, |buf| {
+                for (dst, &sample) in buf.chunks_exact_mut(2).zip(samples) {
+                    dst.copy_from_slice(&sample.to_le_bytes());
+                }
+                Ok(())
+            })
+            .map_err(|e| SttError::TranscriptionFailed(format!("Failed to pass audio: {}", e)))?;
+            locals
+                .set_item("pcm", pcm)
+                .map_err(|e| SttError::TranscriptionFailed(format!("Failed to set pcm: {}", e)))?;
+
+            // frombuffer is a view over the bytes; the float conversion is the only copy
+            py.run_bound(
+                r#"
+import numpy as np
+audio_array = np.frombuffer(pcm, dtype="<i2").astype(np.float32) / 32768.0
+"#,
+                None,
+                Some(&locals),
+            )
+            .map_err(|e| SttError::TranscriptionFailed(format!("Python error: {}", e)))?;
+
+            Self::run_inference(py, &locals)
+        })
+    }
 
-            let text: String = result.extract().map_err(|e| {
-                SttError::TranscriptionFailed(format!("Failed to extract text: {}", e))
+    /// Transcribe a WAV file using the cached model and processor. Fallback for
+    /// environments without NumPy.
+    /// SECURITY: Uses PyO3's locals dict to pass the audio path safely,
+    /// preventing code injection attacks via malicious file paths.
+    #[cfg(feature = "moonshine")]
+    fn transcribe_via_python(&self, audio_path: &Path) -> Result<String, ColdVoxError> {
+        Python::with_gil(|py| {
+            // SECURITY: Pass variables via locals dict, not string interpolation
+            // This prevents code injection via malicious file paths
+            let locals = self.inference_locals(py)?;
+
+            // Convert path to string safely (use forward slashes on all platforms)
+            let path_str = audio_path.to_string_lossy().replace('\\', "/");
+            locals.set_item("audio_path", path_str).map_err(|e| {
+                SttError::TranscriptionFailed(format!("Failed to set audio_path: {}", e))
             })?;
 
-            Ok(text)
+            py.run_bound(
+                r#"
+import librosa
+
+# Load audio using the safely-passed path variable
+audio_array, sampling_rate = librosa.load(audio_path, sr=16000, mono=True)
+"#,
+                None,
+                Some(&locals),
+            )
+            .map_err(|e| SttError::TranscriptionFailed(format!("Python error: {}", e)))?;
+
+            Self::run_inference(py, &locals)
         })
     }
 
@@ -382,8 +426,38 @@ impl SttPlugin for MoonshinePlugin {
             );
 
             // Load and cache model + processor (this takes 5-10 seconds on first run)
-            // Subsequent transcriptions will reuse the cached model
-            self.load_model_and_processor()?;
+            // Subsequent transcriptions will reuse the cached model. The load
+            // blocks, so keep it off the runtime's workers. Use custom model
+            // path if provided, otherwise use HuggingFace model identifier
+            let model_id = self
+                .model_path
+                .as_ref()
+                .and_then(|p| p.to_str())
+                .unwrap_or_else(|| self.model_size.model_identifier())
+                .to_string();
+            let (model, processor) =
+                tokio::task::spawn_blocking(move || Self::load_model_and_processor(&model_id))
+                    .await
+                    .map_err(|e| {
+                        SttError::LoadFailed(format!("Model load task failed: {}", e))
+                    })??;
+            self.cached_model = Some(model);
+            self.cached_processor = Some(processor);
+
+            info!(
+                target: "coldvox::stt::moonshine",
+                model = %self.model_size.model_identifier(),
+                "Model and processor cached successfully"
+            );
+
+            self.in_memory_audio =
+                Python::with_gil(|py| PyModule::import_bound(py, "numpy").is_ok());
+            if !self.in_memory_audio {
+                warn!(
+                    target: "coldvox::stt::moonshine",
+                    "numpy not importable; falling back to temp WAV handoff"
+                );
+            }
 
             self.audio_buffer.clear();
             self.active_config = Some(config);
@@ -467,10 +541,12 @@ impl SttPlugin for MoonshinePlugin {
                 "Transcribing via PyO3/HuggingFace"
             );
 
-            let temp_file = self.save_audio_to_wav(&self.audio_buffer)?;
-            let audio_path = temp_file.path();
-
-            let text = self.transcribe_via_python(audio_path)?;
+            let text = if self.in_memory_audio {
+                self.transcribe_samples_via_python(&self.audio_buffer)?
+            } else {
+                let temp_file = self.save_audio_to_wav(&self.audio_buffer)?;
+                self.transcribe_via_python(temp_file.path())?
+            };
 
             self.audio_buffer.clear();
 
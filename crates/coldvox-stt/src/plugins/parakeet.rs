@@ -21,13 +21,39 @@
 //! - `PARAKEET_MODEL_PATH`: Override model path
 //! - `PARAKEET_VARIANT`: "tdt" or "ctc" (default: "tdt")
 //! - `PARAKEET_DEVICE`: Must be "cuda" or "tensorrt" (CPU not supported)
+//! - `PARAKEET_ENGINE_CACHE_DIR`: TensorRT engine cache root, or "off"
+//!   (default: `~/.coldvox/engine-cache`)
+//!
+//! # Engine cache
+//!
+//! With the TensorRT provider, compiled engines and timing data are kept in
+//! an [`EngineCache`] entry keyed by model files, GPU and provider options, so
+//! only the first load on a machine pays for the engine build. The entry is
+//! passed to ONNX Runtime as TensorRT provider options (engine and timing
+//! caches enabled, both pointed at the entry) when the session is built, and
+//! the entry is compared before and after the load to log whether the
+//! engines were reused or rebuilt.
+//!
+//! # Streaming
+//!
+//! With `TranscriptionConfig::streaming`, audio is decoded in overlapping
+//! windows while speech is ongoing (see [`super::windowed`]): partials are
+//! emitted about once per second and words outside the trailing overlap are
+//! committed, so `finalize` only decodes the last few seconds. Window decodes
+//! run on the blocking pool: `process_audio` starts one when a step is due and
+//! picks up its partial on a later frame, so frames never wait on the model.
 
+#[cfg(feature = "parakeet")]
+use super::engine_cache::EngineCache;
+use super::windowed::{WindowConfig, WindowTranscript, WindowWord, WindowedDecoder};
 use crate::plugin::*;
 use crate::types::{TranscriptionConfig, TranscriptionEvent, WordInfo};
 use async_trait::async_trait;
 use coldvox_foundation::error::{ColdVoxError, SttError};
 use std::env;
 use std::path::{Path, PathBuf};
+#[cfg(feature = "parakeet")]
+use std::sync::Arc;
 use tracing::{debug, error, info, warn};
 
 #[cfg(feature = "parakeet")]
@@ -110,12 +136,21 @@ pub struct ParakeetPlugin {
     model_path: Option<PathBuf>,
     gpu_provider: GpuProvider,
     initialized: bool,
+    /// Shared with decodes running on the blocking pool.
     #[cfg(feature = "parakeet")]
-    model: Option<Parakeet>,
+    model: Option<Arc<parking_lot::Mutex<Parakeet>>>,
     #[cfg(feature = "parakeet")]
     audio_buffer: Vec<i16>,
     #[cfg(feature = "parakeet")]
     active_config: Option<TranscriptionConfig>,
+    /// Present when the active config asks for streaming.
+    #[cfg(feature = "parakeet")]
+    stream: Option<WindowedDecoder>,
+    /// Streaming decode in flight, with the number of window samples it covers.
+    #[cfg(feature = "parakeet")]
+    pending_decode:
+        Option<tokio::task::JoinHandle<(usize, Result<WindowTranscript, ColdVoxError>)>>,
+    window_config: WindowConfig,
 }
 
 impl ParakeetPlugin {
@@ -131,9 +166,20 @@ impl ParakeetPlugin {
             audio_buffer: Vec::new(),
             #[cfg(feature = "parakeet")]
             active_config: None,
+            #[cfg(feature = "parakeet")]
+            stream: None,
+            #[cfg(feature = "parakeet")]
+            pending_decode: None,
+            window_config: WindowConfig::default(),
         }
     }
 
+    /// Window sizes used in streaming mode.
+    pub fn with_window_config(mut self, config: WindowConfig) -> Self {
+        self.window_config = config;
+        self
+    }
+
     pub fn with_variant(mut self, variant: ParakeetModelVariant) -> Self {
         self.variant = variant;
         self
@@ -241,6 +287,196 @@ impl ParakeetPlugin {
 
         Ok(())
     }
+
+    /// Describes the GPU(s) for the engine cache key: engines are only valid
+    /// for the compute capability and driver they were built with.
+    #[cfg(feature = "parakeet")]
+    fn gpu_descriptor() -> String {
+        std::process::Command::new("nvidia-smi")
+            .args([
+                "--query-gpu=name,compute_cap,driver_version",
+                "--format=csv,noheader",
+            ])
+            .output()
+            .ok()
+            .filter(|output| output.status.success())
+            .map(|output| String::from_utf8_lossy(&output.stdout).trim().to_string())
+            .unwrap_or_else(|| "unknown".to_string())
+    }
+
+    /// Open the engine cache entry for `model_path`. `None` when not using
+    /// TensorRT or disabled. Blocks on nvidia-smi and the filesystem.
+    #[cfg(feature = "parakeet")]
+    fn prepare_engine_cache(
+        gpu_provider: GpuProvider,
+        variant: ParakeetModelVariant,
+        model_path: &Path,
+    ) -> Option<EngineCache> {
+        if gpu_provider != GpuProvider::TensorRt || !cfg!(feature = "parakeet-tensorrt") {
+            return None;
+        }
+        let root = match env::var("PARAKEET_ENGINE_CACHE_DIR") {
+            Ok(dir) if dir.eq_ignore_ascii_case("off") => return None,
+            Ok(dir) => PathBuf::from(dir),
+            Err(_) => EngineCache::default_root()?,
+        };
+
+        let options = [
+            ("provider", "tensorrt"),
+            ("variant", variant.model_identifier()),
+        ];
+        match EngineCache::open(
+            &root,
+            "parakeet",
+            model_path,
+            &Self::gpu_descriptor(),
+            &options,
+        ) {
+            Ok(cache) => Some(cache),
+            Err(err) => {
+                warn!(
+                    target: "coldvox::stt::parakeet",
+                    root = %root.display(),
+                    error = %err,
+                    "Engine cache unavailable; TensorRT engines will be rebuilt"
+                );
+                None
+            }
+        }
+    }
+
+    /// Session options for `gpu_provider`. With an engine cache entry, the
+    /// TensorRT provider is registered with its engine and timing caches in
+    /// the entry, ahead of CUDA for the nodes TensorRT cannot take.
+    #[cfg(feature = "parakeet")]
+    fn execution_config(
+        gpu_provider: GpuProvider,
+        engine_cache: Option<&EngineCache>,
+    ) -> ExecutionConfig {
+        let config = ExecutionConfig {
+            execution_provider: gpu_provider.to_execution_provider(),
+            ..Default::default()
+        };
+
+        #[cfg(feature = "parakeet-tensorrt")]
+        {
+            use ort::execution_providers::{CUDAExecutionProvider, TensorRTExecutionProvider};
+
+            if let Some(cache) = engine_cache {
+                let dir = cache.dir().display().to_string();
+                return config.with_custom_configure(move |builder| {
+                    builder.with_execution_providers([
+                        TensorRTExecutionProvider::default()
+                            .with_engine_cache(true)
+                            .with_engine_cache_path(&dir)
+                            .with_timing_cache(true)
+                            .with_timing_cache_path(&dir)
+                            .build(),
+                        CUDAExecutionProvider::default().build(),
+                    ])
+                });
+            }
+        }
+        #[cfg(not(feature = "parakeet-tensorrt"))]
+        let _ = engine_cache;
+
+        config
+    }
+
+    /// Whether audio is being decoded in overlapping windows.
+    fn streaming_active(&self) -> bool {
+        #[cfg(feature = "parakeet")]
+        {
+            self.stream.is_some()
+        }
+        #[cfg(not(feature = "parakeet"))]
+        {
+            false
+        }
+    }
+
+    /// Apply the in-flight streaming decode. With `wait` false, returns
+    /// `Ok(None)` without blocking if it has not finished yet.
+    #[cfg(feature = "parakeet")]
+    async fn collect_decode(&mut self, wait: bool) -> Result<Option<String>, ColdVoxError> {
+        let Some(handle) = self.pending_decode.take() else {
+            return Ok(None);
+        };
+        if !wait && !handle.is_finished() {
+            self.pending_decode = Some(handle);
+            return Ok(None);
+        }
+        let (decoded, result) = handle.await.map_err(|e| {
+            SttError::TranscriptionFailed(format!("Parakeet decode task failed: {}", e))
+        })?;
+        let result = result?;
+        Ok(self
+            .stream
+            .as_mut()
+            .and_then(|stream| stream.finish_decode(decoded, result)))
+    }
+
+    #[cfg(feature = "parakeet")]
+    fn include_words(&self) -> bool {
+        self.active_config
+            .as_ref()
+            .map(|cfg| cfg.include_words)
+            .unwrap_or(false)
+    }
+}
+
+/// [`transcribe_window`] on the blocking pool, so the caller's runtime worker
+/// stays free while the model runs.
+#[cfg(feature = "parakeet")]
+async fn transcribe_blocking(
+    model: Arc<parking_lot::Mutex<Parakeet>>,
+    samples: Vec<f32>,
+    include_words: bool,
+) -> Result<WindowTranscript, ColdVoxError> {
+    tokio::task::spawn_blocking(move || {
+        transcribe_window(&mut model.lock(), samples, include_words)
+    })
+    .await
+    .map_err(|e| SttError::TranscriptionFailed(format!("Parakeet decode task failed: {}", e)))?
+}
+
+/// Run one Parakeet decode over `samples` (normalized f32 at 16 kHz). parakeet-rs
+/// takes the buffer by value, so streaming windows are copied once per decode.
+#[cfg(feature = "parakeet")]
+fn transcribe_window(
+    model: &mut Parakeet,
+    samples: Vec<f32>,
+    include_words: bool,
+) -> Result<WindowTranscript, ColdVoxError> {
+    let timestamp_mode = if include_words {
+        Some(TimestampMode::Words)
+    } else {
+        None
+    };
+    let result = model
+        .transcribe_samples(samples, crate::constants::SAMPLE_RATE_HZ, 1, timestamp_mode)
+        .map_err(|err| {
+            error!(
+                target: "coldvox::stt::parakeet",
+                error = %err,
+                "Parakeet transcription failed"
+            );
+            SttError::TranscriptionFailed(format!("Parakeet transcription failed: {}", err))
+        })?;
+
+    Ok(WindowTranscript {
+        text: result.text.trim().to_string(),
+        words: result
+            .tokens
+            .iter()
+            .filter(|token| !token.text.trim().is_empty())
+            .map(|token| WindowWord {
+                text: token.text.clone(),
+                start: token.start,
+                end: token.end,
+            })
+            .collect(),
+    })
 }
 
 impl Default for ParakeetPlugin {
@@ -393,7 +629,8 @@ impl SttPlugin for ParakeetPlugin {
 
     fn capabilities(&self) -> PluginCapabilities {
         PluginCapabilities {
-            streaming: false, // Batch processing only for now
+            // Overlapping-window decode, only when the active config asks for it
+            streaming: self.streaming_active(),
             batch: true,
             word_timestamps: true, // parakeet-rs provides token-level timestamps
             confidence_scores: false,
@@ -410,8 +647,11 @@ impl SttPlugin for ParakeetPlugin {
     async fn initialize(&mut self, config: TranscriptionConfig) -> Result<(), ColdVoxError> {
         #[cfg(feature = "parakeet")]
         {
-            // Verify GPU is available (REQUIRED)
-            Self::verify_gpu_available()?;
+            // Verify GPU is available (REQUIRED); nvidia-smi blocks, so keep
+            // it off the runtime's workers
+            tokio::task::spawn_blocking(Self::verify_gpu_available)
+                .await
+                .map_err(|e| SttError::LoadFailed(format!("GPU check task failed: {}", e)))??;
 
             let model_path = self.resolve_model_path(&config)?;
 
@@ -423,26 +663,69 @@ impl SttPlugin for ParakeetPlugin {
                 "Initializing Parakeet model (GPU-only)"
             );
 
-            let exec_config = ExecutionConfig {
-                execution_provider: self.gpu_provider.to_execution_provider(),
-                ..Default::default()
+            let engine_cache = {
+                let (gpu_provider, variant) = (self.gpu_provider, self.variant);
+                let model_path = model_path.clone();
+                tokio::task::spawn_blocking(move || {
+                    Self::prepare_engine_cache(gpu_provider, variant, &model_path)
+                })
+                .await
+                .map_err(|e| SttError::LoadFailed(format!("Engine cache task failed: {}", e)))?
             };
+            let exec_config = Self::execution_config(self.gpu_provider, engine_cache.as_ref());
+            let cache_before = engine_cache.as_ref().map(EngineCache::snapshot);
+            let load_start = std::time::Instant::now();
+
+            // Loading the ONNX sessions takes seconds; keep it off the
+            // runtime's workers
+            let loaded = tokio::task::spawn_blocking(move || {
+                Parakeet::from_pretrained(&model_path, Some(exec_config))
+            })
+            .await
+            .map_err(|e| SttError::LoadFailed(format!("Model load task failed: {}", e)))?;
+            let model = loaded.map_err(|err| {
+                error!(
+                    target: "coldvox::stt::parakeet",
+                    error = %err,
+                    "Failed to load Parakeet model"
+                );
+                SttError::LoadFailed(format!(
+                    "Failed to load Parakeet model: {}. Ensure CUDA GPU is available.",
+                    err
+                ))
+            })?;
 
-            let model =
-                Parakeet::from_pretrained(&model_path, Some(exec_config)).map_err(|err| {
-                    error!(
-                        target: "coldvox::stt::parakeet",
-                        error = %err,
-                        "Failed to load Parakeet model"
-                    );
-                    SttError::LoadFailed(format!(
-                        "Failed to load Parakeet model: {}. Ensure CUDA GPU is available.",
-                        err
-                    ))
-                })?;
+            let load_ms = load_start.elapsed().as_millis() as u64;
+            // A hit leaves the entry as it was; a miss must have written
+            // engines, or TensorRT is not using the cache at all
+            let engine_cache_hit = match (&engine_cache, cache_before) {
+                (Some(cache), Some(before)) => {
+                    let after = cache.snapshot();
+                    if after.is_empty() {
+                        warn!(
+                            target: "coldvox::stt::parakeet",
+                            dir = %cache.dir().display(),
+                            "TensorRT wrote no engines to the cache; every load will rebuild"
+                        );
+                    }
+                    Some(!before.is_empty() && before == after)
+                }
+                _ => None,
+            };
+            info!(
+                target: "coldvox::stt::parakeet",
+                load_ms,
+                engine_cache = ?engine_cache.as_ref().map(EngineCache::dir),
+                engine_cache_hit = ?engine_cache_hit,
+                "Parakeet model loaded"
+            );
 
-            self.model = Some(model);
+            self.model = Some(Arc::new(parking_lot::Mutex::new(model)));
+            self.pending_decode = None;
             self.audio_buffer.clear();
+            self.stream = config.streaming.then(|| {
+                WindowedDecoder::new(self.window_config.clone(), crate::constants::SAMPLE_RATE_HZ)
+            });
             self.active_config = Some(config);
             self.initialized = true;
 
@@ -479,9 +762,41 @@ impl SttPlugin for ParakeetPlugin {
                 .into());
             }
 
-            // Buffer audio samples
-            self.audio_buffer.extend_from_slice(samples);
-            Ok(None) // Return partial results on finalize only
+            let Some(stream) = self.stream.as_mut() else {
+                // Batch mode: buffer audio and transcribe on finalize
+                self.audio_buffer.extend_from_slice(samples);
+                return Ok(None);
+            };
+            let due = stream.push(samples);
+
+            let partial = self.collect_decode(false).await?;
+            if due && self.pending_decode.is_none() {
+                let model = self.model.clone().ok_or_else(|| {
+                    SttError::TranscriptionFailed("Parakeet model not loaded".to_string())
+                })?;
+                if let Some(stream) = self.stream.as_mut() {
+                    let window = stream.start_decode();
+                    let decoded = window.len();
+                    // Commit points rely on word timestamps, so request them
+                    // regardless of include_words
+                    self.pending_decode = Some(tokio::spawn(async move {
+                        (decoded, transcribe_blocking(model, window, true).await)
+                    }));
+                }
+            }
+            let emit = self
+                .active_config
+                .as_ref()
+                .is_some_and(|cfg| cfg.partial_results);
+
+            Ok(partial
+                .filter(|_| emit)
+                .map(|text| TranscriptionEvent::Partial {
+                    utterance_id: 0,
+                    text,
+                    t0: None,
+                    t1: None,
+                }))
         }
 
         #[cfg(not(feature = "parakeet"))]
@@ -502,87 +817,86 @@ impl SttPlugin for ParakeetPlugin {
                 return Ok(None);
             }
 
-            if self.audio_buffer.is_empty() {
-                return Ok(None);
-            }
-
-            let buffer_size = self.audio_buffer.len();
-            info!(
-                target: "coldvox::stt::parakeet",
-                "Transcribing buffered audio: {} samples ({:.2}s)",
-                buffer_size,
-                buffer_size as f32 / crate::constants::SAMPLE_RATE_HZ as f32
-            );
+            let include_words = self.include_words();
+            let model = self.model.clone().ok_or_else(|| {
+                SttError::TranscriptionFailed("Parakeet model not loaded".to_string())
+            })?;
 
-            // Convert i16 samples to f32 for parakeet-rs
-            let samples_f32: Vec<f32> = self
-                .audio_buffer
-                .iter()
-                .map(|&s| s as f32 / 32768.0)
-                .collect();
+            // Its commits shrink what is left to decode
+            if let Err(e) = self.collect_decode(true).await {
+                if let Some(stream) = self.stream.as_mut() {
+                    stream.reset();
+                }
+                return Err(e);
+            }
 
-            let include_words = self
-                .active_config
-                .as_ref()
-                .map(|cfg| cfg.include_words)
-                .unwrap_or(false);
-            let timestamp_mode = if include_words {
-                Some(TimestampMode::Words)
+            let (text, words) = if let Some(stream) = self.stream.as_mut() {
+                if stream.is_empty() {
+                    return Ok(None);
+                }
+                debug!(
+                    target: "coldvox::stt::parakeet",
+                    "Finalizing stream: {} uncommitted samples ({:.2}s)",
+                    stream.window().len(),
+                    stream.window().len() as f32 / crate::constants::SAMPLE_RATE_HZ as f32
+                );
+                let window = stream.start_decode();
+                let result = if window.is_empty() {
+                    None
+                } else {
+                    match transcribe_blocking(model, window, true).await {
+                        Ok(result) => Some(result),
+                        Err(e) => {
+                            stream.reset();
+                            return Err(e);
+                        }
+                    }
+                };
+                stream.finish_with(result)
             } else {
-                None
-            };
+                if self.audio_buffer.is_empty() {
+                    return Ok(None);
+                }
 
-            let result = self
-                .model
-                .as_mut()
-                .ok_or_else(|| {
-                    SttError::TranscriptionFailed("Parakeet model not loaded".to_string())
-                })?
-                .transcribe_samples(
-                    samples_f32,
-                    crate::constants::SAMPLE_RATE_HZ,
-                    1,
-                    timestamp_mode,
-                )
-                .map_err(|err| {
-                    error!(
-                        target: "coldvox::stt::parakeet",
-                        error = %err,
-                        "Parakeet transcription failed"
-                    );
-                    SttError::TranscriptionFailed(format!("Parakeet transcription failed: {}", err))
-                })?;
+                let buffer_size = self.audio_buffer.len();
+                info!(
+                    target: "coldvox::stt::parakeet",
+                    "Transcribing buffered audio: {} samples ({:.2}s)",
+                    buffer_size,
+                    buffer_size as f32 / crate::constants::SAMPLE_RATE_HZ as f32
+                );
 
-            let text = result.text.trim().to_string();
+                // Convert i16 samples to f32 for parakeet-rs
+                let samples_f32: Vec<f32> = self
+                    .audio_buffer
+                    .iter()
+                    .map(|&s| s as f32 / 32768.0)
+                    .collect();
+                self.audio_buffer.clear();
+
+                let result = transcribe_blocking(model, samples_f32, include_words).await?;
+                let words = result
+                    .words
+                    .into_iter()
+                    .map(|word| WordInfo {
+                        start: word.start,
+                        end: word.end,
+                        // parakeet-rs does not expose per-token confidence; use a neutral
+                        // sentinel because this plugin does not provide confidence scores.
+                        conf: 0.0,
+                        text: word.text,
+                    })
+                    .collect();
+                (result.text, words)
+            };
 
             debug!(
                 target: "coldvox::stt::parakeet",
                 text = %text,
-                token_count = result.tokens.len(),
                 "Parakeet transcription complete"
             );
 
-            let words = if include_words && !result.tokens.is_empty() {
-                Some(
-                    result
-                        .tokens
-                        .iter()
-                        .filter(|token| !token.text.trim().is_empty())
-                        .map(|token| WordInfo {
-                            start: token.start,
-                            end: token.end,
-                            // parakeet-rs does not expose per-token confidence; use a neutral
-                            // sentinel because this plugin does not provide confidence scores.
-                            conf: 0.0,
-                            text: token.text.clone(),
-                        })
-                        .collect(),
-                )
-            } else {
-                None
-            };
-
-            self.audio_buffer.clear();
+            let words = (include_words && !words.is_empty()).then_some(words);
 
             Ok(Some(TranscriptionEvent::Final {
                 utterance_id: 0,
@@ -604,7 +918,14 @@ impl SttPlugin for ParakeetPlugin {
     async fn reset(&mut self) -> Result<(), ColdVoxError> {
         #[cfg(feature = "parakeet")]
         {
+            // A decode still running belongs to the abandoned utterance
+            if let Some(handle) = self.pending_decode.take() {
+                handle.abort();
+            }
             self.audio_buffer.clear();
+            if let Some(stream) = self.stream.as_mut() {
+                stream.reset();
+            }
             Ok(())
         }
 
@@ -628,8 +949,12 @@ impl SttPlugin for ParakeetPlugin {
     async fn unload(&mut self) -> Result<(), ColdVoxError> {
         #[cfg(feature = "parakeet")]
         {
+            if let Some(handle) = self.pending_decode.take() {
+                handle.abort();
+            }
             self.model = None;
             self.audio_buffer.clear();
+            self.stream = None;
             self.initialized = false;
             Ok(())
         }
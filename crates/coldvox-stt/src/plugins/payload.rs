@@ -0,0 +1,191 @@
+//! Audio payload encoding for remote STT uploads.
+//!
+//! Encoders are fed as frames arrive, so `finalize` only pays for the last
+//! partial block plus header fix-ups.
+//!
+//! Opus (lossy, for WAN links) is descoped for now: it links libopus, and
+//! its crates could not be pinned alongside this encoder. FLAC is the
+//! smallest option until it is added back behind a feature.
+
+use super::flac::FlacEncoder;
+use coldvox_foundation::error::ColdVoxError;
+use serde::{Deserialize, Serialize};
+use std::fmt;
+use std::str::FromStr;
+
+/// Container/codec used for the uploaded audio file.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq, Serialize, Deserialize)]
+#[serde(rename_all = "lowercase")]
+pub enum PayloadCodec {
+    /// 16-bit PCM WAV (largest; accepted everywhere)
+    Wav,
+    /// Lossless FLAC, typically 40-60% of the WAV size for speech
+    #[default]
+    Flac,
+}
+
+impl PayloadCodec {
+    pub fn file_name(self) -> &'static str {
+        match self {
+            Self::Wav => "audio.wav",
+            Self::Flac => "audio.flac",
+        }
+    }
+
+    pub fn mime_type(self) -> &'static str {
+        match self {
+            Self::Wav => "audio/wav",
+            Self::Flac => "audio/flac",
+        }
+    }
+}
+
+impl fmt::Display for PayloadCodec {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.write_str(match self {
+            Self::Wav => "WAV",
+            Self::Flac => "FLAC",
+        })
+    }
+}
+
+impl FromStr for PayloadCodec {
+    type Err = String;
+
+    fn from_str(s: &str) -> Result<Self, Self::Err> {
+        match s.to_ascii_lowercase().as_str() {
+            "wav" => Ok(Self::Wav),
+            "flac" => Ok(Self::Flac),
+            other => Err(format!(
+                "Unknown payload codec '{other}': expected wav or flac"
+            )),
+        }
+    }
+}
+
+/// Incremental encoder for one utterance.
+pub enum PayloadEncoder {
+    Wav(WavEncoder),
+    Flac(FlacEncoder),
+}
+
+impl PayloadEncoder {
+    pub fn new(codec: PayloadCodec, sample_rate: u32) -> Result<Self, ColdVoxError> {
+        match codec {
+            PayloadCodec::Wav => Ok(Self::Wav(WavEncoder::new(sample_rate))),
+            PayloadCodec::Flac => Ok(Self::Flac(FlacEncoder::new(sample_rate))),
+        }
+    }
+
+    pub fn push(&mut self, samples: &[i16]) -> Result<(), ColdVoxError> {
+        match self {
+            Self::Wav(enc) => enc.push(samples),
+            Self::Flac(enc) => enc.push(samples),
+        }
+        Ok(())
+    }
+
+    pub fn total_samples(&self) -> u64 {
+        match self {
+            Self::Wav(enc) => enc.total_samples(),
+            Self::Flac(enc) => enc.total_samples(),
+        }
+    }
+
+    /// Bytes produced so far; the final payload will be slightly larger.
+    pub fn encoded_len(&self) -> usize {
+        match self {
+            Self::Wav(enc) => enc.encoded_len(),
+            Self::Flac(enc) => enc.encoded_len(),
+        }
+    }
+
+    pub fn finish(self) -> Result<Vec<u8>, ColdVoxError> {
+        match self {
+            Self::Wav(enc) => Ok(enc.finish()),
+            Self::Flac(enc) => Ok(enc.finish()),
+        }
+    }
+}
+
+/// Canonical 44-byte-header PCM WAV, sizes patched on finish.
+pub struct WavEncoder {
+    out: Vec<u8>,
+}
+
+impl WavEncoder {
+    const HEADER_LEN: usize = 44;
+
+    pub fn new(sample_rate: u32) -> Self {
+        let mut out = Vec::with_capacity(Self::HEADER_LEN + sample_rate as usize * 2);
+        out.extend_from_slice(b"RIFF");
+        out.extend_from_slice(&0u32.to_le_bytes());
+        out.extend_from_slice(b"WAVEfmt ");
+        out.extend_from_slice(&16u32.to_le_bytes());
+        out.extend_from_slice(&1u16.to_le_bytes()); // PCM
+        out.extend_from_slice(&1u16.to_le_bytes()); // mono
+        out.extend_from_slice(&sample_rate.to_le_bytes());
+        out.extend_from_slice(&(sample_rate * 2).to_le_bytes());
+        out.extend_from_slice(&2u16.to_le_bytes()); // block align
+        out.extend_from_slice(&16u16.to_le_bytes());
+        out.extend_from_slice(b"data");
+        out.extend_from_slice(&0u32.to_le_bytes());
+        Self { out }
+    }
+
+    pub fn push(&mut self, samples: &[i16]) {
+        self.out.reserve(samples.len() * 2);
+        for &sample in samples {
+            self.out.extend_from_slice(&sample.to_le_bytes());
+        }
+    }
+
+    pub fn total_samples(&self) -> u64 {
+        ((self.out.len() - Self::HEADER_LEN) / 2) as u64
+    }
+
+    pub fn encoded_len(&self) -> usize {
+        self.out.len()
+    }
+
+    pub fn finish(mut self) -> Vec<u8> {
+        let data_len = (self.out.len() - Self::HEADER_LEN) as u32;
+        self.out[4..8].copy_from_slice(&(data_len + 36).to_le_bytes());
+        self.out[40..44].copy_from_slice(&data_len.to_le_bytes());
+        self.out
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::io::Cursor;
+
+    #[test]
+    fn wav_encoder_matches_hound_reader() {
+        let samples: Vec<i16> = (0..1000).map(|i| (i * 37 % 2000 - 1000) as i16).collect();
+        let mut enc = PayloadEncoder::new(PayloadCodec::Wav, 16_000).unwrap();
+        for chunk in samples.chunks(160) {
+            enc.push(chunk).unwrap();
+        }
+        assert_eq!(enc.total_samples(), 1000);
+        let data = enc.finish().unwrap();
+        assert_eq!(data.len(), 44 + 2000);
+
+        let mut reader = hound::WavReader::new(Cursor::new(data)).expect("valid WAV");
+        assert_eq!(reader.spec().sample_rate, 16_000);
+        let decoded: Vec<i16> = reader.samples::<i16>().map(|s| s.unwrap()).collect();
+        assert_eq!(decoded, samples);
+    }
+
+    #[test]
+    fn codec_names_parse_and_serialize() {
+        assert_eq!("FLAC".parse::<PayloadCodec>(), Ok(PayloadCodec::Flac));
+        assert!("mp3".parse::<PayloadCodec>().is_err());
+        assert_eq!(
+            serde_json::to_string(&PayloadCodec::Flac).unwrap(),
+            "\"flac\""
+        );
+        assert_eq!(PayloadCodec::default(), PayloadCodec::Flac);
+    }
+}
@@ -0,0 +1,429 @@
+//! Overlapping-window streaming on top of a batch transcriber.
+//!
+//! Audio since the last commit point is re-decoded every `step_samples` and
+//! reported as a partial. Once the uncommitted span exceeds
+//! `max_window_samples`, the words that end before the trailing
+//! `overlap_samples` are committed and the window start moves to the end of
+//! the last committed word. If no word can be committed (the transcriber gave
+//! no timestamps, or one word spans the whole window), the whole window is
+//! committed as decoded. Every decode, including the final one, therefore
+//! covers at most `max_window_samples + step_samples` of audio no matter how
+//! long the utterance runs.
+//!
+//! Callers that must not wait on the transcriber split a decode in two:
+//! [`WindowedDecoder::start_decode`] snapshots the window, the transcription
+//! runs elsewhere while more audio is pushed, and
+//! [`WindowedDecoder::finish_decode`] applies the result.
+
+use crate::types::WordInfo;
+
+#[derive(Debug, Clone)]
+pub struct WindowConfig {
+    /// New audio between partial decodes.
+    pub step_samples: usize,
+    /// Uncommitted span that triggers a commit.
+    pub max_window_samples: usize,
+    /// Trailing audio whose words are never committed, since they may still change.
+    pub overlap_samples: usize,
+}
+
+impl Default for WindowConfig {
+    fn default() -> Self {
+        // At 16 kHz: decode every 1 s, commit past 8 s, keep 2 s of context
+        Self {
+            step_samples: 16_000,
+            max_window_samples: 8 * 16_000,
+            overlap_samples: 2 * 16_000,
+        }
+    }
+}
+
+/// A word from one window decode, timed in seconds from the window start.
+#[derive(Debug, Clone, PartialEq)]
+pub struct WindowWord {
+    pub text: String,
+    pub start: f32,
+    pub end: f32,
+}
+
+/// Result of decoding one window.
+#[derive(Debug, Clone, Default)]
+pub struct WindowTranscript {
+    pub text: String,
+    pub words: Vec<WindowWord>,
+}
+
+pub struct WindowedDecoder {
+    config: WindowConfig,
+    sample_rate: u32,
+    /// Uncommitted audio, normalized once on arrival.
+    audio: Vec<f32>,
+    /// Utterance sample index of `audio[0]`.
+    offset_samples: u64,
+    since_decode: usize,
+    committed: Vec<WordInfo>,
+    last_partial: String,
+}
+
+impl WindowedDecoder {
+    pub fn new(config: WindowConfig, sample_rate: u32) -> Self {
+        let capacity = config.max_window_samples + config.step_samples;
+        Self {
+            config,
+            sample_rate,
+            audio: Vec::with_capacity(capacity),
+            offset_samples: 0,
+            since_decode: 0,
+            committed: Vec::new(),
+            last_partial: String::new(),
+        }
+    }
+
+    /// Append audio. Returns `true` when a partial decode is due.
+    pub fn push(&mut self, samples: &[i16]) -> bool {
+        self.audio
+            .extend(samples.iter().map(|&s| s as f32 / 32768.0));
+        self.since_decode += samples.len();
+        self.since_decode >= self.config.step_samples
+    }
+
+    /// No audio or committed words since the last reset.
+    pub fn is_empty(&self) -> bool {
+        self.audio.is_empty() && self.committed.is_empty()
+    }
+
+    /// Audio the next decode will cover.
+    pub fn window(&self) -> &[f32] {
+        &self.audio
+    }
+
+    /// Decode the current window, commit stable words if it has grown past
+    /// `max_window_samples`, and return the full partial text if it changed.
+    pub fn decode<E>(
+        &mut self,
+        transcribe: impl FnOnce(&[f32]) -> Result<WindowTranscript, E>,
+    ) -> Result<Option<String>, E> {
+        self.since_decode = 0;
+        if self.audio.is_empty() {
+            return Ok(None);
+        }
+        let result = transcribe(&self.audio)?;
+        Ok(self.finish_decode(self.audio.len(), result))
+    }
+
+    /// Copy of the current window for a decode run elsewhere; empty when there
+    /// is nothing to decode. Pass its length and the result to
+    /// [`finish_decode`](Self::finish_decode). Audio may be pushed meanwhile.
+    pub fn start_decode(&mut self) -> Vec<f32> {
+        self.since_decode = 0;
+        self.audio.clone()
+    }
+
+    /// Apply the transcription of the first `decoded` window samples, as
+    /// returned by [`start_decode`](Self::start_decode). Returns the full
+    /// partial text if it changed.
+    pub fn finish_decode(&mut self, decoded: usize, result: WindowTranscript) -> Option<String> {
+        let decoded = decoded.min(self.audio.len());
+        if decoded == 0 {
+            return None;
+        }
+        let tail = if decoded > self.config.max_window_samples {
+            self.commit(decoded, result)
+        } else {
+            result.text.trim().to_string()
+        };
+
+        let partial = join_text(&self.committed_text(), &tail);
+        if partial == self.last_partial {
+            return None;
+        }
+        self.last_partial.clone_from(&partial);
+        Some(partial)
+    }
+
+    /// Decode whatever is uncommitted and return the whole utterance's text and
+    /// words. The decoder is reset for the next utterance.
+    pub fn finish<E>(
+        &mut self,
+        transcribe: impl FnOnce(&[f32]) -> Result<WindowTranscript, E>,
+    ) -> Result<(String, Vec<WordInfo>), E> {
+        let result = if self.audio.is_empty() {
+            None
+        } else {
+            match transcribe(&self.audio) {
+                Ok(result) => Some(result),
+                Err(e) => {
+                    self.reset();
+                    return Err(e);
+                }
+            }
+        };
+        Ok(self.finish_with(result))
+    }
+
+    /// Like [`finish`](Self::finish), with the uncommitted window (as returned
+    /// by [`start_decode`](Self::start_decode)) already transcribed; `None`
+    /// when it was empty.
+    pub fn finish_with(&mut self, result: Option<WindowTranscript>) -> (String, Vec<WordInfo>) {
+        let mut words = std::mem::take(&mut self.committed);
+        let mut text = words
+            .iter()
+            .map(|w| w.text.as_str())
+            .collect::<Vec<_>>()
+            .join(" ");
+
+        if let Some(result) = result {
+            let base = self.offset_seconds();
+            if result.words.is_empty() {
+                words.extend(self.untimed_word(result.text.trim(), self.audio.len()));
+            } else {
+                words.extend(result.words.iter().map(|w| self.to_word_info(w, base)));
+            }
+            text = join_text(&text, result.text.trim());
+        }
+
+        self.reset();
+        (text, words)
+    }
+
+    pub fn reset(&mut self) {
+        self.audio.clear();
+        self.offset_samples = 0;
+        self.since_decode = 0;
+        self.committed.clear();
+        self.last_partial.clear();
+    }
+
+    /// Keep words ending before the overlap region of the first `decoded`
+    /// samples and drop their audio. Returns the text of the words left
+    /// uncommitted.
+    fn commit(&mut self, decoded: usize, result: WindowTranscript) -> String {
+        let sr = self.sample_rate as f32;
+        let stable_until = (decoded - self.config.overlap_samples.min(decoded)) as f32 / sr;
+        let split = result
+            .words
+            .iter()
+            .position(|w| w.end > stable_until)
+            .unwrap_or(result.words.len());
+
+        let base = self.offset_seconds();
+        if split == 0 {
+            // Nothing stable to cut at: commit the decoded window whole so it
+            // cannot keep growing. Without timestamps the text becomes one
+            // entry spanning the window.
+            if result.words.is_empty() {
+                let word = self.untimed_word(result.text.trim(), decoded);
+                self.committed.extend(word);
+            } else {
+                for word in &result.words {
+                    self.committed.push(self.to_word_info(word, base));
+                }
+            }
+            self.audio.drain(..decoded);
+            self.offset_samples += decoded as u64;
+            return String::new();
+        }
+
+        for word in &result.words[..split] {
+            self.committed.push(self.to_word_info(word, base));
+        }
+        let cut = ((result.words[split - 1].end * sr) as usize).min(decoded);
+        self.audio.drain(..cut);
+        self.offset_samples += cut as u64;
+
+        result.words[split..]
+            .iter()
+            .map(|w| w.text.trim())
+            .collect::<Vec<_>>()
+            .join(" ")
+    }
+
+    fn committed_text(&self) -> String {
+        self.committed
+            .iter()
+            .map(|w| w.text.as_str())
+            .collect::<Vec<_>>()
+            .join(" ")
+    }
+
+    fn offset_seconds(&self) -> f32 {
+        self.offset_samples as f32 / self.sample_rate as f32
+    }
+
+    /// One entry spanning the first `samples` of the window, for text that
+    /// came without timestamps.
+    fn untimed_word(&self, text: &str, samples: usize) -> Option<WordInfo> {
+        let start = self.offset_seconds();
+        (!text.is_empty()).then(|| WordInfo {
+            start,
+            end: start + samples as f32 / self.sample_rate as f32,
+            conf: 0.0,
+            text: text.to_string(),
+        })
+    }
+
+    fn to_word_info(&self, word: &WindowWord, base: f32) -> WordInfo {
+        WordInfo {
+            start: base + word.start,
+            end: base + word.end,
+            conf: 0.0,
+            text: word.text.trim().to_string(),
+        }
+    }
+}
+
+fn join_text(head: &str, tail: &str) -> String {
+    match (head.is_empty(), tail.is_empty()) {
+        (true, _) => tail.to_string(),
+        (_, true) => head.to_string(),
+        _ => format!("{} {}", head, tail),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    const SR: u32 = 100;
+
+    fn config() -> WindowConfig {
+        WindowConfig {
+            step_samples: 100,
+            max_window_samples: 400,
+            overlap_samples: 100,
+        }
+    }
+
+    /// Fake transcriber: one word per 100 samples, named by its absolute
+    /// position, derived from the window's first sample value.
+    fn fake(window: &[f32]) -> Result<WindowTranscript, ()> {
+        let first = (window[0] * 32768.0).round() as usize;
+        let words: Vec<WindowWord> = (0..window.len() / 100)
+            .map(|i| WindowWord {
+                text: format!("w{}", (first + i * 100) / 100),
+                start: i as f32,
+                end: i as f32 + 1.0,
+            })
+            .collect();
+        let text = words
+            .iter()
+            .map(|w| w.text.clone())
+            .collect::<Vec<_>>()
+            .join(" ");
+        Ok(WindowTranscript { text, words })
+    }
+
+    /// Samples whose value equals their absolute index, so `fake` can tell
+    /// where a window starts.
+    fn chunk(start: usize, len: usize) -> Vec<i16> {
+        (start..start + len).map(|i| i as i16).collect()
+    }
+
+    #[test]
+    fn partials_grow_and_window_stays_bounded() {
+        let mut dec = WindowedDecoder::new(config(), SR);
+        let mut partials = Vec::new();
+        let mut longest_window = 0;
+        for n in 0..12 {
+            if dec.push(&chunk(n * 100, 100)) {
+                longest_window = longest_window.max(dec.window().len());
+                if let Some(p) = dec.decode(fake).unwrap() {
+                    partials.push(p);
+                }
+            }
+        }
+        assert_eq!(partials.len(), 12);
+        assert_eq!(partials[0], "w0");
+        assert_eq!(
+            partials.last().unwrap(),
+            "w0 w1 w2 w3 w4 w5 w6 w7 w8 w9 w10 w11"
+        );
+        assert!(longest_window <= 500, "window grew to {longest_window}");
+
+        let (text, words) = dec.finish(fake).unwrap();
+        assert_eq!(text, "w0 w1 w2 w3 w4 w5 w6 w7 w8 w9 w10 w11");
+        assert_eq!(words.len(), 12);
+        assert_eq!(words[11].start, 11.0);
+        assert!(dec.window().is_empty());
+    }
+
+    #[test]
+    fn unchanged_partial_is_not_repeated() {
+        let mut dec = WindowedDecoder::new(config(), SR);
+        dec.push(&chunk(0, 100));
+        assert!(dec.decode(fake).unwrap().is_some());
+        assert!(dec.decode(fake).unwrap().is_none());
+    }
+
+    #[test]
+    fn finish_without_decodes_transcribes_everything() {
+        let mut dec = WindowedDecoder::new(config(), SR);
+        assert!(!dec.push(&chunk(0, 50)));
+        dec.push(&chunk(50, 150));
+        let (text, _) = dec.finish(fake).unwrap();
+        assert_eq!(text, "w0 w1");
+    }
+
+    fn no_timestamps(text: &str) -> Result<WindowTranscript, ()> {
+        Ok(WindowTranscript {
+            text: text.to_string(),
+            words: Vec::new(),
+        })
+    }
+
+    #[test]
+    fn window_without_timestamps_is_committed_whole_at_the_cap() {
+        let mut dec = WindowedDecoder::new(config(), SR);
+        dec.push(&chunk(0, 300));
+        let partial = dec.decode(|_| no_timestamps(" hello world ")).unwrap();
+        assert_eq!(partial.as_deref(), Some("hello world"));
+        assert_eq!(dec.window().len(), 300);
+
+        // Past max_window_samples the whole window is committed
+        dec.push(&chunk(300, 200));
+        let partial = dec.decode(|_| no_timestamps("hello world again")).unwrap();
+        assert_eq!(partial.as_deref(), Some("hello world again"));
+        assert!(dec.window().is_empty());
+
+        dec.push(&chunk(500, 100));
+        let partial = dec.decode(|_| no_timestamps("more")).unwrap();
+        assert_eq!(partial.as_deref(), Some("hello world again more"));
+
+        let (text, words) = dec.finish(|_| no_timestamps("more")).unwrap();
+        assert_eq!(text, "hello world again more");
+        assert_eq!(words[0].start, 0.0);
+        assert_eq!(words[0].end, 5.0);
+        assert_eq!(words[1].start, 5.0);
+    }
+
+    #[test]
+    fn window_stays_bounded_without_timestamps() {
+        let mut dec = WindowedDecoder::new(config(), SR);
+        let mut longest_window = 0;
+        for n in 0..50 {
+            if dec.push(&chunk(n * 100, 100)) {
+                longest_window = longest_window.max(dec.window().len());
+                dec.decode(|_| no_timestamps("x")).unwrap();
+            }
+        }
+        assert!(longest_window <= 500, "window grew to {longest_window}");
+    }
+
+    #[test]
+    fn split_decode_applies_to_the_snapshot_only() {
+        let mut dec = WindowedDecoder::new(config(), SR);
+        dec.push(&chunk(0, 500));
+        let window = dec.start_decode();
+        // Audio keeps arriving while the decode runs elsewhere
+        dec.push(&chunk(500, 100));
+        let partial = dec.finish_decode(window.len(), fake(&window).unwrap());
+        assert_eq!(partial.as_deref(), Some("w0 w1 w2 w3 w4"));
+        // w0..w3 committed; w4 and the new audio remain
+        assert_eq!(dec.window().len(), 200);
+
+        let window = dec.start_decode();
+        let result = fake(&window).unwrap();
+        let (text, _) = dec.finish_with(Some(result));
+        assert_eq!(text, "w0 w1 w2 w3 w4 w5");
+    }
+}
@@ -0,0 +1,277 @@
+use std::cell::Cell;
+use std::sync::atomic::{AtomicU64, AtomicUsize, Ordering};
+use std::time::Duration;
+
+/// Sub-buckets per power of two. Bucket width is at most 1/16 of its lower
+/// bound, so reported quantiles are within ~6% of the true value.
+const SUB_BITS: u32 = 4;
+const SUB_BUCKETS: usize = 1 << SUB_BITS;
+
+/// Largest bucketed value is 2^32 - 1 µs (~71 minutes); larger samples land in
+/// the last bucket but still count towards `max_us` and `sum_us`.
+const MAX_BUCKETED_US: u64 = (1 << 32) - 1;
+
+/// Number of log-linear microsecond buckets. Values below 16 µs get a bucket
+/// each; every octave above that is split into 16 equal-width buckets.
+pub const BUCKETS: usize = (32 - SUB_BITS as usize + 1) * SUB_BUCKETS;
+
+/// Recording shards. Threads are spread over them round-robin so concurrent
+/// recorders rarely touch the same cache lines.
+const SHARDS: usize = 8;
+
+static NEXT_SHARD: AtomicUsize = AtomicUsize::new(0);
+
+thread_local! {
+    static SHARD: Cell<usize> = const { Cell::new(usize::MAX) };
+}
+
+fn shard_index() -> usize {
+    SHARD.with(|shard| {
+        let mut idx = shard.get();
+        if idx == usize::MAX {
+            idx = NEXT_SHARD.fetch_add(1, Ordering::Relaxed) % SHARDS;
+            shard.set(idx);
+        }
+        idx
+    })
+}
+
+fn bucket_index(us: u64) -> usize {
+    let us = us.min(MAX_BUCKETED_US);
+    if us < SUB_BUCKETS as u64 {
+        return us as usize;
+    }
+    let msb = 63 - us.leading_zeros();
+    let shift = msb - SUB_BITS;
+    ((msb - SUB_BITS + 1) as usize) * SUB_BUCKETS + (us >> shift) as usize - SUB_BUCKETS
+}
+
+/// Largest value (µs) that falls into bucket `idx`.
+fn bucket_upper_us(idx: usize) -> u64 {
+    if idx < SUB_BUCKETS {
+        return idx as u64;
+    }
+    let shift = (idx / SUB_BUCKETS - 1) as u32;
+    let lower = ((SUB_BUCKETS + idx % SUB_BUCKETS) as u64) << shift;
+    lower + (1u64 << shift) - 1
+}
+
+/// One thread group's counters, padded so shards never share a cache line.
+#[derive(Debug)]
+#[repr(align(128))]
+struct Shard {
+    buckets: [AtomicU64; BUCKETS],
+    count: AtomicU64,
+    sum_us: AtomicU64,
+    max_us: AtomicU64,
+}
+
+impl Shard {
+    fn new() -> Self {
+        Self {
+            buckets: std::array::from_fn(|_| AtomicU64::new(0)),
+            count: AtomicU64::new(0),
+            sum_us: AtomicU64::new(0),
+            max_us: AtomicU64::new(0),
+        }
+    }
+}
+
+/// Fixed-bucket, HDR-style latency histogram with lock-free recording.
+///
+/// `record` is four relaxed atomic RMWs on the calling thread's shard, cheap
+/// enough for per-frame hot paths. Shards are merged on [`snapshot`], which
+/// is intended for periodic reporting rather than the hot path.
+///
+/// [`snapshot`]: LatencyHistogram::snapshot
+#[derive(Debug)]
+pub struct LatencyHistogram {
+    shards: Box<[Shard]>,
+}
+
+impl Default for LatencyHistogram {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl LatencyHistogram {
+    pub fn new() -> Self {
+        Self {
+            shards: (0..SHARDS).map(|_| Shard::new()).collect(),
+        }
+    }
+
+    pub fn record(&self, latency: Duration) {
+        let us = latency.as_micros().min(u64::MAX as u128) as u64;
+        let shard = &self.shards[shard_index()];
+        shard.buckets[bucket_index(us)].fetch_add(1, Ordering::Relaxed);
+        shard.count.fetch_add(1, Ordering::Relaxed);
+        shard.sum_us.fetch_add(us, Ordering::Relaxed);
+        shard.max_us.fetch_max(us, Ordering::Relaxed);
+    }
+
+    /// Merge all shards. Samples recorded concurrently may or may not be
+    /// included; counts are never torn within a single bucket.
+    pub fn snapshot(&self) -> HistogramSnapshot {
+        let mut snapshot = HistogramSnapshot::default();
+        for shard in self.shards.iter() {
+            for (total, bucket) in snapshot.buckets.iter_mut().zip(&shard.buckets) {
+                *total += bucket.load(Ordering::Relaxed);
+            }
+            snapshot.count += shard.count.load(Ordering::Relaxed);
+            snapshot.sum_us += shard.sum_us.load(Ordering::Relaxed);
+            snapshot.max_us = snapshot.max_us.max(shard.max_us.load(Ordering::Relaxed));
+        }
+        snapshot
+    }
+
+    pub fn reset(&self) {
+        for shard in self.shards.iter() {
+            for b in &shard.buckets {
+                b.store(0, Ordering::Relaxed);
+            }
+            shard.count.store(0, Ordering::Relaxed);
+            shard.sum_us.store(0, Ordering::Relaxed);
+            shard.max_us.store(0, Ordering::Relaxed);
+        }
+    }
+}
+
+/// Point-in-time copy of a [`LatencyHistogram`].
+#[derive(Debug, Clone)]
+pub struct HistogramSnapshot {
+    pub buckets: Box<[u64]>,
+    pub count: u64,
+    pub sum_us: u64,
+    pub max_us: u64,
+}
+
+impl Default for HistogramSnapshot {
+    fn default() -> Self {
+        Self {
+            buckets: vec![0; BUCKETS].into_boxed_slice(),
+            count: 0,
+            sum_us: 0,
+            max_us: 0,
+        }
+    }
+}
+
+impl HistogramSnapshot {
+    pub fn mean_us(&self) -> u64 {
+        if self.count == 0 {
+            0
+        } else {
+            self.sum_us / self.count
+        }
+    }
+
+    /// Upper bound (µs) of the bucket containing quantile `q` (0.0..=1.0),
+    /// clamped to the observed maximum.
+    pub fn quantile_us(&self, q: f64) -> u64 {
+        if self.count == 0 {
+            return 0;
+        }
+        let rank = ((q.clamp(0.0, 1.0) * self.count as f64).ceil() as u64).max(1);
+        let mut seen = 0;
+        for (i, &n) in self.buckets.iter().enumerate() {
+            seen += n;
+            if seen >= rank {
+                return bucket_upper_us(i).min(self.max_us);
+            }
+        }
+        self.max_us
+    }
+
+    pub fn p50_us(&self) -> u64 {
+        self.quantile_us(0.50)
+    }
+
+    pub fn p95_us(&self) -> u64 {
+        self.quantile_us(0.95)
+    }
+
+    pub fn p99_us(&self) -> u64 {
+        self.quantile_us(0.99)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::Arc;
+
+    #[test]
+    fn records_into_log_linear_buckets() {
+        let h = LatencyHistogram::new();
+        h.record(Duration::from_micros(0));
+        h.record(Duration::from_micros(1));
+        h.record(Duration::from_micros(3));
+        h.record(Duration::from_millis(1));
+
+        let s = h.snapshot();
+        assert_eq!(s.count, 4);
+        assert_eq!(s.buckets[0], 1);
+        assert_eq!(s.buckets[1], 1);
+        assert_eq!(s.buckets[3], 1);
+        let idx = bucket_index(1000);
+        assert_eq!(s.buckets[idx], 1);
+        assert_eq!(bucket_upper_us(idx), 1023); // 1000us in [992, 1024)
+        assert_eq!(s.max_us, 1000);
+        assert_eq!(s.mean_us(), 251);
+    }
+
+    #[test]
+    fn bucket_bounds_are_contiguous() {
+        assert_eq!(bucket_index(MAX_BUCKETED_US), BUCKETS - 1);
+        assert_eq!(bucket_index(u64::MAX), BUCKETS - 1);
+        assert_eq!(bucket_upper_us(BUCKETS - 1), MAX_BUCKETED_US);
+        for idx in 0..BUCKETS - 1 {
+            let upper = bucket_upper_us(idx);
+            assert_eq!(bucket_index(upper), idx);
+            assert_eq!(bucket_index(upper + 1), idx + 1);
+        }
+    }
+
+    #[test]
+    fn quantiles_are_bucket_bounded() {
+        let h = LatencyHistogram::new();
+        for _ in 0..99 {
+            h.record(Duration::from_micros(100));
+        }
+        h.record(Duration::from_millis(30));
+
+        let s = h.snapshot();
+        assert_eq!(s.p50_us(), 103); // 100us in [100, 104)
+        assert_eq!(s.p99_us(), 103);
+        assert_eq!(s.quantile_us(1.0), 30_000);
+        assert_eq!(LatencyHistogram::new().snapshot().p95_us(), 0);
+    }
+
+    #[test]
+    fn snapshot_merges_shards_from_all_threads() {
+        let h = Arc::new(LatencyHistogram::new());
+        let threads: Vec<_> = (0..SHARDS * 2)
+            .map(|t| {
+                let h = h.clone();
+                std::thread::spawn(move || {
+                    for _ in 0..1000 {
+                        h.record(Duration::from_micros(t as u64 * 10));
+                    }
+                })
+            })
+            .collect();
+        for t in threads {
+            t.join().unwrap();
+        }
+
+        let s = h.snapshot();
+        assert_eq!(s.count, SHARDS as u64 * 2 * 1000);
+        assert_eq!(s.buckets.iter().sum::<u64>(), s.count);
+        assert_eq!(s.max_us, (SHARDS as u64 * 2 - 1) * 10);
+
+        h.reset();
+        assert_eq!(h.snapshot().count, 0);
+    }
+}
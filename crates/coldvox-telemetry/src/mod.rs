@@ -1,9 +1,13 @@
+pub mod histogram;
 pub mod metrics;
 pub mod pipeline_metrics;
 pub mod stt_metrics;
+pub mod utterance_trace;
 pub mod integration;
 
+pub use histogram::*;
 pub use metrics::*;
 pub use pipeline_metrics::*;
 pub use stt_metrics::*;
+pub use utterance_trace::*;
 pub use integration::*;
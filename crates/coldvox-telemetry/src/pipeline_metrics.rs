@@ -3,6 +3,9 @@ use std::sync::atomic::{AtomicBool, AtomicI16, AtomicU64, AtomicUsize, Ordering}
 use std::sync::Arc;
 use std::time::{Duration, Instant};
 
+use crate::histogram::{HistogramSnapshot, LatencyHistogram};
+use crate::utterance_trace::UtteranceTracer;
+
 /// Shared metrics for cross-thread pipeline monitoring
 #[derive(Clone)]
 pub struct PipelineMetrics {
@@ -27,6 +30,10 @@ pub struct PipelineMetrics {
     pub chunker_fps: Arc<AtomicU64>, // Chunks per second * 10
     pub vad_fps: Arc<AtomicU64>,     // VAD frames per second * 10
 
+    // Cascade VAD gate (cumulative frame counts)
+    pub vad_frames_inferred: Arc<AtomicU64>,
+    pub vad_frames_gated: Arc<AtomicU64>,
+
     // Event counters
     pub capture_frames: Arc<AtomicU64>,
     pub chunker_frames: Arc<AtomicU64>,
@@ -35,6 +42,19 @@ pub struct PipelineMetrics {
     pub capture_to_chunker_ms: Arc<AtomicU64>, // Latency in ms
     pub chunker_to_vad_ms: Arc<AtomicU64>,     // Latency in ms
     pub end_to_end_ms: Arc<AtomicU64>,         // Total pipeline latency
+    /// Delay from the capture side signalling a filled ring buffer to the chunker
+    /// task running.
+    pub capture_to_chunker_handoff: Arc<LatencyHistogram>,
+    /// Delay from the chunker broadcasting a frame to the VAD task picking it up.
+    pub chunker_to_vad_handoff: Arc<LatencyHistogram>,
+    /// Delay from a VAD speech boundary to the STT processor acting on it.
+    pub vad_to_stt_handoff: Arc<LatencyHistogram>,
+    /// Time the STT engine spends in a single `process_audio` or `finalize` call.
+    pub stt_engine_processing: Arc<LatencyHistogram>,
+    /// Delay from the last transcription to its text being injected.
+    pub injection_latency: Arc<LatencyHistogram>,
+    /// Per-utterance timelines from speech start to injection.
+    pub utterance_trace: Arc<UtteranceTracer>,
 
     // Activity indicators
     pub is_speaking: Arc<AtomicBool>, // Currently in speech
@@ -67,6 +87,10 @@ pub struct PipelineMetrics {
     pub stt_gc_runs: Arc<AtomicU64>,
     pub vad_detection_latency_ms: Arc<AtomicU64>,
     pub vad_to_stt_handoff_latency_ms: Arc<AtomicU64>,
+
+    /// Queue depth and drops for each audio frame bus subscriber, in
+    /// subscription order.
+    pub subscriber_lag: Arc<RwLock<Vec<Arc<SubscriberLag>>>>,
 }
 
 impl Default for PipelineMetrics {
@@ -88,6 +112,8 @@ impl Default for PipelineMetrics {
             capture_fps: Arc::new(AtomicU64::new(0)),
             chunker_fps: Arc::new(AtomicU64::new(0)),
             vad_fps: Arc::new(AtomicU64::new(0)),
+            vad_frames_inferred: Arc::new(AtomicU64::new(0)),
+            vad_frames_gated: Arc::new(AtomicU64::new(0)),
 
             capture_frames: Arc::new(AtomicU64::new(0)),
             chunker_frames: Arc::new(AtomicU64::new(0)),
@@ -95,6 +121,12 @@ impl Default for PipelineMetrics {
             capture_to_chunker_ms: Arc::new(AtomicU64::new(0)),
             chunker_to_vad_ms: Arc::new(AtomicU64::new(0)),
             end_to_end_ms: Arc::new(AtomicU64::new(0)),
+            capture_to_chunker_handoff: Arc::new(LatencyHistogram::new()),
+            chunker_to_vad_handoff: Arc::new(LatencyHistogram::new()),
+            vad_to_stt_handoff: Arc::new(LatencyHistogram::new()),
+            stt_engine_processing: Arc::new(LatencyHistogram::new()),
+            injection_latency: Arc::new(LatencyHistogram::new()),
+            utterance_trace: Arc::new(UtteranceTracer::new()),
 
             is_speaking: Arc::new(AtomicBool::new(false)),
             last_speech_time: Arc::new(RwLock::new(None)),
@@ -124,6 +156,8 @@ impl Default for PipelineMetrics {
             stt_gc_runs: Arc::new(AtomicU64::new(0)),
             vad_detection_latency_ms: Arc::new(AtomicU64::new(0)),
             vad_to_stt_handoff_latency_ms: Arc::new(AtomicU64::new(0)),
+
+            subscriber_lag: Arc::new(RwLock::new(Vec::new())),
         }
     }
 }
@@ -134,11 +168,18 @@ impl PipelineMetrics {
             return;
         }
 
-        let peak = samples.iter().map(|&s| s.abs()).max().unwrap_or(0);
+        let peak = samples.iter().map(|&s| s.unsigned_abs()).max().unwrap_or(0);
+        let sum: i64 = samples.iter().map(|&s| s as i64 * s as i64).sum();
+        self.record_audio_level(peak, sum as f64 / samples.len() as f64);
+    }
+
+    /// Store levels measured elsewhere (the chunker's per-frame features).
+    /// `mean_square` is in raw sample units.
+    pub fn record_audio_level(&self, peak: u16, mean_square: f64) {
+        let peak = peak.min(i16::MAX as u16) as i16;
         self.current_peak.store(peak, Ordering::Relaxed);
 
-        let sum: i64 = samples.iter().map(|&s| s as i64 * s as i64).sum();
-        let rms = ((sum as f64 / samples.len() as f64).sqrt() * 1000.0) as u64;
+        let rms = (mean_square.sqrt() * 1000.0) as u64;
         self.current_rms.store(rms, Ordering::Relaxed);
 
         let db = if peak > 0 {
@@ -188,6 +229,22 @@ impl PipelineMetrics {
         self.vad_fps.store((fps * 10.0) as u64, Ordering::Relaxed);
     }
 
+    /// Store the VAD gate's cumulative inferred/gated frame counts.
+    pub fn update_vad_gate(&self, inferred: u64, gated: u64) {
+        self.vad_frames_inferred.store(inferred, Ordering::Relaxed);
+        self.vad_frames_gated.store(gated, Ordering::Relaxed);
+    }
+
+    /// Percentage of VAD frames that skipped inference.
+    pub fn vad_gated_percent(&self) -> f64 {
+        let inferred = self.vad_frames_inferred.load(Ordering::Relaxed);
+        let gated = self.vad_frames_gated.load(Ordering::Relaxed);
+        match inferred + gated {
+            0 => 0.0,
+            total => gated as f64 * 100.0 / total as f64,
+        }
+    }
+
     pub fn increment_capture_frames(&self) {
         self.capture_frames.fetch_add(1, Ordering::Relaxed);
     }
@@ -196,6 +253,45 @@ impl PipelineMetrics {
         self.chunker_frames.fetch_add(1, Ordering::Relaxed);
     }
 
+    pub fn record_capture_to_chunker_handoff(&self, delay: Duration) {
+        self.capture_to_chunker_handoff.record(delay);
+        self.capture_to_chunker_ms
+            .store(delay.as_millis() as u64, Ordering::Relaxed);
+    }
+
+    pub fn record_chunker_to_vad_handoff(&self, delay: Duration) {
+        self.chunker_to_vad_handoff.record(delay);
+        self.chunker_to_vad_ms
+            .store(delay.as_millis() as u64, Ordering::Relaxed);
+    }
+
+    pub fn record_vad_to_stt_handoff(&self, delay: Duration) {
+        self.vad_to_stt_handoff.record(delay);
+        self.update_vad_to_stt_handoff_latency(delay.as_millis() as u64);
+    }
+
+    pub fn record_stt_engine_processing(&self, elapsed: Duration) {
+        self.stt_engine_processing.record(elapsed);
+    }
+
+    pub fn record_injection_latency(&self, latency: Duration) {
+        self.injection_latency.record(latency);
+    }
+
+    /// Tail latencies of every pipeline stage, for periodic logging.
+    pub fn latency_report(&self) -> [(&'static str, HistogramSnapshot); 5] {
+        [
+            (
+                "capture_to_chunker",
+                self.capture_to_chunker_handoff.snapshot(),
+            ),
+            ("chunker_to_vad", self.chunker_to_vad_handoff.snapshot()),
+            ("vad_to_stt", self.vad_to_stt_handoff.snapshot()),
+            ("stt_engine", self.stt_engine_processing.snapshot()),
+            ("injection", self.injection_latency.snapshot()),
+        ]
+    }
+
     pub fn update_vad_detection_latency(&self, latency_ms: u64) {
         let current = self.vad_detection_latency_ms.load(Ordering::Relaxed);
         if latency_ms > current {
@@ -211,6 +307,58 @@ impl PipelineMetrics {
                 .store(latency_ms, Ordering::Relaxed);
         }
     }
+
+    /// Lag gauge for the frame bus subscriber `name`, registering it on first
+    /// use. Subscribers sharing a name share a gauge.
+    pub fn subscriber_lag(&self, name: &str) -> Arc<SubscriberLag> {
+        if let Some(lag) = self.subscriber_lag.read().iter().find(|l| l.name == name) {
+            return lag.clone();
+        }
+        let mut lags = self.subscriber_lag.write();
+        if let Some(lag) = lags.iter().find(|l| l.name == name) {
+            return lag.clone();
+        }
+        let lag = Arc::new(SubscriberLag::new(name));
+        lags.push(lag.clone());
+        lag
+    }
+
+    /// Snapshot of every subscriber's gauge.
+    pub fn subscriber_lags(&self) -> Vec<Arc<SubscriberLag>> {
+        self.subscriber_lag.read().clone()
+    }
+}
+
+/// How far one frame bus subscriber is behind the chunker.
+#[derive(Debug)]
+pub struct SubscriberLag {
+    pub name: String,
+    /// Frames currently queued for the subscriber.
+    pub queued: AtomicUsize,
+    /// Deepest the queue has been.
+    pub peak_queued: AtomicUsize,
+    /// Frames discarded by the subscriber's delivery policy.
+    pub dropped: AtomicU64,
+}
+
+impl SubscriberLag {
+    pub fn new(name: &str) -> Self {
+        Self {
+            name: name.to_string(),
+            queued: AtomicUsize::new(0),
+            peak_queued: AtomicUsize::new(0),
+            dropped: AtomicU64::new(0),
+        }
+    }
+
+    pub fn record_depth(&self, queued: usize) {
+        self.queued.store(queued, Ordering::Relaxed);
+        self.peak_queued.fetch_max(queued, Ordering::Relaxed);
+    }
+
+    pub fn record_drop(&self) {
+        self.dropped.fetch_add(1, Ordering::Relaxed);
+    }
 }
 
 #[derive(Debug, Clone, Copy)]
@@ -262,3 +410,31 @@ impl Default for FpsTracker {
         Self::new()
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn subscriber_lag_is_registered_once_per_name() {
+        let metrics = PipelineMetrics::default();
+        let stt = metrics.subscriber_lag("stt");
+        stt.record_depth(5);
+        stt.record_depth(2);
+        stt.record_drop();
+        metrics.subscriber_lag("ui").record_depth(1);
+
+        let again = metrics.subscriber_lag("stt");
+        assert!(Arc::ptr_eq(&stt, &again));
+        assert_eq!(again.queued.load(Ordering::Relaxed), 2);
+        assert_eq!(again.peak_queued.load(Ordering::Relaxed), 5);
+        assert_eq!(again.dropped.load(Ordering::Relaxed), 1);
+
+        let names: Vec<_> = metrics
+            .subscriber_lags()
+            .iter()
+            .map(|l| l.name.clone())
+            .collect();
+        assert_eq!(names, ["stt", "ui"]);
+    }
+}
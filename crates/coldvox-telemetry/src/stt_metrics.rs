@@ -5,7 +5,7 @@
 //! and operational metrics.
 
 use parking_lot::RwLock;
-use std::collections::VecDeque;
+use std::collections::{HashMap, VecDeque};
 use std::sync::Arc;
 use std::time::{Duration, Instant};
 
@@ -26,6 +26,7 @@ struct MetricsInner {
     operational: OperationalMetrics,
     latency_history: VecDeque<LatencySnapshot>,
     word_confidence_history: VecDeque<f64>,
+    race: HashMap<String, EngineRaceStats>,
 }
 
 #[derive(Default, Clone, Debug)]
@@ -66,6 +67,41 @@ pub struct OperationalMetrics {
     pub processing_fps: u64,
 }
 
+/// Per-engine outcome of racing two STT engines on the same utterance
+#[derive(Default, Clone, Debug, PartialEq)]
+pub struct EngineRaceStats {
+    pub wins: u64,
+    pub losses: u64,
+    /// Finalize latencies of races where this engine finished
+    pub finalize_latency_sum_us: u64,
+    pub finalize_count: u64,
+    pub max_finalize_latency_us: u64,
+}
+
+impl EngineRaceStats {
+    pub fn win_rate(&self) -> f64 {
+        let total = self.wins + self.losses;
+        if total > 0 {
+            self.wins as f64 / total as f64
+        } else {
+            0.0
+        }
+    }
+
+    pub fn mean_finalize_latency_us(&self) -> u64 {
+        self.finalize_latency_sum_us
+            .checked_div(self.finalize_count)
+            .unwrap_or(0)
+    }
+
+    fn record_latency(&mut self, latency: Duration) {
+        let latency_us = latency.as_micros() as u64;
+        self.finalize_latency_sum_us += latency_us;
+        self.finalize_count += 1;
+        self.max_finalize_latency_us = self.max_finalize_latency_us.max(latency_us);
+    }
+}
+
 /// Snapshot of latency measurements for historical tracking
 #[derive(Debug, Clone)]
 pub struct LatencySnapshot {
@@ -202,6 +238,31 @@ impl SttPerformanceMetrics {
         self.inner.write().operational.error_count += 1;
     }
 
+    /// Record one race. `loser_latency` is `None` when the loser was
+    /// cancelled before it finished.
+    pub fn record_race(
+        &self,
+        winner: &str,
+        winner_latency: Duration,
+        loser: &str,
+        loser_latency: Option<Duration>,
+    ) {
+        let mut inner = self.inner.write();
+        let stats = inner.race.entry(winner.to_string()).or_default();
+        stats.wins += 1;
+        stats.record_latency(winner_latency);
+
+        let stats = inner.race.entry(loser.to_string()).or_default();
+        stats.losses += 1;
+        if let Some(latency) = loser_latency {
+            stats.record_latency(latency);
+        }
+    }
+
+    pub fn race_stats(&self) -> HashMap<String, EngineRaceStats> {
+        self.inner.read().race.clone()
+    }
+
     pub fn get_average_confidence(&self) -> f64 {
         let inner = self.inner.read();
         if inner.accuracy.confidence_count > 0 {
@@ -418,6 +479,30 @@ mod tests {
         assert!(latency.end_to_end_us < 50_000);
     }
 
+    #[test]
+    fn test_race_stats_per_engine() {
+        let metrics = SttPerformanceMetrics::new();
+        metrics.record_race("parakeet", Duration::from_millis(100), "http-remote", None);
+        metrics.record_race(
+            "http-remote",
+            Duration::from_millis(200),
+            "parakeet",
+            Some(Duration::from_millis(400)),
+        );
+
+        let stats = metrics.race_stats();
+        let parakeet = &stats["parakeet"];
+        assert_eq!((parakeet.wins, parakeet.losses), (1, 1));
+        assert_eq!(parakeet.mean_finalize_latency_us(), 250_000);
+        assert_eq!(parakeet.max_finalize_latency_us, 400_000);
+        assert!((parakeet.win_rate() - 0.5).abs() < f64::EPSILON);
+
+        // A cancelled loser has no latency sample
+        let remote = &stats["http-remote"];
+        assert_eq!(remote.finalize_count, 1);
+        assert_eq!(remote.mean_finalize_latency_us(), 200_000);
+    }
+
     #[test]
     fn test_memory_usage_tracking() {
         let metrics = SttPerformanceMetrics::new();
@@ -0,0 +1,613 @@
+//! Per-utterance timelines from speech onset to injected text.
+//!
+//! Each pipeline stage calls [`UtteranceTracer::speech_start`],
+//! [`UtteranceTracer::speech_end`] or [`UtteranceTracer::mark`] as an
+//! utterance passes through it, naming the utterance by its [`TraceId`]. The
+//! id is the sample-clock position of the session start, which travels with
+//! the VAD and session events; once STT produces a final, its `utterance_id`
+//! is bound to the trace so the injection side can mark it by that instead.
+//!
+//! A finished utterance is logged as one compact `coldvox::trace` record,
+//! kept in a short history for dashboards, and optionally appended to a
+//! Chrome trace file (`chrome://tracing` or Perfetto) as one span per stage.
+
+use parking_lot::Mutex;
+use std::collections::VecDeque;
+use std::fs::File;
+use std::io::{self, BufWriter, Write};
+use std::path::Path;
+use std::time::{Duration, Instant};
+
+/// Finished timelines kept for [`UtteranceTracer::recent`].
+const HISTORY: usize = 16;
+
+/// Utterances allowed in flight at once; older ones are reported as
+/// incomplete.
+const MAX_OPEN: usize = 8;
+
+/// Names one utterance's timeline: the start timestamp (ms) of the VAD or
+/// hotkey event that opened its session.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct TraceId(pub u64);
+
+/// When the frame that triggered a VAD event passed the audio stages.
+#[derive(Debug, Clone, Copy)]
+pub struct FrameTimes {
+    /// Capture time, on the sample clock.
+    pub captured: Instant,
+    /// When the frame reader pulled the frame's newest samples off the ring.
+    pub read: Instant,
+    /// When the chunker emitted the frame.
+    pub chunked: Instant,
+}
+
+/// A point an utterance passes on its way through the pipeline, in order.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum TraceStage {
+    /// Frame reader pulled the onset frame's samples off the capture ring.
+    FrameRead,
+    /// Chunker emitted the onset frame.
+    Chunked,
+    /// VAD emitted speech start.
+    SpeechStart,
+    /// STT processor began the session.
+    SessionStart,
+    /// VAD emitted speech end.
+    SpeechEnd,
+    /// STT processor handled the session end.
+    SessionEnd,
+    /// Plugin `finalize` called.
+    FinalizeStart,
+    /// Plugin `finalize` returned.
+    FinalizeEnd,
+    /// Injection processor received the final transcription.
+    FinalReceived,
+    /// Injector called.
+    InjectStart,
+    /// Injector returned.
+    Injected,
+}
+
+impl TraceStage {
+    pub fn as_str(self) -> &'static str {
+        match self {
+            TraceStage::FrameRead => "frame_read",
+            TraceStage::Chunked => "chunked",
+            TraceStage::SpeechStart => "speech_start",
+            TraceStage::SessionStart => "session_start",
+            TraceStage::SpeechEnd => "speech_end",
+            TraceStage::SessionEnd => "session_end",
+            TraceStage::FinalizeStart => "finalize_start",
+            TraceStage::FinalizeEnd => "finalize_end",
+            TraceStage::FinalReceived => "final_received",
+            TraceStage::InjectStart => "inject_start",
+            TraceStage::Injected => "injected",
+        }
+    }
+}
+
+/// One utterance's timeline.
+#[derive(Debug, Clone)]
+pub struct UtteranceTimeline {
+    pub id: u64,
+    /// `utterance_id` of the final transcription, once STT produced one.
+    pub utterance_id: Option<u64>,
+    /// Speech start and end on the audio sample clock (ms since the stream
+    /// started), when VAD detected them.
+    pub audio_start_ms: Option<u64>,
+    pub audio_end_ms: Option<u64>,
+    /// Capture time of the frames VAD detected the start and end in.
+    pub captured_start: Option<Instant>,
+    pub captured_end: Option<Instant>,
+    /// Stages passed, in the order they happened.
+    pub marks: Vec<(TraceStage, Instant)>,
+    /// False when the utterance was dropped or produced no text.
+    pub completed: bool,
+}
+
+impl UtteranceTimeline {
+    fn new(id: TraceId) -> Self {
+        Self {
+            id: id.0,
+            utterance_id: None,
+            audio_start_ms: None,
+            audio_end_ms: None,
+            captured_start: None,
+            captured_end: None,
+            marks: Vec::with_capacity(11),
+            completed: false,
+        }
+    }
+
+    pub fn at(&self, stage: TraceStage) -> Option<Instant> {
+        self.marks
+            .iter()
+            .find(|(s, _)| *s == stage)
+            .map(|(_, at)| *at)
+    }
+
+    fn has(&self, stage: TraceStage) -> bool {
+        self.at(stage).is_some()
+    }
+
+    fn push(&mut self, stage: TraceStage, at: Instant) {
+        if !self.has(stage) {
+            self.marks.push((stage, at));
+        }
+    }
+
+    /// Time from each mark to the next, labelled with the later stage.
+    pub fn stage_durations(&self) -> Vec<(TraceStage, Duration)> {
+        self.marks
+            .windows(2)
+            .map(|pair| (pair[1].0, pair[1].1.saturating_duration_since(pair[0].1)))
+            .collect()
+    }
+
+    /// The longest stage after the user stopped talking.
+    pub fn slowest_stage(&self) -> Option<(TraceStage, Duration)> {
+        let spoken = self.marks.iter().position(|(stage, _)| {
+            matches!(stage, TraceStage::SpeechEnd | TraceStage::SessionEnd)
+        })?;
+        self.marks[spoken..]
+            .windows(2)
+            .map(|pair| (pair[1].0, pair[1].1.saturating_duration_since(pair[0].1)))
+            .max_by_key(|(_, took)| *took)
+    }
+
+    /// Delay from the end of the captured speech to the last mark: what the
+    /// user waits for after they stop talking.
+    pub fn tail_latency(&self) -> Option<Duration> {
+        let end = self
+            .captured_end
+            .or_else(|| self.at(TraceStage::SessionEnd))?;
+        let (_, last) = self.marks.last()?;
+        Some(last.saturating_duration_since(end))
+    }
+
+    /// `stage=ms` pairs for log records and dashboards.
+    pub fn summary(&self) -> String {
+        let mut out = String::new();
+        if let (Some(captured), Some(end)) = (self.captured_end, self.at(TraceStage::SpeechEnd)) {
+            out.push_str(&format!(
+                "vad_end_detect={}ms ",
+                end.saturating_duration_since(captured).as_millis()
+            ));
+        }
+        for (stage, took) in self.stage_durations() {
+            out.push_str(&format!("{}={}ms ", stage.as_str(), took.as_millis()));
+        }
+        if let Some(tail) = self.tail_latency() {
+            out.push_str(&format!("tail={}ms", tail.as_millis()));
+        }
+        out.trim_end().to_string()
+    }
+}
+
+#[derive(Default)]
+struct TracerState {
+    /// Utterances not yet injected or given up on, oldest first.
+    open: VecDeque<UtteranceTimeline>,
+    recent: VecDeque<UtteranceTimeline>,
+}
+
+impl TracerState {
+    /// Open a timeline for `id`, reporting one already open under the same
+    /// id (a restarted sample clock) and any evicted to stay under
+    /// [`MAX_OPEN`] as incomplete.
+    fn begin(&mut self, id: TraceId) -> (&mut UtteranceTimeline, Vec<UtteranceTimeline>) {
+        let mut dropped: Vec<_> = self.take(id).into_iter().collect();
+        while self.open.len() >= MAX_OPEN {
+            dropped.extend(self.open.pop_front());
+        }
+        self.open.push_back(UtteranceTimeline::new(id));
+        (self.open.back_mut().expect("just pushed"), dropped)
+    }
+
+    fn get(&mut self, id: TraceId) -> Option<&mut UtteranceTimeline> {
+        self.open.iter_mut().find(|t| t.id == id.0)
+    }
+
+    fn take(&mut self, id: TraceId) -> Option<UtteranceTimeline> {
+        let index = self.open.iter().position(|t| t.id == id.0)?;
+        self.open.remove(index)
+    }
+
+    fn bound_to(&self, utterance_id: u64) -> Option<TraceId> {
+        self.open
+            .iter()
+            .find(|t| t.utterance_id == Some(utterance_id))
+            .map(|t| TraceId(t.id))
+    }
+}
+
+/// Collects [`UtteranceTimeline`]s across pipeline threads.
+///
+/// Marks happen a handful of times per utterance, so a mutex is fine here;
+/// nothing on the per-frame path touches it.
+pub struct UtteranceTracer {
+    state: Mutex<TracerState>,
+    chrome_trace: Mutex<Option<BufWriter<File>>>,
+    epoch: Instant,
+}
+
+impl Default for UtteranceTracer {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl std::fmt::Debug for UtteranceTracer {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("UtteranceTracer")
+            .field("chrome_trace", &self.chrome_trace.lock().is_some())
+            .finish()
+    }
+}
+
+impl UtteranceTracer {
+    pub fn new() -> Self {
+        Self {
+            state: Mutex::new(TracerState::default()),
+            chrome_trace: Mutex::new(None),
+            epoch: Instant::now(),
+        }
+    }
+
+    /// Also append every finished timeline to `path` in Chrome trace format.
+    /// The file is truncated; the JSON array is left open, which trace
+    /// viewers accept, so an interrupted run still loads.
+    pub fn enable_chrome_trace(&self, path: impl AsRef<Path>) -> io::Result<()> {
+        let mut writer = BufWriter::new(File::create(path)?);
+        writer.write_all(b"[\n")?;
+        writer.flush()?;
+        *self.chrome_trace.lock() = Some(writer);
+        Ok(())
+    }
+
+    /// VAD detected speech at `audio_ms` on the sample clock, in `frame`.
+    /// Returns the id the rest of the pipeline marks the utterance by.
+    pub fn speech_start(&self, audio_ms: u64, frame: FrameTimes) -> TraceId {
+        let id = TraceId(audio_ms);
+        let now = Instant::now();
+        let dropped = {
+            let mut state = self.state.lock();
+            let (timeline, dropped) = state.begin(id);
+            timeline.audio_start_ms = Some(audio_ms);
+            timeline.captured_start = Some(frame.captured);
+            timeline.push(TraceStage::FrameRead, frame.read);
+            timeline.push(TraceStage::Chunked, frame.chunked);
+            timeline.push(TraceStage::SpeechStart, now);
+            dropped
+        };
+        self.report(dropped);
+        id
+    }
+
+    /// VAD detected the end of utterance `id`'s speech at `audio_ms`, in
+    /// `frame`.
+    pub fn speech_end(&self, id: TraceId, audio_ms: u64, frame: FrameTimes) {
+        let now = Instant::now();
+        let mut state = self.state.lock();
+        if let Some(timeline) = state.get(id) {
+            timeline.audio_end_ms = Some(audio_ms);
+            timeline.captured_end = Some(frame.captured);
+            timeline.push(TraceStage::SpeechEnd, now);
+        }
+    }
+
+    /// Record that utterance `id` just passed `stage`. A session start the
+    /// VAD did not trace (hotkey activation) opens the timeline.
+    pub fn mark(&self, id: TraceId, stage: TraceStage) {
+        let now = Instant::now();
+        let mut dropped = Vec::new();
+        {
+            let mut state = self.state.lock();
+            if stage == TraceStage::SessionStart && state.get(id).is_none() {
+                dropped = state.begin(id).1;
+            }
+            if let Some(timeline) = state.get(id) {
+                timeline.push(stage, now);
+            }
+        }
+        self.report(dropped);
+    }
+
+    /// STT delivered utterance `id` as the final with `utterance_id`; later
+    /// stages mark it through [`mark_utterance`](Self::mark_utterance).
+    pub fn bind(&self, id: TraceId, utterance_id: u64) {
+        if let Some(timeline) = self.state.lock().get(id) {
+            timeline.utterance_id = Some(utterance_id);
+        }
+    }
+
+    /// Utterance the final with `utterance_id` was bound to, whether still
+    /// open or recently finished.
+    pub fn trace_of(&self, utterance_id: u64) -> Option<TraceId> {
+        let state = self.state.lock();
+        state.bound_to(utterance_id).or_else(|| {
+            state
+                .recent
+                .iter()
+                .rev()
+                .find(|t| t.utterance_id == Some(utterance_id))
+                .map(|t| TraceId(t.id))
+        })
+    }
+
+    /// Record that the final with `utterance_id` just passed `stage`.
+    /// [`TraceStage::Injected`] completes its timeline.
+    pub fn mark_utterance(&self, utterance_id: u64, stage: TraceStage) {
+        let now = Instant::now();
+        let finished = {
+            let mut state = self.state.lock();
+            let Some(id) = state.bound_to(utterance_id) else {
+                return;
+            };
+            if stage != TraceStage::Injected {
+                if let Some(timeline) = state.get(id) {
+                    timeline.push(stage, now);
+                }
+                return;
+            }
+            let mut done = state.take(id).expect("bound trace is open");
+            done.push(stage, now);
+            done.completed = true;
+            done
+        };
+        self.report(vec![finished]);
+    }
+
+    /// Utterance `id` produced no text (aborted, empty or failed finalize);
+    /// report it as it stands.
+    pub fn abandon(&self, id: TraceId) {
+        let dropped = self.state.lock().take(id);
+        self.report(dropped.into_iter().collect());
+    }
+
+    /// The final with `utterance_id` was not injected; report its timeline
+    /// as it stands.
+    pub fn abandon_utterance(&self, utterance_id: u64) {
+        let dropped = {
+            let mut state = self.state.lock();
+            state.bound_to(utterance_id).and_then(|id| state.take(id))
+        };
+        self.report(dropped.into_iter().collect());
+    }
+
+    /// Finished timelines, oldest first.
+    pub fn recent(&self) -> Vec<UtteranceTimeline> {
+        self.state.lock().recent.iter().cloned().collect()
+    }
+
+    pub fn last(&self) -> Option<UtteranceTimeline> {
+        self.state.lock().recent.back().cloned()
+    }
+
+    fn report(&self, finished: Vec<UtteranceTimeline>) {
+        if finished.is_empty() {
+            return;
+        }
+        for timeline in &finished {
+            tracing::info!(
+                target: "coldvox::trace",
+                utterance = timeline.id,
+                completed = timeline.completed,
+                audio_start_ms = timeline.audio_start_ms,
+                audio_end_ms = timeline.audio_end_ms,
+                tail_ms = timeline.tail_latency().map(|d| d.as_millis() as u64),
+                stages = %timeline.summary(),
+                "Utterance timeline"
+            );
+        }
+        if let Some(writer) = self.chrome_trace.lock().as_mut() {
+            let written = finished
+                .iter()
+                .try_for_each(|timeline| self.write_chrome_events(writer, timeline))
+                .and_then(|_| writer.flush());
+            if let Err(e) = written {
+                tracing::warn!(target: "coldvox::trace", error = %e, "Failed to write Chrome trace");
+            }
+        }
+
+        let mut state = self.state.lock();
+        for timeline in finished {
+            if state.recent.len() == HISTORY {
+                state.recent.pop_front();
+            }
+            state.recent.push_back(timeline);
+        }
+    }
+
+    /// One complete ("X") event per stage, on a track per utterance.
+    fn write_chrome_events(
+        &self,
+        writer: &mut impl Write,
+        timeline: &UtteranceTimeline,
+    ) -> io::Result<()> {
+        let us = |at: Instant| at.saturating_duration_since(self.epoch).as_micros();
+        let mut spans: Vec<(&str, Instant, Instant)> = Vec::new();
+        if let (Some(captured), Some(&(stage, first))) =
+            (timeline.captured_start, timeline.marks.first())
+        {
+            // Up to the frame read with frame times, else through VAD detection
+            let name = match stage {
+                TraceStage::SpeechStart => "vad_start_detect",
+                stage => stage.as_str(),
+            };
+            spans.push((name, captured, first));
+        }
+        if let (Some(captured), Some(end)) =
+            (timeline.captured_end, timeline.at(TraceStage::SpeechEnd))
+        {
+            spans.push(("vad_end_detect", captured, end));
+        }
+        for pair in timeline.marks.windows(2) {
+            spans.push((pair[1].0.as_str(), pair[0].1, pair[1].1));
+        }
+        for (name, from, to) in spans {
+            writeln!(
+                writer,
+                r#"{{"name":"{}","cat":"utterance","ph":"X","ts":{},"dur":{},"pid":1,"tid":{},"args":{{"utterance":{},"completed":{}}}}},"#,
+                name,
+                us(from),
+                us(to).saturating_sub(us(from)),
+                timeline.id,
+                timeline.id,
+                timeline.completed
+            )?;
+        }
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn stages(timeline: &UtteranceTimeline) -> Vec<TraceStage> {
+        timeline.marks.iter().map(|(stage, _)| *stage).collect()
+    }
+
+    fn frame() -> FrameTimes {
+        let now = Instant::now();
+        FrameTimes {
+            captured: now,
+            read: now,
+            chunked: now,
+        }
+    }
+
+    #[test]
+    fn vad_utterance_runs_to_injection() {
+        let tracer = UtteranceTracer::new();
+        let id = tracer.speech_start(1_000, frame());
+        tracer.mark(id, TraceStage::SessionStart);
+        tracer.speech_end(id, 2_500, frame());
+        for stage in [
+            TraceStage::SessionEnd,
+            TraceStage::FinalizeStart,
+            TraceStage::FinalizeEnd,
+        ] {
+            tracer.mark(id, stage);
+        }
+        tracer.bind(id, 42);
+        assert_eq!(tracer.trace_of(42), Some(id));
+        tracer.mark_utterance(42, TraceStage::FinalReceived);
+        tracer.mark_utterance(42, TraceStage::InjectStart);
+        assert!(tracer.last().is_none());
+        tracer.mark_utterance(42, TraceStage::Injected);
+
+        let timeline = tracer.last().expect("finished");
+        assert_eq!(tracer.trace_of(42), Some(id));
+        assert!(timeline.completed);
+        assert_eq!(timeline.id, 1_000);
+        assert_eq!(timeline.utterance_id, Some(42));
+        assert_eq!(timeline.audio_start_ms, Some(1_000));
+        assert_eq!(timeline.audio_end_ms, Some(2_500));
+        assert_eq!(
+            &stages(&timeline)[..3],
+            [
+                TraceStage::FrameRead,
+                TraceStage::Chunked,
+                TraceStage::SpeechStart
+            ]
+        );
+        assert_eq!(stages(&timeline).len(), 11);
+        assert_eq!(timeline.stage_durations().len(), 10);
+        assert!(timeline.tail_latency().is_some());
+        let (slowest, _) = timeline.slowest_stage().expect("stages after speech end");
+        assert!(!matches!(
+            slowest,
+            TraceStage::SpeechStart | TraceStage::SessionStart | TraceStage::SpeechEnd
+        ));
+    }
+
+    #[test]
+    fn overlapping_utterances_are_marked_by_id() {
+        let tracer = UtteranceTracer::new();
+        let first = tracer.speech_start(0, frame());
+        tracer.speech_end(first, 1_000, frame());
+        // Second utterance starts before the first is transcribed
+        let second = tracer.speech_start(1_200, frame());
+        tracer.speech_end(second, 2_000, frame());
+
+        // The second finalizes first; its marks must not land on the first
+        tracer.mark(second, TraceStage::FinalizeStart);
+        tracer.mark(second, TraceStage::FinalizeEnd);
+        tracer.bind(second, 7);
+        tracer.mark_utterance(7, TraceStage::FinalReceived);
+        tracer.mark_utterance(7, TraceStage::Injected);
+
+        let done = tracer.last().expect("second finished");
+        assert_eq!(done.id, 1_200);
+        assert!(done.completed);
+        assert!(done.has(TraceStage::FinalizeStart));
+
+        tracer.mark(first, TraceStage::FinalizeStart);
+        tracer.abandon(first);
+        let abandoned = tracer.last().expect("first reported");
+        assert_eq!(abandoned.id, 0);
+        assert!(!abandoned.completed);
+        assert!(!abandoned.has(TraceStage::FinalReceived));
+        assert_eq!(tracer.recent().len(), 2);
+    }
+
+    #[test]
+    fn unknown_ids_are_ignored_and_old_traces_evicted() {
+        let tracer = UtteranceTracer::new();
+        tracer.mark(TraceId(5), TraceStage::FinalizeStart);
+        tracer.mark_utterance(9, TraceStage::Injected);
+        assert!(tracer.last().is_none());
+
+        for ms in 0..=MAX_OPEN as u64 {
+            tracer.speech_start(ms * 1_000, frame());
+        }
+        let evicted = tracer.last().expect("oldest evicted");
+        assert_eq!(evicted.id, 0);
+        assert!(!evicted.completed);
+    }
+
+    #[test]
+    fn hotkey_session_starts_a_timeline() {
+        let tracer = UtteranceTracer::new();
+        let id = TraceId(300);
+        tracer.mark(id, TraceStage::SessionStart);
+        tracer.mark(id, TraceStage::SessionEnd);
+        tracer.bind(id, 1);
+        tracer.mark_utterance(1, TraceStage::FinalReceived);
+        tracer.mark_utterance(1, TraceStage::Injected);
+
+        let timeline = tracer.last().expect("finished");
+        assert_eq!(
+            stages(&timeline),
+            [
+                TraceStage::SessionStart,
+                TraceStage::SessionEnd,
+                TraceStage::FinalReceived,
+                TraceStage::Injected
+            ]
+        );
+        assert!(timeline.audio_start_ms.is_none());
+    }
+
+    #[test]
+    fn chrome_trace_gets_one_span_per_stage() {
+        let path = std::env::temp_dir().join(format!("coldvox-trace-{}.json", std::process::id()));
+        let tracer = UtteranceTracer::new();
+        tracer.enable_chrome_trace(&path).unwrap();
+        let id = tracer.speech_start(0, frame());
+        tracer.speech_end(id, 500, frame());
+        tracer.bind(id, 3);
+        tracer.mark_utterance(3, TraceStage::FinalReceived);
+        tracer.mark_utterance(3, TraceStage::Injected);
+
+        let written = std::fs::read_to_string(&path).unwrap();
+        assert!(written.starts_with("[\n"));
+        // frame_read, vad_end_detect and five stage-to-stage spans
+        assert_eq!(written.matches(r#""ph":"X""#).count(), 7);
+        assert!(written.contains(r#""name":"frame_read""#));
+        assert!(written.contains(r#""name":"injected""#));
+        let _ = std::fs::remove_file(&path);
+    }
+}
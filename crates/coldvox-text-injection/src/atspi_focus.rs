@@ -0,0 +1,371 @@
+//! # Event-driven AT-SPI focus cache
+//!
+//! Resolving the focused element per injection means a fresh accessibility
+//! bus connection, a `Collection.GetMatches` call and several proxy builds,
+//! which costs 50-150 ms on a busy KDE session. [`AtspiFocusCache`] keeps one
+//! connection for the process, subscribes to focus and window-activation
+//! events, and keeps `EditableText`/`Text` proxies for the focused element
+//! ready, so injection skips discovery entirely. Discovery is only used as a
+//! fallback when the cache is empty or a cached proxy fails.
+
+use crate::types::InjectionResult;
+use atspi::connection::AccessibilityConnection;
+use atspi::events::object::StateChangedEvent;
+use atspi::events::window::ActivateEvent;
+use atspi::proxy::accessible::AccessibleProxy;
+use atspi::proxy::collection::CollectionProxy;
+use atspi::proxy::editable_text::EditableTextProxy;
+use atspi::proxy::text::TextProxy;
+use atspi::{Event, Interface, MatchType, ObjectMatchRule, ObjectRef, SortOrder, State};
+use coldvox_foundation::error::InjectionError;
+use futures_util::StreamExt;
+use parking_lot::RwLock;
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::Arc;
+use std::time::{Duration, Instant};
+use tokio::sync::Mutex;
+use tokio::time;
+use tracing::{debug, trace, warn};
+use zbus::proxy::CacheProperties;
+
+/// Budget for connecting and subscribing; beyond that injection falls back to
+/// per-call discovery.
+const CONNECT_TIMEOUT: Duration = Duration::from_millis(250);
+/// Budget for resolving a newly focused element off the injection path.
+const RESOLVE_TIMEOUT: Duration = Duration::from_millis(500);
+/// Wait before retrying a failed connection.
+const RETRY_AFTER: Duration = Duration::from_secs(5);
+
+/// The currently focused accessible element with proxies ready to use.
+#[derive(Debug, Clone)]
+pub struct FocusedTarget {
+    /// Unique bus name of the application owning the element.
+    pub app: String,
+    /// Object path of the element.
+    pub path: String,
+    /// Whether the element implements `EditableText`.
+    pub editable: bool,
+    /// When the element gained focus.
+    pub focused_at: Instant,
+    editable_text: EditableTextProxy<'static>,
+    text: TextProxy<'static>,
+}
+
+impl FocusedTarget {
+    /// Identifier for allow/block lists and per-app method ordering: the bus
+    /// name, matching what `Collection` discovery reports.
+    pub fn app_id(&self) -> &str {
+        if !self.app.is_empty() {
+            return &self.app;
+        }
+        self.path.rsplit('/').next().unwrap_or(&self.path)
+    }
+
+    /// Insert `text` at the caret. Two D-Bus calls, no discovery.
+    pub async fn insert_at_caret(&self, text: &str, timeout: Duration) -> InjectionResult<()> {
+        let timeout_ms = timeout.as_millis() as u64;
+        let caret = time::timeout(timeout, self.text.caret_offset())
+            .await
+            .map_err(|_| InjectionError::Timeout(timeout_ms))?
+            .map_err(|e| InjectionError::Other(format!("Text.caret_offset failed: {e}")))?;
+        time::timeout(
+            timeout,
+            self.editable_text
+                .insert_text(caret, text, text.chars().count() as i32),
+        )
+        .await
+        .map_err(|_| InjectionError::Timeout(timeout_ms))?
+        .map_err(|e| InjectionError::Other(format!("EditableText.insert_text failed: {e}")))?;
+        Ok(())
+    }
+
+    /// Replace the `delete_chars` characters before the caret with `text`
+    /// (incremental injection). Deletes only the changed span rather than
+    /// rewriting the whole field with `SetTextContents`.
+    pub async fn replace_before_caret(
+        &self,
+        delete_chars: usize,
+        text: &str,
+        timeout: Duration,
+    ) -> InjectionResult<()> {
+        let timeout_ms = timeout.as_millis() as u64;
+        let caret = time::timeout(timeout, self.text.caret_offset())
+            .await
+            .map_err(|_| InjectionError::Timeout(timeout_ms))?
+            .map_err(|e| InjectionError::Other(format!("Text.caret_offset failed: {e}")))?;
+        let start = caret - delete_chars as i32;
+        if start < 0 {
+            return Err(InjectionError::Other(format!(
+                "Cannot delete {delete_chars} chars before caret at {caret}"
+            )));
+        }
+        if delete_chars > 0 {
+            time::timeout(timeout, self.editable_text.delete_text(start, caret))
+                .await
+                .map_err(|_| InjectionError::Timeout(timeout_ms))?
+                .map_err(|e| {
+                    InjectionError::Other(format!("EditableText.delete_text failed: {e}"))
+                })?;
+        }
+        if !text.is_empty() {
+            time::timeout(
+                timeout,
+                self.editable_text
+                    .insert_text(start, text, text.chars().count() as i32),
+            )
+            .await
+            .map_err(|_| InjectionError::Timeout(timeout_ms))?
+            .map_err(|e| InjectionError::Other(format!("EditableText.insert_text failed: {e}")))?;
+        }
+        Ok(())
+    }
+
+    async fn resolve(conn: &zbus::Connection, app: String, path: String) -> zbus::Result<Self> {
+        let accessible = AccessibleProxy::builder(conn)
+            .destination(app.clone())?
+            .path(path.clone())?
+            .cache_properties(CacheProperties::No)
+            .build()
+            .await?;
+        let editable = accessible
+            .get_interfaces()
+            .await?
+            .contains(Interface::EditableText);
+        // Uncached: the caret moves without PropertiesChanged signals
+        let editable_text = EditableTextProxy::builder(conn)
+            .destination(app.clone())?
+            .path(path.clone())?
+            .cache_properties(CacheProperties::No)
+            .build()
+            .await?;
+        let text = TextProxy::builder(conn)
+            .destination(app.clone())?
+            .path(path.clone())?
+            .cache_properties(CacheProperties::No)
+            .build()
+            .await?;
+        Ok(Self {
+            app,
+            path,
+            editable,
+            focused_at: Instant::now(),
+            editable_text,
+            text,
+        })
+    }
+}
+
+/// Process-wide AT-SPI connection and focus cache.
+pub struct AtspiFocusCache {
+    conn: AccessibilityConnection,
+    focused: RwLock<Option<FocusedTarget>>,
+    /// Cleared when the event task ends (bus gone or runtime shut down).
+    alive: AtomicBool,
+}
+
+struct Slot {
+    cache: Option<Arc<AtspiFocusCache>>,
+    failed_at: Option<Instant>,
+}
+
+static SHARED: Mutex<Slot> = Mutex::const_new(Slot {
+    cache: None,
+    failed_at: None,
+});
+
+impl AtspiFocusCache {
+    /// The shared cache, connecting (and subscribing) on first use or after
+    /// the previous connection died. `None` while AT-SPI is unreachable.
+    pub async fn shared() -> Option<Arc<AtspiFocusCache>> {
+        let mut slot = SHARED.lock().await;
+        if let Some(cache) = slot.cache.as_ref().filter(|cache| cache.is_alive()) {
+            return Some(cache.clone());
+        }
+        if slot
+            .failed_at
+            .is_some_and(|failed| failed.elapsed() < RETRY_AFTER)
+        {
+            return None;
+        }
+
+        match time::timeout(CONNECT_TIMEOUT, Self::connect()).await {
+            Ok(Ok(cache)) => {
+                slot.cache = Some(cache.clone());
+                slot.failed_at = None;
+                Some(cache)
+            }
+            Ok(Err(e)) => {
+                debug!("AT-SPI focus cache unavailable: {}", e);
+                slot.cache = None;
+                slot.failed_at = Some(Instant::now());
+                None
+            }
+            Err(_) => {
+                debug!("AT-SPI focus cache connect timed out");
+                slot.cache = None;
+                slot.failed_at = Some(Instant::now());
+                None
+            }
+        }
+    }
+
+    /// The shared cache if it is already connected; never connects.
+    pub fn current() -> Option<Arc<AtspiFocusCache>> {
+        SHARED
+            .try_lock()
+            .ok()
+            .and_then(|slot| slot.cache.clone())
+            .filter(|cache| cache.is_alive())
+    }
+
+    /// The focused element, kept current by events.
+    pub fn focused(&self) -> Option<FocusedTarget> {
+        self.focused.read().clone()
+    }
+
+    /// The shared accessibility bus connection, for callers that still need
+    /// discovery.
+    pub fn connection(&self) -> &zbus::Connection {
+        self.conn.connection()
+    }
+
+    /// Drop the cached element after one of its proxies failed (e.g. the
+    /// application exited); the next focus event repopulates it.
+    pub fn invalidate(&self) {
+        self.focused.write().take();
+    }
+
+    pub fn is_alive(&self) -> bool {
+        self.alive.load(Ordering::Acquire)
+    }
+
+    async fn connect() -> Result<Arc<Self>, String> {
+        let conn = AccessibilityConnection::new()
+            .await
+            .map_err(|e| format!("AT-SPI connect failed: {e}"))?;
+        conn.register_event::<StateChangedEvent>()
+            .await
+            .map_err(|e| format!("Subscribing to focus events failed: {e}"))?;
+        conn.register_event::<ActivateEvent>()
+            .await
+            .map_err(|e| format!("Subscribing to window events failed: {e}"))?;
+
+        let cache = Arc::new(Self {
+            conn,
+            focused: RwLock::new(None),
+            alive: AtomicBool::new(true),
+        });
+        tokio::spawn(cache.clone().watch());
+        debug!("AT-SPI focus cache connected");
+        Ok(cache)
+    }
+
+    /// Follow focus and activation events until the connection drops.
+    async fn watch(self: Arc<Self>) {
+        // Cleared on return and when the runtime drops the task
+        struct Alive<'a>(&'a AtomicBool);
+        impl Drop for Alive<'_> {
+            fn drop(&mut self) {
+                self.0.store(false, Ordering::Release);
+            }
+        }
+        let _alive = Alive(&self.alive);
+
+        let events = self.conn.event_stream();
+        tokio::pin!(events);
+        self.refresh().await;
+
+        while let Some(event) = events.next().await {
+            let event: Event = match event {
+                Ok(event) => event,
+                Err(e) => {
+                    trace!("Ignoring undecodable AT-SPI event: {}", e);
+                    continue;
+                }
+            };
+            if let Ok(changed) = StateChangedEvent::try_from(event.clone()) {
+                if changed.state != State::Focused {
+                    continue;
+                }
+                if changed.enabled {
+                    self.track(&changed.item).await;
+                } else {
+                    self.forget(&changed.item);
+                }
+            } else if ActivateEvent::try_from(event).is_ok() {
+                // The element focused inside the new window may not emit a
+                // state change of its own
+                self.refresh().await;
+            }
+        }
+        warn!("AT-SPI event stream ended; focus cache disabled until reconnect");
+    }
+
+    async fn track(&self, item: &ObjectRef) {
+        let Some(app) = item.name().map(|name| name.to_string()) else {
+            return;
+        };
+        let path = item.path().to_string();
+        let resolved = time::timeout(
+            RESOLVE_TIMEOUT,
+            FocusedTarget::resolve(self.connection(), app.clone(), path.clone()),
+        )
+        .await;
+        match resolved {
+            Ok(Ok(target)) => {
+                trace!(
+                    "AT-SPI focus moved to {} {} (editable: {})",
+                    target.app,
+                    target.path,
+                    target.editable
+                );
+                *self.focused.write() = Some(target);
+            }
+            Ok(Err(e)) => {
+                debug!("Failed to resolve focused element {} {}: {}", app, path, e);
+                self.invalidate();
+            }
+            Err(_) => {
+                debug!("Resolving focused element {} {} timed out", app, path);
+                self.invalidate();
+            }
+        }
+    }
+
+    fn forget(&self, item: &ObjectRef) {
+        let mut focused = self.focused.write();
+        let matches = focused.as_ref().is_some_and(|target| {
+            item.path().as_str() == target.path
+                && item.name().is_some_and(|name| name.as_str() == target.app)
+        });
+        if matches {
+            focused.take();
+        }
+    }
+
+    /// Look the focused element up once through `Collection` (at startup and
+    /// on window activation).
+    async fn refresh(&self) {
+        let lookup = async {
+            let collection = CollectionProxy::builder(self.connection())
+                .destination("org.a11y.atspi.Registry")?
+                .path("/org/a11y/atspi/accessible/root")?
+                .build()
+                .await?;
+            let mut rule = ObjectMatchRule::default();
+            rule.states = State::Focused.into();
+            rule.states_mt = MatchType::All;
+            collection
+                .get_matches(rule, SortOrder::Canonical, 1, false)
+                .await
+        };
+        match time::timeout(RESOLVE_TIMEOUT, lookup).await {
+            Ok(Ok(mut matches)) => match matches.pop() {
+                Some(item) => self.track(&item).await,
+                None => self.invalidate(),
+            },
+            Ok(Err(e)) => debug!("AT-SPI focus refresh failed: {}", e),
+            Err(_) => debug!("AT-SPI focus refresh timed out"),
+        }
+    }
+}
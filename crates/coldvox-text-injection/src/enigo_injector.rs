@@ -74,6 +74,44 @@ impl EnigoInjector {
         }
     }
 
+    /// Send `edit` as one batch: backspaces for the removed span, then the
+    /// new text, in a single blocking task.
+    async fn send_edit(&self, edit: &crate::incremental::TextEdit) -> Result<(), InjectionError> {
+        let backspaces = edit.delete_graphemes;
+        let insert = edit.insert.clone();
+
+        let result = tokio::task::spawn_blocking(move || {
+            let mut enigo = Enigo::new(&Settings::default()).map_err(|e| {
+                InjectionError::MethodFailed(format!("Failed to create Enigo: {}", e))
+            })?;
+            for _ in 0..backspaces {
+                enigo.key(Key::Backspace, Direction::Click).map_err(|e| {
+                    InjectionError::MethodFailed(format!("Failed to type backspace: {}", e))
+                })?;
+            }
+            if !insert.is_empty() {
+                enigo.text(&insert).map_err(|e| {
+                    InjectionError::MethodFailed(format!("Failed to type text: {}", e))
+                })?;
+            }
+            Ok(())
+        })
+        .await;
+
+        match result {
+            Ok(Ok(())) => {
+                debug!(
+                    "Applied edit via enigo ({} backspaces, {} chars)",
+                    backspaces,
+                    edit.insert.len()
+                );
+                Ok(())
+            }
+            Ok(Err(e)) => Err(e),
+            Err(_) => Err(InjectionError::Timeout(0)), // Spawn failed
+        }
+    }
+
     /// Trigger paste action using enigo (Ctrl+V)
     async fn trigger_paste(&self) -> Result<(), InjectionError> {
         let result = tokio::task::spawn_blocking(|| {
@@ -164,6 +202,15 @@ impl TextInjector for EnigoInjector {
         }
     }
 
+    async fn apply_edit(&self, edit: &crate::incremental::TextEdit) -> InjectionResult<()> {
+        if !self.is_available().await {
+            return Err(InjectionError::MethodNotAvailable(
+                "Enigo is not enabled".to_string(),
+            ));
+        }
+        self.send_edit(edit).await
+    }
+
     fn backend_info(&self) -> Vec<(&'static str, String)> {
         vec![
             ("type", "synthetic input".to_string()),
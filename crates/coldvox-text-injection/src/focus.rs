@@ -90,8 +90,15 @@ pub struct SystemFocusAdapter;
 #[async_trait]
 impl FocusBackend for SystemFocusAdapter {
     async fn query_focus(&self) -> Result<FocusStatus, InjectionError> {
-        // Temporarily disabled due to AT-SPI API changes
-        // TODO(#38): Update to work with current atspi crate API
+        // Answered from the event-driven focus cache; no D-Bus round trips
+        #[cfg(feature = "atspi")]
+        if let Some(cache) = crate::atspi_focus::AtspiFocusCache::shared().await {
+            return Ok(match cache.focused() {
+                Some(target) if target.editable => FocusStatus::EditableText,
+                Some(_) => FocusStatus::NonEditable,
+                None => FocusStatus::Unknown,
+            });
+        }
         Ok(FocusStatus::Unknown)
     }
 }
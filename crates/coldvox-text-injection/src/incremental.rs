@@ -0,0 +1,386 @@
+//! # Incremental injection of partial transcripts
+//!
+//! With `InjectionConfig::incremental_partials` the processor types partial
+//! transcripts while the user speaks instead of waiting for the final text.
+//! [`IncrementalTyper`] remembers what the current utterance has already put
+//! in the field and turns each newer transcript into a minimal [`TextEdit`]:
+//! delete the differing tail before the caret, insert the new tail. Updates
+//! arriving between two processor ticks are coalesced, so each tick applies
+//! at most one edit per utterance.
+
+use std::collections::VecDeque;
+use std::time::Instant;
+use unicode_segmentation::UnicodeSegmentation;
+
+/// Replace the text just before the caret.
+#[derive(Debug, Clone, Default, PartialEq, Eq)]
+pub struct TextEdit {
+    /// Characters (Unicode scalar values) to delete before the caret, for
+    /// offset-based backends such as AT-SPI `EditableText`.
+    pub delete_chars: usize,
+    /// The same span in grapheme clusters, i.e. the number of backspaces.
+    pub delete_graphemes: usize,
+    /// Text to insert at the caret after deleting.
+    pub insert: String,
+}
+
+impl TextEdit {
+    /// Minimal edit turning `typed` into `target`: keep the longest common
+    /// grapheme prefix, rewrite the rest.
+    pub fn between(typed: &str, target: &str) -> Self {
+        let prefix = typed
+            .grapheme_indices(true)
+            .zip(target.grapheme_indices(true))
+            .take_while(|((_, a), (_, b))| a == b)
+            .last()
+            .map(|((i, g), _)| i + g.len())
+            .unwrap_or(0);
+        let removed = &typed[prefix..];
+        Self {
+            delete_chars: removed.chars().count(),
+            delete_graphemes: removed.graphemes(true).count(),
+            insert: target[prefix..].to_string(),
+        }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.delete_chars == 0 && self.insert.is_empty()
+    }
+}
+
+/// Next step for the processor.
+#[derive(Debug, Clone)]
+pub struct PendingEdit {
+    pub utterance_id: u64,
+    pub edit: TextEdit,
+    /// Field content for this utterance once the edit is applied.
+    pub target: String,
+    /// Whether `target` is the utterance's final text.
+    pub is_final: bool,
+    /// Incremental editing failed in this utterance; finish it through the
+    /// regular path instead: delete what `edit` removes, then inject
+    /// `edit.insert`, the part of the final not yet typed.
+    pub fallback: bool,
+    /// App resolved at the utterance's first applied edit.
+    pub app_id: Option<String>,
+    /// When the final transcript arrived (finals only).
+    pub final_at: Option<Instant>,
+}
+
+#[derive(Debug)]
+struct Update {
+    utterance_id: u64,
+    text: String,
+    is_final: bool,
+    received_at: Instant,
+}
+
+/// Tracks what the current utterance has typed and what it should show.
+#[derive(Debug, Default)]
+pub struct IncrementalTyper {
+    /// Utterance whose text is currently in the field.
+    utterance_id: Option<u64>,
+    /// Text that utterance has put in the field. Failed edits are assumed
+    /// to have left it unchanged.
+    typed: String,
+    /// An edit failed; later partials are skipped until the final.
+    broken: bool,
+    app_id: Option<String>,
+    /// Fallback for a final whose edit failed, returned by the next call to
+    /// [`next_edit`](Self::next_edit).
+    retry: Option<PendingEdit>,
+    /// Latest transcript per utterance not yet applied, oldest first.
+    queue: VecDeque<Update>,
+}
+
+impl IncrementalTyper {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Queue a transcript. A partial replaces an earlier unapplied partial of
+    /// the same utterance; finals are never dropped.
+    pub fn update(&mut self, utterance_id: u64, text: &str, is_final: bool) {
+        let text = text.to_string();
+        if let Some(last) = self.queue.back_mut() {
+            if last.utterance_id == utterance_id && !last.is_final {
+                last.text = text;
+                last.is_final = is_final;
+                last.received_at = Instant::now();
+                return;
+            }
+        }
+        self.queue.push_back(Update {
+            utterance_id,
+            text,
+            is_final,
+            received_at: Instant::now(),
+        });
+    }
+
+    /// Whether updates are waiting to be applied.
+    pub fn has_pending(&self) -> bool {
+        self.retry.is_some() || !self.queue.is_empty()
+    }
+
+    /// The next edit to apply, or `None` when the field is up to date.
+    pub fn next_edit(&mut self) -> Option<PendingEdit> {
+        if let Some(retry) = self.retry.take() {
+            return Some(retry);
+        }
+        while let Some(update) = self.queue.pop_front() {
+            if self.utterance_id != Some(update.utterance_id) {
+                self.start(update.utterance_id);
+            }
+            let final_at = update.is_final.then_some(update.received_at);
+
+            if self.broken {
+                if update.is_final {
+                    let retry = self.fallback(update.utterance_id, update.text, final_at);
+                    self.finish();
+                    if !retry.edit.is_empty() {
+                        return Some(retry);
+                    }
+                }
+                continue;
+            }
+
+            let edit = TextEdit::between(&self.typed, &update.text);
+            if edit.is_empty() && !update.is_final {
+                continue;
+            }
+            return Some(PendingEdit {
+                utterance_id: update.utterance_id,
+                edit,
+                target: update.text,
+                is_final: update.is_final,
+                fallback: false,
+                app_id: self.app_id.clone(),
+                final_at,
+            });
+        }
+        None
+    }
+
+    /// Record an applied edit.
+    pub fn applied(&mut self, pending: &PendingEdit, app_id: Option<String>) {
+        if self.utterance_id != Some(pending.utterance_id) {
+            return;
+        }
+        if pending.is_final {
+            self.finish();
+        } else {
+            self.typed.clone_from(&pending.target);
+            if app_id.is_some() {
+                self.app_id = app_id;
+            }
+        }
+    }
+
+    /// Record a failed edit. Later partials of the utterance are skipped and
+    /// its final goes through the regular path, completing the text already
+    /// typed rather than repeating it, so the final is never dropped. A
+    /// failed fallback is not retried. Returns whether a fallback for the
+    /// final was queued.
+    pub fn failed(&mut self, pending: &PendingEdit) -> bool {
+        if pending.fallback || self.utterance_id != Some(pending.utterance_id) {
+            return false;
+        }
+        if !pending.is_final {
+            self.broken = true;
+            return false;
+        }
+        let retry = self.fallback(
+            pending.utterance_id,
+            pending.target.clone(),
+            pending.final_at,
+        );
+        self.finish();
+        if retry.edit.is_empty() {
+            return false;
+        }
+        self.retry = Some(retry);
+        true
+    }
+
+    /// Forget the current utterance and anything queued.
+    pub fn clear(&mut self) {
+        self.queue.clear();
+        self.retry = None;
+        self.finish();
+    }
+
+    /// Text the current utterance has typed so far.
+    pub fn typed(&self) -> &str {
+        &self.typed
+    }
+
+    fn start(&mut self, utterance_id: u64) {
+        self.utterance_id = Some(utterance_id);
+        self.typed.clear();
+        self.broken = false;
+        self.app_id = None;
+    }
+
+    fn finish(&mut self) {
+        self.utterance_id = None;
+        self.typed.clear();
+        self.broken = false;
+        self.app_id = None;
+    }
+
+    /// Regular injection of what the final adds to the text already typed.
+    fn fallback(&self, utterance_id: u64, text: String, final_at: Option<Instant>) -> PendingEdit {
+        PendingEdit {
+            utterance_id,
+            edit: TextEdit::between(&self.typed, &text),
+            target: text,
+            is_final: true,
+            fallback: true,
+            app_id: self.app_id.clone(),
+            final_at,
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Field text after `edit` is applied at the end of `field`.
+    fn apply(field: &mut String, edit: &TextEdit) {
+        for _ in 0..edit.delete_chars {
+            field.pop();
+        }
+        field.push_str(&edit.insert);
+    }
+
+    #[test]
+    fn edit_rewrites_only_the_changed_tail() {
+        let edit = TextEdit::between("hello word", "hello world today");
+        assert_eq!(edit.delete_chars, 1);
+        assert_eq!(edit.insert, "ld today");
+
+        let edit = TextEdit::between("", "hi");
+        assert_eq!((edit.delete_chars, edit.insert.as_str()), (0, "hi"));
+        assert!(TextEdit::between("same", "same").is_empty());
+
+        let edit = TextEdit::between("two words", "two");
+        assert_eq!((edit.delete_chars, edit.insert.as_str()), (6, ""));
+    }
+
+    #[test]
+    fn edit_counts_graphemes_for_backspaces() {
+        // "é" as e + combining acute: two chars, one backspace
+        let edit = TextEdit::between("cafe\u{301}", "cafe");
+        assert_eq!(edit.delete_chars, 2);
+        assert_eq!(edit.delete_graphemes, 1);
+        assert_eq!(edit.insert, "e");
+    }
+
+    #[test]
+    fn partials_coalesce_and_finals_reset() {
+        let mut typer = IncrementalTyper::new();
+        typer.update(1, "hel", false);
+        typer.update(1, "hello wor", false);
+
+        let first = typer.next_edit().unwrap();
+        assert_eq!(first.edit.insert, "hello wor");
+        assert!(typer.next_edit().is_none());
+        typer.applied(&first, Some("kate".to_string()));
+        assert_eq!(typer.typed(), "hello wor");
+
+        typer.update(1, "hello world", true);
+        let last = typer.next_edit().unwrap();
+        assert!(last.is_final);
+        assert_eq!(last.edit.insert, "ld");
+        assert_eq!(last.app_id.as_deref(), Some("kate"));
+        typer.applied(&last, None);
+        assert_eq!(typer.typed(), "");
+
+        // A final is never overwritten by the next utterance's partial
+        typer.update(2, "one", true);
+        typer.update(3, "two", false);
+        assert_eq!(typer.next_edit().unwrap().target, "one");
+        assert_eq!(typer.next_edit().unwrap().target, "two");
+    }
+
+    #[test]
+    fn failure_skips_partials_and_falls_back_on_final() {
+        let mut typer = IncrementalTyper::new();
+        typer.update(7, "dictated", false);
+        let edit = typer.next_edit().unwrap();
+        typer.failed(&edit);
+
+        typer.update(7, "dictated text", false);
+        assert!(typer.next_edit().is_none());
+        typer.update(7, "dictated text.", true);
+        let fallback = typer.next_edit().unwrap();
+        assert!(fallback.fallback && fallback.is_final);
+        let mut field = String::new();
+        apply(&mut field, &fallback.edit);
+        assert_eq!(field, "dictated text.");
+
+        // Text typed before the failure is completed, not repeated
+        let mut field = String::new();
+        typer.update(8, "a", false);
+        let edit = typer.next_edit().unwrap();
+        apply(&mut field, &edit.edit);
+        typer.applied(&edit, None);
+        typer.update(8, "ab", false);
+        let edit = typer.next_edit().unwrap();
+        typer.failed(&edit);
+        typer.update(8, "abc", true);
+        let fallback = typer.next_edit().unwrap();
+        assert!(fallback.fallback);
+        apply(&mut field, &fallback.edit);
+        assert_eq!(field, "abc");
+        // A failed fallback is not retried
+        assert!(!typer.failed(&fallback));
+        assert!(typer.next_edit().is_none());
+    }
+
+    #[test]
+    fn failed_final_edit_completes_typed_text() {
+        let mut typer = IncrementalTyper::new();
+        let mut field = String::new();
+        typer.update(3, "hello", false);
+        let edit = typer.next_edit().unwrap();
+        apply(&mut field, &edit.edit);
+        typer.applied(&edit, Some("kate".to_string()));
+
+        typer.update(3, "hello world", true);
+        let last = typer.next_edit().unwrap();
+        assert_eq!(last.edit.insert, " world");
+        assert!(typer.failed(&last));
+
+        let fallback = typer.next_edit().unwrap();
+        assert!(fallback.fallback && fallback.is_final);
+        assert_eq!(fallback.app_id.as_deref(), Some("kate"));
+        assert_eq!(fallback.final_at, last.final_at);
+        apply(&mut field, &fallback.edit);
+        assert_eq!(field, "hello world");
+        assert!(typer.next_edit().is_none());
+
+        // A typed tail the final revised is deleted before the rest goes in
+        let mut field = String::new();
+        typer.update(4, "hello word", false);
+        let edit = typer.next_edit().unwrap();
+        apply(&mut field, &edit.edit);
+        typer.applied(&edit, Some("kate".to_string()));
+        typer.update(4, "hello world", true);
+        let last = typer.next_edit().unwrap();
+        assert!(typer.failed(&last));
+        let fallback = typer.next_edit().unwrap();
+        assert_eq!(fallback.edit.delete_chars, 1);
+        apply(&mut field, &fallback.edit);
+        assert_eq!(field, "hello world");
+    }
+
+    #[test]
+    fn transcript_whitespace_is_kept() {
+        let mut typer = IncrementalTyper::new();
+        typer.update(1, "line one\n  indented", true);
+        assert_eq!(typer.next_edit().unwrap().target, "line one\n  indented");
+    }
+}
@@ -59,25 +59,37 @@ impl AtspiInjector {
 
         #[cfg(feature = "atspi")]
         {
+            use crate::atspi_focus::AtspiFocusCache;
             use atspi::{
-                connection::AccessibilityConnection, proxy::collection::CollectionProxy,
-                proxy::editable_text::EditableTextProxy, proxy::text::TextProxy, Interface,
-                MatchType, ObjectMatchRule, SortOrder, State,
+                proxy::collection::CollectionProxy, proxy::editable_text::EditableTextProxy,
+                proxy::text::TextProxy, Interface, MatchType, ObjectMatchRule, SortOrder, State,
             };
             use tokio::time;
 
             let per_method_timeout = self.config.per_method_timeout();
 
-            // Connect to AT-SPI
-            let conn = time::timeout(per_method_timeout, AccessibilityConnection::new())
-                .await
-                .map_err(|_| InjectionError::Timeout(per_method_timeout.as_millis() as u64))?
-                .map_err(|e| {
-                    log_atspi_connection_failure(&e.to_string());
-                    InjectionError::Other(format!("AT-SPI connect failed: {e}"))
-                })?;
+            // Fast path: proxies for the focused element are kept ready by focus events
+            let shared = AtspiFocusCache::shared().await;
+            if let Some(cache) = shared.as_ref() {
+                if let Some(target) = cache.focused().filter(|target| target.editable) {
+                    match target.insert_at_caret(text, per_method_timeout).await {
+                        Ok(()) => {
+                            self.finish_insert(text, context, start_time).await;
+                            return Ok(());
+                        }
+                        Err(e) => {
+                            debug!(
+                                "Cached AT-SPI target {} failed ({}); falling back to discovery",
+                                target.path, e
+                            );
+                            cache.invalidate();
+                        }
+                    }
+                }
+            }
 
-            let zbus_conn = conn.connection();
+            let conn = self.bus_connection(shared.as_deref()).await?;
+            let zbus_conn = &conn;
             trace!("AT-SPI connection established for insert_text");
 
             // Find focused element (pre-warming not currently implemented for AT-SPI objects)
@@ -200,41 +212,8 @@ impl AtspiInjector {
                     InjectionError::Other(format!("EditableText.insert_text failed: {e}"))
                 })?;
 
-            let elapsed = start_time.elapsed();
-
-            // Log successful insertion
-            utils::log_injection_success(
-                InjectionMethod::AtspiInsert,
-                text,
-                elapsed,
-                self.config.redact_logs,
-            );
-
-            debug!(
-                "Successfully inserted {} chars via AT-SPI to {:?} in {}ms",
-                text.len(),
-                obj_ref.name(),
-                elapsed.as_millis()
-            );
-
-            // Confirm insertion if needed
-            if let Some(ref target) = context.target_app {
-                let window = context.window_id.as_deref().unwrap_or("unknown");
-                if let Ok(result) = self
-                    .confirmation_context
-                    .confirm_injection(target, text, window)
-                    .await
-                {
-                    match result {
-                        crate::confirm::ConfirmationResult::Success => {
-                            debug!("AT-SPI insertion confirmed via text change event");
-                        }
-                        _ => {
-                            debug!("AT-SPI insertion confirmation failed or timed out");
-                        }
-                    }
-                }
-            }
+            debug!("Inserted via AT-SPI discovery into {:?}", obj_ref.name());
+            self.finish_insert(text, context, start_time).await;
 
             Ok(())
         }
@@ -263,10 +242,10 @@ impl AtspiInjector {
 
         #[cfg(feature = "atspi")]
         {
+            use crate::atspi_focus::AtspiFocusCache;
             use atspi::{
-                connection::AccessibilityConnection, proxy::action::ActionProxy,
-                proxy::collection::CollectionProxy, Interface, MatchType, ObjectMatchRule,
-                SortOrder, State,
+                proxy::action::ActionProxy, proxy::collection::CollectionProxy, Interface,
+                MatchType, ObjectMatchRule, SortOrder, State,
             };
             use tokio::time;
 
@@ -275,16 +254,9 @@ impl AtspiInjector {
             // First, set the clipboard content
             self.set_clipboard_content(text).await?;
 
-            // Connect to AT-SPI
-            let conn = time::timeout(per_method_timeout, AccessibilityConnection::new())
-                .await
-                .map_err(|_| InjectionError::Timeout(per_method_timeout.as_millis() as u64))?
-                .map_err(|e| {
-                    log_atspi_connection_failure(&e.to_string());
-                    InjectionError::Other(format!("AT-SPI connect failed: {e}"))
-                })?;
-
-            let zbus_conn = conn.connection();
+            let shared = AtspiFocusCache::shared().await;
+            let conn = self.bus_connection(shared.as_deref()).await?;
+            let zbus_conn = &conn;
             trace!("AT-SPI connection established for paste_text");
 
             // Find focused element (pre-warming not currently implemented for AT-SPI objects)
@@ -443,6 +415,69 @@ impl AtspiInjector {
 
     /// Set clipboard content for paste operations
     #[allow(dead_code)]
+    /// Bus connection for discovery: the focus cache's when connected,
+    /// otherwise a one-off connection.
+    #[cfg(feature = "atspi")]
+    async fn bus_connection(
+        &self,
+        shared: Option<&crate::atspi_focus::AtspiFocusCache>,
+    ) -> InjectionResult<zbus::Connection> {
+        use atspi::connection::AccessibilityConnection;
+        use tokio::time;
+
+        if let Some(cache) = shared {
+            return Ok(cache.connection().clone());
+        }
+        let per_method_timeout = self.config.per_method_timeout();
+        let conn = time::timeout(per_method_timeout, AccessibilityConnection::new())
+            .await
+            .map_err(|_| InjectionError::Timeout(per_method_timeout.as_millis() as u64))?
+            .map_err(|e| {
+                log_atspi_connection_failure(&e.to_string());
+                InjectionError::Other(format!("AT-SPI connect failed: {e}"))
+            })?;
+        Ok(conn.connection().clone())
+    }
+
+    /// Log a successful insertion and confirm it if the caller asked to.
+    #[cfg(feature = "atspi")]
+    async fn finish_insert(&self, text: &str, context: &InjectionContext, start_time: Instant) {
+        let elapsed = start_time.elapsed();
+
+        // Log successful insertion
+        utils::log_injection_success(
+            InjectionMethod::AtspiInsert,
+            text,
+            elapsed,
+            self.config.redact_logs,
+        );
+
+        debug!(
+            "Successfully inserted {} chars via AT-SPI in {}ms",
+            text.len(),
+            elapsed.as_millis()
+        );
+
+        // Confirm insertion if needed
+        if let Some(ref target) = context.target_app {
+            let window = context.window_id.as_deref().unwrap_or("unknown");
+            if let Ok(result) = self
+                .confirmation_context
+                .confirm_injection(target, text, window)
+                .await
+            {
+                match result {
+                    crate::confirm::ConfirmationResult::Success => {
+                        debug!("AT-SPI insertion confirmed via text change event");
+                    }
+                    _ => {
+                        debug!("AT-SPI insertion confirmation failed or timed out");
+                    }
+                }
+            }
+        }
+    }
+
     async fn set_clipboard_content(&self, text: &str) -> InjectionResult<()> {
         #[cfg(feature = "wl_clipboard")]
         {
@@ -588,12 +623,13 @@ impl TextInjector for AtspiInjector {
     async fn is_available(&self) -> bool {
         #[cfg(feature = "atspi")]
         {
-            use atspi::connection::AccessibilityConnection;
+            use crate::atspi_focus::AtspiFocusCache;
             use tokio::time;
 
             let timeout_duration = self.config.per_method_timeout();
 
-            let availability_check = async { AccessibilityConnection::new().await.is_ok() };
+            // Connects the shared focus cache, so the first injection finds it ready
+            let availability_check = async { AtspiFocusCache::shared().await.is_some() };
 
             match time::timeout(timeout_duration, availability_check).await {
                 Ok(is_ok) => {
@@ -620,6 +656,45 @@ impl TextInjector for AtspiInjector {
         }
     }
 
+    async fn apply_edit(&self, edit: &crate::incremental::TextEdit) -> InjectionResult<()> {
+        #[cfg(feature = "atspi")]
+        {
+            use crate::atspi_focus::AtspiFocusCache;
+
+            // Only with a cached, editable target: discovery per partial would
+            // cost more than the edit saves
+            let Some(cache) = AtspiFocusCache::shared().await else {
+                return Err(InjectionError::MethodNotAvailable(
+                    "AT-SPI focus cache unavailable".to_string(),
+                ));
+            };
+            let Some(target) = cache.focused().filter(|target| target.editable) else {
+                return Err(InjectionError::MethodNotAvailable(
+                    "No cached editable AT-SPI target".to_string(),
+                ));
+            };
+            let result = target
+                .replace_before_caret(
+                    edit.delete_chars,
+                    &edit.insert,
+                    self.config.per_method_timeout(),
+                )
+                .await;
+            if result.is_err() {
+                cache.invalidate();
+            }
+            result
+        }
+
+        #[cfg(not(feature = "atspi"))]
+        {
+            let _ = edit;
+            Err(InjectionError::MethodNotAvailable(
+                "AT-SPI feature is disabled at compile time".to_string(),
+            ))
+        }
+    }
+
     async fn inject_text(
         &self,
         text: &str,
@@ -5,6 +5,8 @@
 //! performs the injection, and then restores the original clipboard content.
 //! Optional Klipper cleanup is available behind a feature flag.
 
+#[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+use super::clipboard_owner::ClipboardOwner;
 use crate::detection::{detect_display_protocol, DisplayProtocol};
 use crate::logging::utils;
 use crate::types::{InjectionConfig, InjectionContext, InjectionMethod, InjectionResult};
@@ -235,6 +237,14 @@ impl ClipboardInjector {
         let start_time = Instant::now();
         trace!("Reading clipboard content for backup");
 
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if let Some(owner) = ClipboardOwner::shared() {
+            match owner.read().await {
+                Ok(content) => return Ok(ClipboardBackup::new(content, "text/plain".to_string())),
+                Err(e) => debug!("In-process clipboard read failed, using helpers: {}", e),
+            }
+        }
+
         let backup = match self.backend_type {
             ClipboardBackend::Wayland => self.read_wayland_clipboard().await?,
             ClipboardBackend::X11 => self.read_x11_clipboard().await?,
@@ -670,6 +680,28 @@ impl ClipboardInjector {
         // Always read fresh clipboard for backup (no pre-warming support yet for clipboard content)
         // Pre-warming would need to store ClipboardBackup in InjectionContext.clipboard_backup
         let backup = self.read_clipboard().await?;
+        let restore_delay = self.config.clipboard_restore_delay_ms.unwrap_or(500);
+
+        // In-process owner: restore in the background as soon as the paste
+        // has been served, or after the delay where that cannot be detected
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if let Some(owner) = ClipboardOwner::shared() {
+            match owner.seed(text.as_bytes(), backup.content.clone()) {
+                Ok(pending) => {
+                    pending.arm();
+                    let paste_result = self.perform_paste().await;
+                    let fallback = if paste_result.is_ok() {
+                        Duration::from_millis(restore_delay)
+                    } else {
+                        Duration::ZERO
+                    };
+                    pending.restore_detached(fallback);
+                    paste_result?;
+                    return self.finish_injection(text, start_time).await;
+                }
+                Err(e) => debug!("In-process clipboard seed failed, using helpers: {}", e),
+            }
+        }
 
         // Seed clipboard with payload
         self.write_clipboard(text.as_bytes(), "text/plain").await?;
@@ -681,7 +713,6 @@ impl ClipboardInjector {
         self.perform_paste().await?;
 
         // Wait for paste to complete
-        let restore_delay = self.config.clipboard_restore_delay_ms.unwrap_or(500);
         tokio::time::sleep(Duration::from_millis(restore_delay)).await;
 
         // Always restore clipboard backup
@@ -689,6 +720,11 @@ impl ClipboardInjector {
             warn!("Failed to restore clipboard: {}", e);
         }
 
+        self.finish_injection(text, start_time).await
+    }
+
+    /// Klipper cleanup and logging shared by both seeding paths
+    async fn finish_injection(&self, text: &str, start_time: Instant) -> InjectionResult<()> {
         // Optional Klipper cleanup if enabled
         #[cfg(feature = "kdotool")]
         {
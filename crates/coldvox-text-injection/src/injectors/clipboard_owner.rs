@@ -0,0 +1,1178 @@
+//! Persistent in-process clipboard owner
+//!
+//! Seeding the clipboard through `wl-copy`/`xclip` costs a fork/exec per
+//! injection, and restoring it relied on fixed sleeps. The owner keeps one
+//! display server connection per process and serves paste requests from
+//! memory: on Wayland through the wlr data-control protocol, on X11 by owning
+//! the `CLIPBOARD` selection. On X11 it can tell the focused application's
+//! paste request from a clipboard manager's, so callers restore the user's
+//! clipboard as soon as the paste target has read the payload, with
+//! `clipboard_restore_delay_ms` only as an upper bound. Wayland data-control
+//! does not say who asked, so consumption detection is unsupported there and
+//! the restore always waits for that delay. Either way the restore runs on a
+//! detached task ([`PendingPaste::restore_detached`]), so injection never
+//! waits for it.
+
+use crate::detection::{detect_display_protocol, DisplayProtocol};
+use crate::types::InjectionResult;
+use coldvox_foundation::error::InjectionError;
+use parking_lot::Mutex;
+use std::sync::{Arc, OnceLock};
+use std::time::{Duration, Instant};
+use tokio::sync::oneshot;
+use tracing::{debug, warn};
+
+/// Text formats offered to paste targets, most specific first. The X11 names
+/// are included because XWayland bridges selections using them.
+const TEXT_MIME_TYPES: [&str; 5] = [
+    "text/plain;charset=utf-8",
+    "UTF8_STRING",
+    "text/plain",
+    "STRING",
+    "TEXT",
+];
+
+/// Upper bound for reading a selection owned by another client.
+const READ_TIMEOUT: Duration = Duration::from_millis(500);
+
+/// Wait before retrying a failed connection; doubles up to `RETRY_MAX`.
+const RETRY_MIN: Duration = Duration::from_secs(1);
+const RETRY_MAX: Duration = Duration::from_secs(60);
+
+/// Who asked for the selection contents.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum Requestor {
+    /// The application that had focus when the paste was sent.
+    PasteTarget,
+    /// A clipboard manager or another client, or a requestor the backend
+    /// cannot identify.
+    Other,
+}
+
+/// How a seeded payload left the clipboard.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Consumed {
+    /// The paste target's request was served after the paste keystroke was
+    /// sent.
+    Served,
+    /// Another client (or a newer seed) took the selection; restoring the
+    /// backup would clobber it.
+    Replaced,
+    /// No paste request arrived within the fallback delay.
+    TimedOut,
+}
+
+/// Selection currently owned by this process.
+struct Owned {
+    id: u64,
+    content: Arc<[u8]>,
+    /// Clipboard contents to put back once a seeded payload is consumed.
+    restores_to: Option<Arc<[u8]>>,
+    /// Set just before the paste keystroke; only the paste target's requests
+    /// from then on count as the paste.
+    armed: bool,
+    notify: Option<oneshot::Sender<Consumed>>,
+}
+
+impl Owned {
+    fn finish(mut self, outcome: Consumed) {
+        if let Some(notify) = self.notify.take() {
+            let _ = notify.send(outcome);
+        }
+    }
+}
+
+/// Ownership state shared between callers and the backend's event thread.
+#[derive(Default)]
+struct Selection {
+    next_id: u64,
+    current: Option<Owned>,
+}
+
+impl Selection {
+    /// Record ownership of `content`; a still-pending seed is reported replaced.
+    fn own(
+        &mut self,
+        content: Arc<[u8]>,
+        restores_to: Option<Arc<[u8]>>,
+        notify: Option<oneshot::Sender<Consumed>>,
+    ) -> u64 {
+        self.next_id += 1;
+        let owned = Owned {
+            id: self.next_id,
+            content,
+            restores_to,
+            armed: false,
+            notify,
+        };
+        if let Some(previous) = self.current.replace(owned) {
+            previous.finish(Consumed::Replaced);
+        }
+        self.next_id
+    }
+
+    fn current_id(&self) -> Option<u64> {
+        self.current.as_ref().map(|owned| owned.id)
+    }
+
+    fn content(&self, id: u64) -> Option<Arc<[u8]>> {
+        self.current
+            .as_ref()
+            .filter(|owned| owned.id == id)
+            .map(|owned| owned.content.clone())
+    }
+
+    /// What a backup taken now should restore: the user's clipboard, even
+    /// while a seeded payload is still waiting to be consumed.
+    fn backup(&self) -> Option<Arc<[u8]>> {
+        self.current
+            .as_ref()
+            .map(|owned| owned.restores_to.clone().unwrap_or(owned.content.clone()))
+    }
+
+    fn arm(&mut self, id: u64) {
+        if let Some(owned) = self.current.as_mut().filter(|owned| owned.id == id) {
+            owned.armed = true;
+        }
+    }
+
+    /// A paste request for `id` was answered. Clipboard managers snapshot the
+    /// selection whenever it changes, possibly after the paste keystroke, so
+    /// their requests never complete the paste.
+    fn served(&mut self, id: u64, requestor: Requestor) {
+        if let Some(owned) = self.current.as_mut().filter(|owned| owned.id == id) {
+            if owned.armed && requestor == Requestor::PasteTarget {
+                if let Some(notify) = owned.notify.take() {
+                    let _ = notify.send(Consumed::Served);
+                }
+            }
+        }
+    }
+
+    /// The display server handed the selection for `id` to another client.
+    fn lost(&mut self, id: u64) {
+        if self.current_id() == Some(id) {
+            if let Some(owned) = self.current.take() {
+                owned.finish(Consumed::Replaced);
+            }
+        }
+    }
+
+    fn clear(&mut self) {
+        if let Some(owned) = self.current.take() {
+            owned.finish(Consumed::Replaced);
+        }
+    }
+}
+
+/// Display-server specific half of the owner.
+trait Backend: Send + Sync {
+    /// Announce the current selection (`Some`) or drop ownership (`None`).
+    /// Returns once the server has processed the request, so a paste sent
+    /// afterwards sees the new contents.
+    fn publish(&self, id: Option<u64>) -> Result<(), String>;
+
+    /// Read text from a selection owned by another client. An empty clipboard
+    /// reads as empty content.
+    fn read_foreign(&self) -> Result<Vec<u8>, String>;
+}
+
+/// Backoff between attempts to connect the shared owner.
+struct Retry {
+    delay: Duration,
+    next: Option<Instant>,
+}
+
+impl Retry {
+    const fn new() -> Self {
+        Self {
+            delay: RETRY_MIN,
+            next: None,
+        }
+    }
+
+    fn due(&self, now: Instant) -> bool {
+        match self.next {
+            Some(next) => now >= next,
+            None => true,
+        }
+    }
+
+    /// Record a failed attempt; returns the wait before the next one.
+    fn failed(&mut self, now: Instant) -> Duration {
+        let wait = self.delay;
+        self.next = Some(now + wait);
+        self.delay = (wait * 2).min(RETRY_MAX);
+        wait
+    }
+}
+
+/// Process-wide clipboard owner backed by a persistent display connection.
+pub struct ClipboardOwner {
+    selection: Arc<Mutex<Selection>>,
+    backend: Box<dyn Backend>,
+}
+
+static SHARED: OnceLock<ClipboardOwner> = OnceLock::new();
+/// Serializes connection attempts and spaces out retries.
+static RETRY: Mutex<Retry> = Mutex::new(Retry::new());
+
+impl ClipboardOwner {
+    /// Owner for the detected display server, connected on first use. `None`
+    /// when no in-process backend works here (e.g. a compositor without
+    /// data-control, or a display server that is not up yet); callers then
+    /// fall back to helper commands. Failed connections are retried with
+    /// backoff.
+    pub fn shared() -> Option<&'static ClipboardOwner> {
+        if let Some(owner) = SHARED.get() {
+            return Some(owner);
+        }
+        let mut retry = RETRY.lock();
+        // Another caller may have connected while we waited for the lock
+        if let Some(owner) = SHARED.get() {
+            return Some(owner);
+        }
+        let now = Instant::now();
+        if !retry.due(now) {
+            return None;
+        }
+        let selection = Arc::new(Mutex::new(Selection::default()));
+        match connect(detect_display_protocol(), &selection) {
+            Ok(backend) => Some(SHARED.get_or_init(|| ClipboardOwner { selection, backend })),
+            Err(e) => {
+                let wait = retry.failed(now);
+                debug!(
+                    "In-process clipboard owner unavailable, using helper commands (retry in {:?}): {e}",
+                    wait
+                );
+                None
+            }
+        }
+    }
+
+    /// Read the clipboard as text.
+    pub async fn read(&'static self) -> InjectionResult<Vec<u8>> {
+        if let Some(content) = self.selection.lock().backup() {
+            return Ok(content.to_vec());
+        }
+        let read = tokio::task::spawn_blocking(move || self.backend.read_foreign());
+        match tokio::time::timeout(READ_TIMEOUT, read).await {
+            Ok(Ok(result)) => result.map_err(InjectionError::Clipboard),
+            Ok(Err(e)) => Err(InjectionError::Other(format!(
+                "Clipboard read task failed: {e}"
+            ))),
+            Err(_) => Err(InjectionError::Timeout(READ_TIMEOUT.as_millis() as u64)),
+        }
+    }
+
+    /// Put `payload` on the clipboard, remembering `backup` to restore once
+    /// the paste has been served.
+    pub fn seed(&'static self, payload: &[u8], backup: Vec<u8>) -> InjectionResult<PendingPaste> {
+        let (notify, consumed) = oneshot::channel();
+        let backup: Arc<[u8]> = backup.into();
+        let id = self
+            .selection
+            .lock()
+            .own(payload.into(), Some(backup.clone()), Some(notify));
+        if let Err(e) = self.backend.publish(Some(id)) {
+            self.selection.lock().lost(id);
+            return Err(InjectionError::Clipboard(e));
+        }
+        Ok(PendingPaste {
+            owner: self,
+            id,
+            backup,
+            consumed,
+        })
+    }
+
+    /// Serve `content` from now on; empty content clears the clipboard.
+    pub fn write(&self, content: &[u8]) -> InjectionResult<()> {
+        let id = if content.is_empty() {
+            self.selection.lock().clear();
+            None
+        } else {
+            Some(self.selection.lock().own(content.into(), None, None))
+        };
+        self.backend.publish(id).map_err(InjectionError::Clipboard)
+    }
+}
+
+/// A payload seeded by [`ClipboardOwner::seed`] that has not been restored yet.
+pub struct PendingPaste {
+    owner: &'static ClipboardOwner,
+    id: u64,
+    backup: Arc<[u8]>,
+    consumed: oneshot::Receiver<Consumed>,
+}
+
+impl PendingPaste {
+    /// Count paste requests from now on. Call right before sending the paste
+    /// keystroke.
+    pub fn arm(&self) {
+        self.owner.selection.lock().arm(self.id);
+    }
+
+    /// Wait until the payload is pasted (at most `fallback`), then restore the
+    /// backup unless another client has taken the clipboard meanwhile.
+    pub async fn restore_when_consumed(self, fallback: Duration) -> Consumed {
+        let outcome = match tokio::time::timeout(fallback, self.consumed).await {
+            Ok(Ok(outcome)) => outcome,
+            Ok(Err(_)) => Consumed::Replaced,
+            Err(_) => Consumed::TimedOut,
+        };
+        if outcome == Consumed::Replaced
+            || self.owner.selection.lock().current_id() != Some(self.id)
+        {
+            return Consumed::Replaced;
+        }
+        if let Err(e) = self.owner.write(&self.backup) {
+            warn!("Failed to restore clipboard in-process: {}", e);
+        }
+        outcome
+    }
+
+    /// Run [`Self::restore_when_consumed`] on its own task so the caller can
+    /// return as soon as the paste keystroke is sent. A later seed taking the
+    /// clipboard first reports this one replaced and restores the same backup.
+    pub fn restore_detached(self, fallback: Duration) -> tokio::task::JoinHandle<Consumed> {
+        tokio::spawn(async move {
+            let outcome = self.restore_when_consumed(fallback).await;
+            debug!("In-process clipboard restore finished ({:?})", outcome);
+            outcome
+        })
+    }
+}
+
+fn connect(
+    protocol: DisplayProtocol,
+    selection: &Arc<Mutex<Selection>>,
+) -> Result<Box<dyn Backend>, String> {
+    #[cfg(feature = "wl_clipboard")]
+    if protocol == DisplayProtocol::Wayland {
+        match wayland::WaylandBackend::connect(selection.clone()) {
+            Ok(backend) => {
+                debug!("In-process clipboard owner connected via Wayland data-control");
+                return Ok(Box::new(backend));
+            }
+            // GNOME lacks data-control; XWayland bridges its X11 selections
+            Err(e) if std::env::var_os("DISPLAY").is_some() => {
+                debug!("Wayland clipboard owner unavailable ({e}), trying XWayland")
+            }
+            Err(e) => return Err(e),
+        }
+    }
+    #[cfg(feature = "x11_clipboard")]
+    if protocol != DisplayProtocol::Unknown {
+        let backend = x11::X11Backend::connect(selection.clone())?;
+        debug!("In-process clipboard owner connected via X11 selections");
+        return Ok(Box::new(backend));
+    }
+    Err(format!("no in-process clipboard backend for {protocol:?}"))
+}
+
+#[cfg(feature = "wl_clipboard")]
+mod wayland {
+    use super::{Backend, Requestor, Selection, TEXT_MIME_TYPES};
+    use parking_lot::Mutex;
+    use std::io::{Read, Write};
+    use std::os::fd::AsFd;
+    use std::sync::Arc;
+    use tracing::{debug, warn};
+    use wayland_client::globals::{registry_queue_init, GlobalListContents};
+    use wayland_client::protocol::{wl_registry::WlRegistry, wl_seat::WlSeat};
+    use wayland_client::{
+        delegate_noop, event_created_child, Connection, Dispatch, Proxy, QueueHandle,
+    };
+    use wayland_protocols_wlr::data_control::v1::client::{
+        zwlr_data_control_device_v1::{self, ZwlrDataControlDeviceV1},
+        zwlr_data_control_manager_v1::ZwlrDataControlManagerV1,
+        zwlr_data_control_offer_v1::{self, ZwlrDataControlOfferV1},
+        zwlr_data_control_source_v1::{self, ZwlrDataControlSourceV1},
+    };
+
+    /// MIME types advertised by an offer.
+    type OfferMimes = Mutex<Vec<String>>;
+
+    struct State {
+        selection: Arc<Mutex<Selection>>,
+        /// Latest selection offer, which may be our own source.
+        offer: Arc<Mutex<Option<ZwlrDataControlOfferV1>>>,
+    }
+
+    pub(super) struct WaylandBackend {
+        conn: Connection,
+        qh: QueueHandle<State>,
+        manager: ZwlrDataControlManagerV1,
+        device: ZwlrDataControlDeviceV1,
+        offer: Arc<Mutex<Option<ZwlrDataControlOfferV1>>>,
+    }
+
+    impl WaylandBackend {
+        pub(super) fn connect(selection: Arc<Mutex<Selection>>) -> Result<Self, String> {
+            let conn =
+                Connection::connect_to_env().map_err(|e| format!("Wayland connect failed: {e}"))?;
+            let (globals, mut queue) = registry_queue_init::<State>(&conn)
+                .map_err(|e| format!("Wayland registry failed: {e}"))?;
+            let qh = queue.handle();
+            let manager: ZwlrDataControlManagerV1 = globals
+                .bind(&qh, 1..=2, ())
+                .map_err(|e| format!("Compositor lacks wlr data-control: {e}"))?;
+            let seat: WlSeat = globals
+                .bind(&qh, 1..=8, ())
+                .map_err(|e| format!("No Wayland seat: {e}"))?;
+            let device = manager.get_data_device(&seat, &qh, ());
+
+            let offer = Arc::new(Mutex::new(None));
+            let mut state = State {
+                selection,
+                offer: offer.clone(),
+            };
+            // Pick up the current selection before the first read
+            queue
+                .roundtrip(&mut state)
+                .map_err(|e| format!("Wayland roundtrip failed: {e}"))?;
+
+            std::thread::Builder::new()
+                .name("coldvox-clipboard".to_string())
+                .spawn(move || {
+                    loop {
+                        if let Err(e) = queue.blocking_dispatch(&mut state) {
+                            warn!("Wayland clipboard connection lost: {}", e);
+                            break;
+                        }
+                    }
+                    state.selection.lock().clear();
+                })
+                .map_err(|e| format!("Failed to spawn clipboard thread: {e}"))?;
+
+            Ok(Self {
+                conn,
+                qh,
+                manager,
+                device,
+                offer,
+            })
+        }
+    }
+
+    impl Backend for WaylandBackend {
+        fn publish(&self, id: Option<u64>) -> Result<(), String> {
+            match id {
+                Some(id) => {
+                    let source = self.manager.create_data_source(&self.qh, id);
+                    for mime in TEXT_MIME_TYPES {
+                        source.offer(mime.to_string());
+                    }
+                    self.device.set_selection(Some(&source));
+                }
+                None => self.device.set_selection(None),
+            }
+            self.conn
+                .roundtrip()
+                .map(|_| ())
+                .map_err(|e| format!("Wayland roundtrip failed: {e}"))
+        }
+
+        fn read_foreign(&self) -> Result<Vec<u8>, String> {
+            let Some(offer) = self.offer.lock().clone() else {
+                return Ok(Vec::new());
+            };
+            let mime = offer
+                .data::<OfferMimes>()
+                .and_then(|mimes| {
+                    let mimes = mimes.lock();
+                    TEXT_MIME_TYPES
+                        .into_iter()
+                        .find(|text| mimes.iter().any(|mime| mime.as_str() == *text))
+                })
+                .ok_or_else(|| "Clipboard holds no text".to_string())?;
+
+            let (mut reader, writer) =
+                std::io::pipe().map_err(|e| format!("Failed to create pipe: {e}"))?;
+            offer.receive(mime.to_string(), writer.as_fd());
+            // The owner writes to its copy of the fd; ours must close for EOF
+            drop(writer);
+            self.conn
+                .flush()
+                .map_err(|e| format!("Wayland flush failed: {e}"))?;
+
+            let mut content = Vec::new();
+            reader
+                .read_to_end(&mut content)
+                .map_err(|e| format!("Failed to read clipboard data: {e}"))?;
+            Ok(content)
+        }
+    }
+
+    impl Dispatch<ZwlrDataControlSourceV1, u64> for State {
+        fn event(
+            state: &mut Self,
+            source: &ZwlrDataControlSourceV1,
+            event: zwlr_data_control_source_v1::Event,
+            id: &u64,
+            _conn: &Connection,
+            _qh: &QueueHandle<Self>,
+        ) {
+            match event {
+                zwlr_data_control_source_v1::Event::Send { fd, .. } => {
+                    let Some(content) = state.selection.lock().content(*id) else {
+                        return;
+                    };
+                    match std::fs::File::from(fd).write_all(&content) {
+                        // Data-control does not identify the requestor, so a
+                        // paste cannot be told from a clipboard manager's read
+                        // and the restore falls back to its delay
+                        Ok(()) => state.selection.lock().served(*id, Requestor::Other),
+                        Err(e) => debug!("Paste target closed clipboard pipe early: {}", e),
+                    }
+                }
+                zwlr_data_control_source_v1::Event::Cancelled => {
+                    state.selection.lock().lost(*id);
+                    source.destroy();
+                }
+                _ => {}
+            }
+        }
+    }
+
+    impl Dispatch<ZwlrDataControlDeviceV1, ()> for State {
+        fn event(
+            state: &mut Self,
+            _device: &ZwlrDataControlDeviceV1,
+            event: zwlr_data_control_device_v1::Event,
+            _data: &(),
+            _conn: &Connection,
+            _qh: &QueueHandle<Self>,
+        ) {
+            match event {
+                zwlr_data_control_device_v1::Event::Selection { id } => {
+                    if let Some(previous) = std::mem::replace(&mut *state.offer.lock(), id) {
+                        previous.destroy();
+                    }
+                }
+                zwlr_data_control_device_v1::Event::PrimarySelection { id: Some(offer) } => {
+                    offer.destroy();
+                }
+                zwlr_data_control_device_v1::Event::Finished => {
+                    state.selection.lock().clear();
+                }
+                _ => {}
+            }
+        }
+
+        event_created_child!(State, ZwlrDataControlDeviceV1, [
+            zwlr_data_control_device_v1::EVT_DATA_OFFER_OPCODE => (ZwlrDataControlOfferV1, OfferMimes::default()),
+        ]);
+    }
+
+    impl Dispatch<ZwlrDataControlOfferV1, OfferMimes> for State {
+        fn event(
+            _state: &mut Self,
+            _offer: &ZwlrDataControlOfferV1,
+            event: zwlr_data_control_offer_v1::Event,
+            mimes: &OfferMimes,
+            _conn: &Connection,
+            _qh: &QueueHandle<Self>,
+        ) {
+            if let zwlr_data_control_offer_v1::Event::Offer { mime_type } = event {
+                mimes.lock().push(mime_type);
+            }
+        }
+    }
+
+    impl Dispatch<WlRegistry, GlobalListContents> for State {
+        fn event(
+            _state: &mut Self,
+            _registry: &WlRegistry,
+            _event: <WlRegistry as Proxy>::Event,
+            _data: &GlobalListContents,
+            _conn: &Connection,
+            _qh: &QueueHandle<Self>,
+        ) {
+        }
+    }
+
+    delegate_noop!(State: ignore WlSeat);
+    delegate_noop!(State: ZwlrDataControlManagerV1);
+}
+
+#[cfg(feature = "x11_clipboard")]
+mod x11 {
+    use super::{Backend, Requestor, Selection, READ_TIMEOUT};
+    use parking_lot::Mutex;
+    use std::sync::{mpsc, Arc};
+    use tracing::{debug, warn};
+    use x11rb::connection::Connection;
+    use x11rb::protocol::xproto::{
+        AtomEnum, ConnectionExt as _, CreateWindowAux, EventMask, InputFocus, PropMode,
+        SelectionNotifyEvent, SelectionRequestEvent, Timestamp, Window, WindowClass,
+        SELECTION_NOTIFY_EVENT,
+    };
+    use x11rb::protocol::Event;
+    use x11rb::rust_connection::RustConnection;
+    use x11rb::wrapper::ConnectionExt as _;
+    use x11rb::{COPY_DEPTH_FROM_PARENT, COPY_FROM_PARENT, CURRENT_TIME, NONE};
+
+    x11rb::atom_manager! {
+        Atoms: AtomsCookie {
+            CLIPBOARD,
+            TARGETS,
+            TIMESTAMP,
+            UTF8_STRING,
+            TEXT,
+            INCR,
+            TEXT_PLAIN: b"text/plain",
+            TEXT_PLAIN_UTF8: b"text/plain;charset=utf-8",
+            COLDVOX_CLIPBOARD,
+            COLDVOX_TIMESTAMP,
+        }
+    }
+
+    fn x11_err(e: impl std::fmt::Display) -> String {
+        format!("X11 clipboard: {e}")
+    }
+
+    /// Whether two resource ids were allocated by the same client connection.
+    pub(super) fn same_client(a: u32, b: u32, resource_id_mask: u32) -> bool {
+        a & !resource_id_mask == b & !resource_id_mask
+    }
+
+    type ReadResult = Result<Vec<u8>, String>;
+
+    struct Shared {
+        conn: RustConnection,
+        window: Window,
+        atoms: Atoms,
+        selection: Arc<Mutex<Selection>>,
+        /// Reader waiting for the `SelectionNotify` of its conversion request.
+        pending_read: Mutex<Option<mpsc::Sender<ReadResult>>>,
+        /// Caller waiting for the `PropertyNotify` that carries the server time.
+        pending_time: Mutex<Option<mpsc::Sender<Timestamp>>>,
+        /// Server time at which we last took the selection.
+        owned_since: Mutex<Timestamp>,
+    }
+
+    pub(super) struct X11Backend {
+        shared: Arc<Shared>,
+        /// One conversion in flight at a time; they share a property.
+        read_lock: Mutex<()>,
+        /// One server time query in flight at a time.
+        time_lock: Mutex<()>,
+    }
+
+    impl X11Backend {
+        pub(super) fn connect(selection: Arc<Mutex<Selection>>) -> Result<Self, String> {
+            let (conn, screen_num) = x11rb::connect(None).map_err(x11_err)?;
+            let root = conn.setup().roots[screen_num].root;
+            let window = conn.generate_id().map_err(x11_err)?;
+            conn.create_window(
+                COPY_DEPTH_FROM_PARENT,
+                window,
+                root,
+                0,
+                0,
+                1,
+                1,
+                0,
+                WindowClass::INPUT_OUTPUT,
+                COPY_FROM_PARENT,
+                &CreateWindowAux::new().event_mask(EventMask::PROPERTY_CHANGE),
+            )
+            .map_err(x11_err)?;
+            let atoms = Atoms::new(&conn)
+                .map_err(x11_err)?
+                .reply()
+                .map_err(x11_err)?;
+
+            let shared = Arc::new(Shared {
+                conn,
+                window,
+                atoms,
+                selection,
+                pending_read: Mutex::new(None),
+                pending_time: Mutex::new(None),
+                owned_since: Mutex::new(CURRENT_TIME),
+            });
+            let events = shared.clone();
+            std::thread::Builder::new()
+                .name("coldvox-clipboard".to_string())
+                .spawn(move || {
+                    loop {
+                        match events.conn.wait_for_event() {
+                            Ok(event) => events.handle(event),
+                            Err(e) => {
+                                warn!("X11 clipboard connection lost: {}", e);
+                                break;
+                            }
+                        }
+                    }
+                    events.selection.lock().clear();
+                })
+                .map_err(|e| format!("Failed to spawn clipboard thread: {e}"))?;
+
+            Ok(Self {
+                shared,
+                read_lock: Mutex::new(()),
+                time_lock: Mutex::new(()),
+            })
+        }
+
+        /// Current server time. ICCCM forbids `CurrentTime` for selection
+        /// requests; a zero-length append to a property on our window yields a
+        /// `PropertyNotify` stamped with the server time.
+        fn server_time(&self) -> Result<Timestamp, String> {
+            let _guard = self.time_lock.lock();
+            let shared = &self.shared;
+            let (waiter, time) = mpsc::channel();
+            *shared.pending_time.lock() = Some(waiter);
+            shared
+                .conn
+                .change_property8(
+                    PropMode::APPEND,
+                    shared.window,
+                    shared.atoms.COLDVOX_TIMESTAMP,
+                    AtomEnum::STRING,
+                    &[],
+                )
+                .map_err(x11_err)?;
+            shared.conn.flush().map_err(x11_err)?;
+            time.recv_timeout(READ_TIMEOUT)
+                .map_err(|_| "Timed out waiting for the X11 server time".to_string())
+        }
+    }
+
+    impl Shared {
+        fn handle(&self, event: Event) {
+            match event {
+                Event::SelectionRequest(request) => {
+                    if let Err(e) = self.serve(&request) {
+                        debug!("Failed to answer X11 selection request: {}", e);
+                    }
+                }
+                Event::SelectionClear(clear) if clear.selection == self.atoms.CLIPBOARD => {
+                    let mut selection = self.selection.lock();
+                    if let Some(id) = selection.current_id() {
+                        selection.lost(id);
+                    }
+                }
+                Event::SelectionNotify(notify) => {
+                    let result = self.fetch(notify.property);
+                    if let Some(reader) = self.pending_read.lock().take() {
+                        let _ = reader.send(result);
+                    }
+                }
+                Event::PropertyNotify(notify)
+                    if notify.window == self.window
+                        && notify.atom == self.atoms.COLDVOX_TIMESTAMP =>
+                {
+                    if let Some(waiter) = self.pending_time.lock().take() {
+                        let _ = waiter.send(notify.time);
+                    }
+                }
+                _ => {}
+            }
+        }
+
+        fn is_text_target(&self, target: u32) -> bool {
+            let atoms = &self.atoms;
+            [
+                atoms.UTF8_STRING,
+                atoms.TEXT_PLAIN_UTF8,
+                atoms.TEXT_PLAIN,
+                atoms.TEXT,
+                AtomEnum::STRING.into(),
+            ]
+            .contains(&target)
+        }
+
+        /// Whether `requestor` belongs to the client with input focus, i.e. the
+        /// application the paste keystroke went to.
+        fn requestor(&self, requestor: Window) -> Requestor {
+            let focus = match self.conn.get_input_focus().map(|cookie| cookie.reply()) {
+                Ok(Ok(reply)) => reply.focus,
+                _ => return Requestor::Other,
+            };
+            let mask = self.conn.setup().resource_id_mask;
+            if focus != NONE
+                && focus != u32::from(InputFocus::POINTER_ROOT)
+                && same_client(requestor, focus, mask)
+            {
+                Requestor::PasteTarget
+            } else {
+                Requestor::Other
+            }
+        }
+
+        fn serve(&self, request: &SelectionRequestEvent) -> Result<(), String> {
+            let atoms = &self.atoms;
+            // Obsolete clients leave the property unset and expect the target
+            let property = if request.property == NONE {
+                request.target
+            } else {
+                request.property
+            };
+            let owned_since = *self.owned_since.lock();
+            let mut served = None;
+
+            let reply_property = if request.selection != atoms.CLIPBOARD
+                || (request.time != CURRENT_TIME && request.time < owned_since)
+            {
+                // Not ours, or asked for a selection we did not own yet
+                NONE
+            } else if request.target == atoms.TARGETS {
+                let targets = [
+                    atoms.TARGETS,
+                    atoms.TIMESTAMP,
+                    atoms.UTF8_STRING,
+                    atoms.TEXT_PLAIN_UTF8,
+                    atoms.TEXT_PLAIN,
+                    AtomEnum::STRING.into(),
+                    atoms.TEXT,
+                ];
+                self.conn
+                    .change_property32(
+                        PropMode::REPLACE,
+                        request.requestor,
+                        property,
+                        AtomEnum::ATOM,
+                        &targets,
+                    )
+                    .map_err(x11_err)?;
+                property
+            } else if request.target == atoms.TIMESTAMP {
+                self.conn
+                    .change_property32(
+                        PropMode::REPLACE,
+                        request.requestor,
+                        property,
+                        AtomEnum::INTEGER,
+                        &[owned_since],
+                    )
+                    .map_err(x11_err)?;
+                property
+            } else if self.is_text_target(request.target) {
+                let selection = self.selection.lock();
+                match selection.current.as_ref() {
+                    // Large payloads would need the INCR protocol; dictated text never does
+                    Some(owned) if owned.content.len() < self.conn.maximum_request_bytes() / 2 => {
+                        self.conn
+                            .change_property8(
+                                PropMode::REPLACE,
+                                request.requestor,
+                                property,
+                                request.target,
+                                &owned.content,
+                            )
+                            .map_err(x11_err)?;
+                        served = Some(owned.id);
+                        property
+                    }
+                    _ => NONE,
+                }
+            } else {
+                NONE
+            };
+
+            let notify = SelectionNotifyEvent {
+                response_type: SELECTION_NOTIFY_EVENT,
+                sequence: 0,
+                time: request.time,
+                requestor: request.requestor,
+                selection: request.selection,
+                target: request.target,
+                property: reply_property,
+            };
+            self.conn
+                .send_event(false, request.requestor, EventMask::NO_EVENT, notify)
+                .map_err(x11_err)?;
+            self.conn.flush().map_err(x11_err)?;
+
+            if let Some(id) = served {
+                let requestor = self.requestor(request.requestor);
+                self.selection.lock().served(id, requestor);
+            }
+            Ok(())
+        }
+
+        /// Read the converted selection from our window.
+        fn fetch(&self, property: u32) -> ReadResult {
+            if property == NONE {
+                return Err("Clipboard owner refused UTF-8 conversion".to_string());
+            }
+            let reply = self
+                .conn
+                .get_property(true, self.window, property, AtomEnum::ANY, 0, u32::MAX / 4)
+                .map_err(x11_err)?
+                .reply()
+                .map_err(x11_err)?;
+            if reply.type_ == self.atoms.INCR {
+                return Err("Incremental clipboard transfers are not supported".to_string());
+            }
+            Ok(reply.value)
+        }
+    }
+
+    impl Backend for X11Backend {
+        fn publish(&self, id: Option<u64>) -> Result<(), String> {
+            let time = self.server_time()?;
+            let shared = &self.shared;
+            let owner = if id.is_some() { shared.window } else { NONE };
+            if id.is_some() {
+                *shared.owned_since.lock() = time;
+            }
+            shared
+                .conn
+                .set_selection_owner(owner, shared.atoms.CLIPBOARD, time)
+                .map_err(x11_err)?;
+            // The reply doubles as a round trip: the server has the new owner
+            let current = shared
+                .conn
+                .get_selection_owner(shared.atoms.CLIPBOARD)
+                .map_err(x11_err)?
+                .reply()
+                .map_err(x11_err)?
+                .owner;
+            if current != owner {
+                return Err("Another client holds the X11 clipboard".to_string());
+            }
+            Ok(())
+        }
+
+        fn read_foreign(&self) -> Result<Vec<u8>, String> {
+            let _guard = self.read_lock.lock();
+            let shared = &self.shared;
+            let owner = shared
+                .conn
+                .get_selection_owner(shared.atoms.CLIPBOARD)
+                .map_err(x11_err)?
+                .reply()
+                .map_err(x11_err)?
+                .owner;
+            if owner == NONE {
+                return Ok(Vec::new());
+            }
+
+            let time = self.server_time()?;
+            let (reader, result) = mpsc::channel();
+            *shared.pending_read.lock() = Some(reader);
+            shared
+                .conn
+                .convert_selection(
+                    shared.window,
+                    shared.atoms.CLIPBOARD,
+                    shared.atoms.UTF8_STRING,
+                    shared.atoms.COLDVOX_CLIPBOARD,
+                    time,
+                )
+                .map_err(x11_err)?;
+            shared.conn.flush().map_err(x11_err)?;
+            result
+                .recv_timeout(READ_TIMEOUT)
+                .map_err(|_| "Timed out reading X11 clipboard".to_string())?
+        }
+    }
+
+    #[cfg(test)]
+    mod tests {
+        use super::same_client;
+
+        #[test]
+        fn requestors_match_by_client_id_base() {
+            // Typical servers hand each client a 2^21 id range
+            let mask = 0x001f_ffff;
+            assert!(same_client(0x0340_0007, 0x0340_1a2b, mask));
+            assert!(!same_client(0x0340_0007, 0x0360_0007, mask));
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn seeded(selection: &mut Selection) -> (u64, oneshot::Receiver<Consumed>) {
+        let (notify, consumed) = oneshot::channel();
+        let id = selection.own(
+            Arc::from(&b"dictated"[..]),
+            Some(Arc::from(&b"original"[..])),
+            Some(notify),
+        );
+        (id, consumed)
+    }
+
+    /// Backend that records what it was asked to publish.
+    #[derive(Default)]
+    struct FakeBackend {
+        published: Arc<Mutex<Vec<Option<u64>>>>,
+    }
+
+    impl Backend for FakeBackend {
+        fn publish(&self, id: Option<u64>) -> Result<(), String> {
+            self.published.lock().push(id);
+            Ok(())
+        }
+
+        fn read_foreign(&self) -> Result<Vec<u8>, String> {
+            Ok(b"foreign".to_vec())
+        }
+    }
+
+    fn fake_owner() -> (&'static ClipboardOwner, Arc<Mutex<Vec<Option<u64>>>>) {
+        let backend = FakeBackend::default();
+        let published = backend.published.clone();
+        let owner = Box::leak(Box::new(ClipboardOwner {
+            selection: Arc::new(Mutex::new(Selection::default())),
+            backend: Box::new(backend),
+        }));
+        (owner, published)
+    }
+
+    #[test]
+    fn paste_requests_count_only_once_armed() {
+        let mut selection = Selection::default();
+        let (id, mut consumed) = seeded(&mut selection);
+
+        // The focused app reading the new selection before the keystroke
+        selection.served(id, Requestor::PasteTarget);
+        assert!(consumed.try_recv().is_err());
+
+        selection.arm(id);
+        selection.served(id, Requestor::PasteTarget);
+        assert_eq!(consumed.try_recv().unwrap(), Consumed::Served);
+        assert_eq!(selection.content(id).as_deref(), Some(&b"dictated"[..]));
+    }
+
+    #[test]
+    fn clipboard_manager_requests_never_complete_the_paste() {
+        let mut selection = Selection::default();
+        let (id, mut consumed) = seeded(&mut selection);
+
+        selection.arm(id);
+        // A slow clipboard manager snapshotting after the keystroke
+        selection.served(id, Requestor::Other);
+        assert!(consumed.try_recv().is_err());
+
+        selection.served(id, Requestor::PasteTarget);
+        assert_eq!(consumed.try_recv().unwrap(), Consumed::Served);
+    }
+
+    #[test]
+    fn losing_the_selection_reports_replaced() {
+        let mut selection = Selection::default();
+        let (id, mut consumed) = seeded(&mut selection);
+
+        // A stale id (an earlier source being cancelled) changes nothing
+        selection.lost(id - 1);
+        assert_eq!(selection.current_id(), Some(id));
+
+        selection.lost(id);
+        assert_eq!(consumed.try_recv().unwrap(), Consumed::Replaced);
+        assert!(selection.current_id().is_none());
+        assert!(selection.backup().is_none());
+    }
+
+    #[test]
+    fn backup_during_pending_seed_is_the_original_clipboard() {
+        let mut selection = Selection::default();
+        let (_, mut first) = seeded(&mut selection);
+        assert_eq!(selection.backup().as_deref(), Some(&b"original"[..]));
+
+        // A second injection before the first was pasted supersedes it
+        let backup = selection.backup();
+        let second = selection.own(Arc::from(&b"next"[..]), backup, None);
+        assert_eq!(first.try_recv().unwrap(), Consumed::Replaced);
+        assert_eq!(selection.backup().as_deref(), Some(&b"original"[..]));
+
+        // A plain write is its own backup
+        selection.own(Arc::from(&b"restored"[..]), None, None);
+        assert!(selection.content(second).is_none());
+        assert_eq!(selection.backup().as_deref(), Some(&b"restored"[..]));
+    }
+
+    #[test]
+    fn failed_connections_are_retried_with_backoff() {
+        let mut retry = Retry::new();
+        let start = Instant::now();
+        assert!(retry.due(start));
+
+        assert_eq!(retry.failed(start), RETRY_MIN);
+        assert!(!retry.due(start));
+        assert!(retry.due(start + RETRY_MIN));
+
+        let mut waits = Vec::new();
+        for _ in 0..8 {
+            waits.push(retry.failed(start));
+        }
+        assert_eq!(waits[0], RETRY_MIN * 2);
+        assert_eq!(*waits.last().unwrap(), RETRY_MAX);
+    }
+
+    #[tokio::test]
+    async fn restores_once_the_paste_target_has_read() {
+        let (owner, published) = fake_owner();
+        let pending = owner.seed(b"dictated", b"original".to_vec()).unwrap();
+        let id = pending.id;
+        pending.arm();
+
+        let restore = tokio::spawn(pending.restore_when_consumed(Duration::from_secs(30)));
+        owner.selection.lock().served(id, Requestor::Other);
+        owner.selection.lock().served(id, Requestor::PasteTarget);
+
+        let outcome = tokio::time::timeout(Duration::from_secs(5), restore)
+            .await
+            .expect("restore should not wait for the fallback")
+            .unwrap();
+        assert_eq!(outcome, Consumed::Served);
+        assert_eq!(owner.read().await.unwrap(), b"original");
+        assert_eq!(published.lock().len(), 2);
+    }
+
+    #[tokio::test]
+    async fn restores_after_the_fallback_without_a_paste_target_request() {
+        let (owner, published) = fake_owner();
+        let pending = owner.seed(b"dictated", b"original".to_vec()).unwrap();
+        pending.arm();
+        owner.selection.lock().served(pending.id, Requestor::Other);
+
+        let outcome = pending
+            .restore_when_consumed(Duration::from_millis(20))
+            .await;
+        assert_eq!(outcome, Consumed::TimedOut);
+        assert_eq!(owner.read().await.unwrap(), b"original");
+        assert_eq!(published.lock().len(), 2);
+    }
+
+    #[tokio::test]
+    async fn detached_restore_keeps_the_original_across_injections() {
+        let (owner, _) = fake_owner();
+        let first = owner.seed(b"first", b"original".to_vec()).unwrap();
+        first.arm();
+        let first = first.restore_detached(Duration::from_secs(30));
+
+        // The next dictation starts while the first restore is still pending
+        let backup = owner.read().await.unwrap();
+        assert_eq!(backup, b"original");
+        let second = owner.seed(b"second", backup).unwrap();
+        second.arm();
+        let second = second.restore_detached(Duration::from_millis(20));
+
+        assert_eq!(first.await.unwrap(), Consumed::Replaced);
+        assert_eq!(second.await.unwrap(), Consumed::TimedOut);
+        assert_eq!(owner.read().await.unwrap(), b"original");
+    }
+
+    #[tokio::test]
+    async fn replaced_clipboard_is_not_restored() {
+        let (owner, published) = fake_owner();
+        let pending = owner.seed(b"dictated", b"original".to_vec()).unwrap();
+        pending.arm();
+        // The user copied something before the paste was served
+        owner.selection.lock().lost(pending.id);
+
+        let outcome = pending.restore_when_consumed(Duration::from_secs(30)).await;
+        assert_eq!(outcome, Consumed::Replaced);
+        assert_eq!(owner.read().await.unwrap(), b"foreign");
+        assert_eq!(published.lock().len(), 1);
+    }
+}
@@ -6,6 +6,8 @@
 
 pub mod atspi;
 pub mod clipboard;
+#[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+pub mod clipboard_owner;
 pub mod unified_clipboard;
 
 // Re-export common types for convenience
@@ -4,6 +4,8 @@
 //! features from ClipboardInjector, ClipboardPasteInjector, and ComboClipboardYdotool.
 //! It supports both strict and best-effort injection modes with configurable behavior.
 
+#[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+use super::clipboard_owner::{ClipboardOwner, PendingPaste};
 use crate::detection::{detect_display_protocol, DisplayProtocol};
 use crate::logging::utils;
 use crate::types::{InjectionConfig, InjectionContext, InjectionMethod, InjectionResult};
@@ -65,6 +67,15 @@ pub enum ClipboardBackend {
     Unknown,
 }
 
+/// Clipboard seeded with the payload, waiting to be restored
+enum Seeded {
+    /// Served by the in-process owner, which reports when the paste was read
+    #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+    InProcess(PendingPaste),
+    /// Written by helper commands; restored after the configured delay
+    Helper(ClipboardBackup),
+}
+
 /// Unified clipboard-based text injector with configurable injection modes
 pub struct UnifiedClipboardInjector {
     /// Configuration for injection
@@ -226,6 +237,21 @@ impl UnifiedClipboardInjector {
         let start_time = Instant::now();
         trace!("Reading clipboard content for backup");
 
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if let Some(owner) = ClipboardOwner::shared() {
+            match owner.read().await {
+                Ok(content) => {
+                    debug!(
+                        "Read clipboard backup in-process in {}ms ({} bytes)",
+                        start_time.elapsed().as_millis(),
+                        content.len()
+                    );
+                    return Ok(ClipboardBackup::new(content, "text/plain".to_string()));
+                }
+                Err(e) => debug!("In-process clipboard read failed, using helpers: {}", e),
+            }
+        }
+
         let backup = match self.backend_type {
             ClipboardBackend::Wayland => self.read_wayland_clipboard().await?,
             ClipboardBackend::X11 => self.read_x11_clipboard().await?,
@@ -549,45 +575,81 @@ impl UnifiedClipboardInjector {
         }
     }
 
-    /// Schedule clipboard restoration with improved async handling
-    async fn schedule_clipboard_restore(&self, backup: Option<ClipboardBackup>) {
-        if let Some(backup) = backup {
-            let delay_ms = self.config.clipboard_restore_delay_ms.unwrap_or(500);
-            // Move only data needed into the task to avoid capturing &self
-            let content = backup.content.clone();
-            let content_len = content.len();
+    /// Seed the clipboard with `text`, preferring the in-process owner
+    async fn seed_clipboard(&self, text: &str, backup: ClipboardBackup) -> InjectionResult<Seeded> {
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if let Some(owner) = ClipboardOwner::shared() {
+            // Seeding returns once the server has the new selection, so no settle delay
+            match owner.seed(text.as_bytes(), backup.content.clone()) {
+                Ok(pending) => return Ok(Seeded::InProcess(pending)),
+                Err(e) => debug!("In-process clipboard seed failed, using helpers: {}", e),
+            }
+        }
 
-            tokio::spawn(async move {
-                tokio::time::sleep(Duration::from_millis(delay_ms)).await;
+        self.write_clipboard(text.as_bytes(), "text/plain").await?;
+        // Stabilize clipboard
+        tokio::time::sleep(Duration::from_millis(20)).await;
+        Ok(Seeded::Helper(backup))
+    }
 
-                // Restore clipboard content regardless of backend
+    /// Schedule clipboard restoration. In-process seeds are restored as soon as
+    /// the paste has been served (immediately if the paste failed); the
+    /// configured delay only bounds the wait.
+    fn schedule_clipboard_restore(&self, seeded: Seeded, pasted: bool) {
+        // Nothing will read the payload if the paste keystroke failed
+        let delay_ms = if pasted {
+            self.config.clipboard_restore_delay_ms.unwrap_or(500)
+        } else {
+            0
+        };
+        let backup = match seeded {
+            #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+            Seeded::InProcess(pending) => {
+                tokio::spawn(async move {
+                    let outcome = pending
+                        .restore_when_consumed(Duration::from_millis(delay_ms))
+                        .await;
+                    debug!("In-process clipboard restore finished ({:?})", outcome);
+                });
+                return;
+            }
+            Seeded::Helper(backup) => backup,
+        };
 
-                #[cfg(feature = "wl_clipboard")]
-                {
-                    use wl_clipboard_rs::copy::{MimeType, Options, Source};
-                    let src = Source::Bytes(content.clone().into_boxed_slice());
-                    let opts = Options::new();
-                    let _ = opts.copy(src, MimeType::Text);
-                    debug!(
-                        "Restored original clipboard via wl-clipboard ({} chars)",
-                        content_len
-                    );
-                }
+        // Move only data needed into the task to avoid capturing &self
+        let content = backup.content;
+        let content_len = content.len();
 
-                #[cfg(not(feature = "wl_clipboard"))]
-                {
-                    // Restore via command-line tools for X11/other backends without borrowing self
-                    let restored = Self::restore_clipboard_direct(content.clone()).await;
-                    match restored {
-                        Ok(_) => debug!(
-                            "Restored original clipboard via command-line ({} chars)",
-                            content_len
-                        ),
-                        Err(e) => warn!("Failed to restore clipboard: {}", e),
-                    }
+        tokio::spawn(async move {
+            tokio::time::sleep(Duration::from_millis(delay_ms)).await;
+
+            // Restore clipboard content regardless of backend
+
+            #[cfg(feature = "wl_clipboard")]
+            {
+                use wl_clipboard_rs::copy::{MimeType, Options, Source};
+                let src = Source::Bytes(content.clone().into_boxed_slice());
+                let opts = Options::new();
+                let _ = opts.copy(src, MimeType::Text);
+                debug!(
+                    "Restored original clipboard via wl-clipboard ({} chars)",
+                    content_len
+                );
+            }
+
+            #[cfg(not(feature = "wl_clipboard"))]
+            {
+                // Restore via command-line tools for X11/other backends without borrowing self
+                let restored = Self::restore_clipboard_direct(content.clone()).await;
+                match restored {
+                    Ok(_) => debug!(
+                        "Restored original clipboard via command-line ({} chars)",
+                        content_len
+                    ),
+                    Err(e) => warn!("Failed to restore clipboard: {}", e),
                 }
-            });
-        }
+            }
+        });
     }
 
     /// Helper to restore clipboard content without borrowing &self
@@ -669,16 +731,17 @@ impl UnifiedClipboardInjector {
         let backup = self.read_clipboard().await?;
 
         // Seed clipboard with payload
-        self.write_clipboard(text.as_bytes(), "text/plain").await?;
+        let seeded = self.seed_clipboard(text, backup).await?;
 
-        // Stabilize clipboard
-        tokio::time::sleep(Duration::from_millis(20)).await;
-
-        // Perform paste action
+        // Perform paste action; only requests from here on count as the paste
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if let Seeded::InProcess(pending) = &seeded {
+            pending.arm();
+        }
         let paste_result = self.perform_paste().await;
 
         // Schedule clipboard restoration (whether paste succeeded or not)
-        self.schedule_clipboard_restore(Some(backup)).await;
+        self.schedule_clipboard_restore(seeded, paste_result.is_ok());
 
         // Handle result based on injection mode
         match (self.injection_mode, paste_result) {
@@ -738,6 +801,11 @@ impl UnifiedClipboardInjector {
 
     /// Check if the injector backend is available
     pub async fn check_availability(&self) -> bool {
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if ClipboardOwner::shared().is_some() {
+            return true;
+        }
+
         match self.backend_type {
             ClipboardBackend::Wayland => {
                 // Try to read clipboard as a basic availability check
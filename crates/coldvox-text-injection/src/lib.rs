@@ -29,9 +29,11 @@ pub mod backend;
 pub mod compat;
 pub mod detection;
 pub mod focus;
+pub mod incremental;
 pub mod log_throttle;
 pub mod logging;
 pub mod manager;
+pub mod method_order;
 pub mod processor;
 pub mod session;
 pub mod types;
@@ -44,6 +46,10 @@ pub mod window_manager;
 // AT-SPI event confirmation module
 pub mod confirm;
 
+// Long-lived AT-SPI connection and event-driven focus cache
+#[cfg(feature = "atspi")]
+pub mod atspi_focus;
+
 // Pre-warming module for injection components
 pub mod prewarm;
 
@@ -132,6 +138,7 @@ pub mod noop_injector;
 pub use backend::Backend;
 pub use coldvox_foundation::error::InjectionError;
 pub use focus::{FocusProvider, FocusStatus};
+pub use incremental::TextEdit;
 pub use manager::StrategyManager;
 pub use processor::{AsyncInjectionProcessor, InjectionProcessor, ProcessorMetrics};
 pub use session::{InjectionSession, SessionConfig, SessionState};
@@ -161,6 +168,17 @@ pub trait TextInjector: Send + Sync {
 
     /// Get backend-specific configuration information
     fn backend_info(&self) -> Vec<(&'static str, String)>;
+
+    /// Delete the text described by `edit` before the caret and insert its
+    /// replacement (incremental injection of partial transcripts). Backends
+    /// that cannot edit around the caret keep this default.
+    async fn apply_edit(&self, edit: &incremental::TextEdit) -> InjectionResult<()> {
+        let _ = edit;
+        Err(InjectionError::MethodNotAvailable(format!(
+            "{} does not support incremental edits",
+            self.backend_name()
+        )))
+    }
 }
 
 // Re-export confirmation module components
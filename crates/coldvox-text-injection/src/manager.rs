@@ -2,6 +2,7 @@ use crate::backend::{Backend, BackendDetector};
 use crate::focus::{FocusProvider, FocusStatus, FocusTracker};
 use crate::log_throttle::LogThrottle;
 use crate::logging::utils as log_utils;
+use crate::method_order::{self, MethodOrder, MethodOrderTable};
 use crate::prewarm::PrewarmController;
 use crate::session::{InjectionSession, SessionState};
 use crate::types::{
@@ -9,8 +10,6 @@ use crate::types::{
 };
 use crate::TextInjector;
 
-/// Type alias for cached method ordering: (app_id, methods)
-type CachedMethodOrder = Option<(String, Vec<InjectionMethod>)>;
 use coldvox_foundation::error::InjectionError;
 
 // Import injectors
@@ -69,6 +68,39 @@ struct CooldownState {
     last_error: String,
 }
 
+/// Environment/config-derived method order before any history is applied.
+/// Clipboard paste is last among real methods; NoOp is appended by ranking.
+fn base_method_order(config: &InjectionConfig) -> Vec<InjectionMethod> {
+    use std::env;
+    let on_wayland = env::var("XDG_SESSION_TYPE")
+        .map(|s| s == "wayland")
+        .unwrap_or(false)
+        || env::var("WAYLAND_DISPLAY").is_ok();
+    let on_x11 = env::var("XDG_SESSION_TYPE")
+        .map(|s| s == "x11")
+        .unwrap_or(false)
+        || env::var("DISPLAY").is_ok();
+
+    let mut base_order = Vec::new();
+
+    // Prefer AT-SPI direct insert first when a desktop session is present
+    if on_wayland || on_x11 {
+        base_order.push(InjectionMethod::AtspiInsert);
+    }
+
+    // Optional, opt-in fallbacks
+    if config.allow_kdotool {
+        base_order.push(InjectionMethod::KdoToolAssist);
+    }
+    if config.allow_enigo {
+        base_order.push(InjectionMethod::EnigoText);
+    }
+
+    // Clipboard paste (with fallback) is intentionally last to avoid clipboard disruption unless needed
+    base_order.push(InjectionMethod::ClipboardPasteFallback);
+    base_order
+}
+
 /// Registry of available text injectors
 struct InjectorRegistry {
     injectors: HashMap<InjectionMethod, Arc<dyn TextInjector>>,
@@ -160,11 +192,11 @@ pub struct StrategyManager {
     /// Focus provider abstraction for determining target context
     focus_provider: Box<dyn FocusProvider>,
     /// Cache of success records per app-method combination
-    success_cache: Arc<Mutex<HashMap<AppMethodKey, SuccessRecord>>>,
+    success_cache: Arc<parking_lot::Mutex<HashMap<AppMethodKey, SuccessRecord>>>,
     /// Cooldown states per app-method combination
-    cooldowns: Arc<Mutex<HashMap<AppMethodKey, CooldownState>>>,
+    cooldowns: Arc<parking_lot::Mutex<HashMap<AppMethodKey, CooldownState>>>,
     /// Global start time for budget tracking
-    global_start: Arc<Mutex<Option<Instant>>>,
+    global_start: Arc<parking_lot::Mutex<Option<Instant>>>,
     /// Metrics for the strategy manager
     metrics: Arc<Mutex<InjectionMetrics>>,
     /// Backend detector for platform-specific capabilities
@@ -172,8 +204,8 @@ pub struct StrategyManager {
     backend_detector: BackendDetector,
     /// Registry of available injectors
     injectors: Arc<InjectorRegistry>,
-    /// Cached method ordering for the current app_id
-    cached_method_order: Arc<RwLock<CachedMethodOrder>>,
+    /// Per-app method ordering, updated on each success or failure
+    method_order: Arc<MethodOrderTable>,
     /// Cached compiled allowlist regex patterns
     #[cfg(feature = "regex")]
     allowlist_regexes: Vec<regex::Regex>,
@@ -269,13 +301,13 @@ impl StrategyManager {
         Self {
             config: config.clone(),
             focus_provider,
-            success_cache: Arc::new(Mutex::new(HashMap::new())),
-            cooldowns: Arc::new(Mutex::new(HashMap::new())),
-            global_start: Arc::new(Mutex::new(None)),
+            success_cache: Arc::new(parking_lot::Mutex::new(HashMap::new())),
+            cooldowns: Arc::new(parking_lot::Mutex::new(HashMap::new())),
+            global_start: Arc::new(parking_lot::Mutex::new(None)),
             metrics,
             backend_detector,
             injectors: Arc::new(injectors),
-            cached_method_order: Arc::new(RwLock::new(None)),
+            method_order: Arc::new(MethodOrderTable::new(base_method_order(&config))),
             #[cfg(feature = "regex")]
             allowlist_regexes,
             #[cfg(feature = "regex")]
@@ -295,12 +327,19 @@ impl StrategyManager {
     pub(crate) async fn get_current_app_id(&self) -> Result<String, InjectionError> {
         #[cfg(feature = "atspi")]
         {
+            use crate::atspi_focus::AtspiFocusCache;
             use atspi::{
-                connection::AccessibilityConnection, proxy::collection::CollectionProxy, MatchType,
-                ObjectMatchRule, SortOrder, State,
+                proxy::collection::CollectionProxy, MatchType, ObjectMatchRule, SortOrder, State,
             };
-            if let Ok(conn) = AccessibilityConnection::new().await {
-                let zbus_conn = conn.connection();
+
+            // Kept current by focus events, so usually no discovery is needed
+            let cache = AtspiFocusCache::shared().await;
+            if let Some(target) = cache.as_ref().and_then(|cache| cache.focused()) {
+                return Ok(target.app_id().to_string());
+            }
+
+            if let Some(cache) = cache {
+                let zbus_conn = cache.connection();
                 if let Ok(builder) = CollectionProxy::builder(zbus_conn)
                     .destination("org.a11y.atspi.Registry")
                     .and_then(|b| b.path("/org/a11y/atspi/accessible/root"))
@@ -473,22 +512,19 @@ impl StrategyManager {
     /// Check if a method is in cooldown for the current app
     pub(crate) fn is_in_cooldown(&self, method: InjectionMethod) -> bool {
         let now = Instant::now();
-        let cooldowns = self.cooldowns.lock().unwrap();
+        let cooldowns = self.cooldowns.lock();
         cooldowns
             .iter()
             .any(|((_, m), cd)| *m == method && now < cd.until)
     }
 
-    /// Update success record with time-based decay for old records
-    pub(crate) fn update_success_record(
-        &self,
-        app_id: &str,
-        method: InjectionMethod,
-        success: bool,
-    ) {
+    /// Update success record with time-based decay for old records.
+    /// Public only for `coldvox-app`'s pipeline benchmark; not part of the API.
+    #[doc(hidden)]
+    pub fn update_success_record(&self, app_id: &str, method: InjectionMethod, success: bool) {
         let key = (app_id.to_string(), method);
 
-        let mut success_cache = self.success_cache.lock().unwrap();
+        let mut success_cache = self.success_cache.lock();
         let record = success_cache
             .entry(key.clone())
             .or_insert_with(|| SuccessRecord {
@@ -528,16 +564,32 @@ impl StrategyManager {
             total
         );
 
+        drop(success_cache);
+
+        self.rerank(app_id);
         if should_cooldown {
             self.apply_cooldown(app_id, method, "Multiple consecutive failures");
         }
     }
 
+    /// Recompute the cached method order for `app_id` from its success
+    /// records. Runs under the success-record lock, so concurrent updates
+    /// publish in order.
+    fn rerank(&self, app_id: &str) {
+        let success_cache = self.success_cache.lock();
+        self.method_order.update(app_id, |m| {
+            success_cache
+                .get(&(app_id.to_string(), m))
+                .map(|r| r.success_rate)
+                .unwrap_or(0.5)
+        });
+    }
+
     /// Apply exponential backoff cooldown for a failed method
     pub(crate) fn apply_cooldown(&self, app_id: &str, method: InjectionMethod, error: &str) {
         let key = (app_id.to_string(), method);
 
-        let mut cooldowns = self.cooldowns.lock().unwrap();
+        let mut cooldowns = self.cooldowns.lock();
         let cooldown = cooldowns.entry(key).or_insert_with(|| CooldownState {
             until: Instant::now(),
             backoff_level: 0,
@@ -570,8 +622,7 @@ impl StrategyManager {
     /// Clear cooldown for a method (e.g., after successful use)
     fn clear_cooldown(&self, app_id: &str, method: InjectionMethod) {
         let key = (app_id.to_string(), method);
-        let mut cooldowns = self.cooldowns.lock().unwrap();
-        cooldowns.remove(&key);
+        self.cooldowns.lock().remove(&key);
     }
 
     /// Trigger pre-warming when session enters Buffering state
@@ -595,173 +646,27 @@ impl StrategyManager {
     /// Get ordered list of methods to try based on backend availability and success rates.
     /// Includes NoOp as a final fallback so the list is never empty.
     pub(crate) fn _get_method_priority(&self, app_id: &str) -> Vec<InjectionMethod> {
-        // Base order derived from environment first (robust when portals/VK are unavailable)
-        use std::env;
-        let on_wayland = env::var("XDG_SESSION_TYPE")
-            .map(|s| s == "wayland")
-            .unwrap_or(false)
-            || env::var("WAYLAND_DISPLAY").is_ok();
-        let on_x11 = env::var("XDG_SESSION_TYPE")
-            .map(|s| s == "x11")
-            .unwrap_or(false)
-            || env::var("DISPLAY").is_ok();
-
-        let mut base_order: Vec<InjectionMethod> = Vec::new();
-
-        if on_wayland {
-            // Prefer AT-SPI direct insert first on Wayland when available; delay clipboard paste to last.
-            base_order.push(InjectionMethod::AtspiInsert);
-        }
-
-        if on_x11 {
-            base_order.push(InjectionMethod::AtspiInsert);
-        }
-
-        // Optional, opt-in fallbacks
-        if self.config.allow_kdotool {
-            base_order.push(InjectionMethod::KdoToolAssist);
-        }
-        if self.config.allow_enigo {
-            base_order.push(InjectionMethod::EnigoText);
-        }
-
-        // Clipboard paste (with fallback) is intentionally last to avoid clipboard disruption unless needed
-        base_order.push(InjectionMethod::ClipboardPasteFallback);
-
-        // Deduplicate while preserving order
-        use std::collections::HashSet;
-        let mut seen = HashSet::new();
-        base_order.retain(|m| seen.insert(*m));
-
-        // Sort primarily by base order; use historical success rate only as a tiebreaker
-        let base_order_copy = base_order.clone();
-        let success_cache = self.success_cache.lock().unwrap();
-
-        base_order.sort_by(|a, b| {
-            let pos_a = base_order_copy
-                .iter()
-                .position(|m| m == a)
-                .unwrap_or(usize::MAX);
-            let pos_b = base_order_copy
-                .iter()
-                .position(|m| m == b)
-                .unwrap_or(usize::MAX);
-            pos_a.cmp(&pos_b).then_with(|| {
-                let key_a = (app_id.to_string(), *a);
-                let key_b = (app_id.to_string(), *b);
-                let rate_a = success_cache
-                    .get(&key_a)
-                    .map(|r| r.success_rate)
-                    .unwrap_or(0.5);
-                let rate_b = success_cache
-                    .get(&key_b)
-                    .map(|r| r.success_rate)
-                    .unwrap_or(0.5);
-                rate_b
-                    .partial_cmp(&rate_a)
-                    .unwrap_or(std::cmp::Ordering::Equal)
-            })
-        });
-
-        drop(success_cache);
-
-        // Always include NoOp at the end as a last resort
-        base_order.push(InjectionMethod::NoOp);
-
-        base_order
+        self.compute_method_order(app_id)
     }
 
     /// Helper: Compute method order based on environment and config
     fn compute_method_order(&self, app_id: &str) -> Vec<InjectionMethod> {
-        use std::env;
-        let on_wayland = env::var("XDG_SESSION_TYPE")
-            .map(|s| s == "wayland")
-            .unwrap_or(false)
-            || env::var("WAYLAND_DISPLAY").is_ok();
-        let on_x11 = env::var("XDG_SESSION_TYPE")
-            .map(|s| s == "x11")
-            .unwrap_or(false)
-            || env::var("DISPLAY").is_ok();
-
-        let mut base_order = Vec::new();
-
-        if on_wayland || on_x11 {
-            base_order.push(InjectionMethod::AtspiInsert);
-        }
-
-        // Add optional methods if enabled
-        if self.config.allow_kdotool {
-            base_order.push(InjectionMethod::KdoToolAssist);
-        }
-        if self.config.allow_enigo {
-            base_order.push(InjectionMethod::EnigoText);
-        }
-
-        // Ensure ClipboardPaste (with internal fallback) is tried last
-        base_order.push(InjectionMethod::ClipboardPasteFallback);
-
-        // Deduplicate while preserving order
-        use std::collections::HashSet;
-        let mut seen = HashSet::new();
-        base_order.retain(|m| seen.insert(*m));
-
-        // Sort primarily by base order; use success rate as tiebreaker
-        let base_order_copy = base_order.clone();
-        let success_cache = self.success_cache.lock().unwrap();
-
-        base_order.sort_by(|a, b| {
-            let pos_a = base_order_copy
-                .iter()
-                .position(|m| m == a)
-                .unwrap_or(usize::MAX);
-            let pos_b = base_order_copy
-                .iter()
-                .position(|m| m == b)
-                .unwrap_or(usize::MAX);
-            pos_a.cmp(&pos_b).then_with(|| {
-                let key_a = (app_id.to_string(), *a);
-                let key_b = (app_id.to_string(), *b);
-                let success_a = success_cache
-                    .get(&key_a)
-                    .map(|r| r.success_rate)
-                    .unwrap_or(0.5);
-                let success_b = success_cache
-                    .get(&key_b)
-                    .map(|r| r.success_rate)
-                    .unwrap_or(0.5);
-                success_b
-                    .partial_cmp(&success_a)
-                    .unwrap_or(std::cmp::Ordering::Equal)
-            })
-        });
-
-        drop(success_cache);
-
-        // Ensure NoOp is always available as a last resort
-        base_order.push(InjectionMethod::NoOp);
-        base_order
+        let base_order = base_method_order(&self.config);
+        let success_cache = self.success_cache.lock();
+        method_order::rank(&base_order, |m| {
+            success_cache
+                .get(&(app_id.to_string(), m))
+                .map(|r| r.success_rate)
+                .unwrap_or(0.5)
+        })
     }
 
-    /// Get the preferred method order based on current context and history (cached per app)
-    pub(crate) async fn get_method_order_cached(&self, app_id: &str) -> Vec<InjectionMethod> {
-        // Use cached order when app_id unchanged
-        {
-            let cached_guard = self.cached_method_order.read().await;
-            if let Some((cached_app, cached_order)) = &*cached_guard {
-                if cached_app == app_id {
-                    return cached_order.clone();
-                }
-            }
-        }
-
-        let base_order = self.compute_method_order(app_id);
-
-        // Cache and return
-        {
-            let mut cached_guard = self.cached_method_order.write().await;
-            *cached_guard = Some((app_id.to_string(), base_order.clone()));
-        }
-        base_order
+    /// Get the preferred method order for `app_id` from the ranking table.
+    /// A shared read lock and a lookup; no sorting. Public only for
+    /// `coldvox-app`'s pipeline benchmark; not part of the API.
+    #[doc(hidden)]
+    pub fn get_method_order_cached(&self, app_id: &str) -> MethodOrder {
+        self.method_order.get(app_id)
     }
 
     /// Back-compat: previous tests may call no-arg version; compute without caching
@@ -772,16 +677,27 @@ impl StrategyManager {
 
     /// Build a human-readable summary of the current fallback chain with availability and history.
     fn describe_method_path(&self, app_id: &str, methods: &[InjectionMethod]) -> String {
-        let success_snapshot: HashMap<AppMethodKey, SuccessRecord> = self
-            .success_cache
-            .lock()
-            .map(|guard| guard.clone())
-            .unwrap_or_else(|_| HashMap::new());
-        let cooldown_snapshot: HashMap<AppMethodKey, CooldownState> = self
-            .cooldowns
-            .lock()
-            .map(|guard| guard.clone())
-            .unwrap_or_else(|_| HashMap::new());
+        // Copy only this app's entries instead of snapshotting both maps
+        let mut success_snapshot: HashMap<AppMethodKey, SuccessRecord> = HashMap::new();
+        let mut cooldown_snapshot: HashMap<AppMethodKey, CooldownState> = HashMap::new();
+        {
+            let guard = self.success_cache.lock();
+            for method in methods {
+                let key = (app_id.to_string(), *method);
+                if let Some(record) = guard.get(&key) {
+                    success_snapshot.insert(key, record.clone());
+                }
+            }
+        }
+        {
+            let guard = self.cooldowns.lock();
+            for method in methods {
+                let key = (app_id.to_string(), *method);
+                if let Some(state) = guard.get(&key) {
+                    cooldown_snapshot.insert(key, state.clone());
+                }
+            }
+        }
         let now = Instant::now();
 
         methods
@@ -834,7 +750,7 @@ impl StrategyManager {
 
     /// Check if we've exceeded the global time budget
     fn has_budget_remaining(&self) -> bool {
-        let guard = self.global_start.lock().unwrap();
+        let guard = self.global_start.lock();
         if let Some(start) = *guard {
             start.elapsed() < self.config.max_total_latency()
         } else {
@@ -941,35 +857,9 @@ impl StrategyManager {
         Ok(())
     }
 
-    /// Try to inject text using the best available method
-    pub async fn inject(&mut self, text: &str) -> Result<(), InjectionError> {
-        if text.is_empty() {
-            return Ok(());
-        }
-
-        // Log the injection request with redaction
-        let redacted = redact_text(text, self.config.redact_logs);
-        debug!("Injection requested for text: {}", redacted);
-        if !self.config.redact_logs {
-            trace!("Full text to inject: {}", text);
-        }
-
-        // Check if injection is paused
-        if self.is_paused() {
-            return Err(InjectionError::Other(
-                "Injection is currently paused".to_string(),
-            ));
-        }
-
-        // Start global timer
-        *self.global_start.lock().unwrap() = Some(Instant::now());
-        if self.config.max_total_latency_ms <= 1 {
-            if let Ok(mut metrics) = self.metrics.lock() {
-                metrics.record_rate_limited();
-            }
-            return Err(InjectionError::BudgetExhausted);
-        }
-
+    /// Focus and allow/block checks shared by full and incremental injection.
+    /// Returns the focus status and the target app id.
+    async fn vet_target(&mut self) -> Result<(FocusStatus, String), InjectionError> {
         // Get current focus status
         let focus_status = match self.focus_provider.get_focus_status().await {
             Ok(status) => status,
@@ -1024,6 +914,111 @@ impl StrategyManager {
             )));
         }
 
+        Ok((focus_status, app_id))
+    }
+
+    /// Start an incremental utterance: the pause, focus and allow/block checks
+    /// of [`inject`](Self::inject), done once so per-partial edits skip them.
+    /// Returns the app id to pass to [`apply_edit`](Self::apply_edit).
+    pub async fn begin_incremental(&mut self) -> Result<String, InjectionError> {
+        if self.is_paused() {
+            return Err(InjectionError::Other(
+                "Injection is currently paused".to_string(),
+            ));
+        }
+        let (_, app_id) = self.vet_target().await?;
+        Ok(app_id)
+    }
+
+    /// Apply one incremental edit for `app_id`. Methods are tried in the
+    /// app's order, skipping backends that cannot edit at the caret; any other
+    /// error ends the attempt since the field may already be partly edited.
+    pub async fn apply_edit(
+        &self,
+        app_id: &str,
+        edit: &crate::incremental::TextEdit,
+    ) -> Result<InjectionMethod, InjectionError> {
+        if edit.is_empty() {
+            return Ok(InjectionMethod::NoOp);
+        }
+        let method_order = self.get_method_order_cached(app_id);
+        for method in method_order.iter().copied() {
+            let Some(injector) = self.injectors.get(method) else {
+                continue;
+            };
+            if self.is_in_cooldown(method) {
+                continue;
+            }
+            let started = Instant::now();
+            match injector.apply_edit(edit).await {
+                Ok(()) => {
+                    let elapsed = started.elapsed();
+                    trace!(
+                        method = ?method,
+                        delete = edit.delete_chars,
+                        insert = edit.insert.len(),
+                        elapsed_us = elapsed.as_micros() as u64,
+                        "Applied incremental edit"
+                    );
+                    if let Ok(mut m) = self.metrics.lock() {
+                        m.record_success(method, elapsed.as_millis() as u64);
+                    }
+                    self.update_success_record(app_id, method, true);
+                    return Ok(method);
+                }
+                Err(InjectionError::MethodNotAvailable(reason)) => {
+                    trace!(method = ?method, %reason, "Method cannot apply edits");
+                }
+                Err(e) => {
+                    debug!(method = ?method, error = %e, "Incremental edit failed");
+                    if let Ok(mut m) = self.metrics.lock() {
+                        m.record_failure(
+                            method,
+                            started.elapsed().as_millis() as u64,
+                            e.to_string(),
+                        );
+                    }
+                    self.update_success_record(app_id, method, false);
+                    return Err(e);
+                }
+            }
+        }
+        Err(InjectionError::MethodNotAvailable(
+            "No backend can apply incremental edits".to_string(),
+        ))
+    }
+
+    /// Try to inject text using the best available method
+    pub async fn inject(&mut self, text: &str) -> Result<(), InjectionError> {
+        if text.is_empty() {
+            return Ok(());
+        }
+
+        // Log the injection request with redaction
+        let redacted = redact_text(text, self.config.redact_logs);
+        debug!("Injection requested for text: {}", redacted);
+        if !self.config.redact_logs {
+            trace!("Full text to inject: {}", text);
+        }
+
+        // Check if injection is paused
+        if self.is_paused() {
+            return Err(InjectionError::Other(
+                "Injection is currently paused".to_string(),
+            ));
+        }
+
+        // Start global timer
+        *self.global_start.lock() = Some(Instant::now());
+        if self.config.max_total_latency_ms <= 1 {
+            if let Ok(mut metrics) = self.metrics.lock() {
+                metrics.record_rate_limited();
+            }
+            return Err(InjectionError::BudgetExhausted);
+        }
+
+        let (focus_status, app_id) = self.vet_target().await?;
+
         // Check if we should trigger pre-warming
         self.check_and_trigger_prewarm().await;
 
@@ -1071,7 +1066,7 @@ impl StrategyManager {
         };
 
         // Get ordered list of methods to try
-        let method_order = self.get_method_order_cached(&app_id).await;
+        let method_order = self.get_method_order_cached(&app_id);
         let method_path_summary = self.describe_method_path(&app_id, &method_order);
         info!(
             app_id = %app_id,
@@ -1087,13 +1082,13 @@ impl StrategyManager {
         let total_start = Instant::now();
         let mut attempts = 0;
         let total_methods = method_order.len();
-        for method in method_order.clone() {
+        for method in method_order.iter().copied() {
             attempts += 1;
             // Skip if in cooldown
             if self.is_in_cooldown(method) {
                 let remaining_ms = {
                     let now = Instant::now();
-                    let guard = self.cooldowns.lock().unwrap();
+                    let guard = self.cooldowns.lock();
                     guard
                         .get(&(app_id.clone(), method))
                         .and_then(|state| state.until.checked_duration_since(now))
@@ -1472,7 +1467,7 @@ mod tests {
         manager.update_success_record("unknown_app", InjectionMethod::AtspiInsert, true);
         let key = ("unknown_app".to_string(), InjectionMethod::AtspiInsert);
         {
-            let cache = manager.success_cache.lock().unwrap();
+            let cache = manager.success_cache.lock();
             let record = cache.get(&key).unwrap();
             assert_eq!(record.success_count, 1);
             assert_eq!(record.fail_count, 0);
@@ -1481,13 +1476,33 @@ mod tests {
 
         // Test failure
         manager.update_success_record("unknown_app", InjectionMethod::AtspiInsert, false);
-        let cache = manager.success_cache.lock().unwrap();
+        let cache = manager.success_cache.lock();
         let record = cache.get(&key).unwrap();
         assert_eq!(record.success_count, 1);
         assert_eq!(record.fail_count, 1);
         assert!(record.success_rate > 0.3 && record.success_rate < 0.8);
     }
 
+    // Test that history never lifts clipboard paste out of last place
+    #[tokio::test]
+    async fn test_history_keeps_clipboard_last() {
+        let config = InjectionConfig {
+            allow_enigo: true,
+            ..Default::default()
+        };
+        let metrics = Arc::new(Mutex::new(InjectionMetrics::default()));
+        let manager = StrategyManager::new(config, metrics).await;
+        let app = "test_app";
+        let clipboard = InjectionMethod::ClipboardPasteFallback;
+
+        manager.update_success_record(app, clipboard, true);
+        manager.update_success_record(app, InjectionMethod::EnigoText, false);
+        let order = manager.get_method_order_cached(app);
+        assert_eq!(*order, manager.get_method_order_uncached());
+        assert_eq!(order[order.len() - 2], clipboard);
+        assert_eq!(order.last(), Some(&InjectionMethod::NoOp));
+    }
+
     // Test cooldown updates
     #[tokio::test]
     async fn test_cooldown_update() {
@@ -1500,14 +1515,14 @@ mod tests {
         manager.update_cooldown(test_app_id, InjectionMethod::AtspiInsert, "test error");
         let key = (test_app_id.to_string(), InjectionMethod::AtspiInsert);
         {
-            let cooldowns = manager.cooldowns.lock().unwrap();
+            let cooldowns = manager.cooldowns.lock();
             let cooldown = cooldowns.get(&key).unwrap();
             assert_eq!(cooldown.backoff_level, 1);
         }
 
         // Second failure - backoff level should increase
         manager.update_cooldown(test_app_id, InjectionMethod::AtspiInsert, "test error");
-        let cooldowns = manager.cooldowns.lock().unwrap();
+        let cooldowns = manager.cooldowns.lock();
         let cooldown = cooldowns.get(&key).unwrap();
         assert_eq!(cooldown.backoff_level, 2);
 
@@ -1535,14 +1550,14 @@ mod tests {
 
         // Set start time
         {
-            let mut guard = manager.global_start.lock().unwrap();
+            let mut guard = manager.global_start.lock();
             *guard = Some(Instant::now() - Duration::from_millis(50));
         }
         assert!(manager.has_budget_remaining());
 
         // Exceed budget
         {
-            let mut guard = manager.global_start.lock().unwrap();
+            let mut guard = manager.global_start.lock();
             *guard = Some(Instant::now() - Duration::from_millis(150));
         }
         assert!(!manager.has_budget_remaining());
@@ -0,0 +1,212 @@
+//! # Per-app method ordering table
+//!
+//! [`MethodOrderTable`] holds a precomputed fallback order for every app seen
+//! so far. Orders are recomputed for one app whenever one of its methods
+//! succeeds, fails or enters cooldown. Reads on the injection hot path never
+//! sort: one shared read lock, one hash lookup, one `Arc` clone.
+//!
+//! The ranking keeps the environment/config base order; success rate only
+//! breaks ties. Methods in cooldown keep their place and are skipped by the
+//! injection loop until the cooldown ends.
+
+use crate::types::InjectionMethod;
+use parking_lot::RwLock;
+use std::collections::HashMap;
+use std::sync::Arc;
+
+/// Apps with their own ranking. Orders for further apps are still answered
+/// (with the base order) but not stored, so the table cannot grow unbounded
+/// when app ids are noisy (e.g. window titles).
+const MAX_APPS: usize = 256;
+
+/// Method order for one app; replaced as a whole on each update.
+pub type MethodOrder = Arc<Vec<InjectionMethod>>;
+
+/// Lookup table of per-app method orders.
+pub struct MethodOrderTable {
+    /// Environment/config order used for apps without history. Ends in NoOp.
+    base: MethodOrder,
+    apps: RwLock<HashMap<String, MethodOrder>>,
+}
+
+impl MethodOrderTable {
+    /// Create a table whose apps all start from `base` (NoOp is appended if
+    /// missing so the order is never empty).
+    pub fn new(mut base: Vec<InjectionMethod>) -> Self {
+        if !base.contains(&InjectionMethod::NoOp) {
+            base.push(InjectionMethod::NoOp);
+        }
+        Self {
+            base: Arc::new(base),
+            apps: RwLock::new(HashMap::new()),
+        }
+    }
+
+    /// The order used for apps without history.
+    pub fn base(&self) -> &[InjectionMethod] {
+        &self.base
+    }
+
+    /// Current order for `app_id`.
+    pub fn get(&self, app_id: &str) -> MethodOrder {
+        self.apps
+            .read()
+            .get(app_id)
+            .cloned()
+            .unwrap_or_else(|| self.base.clone())
+    }
+
+    /// Recompute the order for `app_id` from `success_rate` (rate per method,
+    /// 0.5 when unknown) and publish it. Callers serialize updates for the
+    /// same app (the manager holds its success-record lock).
+    pub fn update(&self, app_id: &str, success_rate: impl Fn(InjectionMethod) -> f64) {
+        let order = Arc::new(rank(&self.base, success_rate));
+
+        let mut apps = self.apps.write();
+        if let Some(slot) = apps.get_mut(app_id) {
+            *slot = order;
+        } else if apps.len() < MAX_APPS {
+            apps.insert(app_id.to_string(), order);
+        }
+    }
+
+    /// Number of apps with their own ranking.
+    pub fn len(&self) -> usize {
+        self.apps.read().len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// Order methods by their position in `base` (which keeps clipboard paste
+/// last among real methods), using historical success rate, best first, only
+/// to break ties. Duplicates are dropped and NoOp always stays last.
+pub fn rank(
+    base: &[InjectionMethod],
+    success_rate: impl Fn(InjectionMethod) -> f64,
+) -> Vec<InjectionMethod> {
+    let mut scored: Vec<(usize, InjectionMethod, f64)> = Vec::with_capacity(base.len());
+    for (position, m) in base.iter().copied().enumerate() {
+        if m != InjectionMethod::NoOp && !scored.iter().any(|(_, seen, _)| *seen == m) {
+            scored.push((position, m, success_rate(m)));
+        }
+    }
+    scored.sort_by(|(pos_a, _, rate_a), (pos_b, _, rate_b)| {
+        pos_a.cmp(pos_b).then_with(|| {
+            rate_b
+                .partial_cmp(rate_a)
+                .unwrap_or(std::cmp::Ordering::Equal)
+        })
+    });
+    let mut order: Vec<InjectionMethod> = scored.into_iter().map(|(_, m, _)| m).collect();
+    order.push(InjectionMethod::NoOp);
+    order
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn base() -> Vec<InjectionMethod> {
+        vec![
+            InjectionMethod::AtspiInsert,
+            InjectionMethod::ClipboardPasteFallback,
+        ]
+    }
+
+    fn favor(method: InjectionMethod) -> impl Fn(InjectionMethod) -> f64 {
+        move |m| if m == method { 1.0 } else { 0.0 }
+    }
+
+    #[test]
+    fn unknown_apps_get_base_order() {
+        let table = MethodOrderTable::new(base());
+        let order = table.get("firefox");
+        assert_eq!(
+            order.as_slice(),
+            &[
+                InjectionMethod::AtspiInsert,
+                InjectionMethod::ClipboardPasteFallback,
+                InjectionMethod::NoOp
+            ]
+        );
+        assert!(table.is_empty());
+        assert!(Arc::ptr_eq(&order, &table.get("kate")));
+    }
+
+    #[test]
+    fn history_never_moves_clipboard_ahead_of_base_order() {
+        let table = MethodOrderTable::new(base());
+        let before = table.get("firefox");
+        table.update("firefox", favor(InjectionMethod::ClipboardPasteFallback));
+        table.update("kate", favor(InjectionMethod::AtspiInsert));
+        assert_eq!(table.len(), 2);
+
+        assert_eq!(table.get("firefox").as_slice(), table.base());
+        assert_eq!(table.get("kate").as_slice(), table.base());
+        // Orders handed out earlier stay valid for their readers
+        assert_eq!(before.as_slice(), table.base());
+    }
+
+    #[test]
+    fn table_is_bounded() {
+        let table = MethodOrderTable::new(base());
+        for i in 0..MAX_APPS + 10 {
+            table.update(&format!("app{i}"), |_| 0.5);
+        }
+        assert_eq!(table.len(), MAX_APPS);
+        assert_eq!(table.get("app9999").as_slice(), table.base());
+    }
+
+    #[test]
+    fn noop_stays_last() {
+        let order = rank(
+            &[
+                InjectionMethod::NoOp,
+                InjectionMethod::EnigoText,
+                InjectionMethod::AtspiInsert,
+            ],
+            favor(InjectionMethod::AtspiInsert),
+        );
+        assert_eq!(
+            order,
+            vec![
+                InjectionMethod::EnigoText,
+                InjectionMethod::AtspiInsert,
+                InjectionMethod::NoOp
+            ]
+        );
+    }
+
+    #[test]
+    fn base_position_wins_over_success_rate() {
+        let methods = [
+            InjectionMethod::AtspiInsert,
+            InjectionMethod::KdoToolAssist,
+            InjectionMethod::ClipboardPasteFallback,
+        ];
+        let order = rank(&methods, favor(InjectionMethod::ClipboardPasteFallback));
+        assert_eq!(order[..3], methods);
+        assert_eq!(order.last(), Some(&InjectionMethod::NoOp));
+
+        // Duplicates keep their first position
+        let order = rank(
+            &[
+                InjectionMethod::AtspiInsert,
+                InjectionMethod::ClipboardPasteFallback,
+                InjectionMethod::AtspiInsert,
+            ],
+            |_| 0.5,
+        );
+        assert_eq!(
+            order,
+            vec![
+                InjectionMethod::AtspiInsert,
+                InjectionMethod::ClipboardPasteFallback,
+                InjectionMethod::NoOp
+            ]
+        );
+    }
+}
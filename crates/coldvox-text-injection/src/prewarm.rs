@@ -62,6 +62,43 @@ struct AtspiData {
     has_editable_text: bool,
 }
 
+impl AtspiData {
+    #[cfg(feature = "atspi")]
+    fn from_focused(focused: Option<crate::atspi_focus::FocusedTarget>) -> Self {
+        Self {
+            connection: Some("connected".to_string()),
+            focused_node: focused.as_ref().map(|target| target.path.clone()),
+            target_app: focused.as_ref().map(|target| target.app_id().to_string()),
+            window_id: focused.as_ref().map(|target| target.path.clone()),
+            has_editable_text: focused.is_some_and(|target| target.editable),
+        }
+    }
+
+    /// Read straight from the shared focus cache when it is connected. Focus
+    /// events keep it current, so this needs no TTL; the cached snapshot and
+    /// its TTL only cover the time AT-SPI is unreachable.
+    fn live() -> Option<Self> {
+        #[cfg(feature = "atspi")]
+        {
+            let cache = crate::atspi_focus::AtspiFocusCache::current()?;
+            Some(Self::from_focused(cache.focused()))
+        }
+
+        #[cfg(not(feature = "atspi"))]
+        {
+            None
+        }
+    }
+
+    fn context(&self) -> AtspiContext {
+        AtspiContext {
+            focused_node: self.target_app.clone(), // Use target_app as focused_node for now
+            target_app: self.target_app.clone(),
+            window_id: self.window_id.clone(),
+        }
+    }
+}
+
 /// Clipboard snapshot data
 #[derive(Debug, Clone)]
 pub struct ClipboardData {
@@ -125,17 +162,12 @@ impl PrewarmController {
 
     /// Get the AT-SPI context with pre-warmed data
     pub async fn get_atspi_context(&self) -> AtspiContext {
-        let atsi_data = self.atspi_data.read().await;
-
-        if let Some(data) = atsi_data.get() {
-            AtspiContext {
-                focused_node: data.target_app.clone(), // Use target_app as focused_node for now
-                target_app: data.target_app.clone(),
-                window_id: data.window_id.clone(),
-            }
-        } else {
-            AtspiContext::default()
+        if let Some(data) = AtspiData::live() {
+            return data.context();
         }
+
+        let atsi_data = self.atspi_data.read().await;
+        atsi_data.get().map(AtspiData::context).unwrap_or_default()
     }
 
     /// Check if the event listener is armed
@@ -169,75 +201,24 @@ impl PrewarmController {
 
         #[cfg(feature = "atspi")]
         {
-            use atspi::{
-                connection::AccessibilityConnection, proxy::collection::CollectionProxy, MatchType,
-                ObjectMatchRule, SortOrder, State,
-            };
-            use tokio::time;
-
-            // Connect to AT-SPI with tiny timeout
-            let conn = time::timeout(STEP_TIMEOUT, AccessibilityConnection::new())
-                .await
-                .map_err(|_| "AT-SPI connection timeout".to_string())?
-                .map_err(|e| format!("AT-SPI connect failed: {e}"))?;
-
-            let zbus_conn = conn.connection();
-            trace!("AT-SPI connection established during pre-warming");
-
-            // Find focused element
-            let collection_fut = CollectionProxy::builder(zbus_conn)
-                .destination("org.a11y.atspi.Registry")
-                .map_err(|e| format!("CollectionProxy destination failed: {e}"))?
-                .path("/org/a11y/atspi/accessible/root")
-                .map_err(|e| format!("CollectionProxy path failed: {e}"))?
-                .build();
-
-            let collection = time::timeout(STEP_TIMEOUT, collection_fut)
-                .await
-                .map_err(|_| "CollectionProxy timeout".to_string())?
-                .map_err(|e| format!("CollectionProxy build failed: {e}"))?;
-
-            let mut rule = ObjectMatchRule::default();
-            rule.states = State::Focused.into();
-            rule.states_mt = MatchType::All;
+            use crate::atspi_focus::AtspiFocusCache;
 
-            let get_matches = collection.get_matches(rule.clone(), SortOrder::Canonical, 1, false);
-            let matches = time::timeout(STEP_TIMEOUT, get_matches)
+            // Connecting the shared cache subscribes to focus events; from then
+            // on the focused element is tracked without polling
+            let cache = AtspiFocusCache::shared()
                 .await
-                .map_err(|_| "Get matches timeout".to_string())?
-                .map_err(|e| format!("Get matches failed: {e}"))?;
-
-            let mut focused_node = None;
-            let mut target_app = None;
-            let mut window_id = None;
-            let mut has_editable_text = false;
-
-            if let Some(obj_ref) = matches.first() {
-                // Store the focused node
-                focused_node = Some("focused".to_string());
-
-                target_app = obj_ref.name().map(|n| n.to_string());
-                window_id = Some(obj_ref.path().to_string());
-
-                // Simplified editable text check - assume it's editable if we found a focused element
-                has_editable_text = true;
-            }
+                .ok_or_else(|| "AT-SPI focus cache unavailable".to_string())?;
+            let focused = cache.focused();
 
             let elapsed = start_time.elapsed();
             debug!(
                 "AT-SPI pre-warming completed in {}ms (focused: {}, editable: {})",
                 elapsed.as_millis(),
-                focused_node.is_some(),
-                has_editable_text
+                focused.is_some(),
+                focused.as_ref().is_some_and(|target| target.editable)
             );
 
-            Ok(AtspiData {
-                connection: Some("connected".to_string()),
-                focused_node: Some("focused".to_string()),
-                target_app,
-                window_id,
-                has_editable_text,
-            })
+            Ok(AtspiData::from_focused(focused))
         }
 
         #[cfg(not(feature = "atspi"))]
@@ -287,6 +268,21 @@ impl PrewarmController {
         let start_time = Instant::now();
         debug!("Snapshotting clipboard content");
 
+        // Connecting the in-process owner here keeps that cost off the first injection
+        #[cfg(any(feature = "wl_clipboard", feature = "x11_clipboard"))]
+        if let Some(owner) = crate::injectors::clipboard_owner::ClipboardOwner::shared() {
+            let content = owner.read().await.map_err(|e| e.to_string())?;
+            debug!(
+                "Clipboard snapshot completed in-process in {}ms ({} bytes)",
+                start_time.elapsed().as_millis(),
+                content.len()
+            );
+            return Ok(ClipboardData {
+                content: Some(content),
+                mime_type: Some("text/plain".to_string()),
+            });
+        }
+
         #[cfg(feature = "wl_clipboard")]
         {
             // Simplified clipboard handling for now
@@ -514,14 +510,16 @@ impl PrewarmController {
         );
     }
 
-    /// Check if any cached data is expired
+    /// Check if any cached data is expired. AT-SPI data only counts while
+    /// the focus cache is disconnected; otherwise it is never stale.
     async fn is_any_data_expired(&self) -> bool {
         let atsi = self.atspi_data.read().await;
         let clipboard = self.clipboard_data.read().await;
         let portal = self.portal_data.read().await;
         let vk = self.virtual_keyboard_data.read().await;
 
-        !atsi.is_valid() || !clipboard.is_valid() || !portal.is_valid() || !vk.is_valid()
+        let atspi_expired = !atsi.is_valid() && AtspiData::live().is_none();
+        atspi_expired || !clipboard.is_valid() || !portal.is_valid() || !vk.is_valid()
     }
 }
 
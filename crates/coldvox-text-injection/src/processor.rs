@@ -1,11 +1,6 @@
 use coldvox_stt::TranscriptionEvent;
-
-/// Placeholder for pipeline metrics - to be provided by the main app
-#[derive(Debug, Clone, Default)]
-pub struct PipelineMetrics {
-    pub processed_events: u64,
-    pub injection_latency_ms: u64,
-}
+pub use coldvox_telemetry::PipelineMetrics;
+use coldvox_telemetry::TraceStage;
 use std::sync::{Arc, Mutex};
 use tokio::sync::mpsc;
 use tokio::time::{self, Duration, Instant};
@@ -14,7 +9,9 @@ use tracing::{debug, error, info, warn};
 use super::manager::StrategyManager;
 use super::session::{InjectionSession, SessionConfig, SessionState};
 use super::InjectionConfig;
+use crate::incremental::{IncrementalTyper, PendingEdit, TextEdit};
 use crate::types::InjectionMetrics;
+use coldvox_foundation::error::InjectionError;
 
 /// Local metrics for the injection processor (UI/state), distinct from types::InjectionMetrics
 #[derive(Debug, Clone, Default)]
@@ -61,7 +58,15 @@ pub struct InjectionProcessor {
     /// Shared injection metrics for all components
     injection_metrics: Arc<Mutex<crate::types::InjectionMetrics>>,
     /// Pipeline metrics for integration
-    _pipeline_metrics: Option<Arc<PipelineMetrics>>,
+    pipeline_metrics: Option<Arc<PipelineMetrics>>,
+    /// When the final transcription behind the injection in flight arrived
+    pending_since: Option<Instant>,
+    /// Partial-transcript typing state (`incremental_partials` only)
+    incremental: Option<IncrementalTyper>,
+    /// Utterances whose finals sit in the session buffer
+    buffered_utterances: Vec<u64>,
+    /// Utterances behind the injection in flight
+    in_flight: Vec<u64>,
 }
 
 impl InjectionProcessor {
@@ -82,13 +87,19 @@ impl InjectionProcessor {
             ..Default::default()
         }));
 
+        let incremental = config.incremental_partials.then(IncrementalTyper::new);
+
         Self {
             session,
             injector,
             config,
             metrics,
             injection_metrics,
-            _pipeline_metrics: pipeline_metrics,
+            pipeline_metrics,
+            pending_since: None,
+            incremental,
+            buffered_utterances: Vec::new(),
+            in_flight: Vec::new(),
         }
     }
 
@@ -96,9 +107,15 @@ impl InjectionProcessor {
     /// Returns Some(text) when there is content to inject, otherwise None.
     pub fn prepare_injection(&mut self) -> Option<String> {
         if self.session.should_inject() {
+            self.pending_since = self
+                .session
+                .time_since_last_transcription()
+                .and_then(|since| Instant::now().checked_sub(since));
             let text = self.session.take_buffer();
             if !text.is_empty() {
                 debug!("Injecting {} characters from session", text.len());
+                self.in_flight = std::mem::take(&mut self.buffered_utterances);
+                self.mark_in_flight(TraceStage::InjectStart);
                 return Some(text);
             }
         }
@@ -107,15 +124,110 @@ impl InjectionProcessor {
 
     /// Record the result of an injection attempt and refresh metrics.
     pub fn record_injection_result(&mut self, success: bool) {
+        let pending_since = self.pending_since.take();
         if success {
+            if let (Some(metrics), Some(since)) = (&self.pipeline_metrics, pending_since) {
+                metrics.record_injection_latency(since.elapsed());
+            }
+            self.mark_in_flight(TraceStage::Injected);
             self.metrics.lock().unwrap().successful_injections += 1;
             self.metrics.lock().unwrap().last_injection_time = Some(Instant::now());
         } else {
             self.metrics.lock().unwrap().failed_injections += 1;
+            self.abandon_in_flight();
         }
+        self.in_flight.clear();
         self.update_metrics();
     }
 
+    /// Next incremental edit to apply, if any (coalesces queued partials).
+    pub fn next_edit(&mut self) -> Option<PendingEdit> {
+        let pending = self.incremental.as_mut()?.next_edit()?;
+        if pending.app_id.is_none() && !pending.fallback {
+            self.mark_trace(pending.utterance_id, TraceStage::InjectStart);
+        }
+        Some(pending)
+    }
+
+    /// Record the outcome of an incremental edit. `app_id` is the target
+    /// resolved for the utterance's first edit.
+    pub fn record_edit_result(
+        &mut self,
+        pending: &PendingEdit,
+        app_id: Option<String>,
+        success: bool,
+    ) {
+        let Some(typer) = self.incremental.as_mut() else {
+            return;
+        };
+        let fell_back = if success {
+            typer.applied(pending, app_id);
+            false
+        } else {
+            typer.failed(pending)
+        };
+        if !pending.is_final {
+            return;
+        }
+        if fell_back {
+            // The typer queued the full final for regular injection; its
+            // outcome decides the utterance
+            debug!(
+                "Incremental edit of final [{}] failed, injecting the rest of it",
+                pending.utterance_id
+            );
+            return;
+        }
+
+        if success {
+            if let (Some(metrics), Some(since)) = (&self.pipeline_metrics, pending.final_at) {
+                metrics.record_injection_latency(since.elapsed());
+            }
+            self.mark_trace(pending.utterance_id, TraceStage::Injected);
+            let mut metrics = self.metrics.lock().unwrap();
+            metrics.successful_injections += 1;
+            metrics.last_injection_time = Some(Instant::now());
+        } else {
+            self.metrics.lock().unwrap().failed_injections += 1;
+            if let Some(metrics) = &self.pipeline_metrics {
+                metrics
+                    .utterance_trace
+                    .abandon_utterance(pending.utterance_id);
+            }
+        }
+    }
+
+    /// Apply all pending incremental edits with this processor's injector.
+    pub async fn flush_edits(&mut self) {
+        while let Some(pending) = self.next_edit() {
+            let (app_id, result) = apply_pending(&mut self.injector, &pending).await;
+            if let Err(e) = &result {
+                debug!("Incremental edit failed: {}", e);
+            }
+            self.record_edit_result(&pending, app_id, result.is_ok());
+        }
+    }
+
+    fn mark_trace(&self, utterance_id: u64, stage: TraceStage) {
+        if let Some(metrics) = &self.pipeline_metrics {
+            metrics.utterance_trace.mark_utterance(utterance_id, stage);
+        }
+    }
+
+    fn mark_in_flight(&self, stage: TraceStage) {
+        for &utterance_id in &self.in_flight {
+            self.mark_trace(utterance_id, stage);
+        }
+    }
+
+    fn abandon_in_flight(&self) {
+        if let Some(metrics) = &self.pipeline_metrics {
+            for &utterance_id in &self.in_flight {
+                metrics.utterance_trace.abandon_utterance(utterance_id);
+            }
+        }
+    }
+
     /// Get current metrics
     pub fn metrics(&self) -> ProcessorMetrics {
         self.metrics.lock().unwrap().clone()
@@ -131,6 +243,9 @@ impl InjectionProcessor {
                     "Received partial transcription [{}]: {}",
                     utterance_id, text
                 );
+                if let Some(typer) = self.incremental.as_mut() {
+                    typer.update(utterance_id, &text, false);
+                }
                 self.update_metrics();
             }
             TranscriptionEvent::Final {
@@ -138,7 +253,15 @@ impl InjectionProcessor {
             } => {
                 let text_len = text.len();
                 info!("Received final transcription [{}]: {}", utterance_id, text);
-                self.session.add_transcription(text);
+                self.mark_trace(utterance_id, TraceStage::FinalReceived);
+                // Incremental mode types finals as the last edit of their utterance
+                match self.incremental.as_mut() {
+                    Some(typer) => typer.update(utterance_id, &text, true),
+                    None => {
+                        self.session.add_transcription(text);
+                        self.buffered_utterances.push(utterance_id);
+                    }
+                }
                 // Record the number of characters buffered
                 if let Ok(mut metrics) = self.injection_metrics.lock() {
                     metrics.record_buffered_chars(text_len as u64);
@@ -153,6 +276,9 @@ impl InjectionProcessor {
 
     /// Check if injection should be performed and execute if needed
     pub async fn check_and_inject(&mut self) -> anyhow::Result<()> {
+        if self.incremental.is_some() {
+            self.flush_edits().await;
+        }
         if self.session.should_inject() {
             // Mode decision is now centralized in StrategyManager
             // which receives the config and makes the paste vs keystroke decision
@@ -174,6 +300,12 @@ impl InjectionProcessor {
     /// Clear current session buffer
     pub fn clear_session(&mut self) {
         self.session.clear();
+        self.in_flight = std::mem::take(&mut self.buffered_utterances);
+        self.abandon_in_flight();
+        self.in_flight.clear();
+        if let Some(typer) = self.incremental.as_mut() {
+            typer.clear();
+        }
         self.update_metrics();
         info!("Session cleared manually");
     }
@@ -186,11 +318,11 @@ impl InjectionProcessor {
         }
 
         // Record the time from final transcription to injection
-        let latency = self
-            .session
-            .time_since_last_transcription()
-            .map(|d| d.as_millis() as u64)
-            .unwrap_or(0);
+        let since_final = self.session.time_since_last_transcription();
+        let latency = since_final.map(|d| d.as_millis() as u64).unwrap_or(0);
+        let started = Instant::now();
+        self.in_flight = std::mem::take(&mut self.buffered_utterances);
+        self.mark_in_flight(TraceStage::InjectStart);
 
         info!(
             "Injecting {} characters from session (latency: {}ms)",
@@ -207,12 +339,19 @@ impl InjectionProcessor {
         match self.injector.inject(&text).await {
             Ok(()) => {
                 info!("Successfully injected text");
+                if let (Some(metrics), Some(since_final)) = (&self.pipeline_metrics, since_final) {
+                    metrics.record_injection_latency(since_final + started.elapsed());
+                }
+                self.mark_in_flight(TraceStage::Injected);
+                self.in_flight.clear();
                 self.metrics.lock().unwrap().successful_injections += 1;
                 self.metrics.lock().unwrap().last_injection_time = Some(Instant::now());
             }
             Err(e) => {
                 error!("Failed to inject text: {}", e);
                 self.metrics.lock().unwrap().failed_injections += 1;
+                self.abandon_in_flight();
+                self.in_flight.clear();
                 return Err(e.into());
             }
         }
@@ -257,10 +396,52 @@ impl InjectionProcessor {
 
     /// Get the last partial transcription text (for real-time feedback)
     pub fn last_partial_text(&self) -> Option<String> {
-        None
+        self.incremental
+            .as_ref()
+            .map(|typer| typer.typed().to_string())
+            .filter(|typed| !typed.is_empty())
     }
 }
 
+/// Apply one incremental edit. Falls back to regular injection when the
+/// typer asks for it; otherwise resolves the target app on the utterance's
+/// first edit and returns it for the following ones.
+async fn apply_pending(
+    injector: &mut StrategyManager,
+    pending: &PendingEdit,
+) -> (Option<String>, Result<(), InjectionError>) {
+    if pending.fallback {
+        // Trim typed text the final revised, then type the rest as usual
+        if pending.edit.delete_chars > 0 {
+            let delete = TextEdit {
+                insert: String::new(),
+                ..pending.edit.clone()
+            };
+            let app_id = pending.app_id.as_deref().unwrap_or_default();
+            if let Err(e) = injector.apply_edit(app_id, &delete).await {
+                return (None, Err(e));
+            }
+        }
+        return (None, injector.inject(&pending.edit.insert).await);
+    }
+    let app_id = match &pending.app_id {
+        Some(app_id) => app_id.clone(),
+        None => match injector.begin_incremental().await {
+            Ok(app_id) => app_id,
+            Err(e) => return (None, Err(e)),
+        },
+    };
+    let result = injector
+        .apply_edit(&app_id, &pending.edit)
+        .await
+        .map(|_| ());
+    (Some(app_id), result)
+}
+
+/// Tick for session checks when partials are not typed. A final is injected
+/// at most this long after the session's silence timeout expires.
+const SESSION_CHECK_INTERVAL: Duration = Duration::from_millis(100);
+
 /// Async wrapper for the injection processor that runs in a dedicated task
 pub struct AsyncInjectionProcessor {
     processor: Arc<tokio::sync::Mutex<InjectionProcessor>>,
@@ -268,6 +449,8 @@ pub struct AsyncInjectionProcessor {
     shutdown_rx: mpsc::Receiver<()>,
     // dedicated injector to avoid awaiting while holding the processor lock
     injector: StrategyManager,
+    /// Tick interval; shorter in incremental mode so text follows speech
+    check_interval: Duration,
 }
 
 impl AsyncInjectionProcessor {
@@ -280,6 +463,11 @@ impl AsyncInjectionProcessor {
     ) -> Self {
         // Create shared injection metrics
         let injection_metrics = Arc::new(Mutex::new(crate::types::InjectionMetrics::default()));
+        let check_interval = if config.incremental_partials {
+            config.incremental_interval()
+        } else {
+            SESSION_CHECK_INTERVAL
+        };
 
         // Create processor with shared metrics
         let processor = Arc::new(tokio::sync::Mutex::new(
@@ -295,13 +483,14 @@ impl AsyncInjectionProcessor {
             transcription_rx,
             shutdown_rx,
             injector,
+            check_interval,
         }
     }
 
     /// Run the injection processor loop
     pub async fn run(mut self) -> anyhow::Result<()> {
-        let check_interval = Duration::from_millis(100); // TODO: Make configurable (config refinement)
-        let mut interval = time::interval(check_interval);
+        let mut interval = time::interval(self.check_interval);
+        interval.set_missed_tick_behavior(time::MissedTickBehavior::Delay);
 
         info!("Injection processor started");
 
@@ -315,6 +504,21 @@ impl AsyncInjectionProcessor {
 
                 // Periodic check for silence timeout
                 _ = interval.tick() => {
+                    // Apply partial-transcript edits queued since the last tick, one
+                    // coalesced edit per utterance
+                    loop {
+                        let pending = self.processor.lock().await.next_edit();
+                        let Some(pending) = pending else { break };
+                        let (app_id, result) = apply_pending(&mut self.injector, &pending).await;
+                        if let Err(e) = &result {
+                            debug!("Incremental edit failed: {}", e);
+                        }
+                        self.processor
+                            .lock()
+                            .await
+                            .record_edit_result(&pending, app_id, result.is_ok());
+                    }
+
                     // Prepare any pending injection without holding the lock across await
                     let maybe_text = {
                         let mut processor = self.processor.lock().await;
@@ -468,4 +672,71 @@ mod tests {
         assert_eq!(processor.session_state(), SessionState::Buffering);
         assert_eq!(processor.session.buffer_len(), 1);
     }
+
+    #[tokio::test]
+    async fn test_incremental_partials_become_edits() {
+        let config = InjectionConfig {
+            incremental_partials: true,
+            ..Default::default()
+        };
+        let injection_metrics = Arc::new(Mutex::new(crate::types::InjectionMetrics::default()));
+        let mut processor = InjectionProcessor::new(config, None, injection_metrics).await;
+
+        for text in ["Hel", "Hello", "Hello wor"] {
+            processor.handle_transcription(TranscriptionEvent::Partial {
+                utterance_id: 1,
+                text: text.to_string(),
+                t0: None,
+                t1: None,
+            });
+        }
+
+        // Coalesced into one edit
+        let edit = processor.next_edit().unwrap();
+        assert_eq!(edit.edit.insert, "Hello wor");
+        assert!(processor.next_edit().is_none());
+        processor.record_edit_result(&edit, Some("test-app".to_string()), true);
+        assert_eq!(processor.last_partial_text().as_deref(), Some("Hello wor"));
+
+        // The final is the utterance's last edit, not a buffered injection
+        processor.handle_transcription(TranscriptionEvent::Final {
+            utterance_id: 1,
+            text: "Hello world".to_string(),
+            words: None,
+        });
+        assert_eq!(processor.session_state(), SessionState::Idle);
+        let edit = processor.next_edit().unwrap();
+        assert!(edit.is_final);
+        assert_eq!(edit.edit.insert, "ld");
+        processor.record_edit_result(&edit, None, true);
+        assert_eq!(processor.metrics().successful_injections, 1);
+        assert!(processor.last_partial_text().is_none());
+    }
+
+    #[tokio::test]
+    async fn test_failed_final_edit_is_injected_in_full() {
+        let config = InjectionConfig {
+            incremental_partials: true,
+            ..Default::default()
+        };
+        let injection_metrics = Arc::new(Mutex::new(crate::types::InjectionMetrics::default()));
+        let mut processor = InjectionProcessor::new(config, None, injection_metrics).await;
+
+        processor.handle_transcription(TranscriptionEvent::Final {
+            utterance_id: 4,
+            text: "Hello world".to_string(),
+            words: None,
+        });
+        let edit = processor.next_edit().unwrap();
+        processor.record_edit_result(&edit, Some("test-app".to_string()), false);
+        // Not counted yet: the fallback decides the outcome
+        assert_eq!(processor.metrics().failed_injections, 0);
+
+        let fallback = processor.next_edit().unwrap();
+        assert!(fallback.fallback);
+        assert_eq!(fallback.edit.insert, "Hello world");
+        processor.record_edit_result(&fallback, None, true);
+        assert_eq!(processor.metrics().successful_injections, 1);
+        assert!(processor.next_edit().is_none());
+    }
 }
@@ -150,6 +150,14 @@ pub struct InjectionConfig {
     /// If true, exit the process immediately if all injection methods fail.
     #[serde(default = "default_fail_fast")]
     pub fail_fast: bool,
+
+    /// Type partial transcripts while the user speaks, rewriting them in place
+    /// as they change (needs an AT-SPI or Enigo backend; others get the final only)
+    #[serde(default = "default_false")]
+    pub incremental_partials: bool,
+    /// How often pending partial updates are applied in incremental mode (ms)
+    #[serde(default = "default_incremental_interval_ms")]
+    pub incremental_interval_ms: u64,
 }
 
 fn default_false() -> bool {
@@ -244,6 +252,10 @@ fn default_cooldown_max_ms() -> u64 {
     300_000 // 5 minutes
 }
 
+fn default_incremental_interval_ms() -> u64 {
+    40 // ~one display frame at 25 Hz; bounds edits per second
+}
+
 fn default_discovery_timeout_ms() -> u64 {
     1000 // 1 second
 }
@@ -279,6 +291,8 @@ impl Default for InjectionConfig {
             allowlist: default_allowlist(),
             blocklist: default_blocklist(),
             fail_fast: default_fail_fast(),
+            incremental_partials: default_false(),
+            incremental_interval_ms: default_incremental_interval_ms(),
         }
     }
 }
@@ -295,6 +309,10 @@ impl InjectionConfig {
     pub fn paste_action_timeout(&self) -> Duration {
         Duration::from_millis(self.paste_action_timeout_ms)
     }
+
+    pub fn incremental_interval(&self) -> Duration {
+        Duration::from_millis(self.incremental_interval_ms.max(1))
+    }
 }
 
 /// Result type for injection operations
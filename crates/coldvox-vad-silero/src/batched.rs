@@ -0,0 +1,523 @@
+//! Multi-stream VAD that evaluates every stream's frame in one model call per tick.
+//!
+//! Each capture device gets a [`BatchedVadStream`].
+//! [`process_batched`](BatchedVadStream::process_batched) queues the frame
+//! with a oneshot for its probability and awaits it. The submitter that
+//! completes the tick runs one batched inference over all pending frames and
+//! answers every oneshot. A tick is complete once every stream from the
+//! previous batch has submitted. If the tick is still open when
+//! `max_batch_wait` lapses, the waiting submitters flush it. A stream that
+//! stops submitting therefore holds up at most one tick. The blocking
+//! [`VadEngine::process`] never waits: it runs its frame together with
+//! whatever is already queued. Per-stream recurrent state lives in the
+//! engine, indexed by stream slot.
+
+use crate::config::SileroConfig;
+use crate::debounce::SpeechDebouncer;
+use coldvox_vad::{VadEngine, VadEvent, VadState};
+use std::sync::{Arc, Mutex, MutexGuard};
+use std::time::Duration;
+use tokio::sync::oneshot;
+use tokio::time::Instant;
+
+/// Samples per stream per inference (16 kHz, 32 ms).
+pub const BATCH_FRAME_SAMPLES: usize = 512;
+
+/// A model that scores several independent streams at once.
+pub trait BatchModel: Send {
+    /// Floats of recurrent state carried per stream between calls.
+    fn state_len(&self) -> usize;
+
+    /// Score `probs.len()` streams. `frames` holds one [`BATCH_FRAME_SAMPLES`]
+    /// window per stream in `[-1, 1]`; `states` holds each stream's state
+    /// contiguously and is updated in place.
+    fn infer(
+        &mut self,
+        frames: &[f32],
+        states: &mut [f32],
+        probs: &mut [f32],
+    ) -> Result<(), String>;
+}
+
+/// How long the tick leader waits for the remaining streams' frames.
+pub const DEFAULT_MAX_BATCH_WAIT: Duration = Duration::from_millis(4);
+
+/// Shared multi-stream engine; create per-device handles with [`stream`](Self::stream).
+#[derive(Clone)]
+pub struct BatchedVadEngine {
+    shared: Arc<Shared>,
+}
+
+struct Shared {
+    config: SileroConfig,
+    max_batch_wait: Duration,
+    tick: Mutex<Tick>,
+    model: Mutex<ModelState>,
+}
+
+type Reply = oneshot::Sender<Result<f32, String>>;
+
+#[derive(Default)]
+struct Tick {
+    registered: usize,
+    free_slots: Vec<usize>,
+    slot_count: usize,
+    /// Streams the tick being gathered waits for: those in the last batch,
+    /// plus any registered since.
+    expected: usize,
+    /// Frames submitted for the batch currently being gathered.
+    pending: Vec<(usize, [f32; BATCH_FRAME_SAMPLES], Reply)>,
+    /// When the tick being gathered is flushed regardless.
+    deadline: Option<Instant>,
+    batches: u64,
+    frames: u64,
+}
+
+impl Tick {
+    fn complete(&self) -> bool {
+        self.pending.len() >= self.expected.min(self.registered)
+    }
+
+    fn take_batch(&mut self) -> Vec<(usize, [f32; BATCH_FRAME_SAMPLES], Reply)> {
+        self.deadline = None;
+        self.expected = self.pending.len();
+        std::mem::take(&mut self.pending)
+    }
+}
+
+struct ModelState {
+    model: Box<dyn BatchModel>,
+    /// `slot_count * state_len` floats, one contiguous block per slot.
+    states: Vec<f32>,
+    // Reused gather buffers for the batched call
+    frames: Vec<f32>,
+    batch_states: Vec<f32>,
+    probs: Vec<f32>,
+}
+
+/// Batch counters, for checking how well streams are being coalesced.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct BatchStats {
+    pub batches: u64,
+    pub frames: u64,
+}
+
+impl BatchStats {
+    pub fn mean_batch_size(&self) -> f64 {
+        if self.batches == 0 {
+            0.0
+        } else {
+            self.frames as f64 / self.batches as f64
+        }
+    }
+}
+
+impl BatchedVadEngine {
+    pub fn with_model(model: Box<dyn BatchModel>, config: SileroConfig) -> Self {
+        Self {
+            shared: Arc::new(Shared {
+                config,
+                max_batch_wait: DEFAULT_MAX_BATCH_WAIT,
+                tick: Mutex::new(Tick::default()),
+                model: Mutex::new(ModelState {
+                    model,
+                    states: Vec::new(),
+                    frames: Vec::new(),
+                    batch_states: Vec::new(),
+                    probs: Vec::new(),
+                }),
+            }),
+        }
+    }
+
+    /// Set the gather window. Must be called before any stream is created.
+    pub fn with_max_batch_wait(mut self, wait: Duration) -> Self {
+        if let Some(shared) = Arc::get_mut(&mut self.shared) {
+            shared.max_batch_wait = wait;
+        } else {
+            tracing::warn!("max_batch_wait ignored: engine already has streams");
+        }
+        self
+    }
+
+    /// Register a new stream with fresh recurrent state.
+    pub fn stream(&self) -> BatchedVadStream {
+        let slot = {
+            let mut tick = lock(&self.shared.tick);
+            tick.registered += 1;
+            tick.expected += 1;
+            match tick.free_slots.pop() {
+                Some(slot) => slot,
+                None => {
+                    tick.slot_count += 1;
+                    tick.slot_count - 1
+                }
+            }
+        };
+        self.shared.clear_state(slot);
+
+        BatchedVadStream {
+            shared: Arc::clone(&self.shared),
+            slot,
+            debouncer: SpeechDebouncer::new(&self.shared.config),
+            last_probability: 0.0,
+        }
+    }
+
+    pub fn stats(&self) -> BatchStats {
+        let tick = lock(&self.shared.tick);
+        BatchStats {
+            batches: tick.batches,
+            frames: tick.frames,
+        }
+    }
+}
+
+impl Shared {
+    fn clear_state(&self, slot: usize) {
+        let mut m = lock(&self.model);
+        let len = m.model.state_len();
+        if m.states.len() < (slot + 1) * len {
+            m.states.resize((slot + 1) * len, 0.0);
+        }
+        m.states[slot * len..(slot + 1) * len].fill(0.0);
+    }
+
+    /// Queue `frame` and wait for its probability, running the batch if
+    /// this frame completes the tick or the gather window lapses.
+    async fn submit(&self, slot: usize, frame: [f32; BATCH_FRAME_SAMPLES]) -> Result<f32, String> {
+        let (reply, mut rx) = oneshot::channel();
+        let deadline = {
+            let mut tick = lock(&self.tick);
+            tick.pending.push((slot, frame, reply));
+            if tick.complete() {
+                let batch = tick.take_batch();
+                drop(tick);
+                self.run(batch);
+                None
+            } else {
+                let wait = self.max_batch_wait;
+                Some(*tick.deadline.get_or_insert_with(|| Instant::now() + wait))
+            }
+        };
+
+        if let Some(deadline) = deadline {
+            if let Ok(result) = tokio::time::timeout_at(deadline, &mut rx).await {
+                return result.map_err(|_| "batched VAD result dropped".to_string())?;
+            }
+            // Window lapsed with streams missing; run what arrived. If another
+            // submitter already took this frame, its answer is on the way.
+            self.flush(slot);
+        }
+        rx.await
+            .map_err(|_| "batched VAD result dropped".to_string())?
+    }
+
+    /// Queue `frame` and run the batch now, without waiting for other streams.
+    fn submit_now(&self, slot: usize, frame: [f32; BATCH_FRAME_SAMPLES]) -> Result<f32, String> {
+        let (reply, mut rx) = oneshot::channel();
+        let batch = {
+            let mut tick = lock(&self.tick);
+            tick.pending.push((slot, frame, reply));
+            tick.take_batch()
+        };
+        self.run(batch);
+        rx.try_recv()
+            .map_err(|_| "batched VAD result dropped".to_string())?
+    }
+
+    /// Run the tick being gathered if `slot`'s frame is still in it.
+    fn flush(&self, slot: usize) {
+        let batch = {
+            let mut tick = lock(&self.tick);
+            if !tick.pending.iter().any(|(s, _, _)| *s == slot) {
+                return;
+            }
+            tick.take_batch()
+        };
+        self.run(batch);
+    }
+
+    /// Run one inference over `batch` and answer each frame's oneshot.
+    fn run(&self, batch: Vec<(usize, [f32; BATCH_FRAME_SAMPLES], Reply)>) {
+        let outcome = self.run_batch(&batch);
+        {
+            let mut tick = lock(&self.tick);
+            tick.batches += 1;
+            tick.frames += batch.len() as u64;
+        }
+        for (i, (_, _, reply)) in batch.into_iter().enumerate() {
+            // The submitter may have been cancelled; its frame still advanced
+            // the stream's state
+            let _ = reply.send(outcome.as_ref().map(|p| p[i]).map_err(Clone::clone));
+        }
+    }
+
+    fn run_batch(
+        &self,
+        batch: &[(usize, [f32; BATCH_FRAME_SAMPLES], Reply)],
+    ) -> Result<Vec<f32>, String> {
+        let mut guard = lock(&self.model);
+        let m = &mut *guard;
+        let len = m.model.state_len();
+        let n = batch.len();
+
+        m.frames.clear();
+        m.batch_states.clear();
+        for (slot, frame, _) in batch {
+            m.frames.extend_from_slice(frame);
+            m.batch_states
+                .extend_from_slice(&m.states[slot * len..(slot + 1) * len]);
+        }
+        m.probs.clear();
+        m.probs.resize(n, 0.0);
+
+        m.model
+            .infer(&m.frames, &mut m.batch_states, &mut m.probs)?;
+
+        for (i, (slot, _, _)) in batch.iter().enumerate() {
+            m.states[slot * len..(slot + 1) * len]
+                .copy_from_slice(&m.batch_states[i * len..(i + 1) * len]);
+        }
+        Ok(m.probs.clone())
+    }
+}
+
+/// One stream's view of a [`BatchedVadEngine`].
+pub struct BatchedVadStream {
+    shared: Arc<Shared>,
+    slot: usize,
+    debouncer: SpeechDebouncer,
+    last_probability: f32,
+}
+
+impl BatchedVadStream {
+    pub fn last_probability(&self) -> f32 {
+        self.last_probability
+    }
+
+    /// Score `frame` in the same model call as the other streams' frames
+    /// for this tick.
+    pub async fn process_batched(&mut self, frame: &[i16]) -> Result<Option<VadEvent>, String> {
+        let input = Self::input(frame)?;
+        let probability = self.shared.submit(self.slot, input).await?;
+        Ok(self.update(probability))
+    }
+
+    fn input(frame: &[i16]) -> Result<[f32; BATCH_FRAME_SAMPLES], String> {
+        if frame.len() != BATCH_FRAME_SAMPLES {
+            return Err(format!(
+                "Silero VAD requires {} samples, got {}",
+                BATCH_FRAME_SAMPLES,
+                frame.len()
+            ));
+        }
+
+        let mut input = [0.0f32; BATCH_FRAME_SAMPLES];
+        for (d, &s) in input.iter_mut().zip(frame) {
+            *d = s as f32 / i16::MAX as f32;
+        }
+        Ok(input)
+    }
+
+    fn update(&mut self, probability: f32) -> Option<VadEvent> {
+        tracing::trace!(
+            "Batched Silero VAD: slot={}, probability={:.4}, state={:?}",
+            self.slot,
+            probability,
+            self.debouncer.current_state()
+        );
+        self.last_probability = probability;
+        self.debouncer.update(probability)
+    }
+}
+
+impl VadEngine for BatchedVadStream {
+    /// Runs immediately, batched only with frames already queued by
+    /// [`process_batched`](Self::process_batched) callers.
+    fn process(&mut self, frame: &[i16]) -> Result<Option<VadEvent>, String> {
+        let input = Self::input(frame)?;
+        let probability = self.shared.submit_now(self.slot, input)?;
+        Ok(self.update(probability))
+    }
+
+    fn reset(&mut self) {
+        self.shared.clear_state(self.slot);
+        self.debouncer.reset();
+        self.last_probability = 0.0;
+    }
+
+    fn current_state(&self) -> VadState {
+        self.debouncer.current_state()
+    }
+
+    fn required_sample_rate(&self) -> u32 {
+        16000
+    }
+
+    fn required_frame_size_samples(&self) -> usize {
+        BATCH_FRAME_SAMPLES
+    }
+}
+
+impl Drop for BatchedVadStream {
+    fn drop(&mut self) {
+        let batch = {
+            let mut tick = lock(&self.shared.tick);
+            tick.registered -= 1;
+            tick.free_slots.push(self.slot);
+            // The tick may have been waiting only for this stream
+            if tick.pending.is_empty() || !tick.complete() {
+                None
+            } else {
+                Some(tick.take_batch())
+            }
+        };
+        if let Some(batch) = batch {
+            self.shared.run(batch);
+        }
+    }
+}
+
+fn lock<T>(m: &Mutex<T>) -> MutexGuard<'_, T> {
+    m.lock().unwrap_or_else(|e| e.into_inner())
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+
+    /// Probability is the frame's mean; state counts calls per stream.
+    struct MeanModel {
+        largest_batch: Arc<AtomicUsize>,
+    }
+
+    impl BatchModel for MeanModel {
+        fn state_len(&self) -> usize {
+            1
+        }
+
+        fn infer(
+            &mut self,
+            frames: &[f32],
+            states: &mut [f32],
+            probs: &mut [f32],
+        ) -> Result<(), String> {
+            self.largest_batch.fetch_max(probs.len(), Ordering::SeqCst);
+            for (i, p) in probs.iter_mut().enumerate() {
+                let frame = &frames[i * BATCH_FRAME_SAMPLES..(i + 1) * BATCH_FRAME_SAMPLES];
+                *p = frame.iter().sum::<f32>() / BATCH_FRAME_SAMPLES as f32;
+                states[i] += 1.0;
+            }
+            Ok(())
+        }
+    }
+
+    fn engine() -> (BatchedVadEngine, Arc<AtomicUsize>) {
+        let largest = Arc::new(AtomicUsize::new(0));
+        let model = MeanModel {
+            largest_batch: largest.clone(),
+        };
+        let engine = BatchedVadEngine::with_model(Box::new(model), SileroConfig::default())
+            .with_max_batch_wait(Duration::from_secs(5));
+        (engine, largest)
+    }
+
+    fn current_thread() -> tokio::runtime::Runtime {
+        tokio::runtime::Builder::new_current_thread()
+            .enable_time()
+            .build()
+            .unwrap()
+    }
+
+    #[test]
+    fn concurrent_streams_share_one_call_per_tick() {
+        let (engine, largest) = engine();
+        let start = std::time::Instant::now();
+        // One thread: submitters must yield while waiting, or the other
+        // streams would never get to submit
+        current_thread().block_on(async {
+            let tasks: Vec<_> = (0..4)
+                .map(|i| {
+                    let mut s = engine.stream();
+                    tokio::spawn(async move {
+                        let level = (i as i16 + 1) * 1000;
+                        for _ in 0..10 {
+                            s.process_batched(&[level; BATCH_FRAME_SAMPLES])
+                                .await
+                                .unwrap();
+                            let expected = level as f32 / i16::MAX as f32;
+                            assert!((s.last_probability() - expected).abs() < 1e-6);
+                        }
+                    })
+                })
+                .collect();
+            for t in tasks {
+                t.await.unwrap();
+            }
+        });
+
+        assert!(start.elapsed() < Duration::from_secs(5));
+        let stats = engine.stats();
+        assert_eq!(stats.frames, 40);
+        // With a generous gather window every tick carries all four streams
+        assert_eq!(stats.batches, 10);
+        assert_eq!(largest.load(Ordering::SeqCst), 4);
+        assert_eq!(stats.mean_batch_size(), 4.0);
+    }
+
+    #[test]
+    fn idle_stream_holds_up_one_tick_at_most() {
+        let (engine, _) = engine();
+        let engine = engine.with_max_batch_wait(Duration::from_millis(200));
+        let mut active = engine.stream();
+        let _idle = engine.stream();
+        let start = std::time::Instant::now();
+        current_thread().block_on(async {
+            for _ in 0..5 {
+                active
+                    .process_batched(&[0; BATCH_FRAME_SAMPLES])
+                    .await
+                    .unwrap();
+            }
+        });
+
+        // Only the first tick waits for the idle stream
+        let elapsed = start.elapsed();
+        assert!(elapsed >= Duration::from_millis(200), "{elapsed:?}");
+        assert!(elapsed < Duration::from_millis(400), "{elapsed:?}");
+        assert_eq!(engine.stats().batches, 5);
+    }
+
+    #[test]
+    fn single_stream_runs_without_waiting() {
+        let (engine, _) = engine();
+        let mut s = engine.stream();
+        let start = Instant::now();
+        assert_eq!(s.process(&[0; BATCH_FRAME_SAMPLES]).unwrap(), None);
+        assert!(start.elapsed() < Duration::from_secs(1));
+        assert!(s.process(&[0; 100]).is_err());
+    }
+
+    #[test]
+    fn streams_keep_separate_state_and_reuse_slots() {
+        let (engine, _) = engine();
+        let mut a = engine.stream();
+        let b = engine.stream();
+        drop(b);
+        // `a` alone is the whole batch again once `b` is gone
+        a.process(&[0; BATCH_FRAME_SAMPLES]).unwrap();
+        a.process(&[0; BATCH_FRAME_SAMPLES]).unwrap();
+        let state_a = lock(&engine.shared.model).states[a.slot];
+        assert_eq!(state_a, 2.0);
+
+        // The freed slot is recycled with cleared state
+        let c = engine.stream();
+        assert_ne!(c.slot, a.slot);
+        assert_eq!(lock(&engine.shared.model).states[c.slot], 0.0);
+
+        a.reset();
+        assert_eq!(lock(&engine.shared.model).states[a.slot], 0.0);
+    }
+}
@@ -1,21 +1,4 @@
-use coldvox_vad::constants::FRAME_SIZE_SAMPLES;
-use serde::{Deserialize, Serialize};
+//! Silero settings are the unified VAD config's, so there is one set of
+//! thresholds (and one `speculative_slope`) to keep in sync.
 
-#[derive(Debug, Clone, Serialize, Deserialize)]
-pub struct SileroConfig {
-    pub threshold: f32,
-    pub min_speech_duration_ms: u32,
-    pub min_silence_duration_ms: u32,
-    pub window_size_samples: usize,
-}
-
-impl Default for SileroConfig {
-    fn default() -> Self {
-        Self {
-            threshold: 0.3,
-            min_speech_duration_ms: 250,
-            min_silence_duration_ms: 100,
-            window_size_samples: FRAME_SIZE_SAMPLES,
-        }
-    }
-}
+pub use coldvox_vad::config::SileroConfig;
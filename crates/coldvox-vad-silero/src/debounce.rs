@@ -0,0 +1,269 @@
+use crate::config::SileroConfig;
+use coldvox_vad::{VadEvent, VadState};
+use std::time::Instant;
+
+/// Speech/silence state machine over per-frame speech probabilities.
+///
+/// Shared by every Silero-backed engine so they agree on onset debounce and
+/// hangover: speech starts after `min_speech_duration_ms` above threshold and
+/// ends after `min_silence_duration_ms` below it. With `speculative_slope`
+/// set, a sharp probability rise in silence is announced as
+/// `SpeculativeStart` before the onset is confirmed.
+pub struct SpeechDebouncer {
+    threshold: f32,
+    min_speech_duration_ms: u32,
+    min_silence_duration_ms: u32,
+    current_state: VadState,
+    speech_start_time: Option<Instant>,
+    silence_start_time: Option<Instant>,
+    speech_start_timestamp_ms: u64,
+    frames_processed: u64,
+    speculative_slope: Option<f32>,
+    speculating: bool,
+    last_probability: f32,
+}
+
+impl SpeechDebouncer {
+    pub fn new(config: &SileroConfig) -> Self {
+        Self {
+            threshold: config.threshold,
+            min_speech_duration_ms: config.min_speech_duration_ms,
+            min_silence_duration_ms: config.min_silence_duration_ms,
+            current_state: VadState::Silence,
+            speech_start_time: None,
+            silence_start_time: None,
+            speech_start_timestamp_ms: 0,
+            frames_processed: 0,
+            speculative_slope: config.speculative_slope,
+            speculating: false,
+            last_probability: 0.0,
+        }
+    }
+
+    /// Feed the probability for the next 512-sample frame.
+    pub fn update(&mut self, probability: f32) -> Option<VadEvent> {
+        self.frames_processed += 1;
+        let timestamp_ms = self.frames_processed * 512 * 1000 / 16000;
+
+        let event = self
+            .transition(probability, timestamp_ms)
+            .or_else(|| self.speculate(probability, timestamp_ms));
+        if matches!(event, Some(VadEvent::SpeechStart { .. })) {
+            self.speculating = false;
+        }
+        self.last_probability = probability;
+        event
+    }
+
+    fn transition(&mut self, probability: f32, timestamp_ms: u64) -> Option<VadEvent> {
+        match self.current_state {
+            VadState::Silence => {
+                if probability >= self.threshold {
+                    if self.speech_start_time.is_none() {
+                        self.speech_start_time = Some(Instant::now());
+                        self.speech_start_timestamp_ms = timestamp_ms;
+                    } else if let Some(start) = self.speech_start_time {
+                        if start.elapsed().as_millis() >= self.min_speech_duration_ms as u128 {
+                            self.current_state = VadState::Speech;
+                            self.speech_start_time = None;
+                            self.silence_start_time = None;
+
+                            return Some(VadEvent::SpeechStart {
+                                timestamp_ms: self.speech_start_timestamp_ms,
+                                energy_db: probability_to_db(probability),
+                            });
+                        }
+                    }
+                } else {
+                    self.speech_start_time = None;
+                }
+            }
+            VadState::Speech => {
+                if probability < self.threshold {
+                    if self.silence_start_time.is_none() {
+                        self.silence_start_time = Some(Instant::now());
+                    } else if let Some(start) = self.silence_start_time {
+                        if start.elapsed().as_millis() >= self.min_silence_duration_ms as u128 {
+                            self.current_state = VadState::Silence;
+                            self.speech_start_time = None;
+                            self.silence_start_time = None;
+
+                            let duration_ms = timestamp_ms - self.speech_start_timestamp_ms;
+
+                            return Some(VadEvent::SpeechEnd {
+                                timestamp_ms,
+                                duration_ms,
+                                energy_db: probability_to_db(probability),
+                            });
+                        }
+                    }
+                } else {
+                    self.silence_start_time = None;
+                }
+            }
+        }
+
+        None
+    }
+
+    /// Open a speculative onset on a sharp rise; cancel it once the
+    /// probability falls back below threshold with no onset timer running.
+    fn speculate(&mut self, probability: f32, timestamp_ms: u64) -> Option<VadEvent> {
+        let slope = self.speculative_slope?;
+        if self.current_state != VadState::Silence {
+            return None;
+        }
+        if !self.speculating {
+            if probability - self.last_probability >= slope {
+                self.speculating = true;
+                return Some(VadEvent::SpeculativeStart {
+                    timestamp_ms,
+                    probability,
+                });
+            }
+        } else if self.speech_start_time.is_none()
+            && probability < self.threshold
+            && probability <= self.last_probability
+        {
+            self.speculating = false;
+            return Some(VadEvent::SpeculativeCancel { timestamp_ms });
+        }
+        None
+    }
+
+    pub fn threshold(&self) -> f32 {
+        self.threshold
+    }
+
+    pub fn current_state(&self) -> VadState {
+        self.current_state
+    }
+
+    /// Whether an onset or hangover timer (or a speculative onset) is running,
+    /// i.e. the next few frames can still flip the state.
+    pub fn in_transition(&self) -> bool {
+        self.speech_start_time.is_some() || self.silence_start_time.is_some() || self.speculating
+    }
+
+    pub fn is_speculating(&self) -> bool {
+        self.speculating
+    }
+
+    pub fn frames_processed(&self) -> u64 {
+        self.frames_processed
+    }
+
+    pub fn reset(&mut self) {
+        self.current_state = VadState::Silence;
+        self.speech_start_time = None;
+        self.silence_start_time = None;
+        self.speech_start_timestamp_ms = 0;
+        self.frames_processed = 0;
+        self.speculating = false;
+        self.last_probability = 0.0;
+    }
+}
+
+pub(crate) fn probability_to_db(probability: f32) -> f32 {
+    if probability <= 0.0 {
+        -60.0
+    } else {
+        20.0 * probability.log10()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn config() -> SileroConfig {
+        SileroConfig {
+            min_speech_duration_ms: 0,
+            min_silence_duration_ms: 0,
+            ..Default::default()
+        }
+    }
+
+    #[test]
+    fn onset_and_hangover_need_two_frames() {
+        let mut d = SpeechDebouncer::new(&config());
+        assert_eq!(d.update(0.9), None);
+        assert!(d.in_transition());
+        assert!(matches!(
+            d.update(0.9),
+            Some(VadEvent::SpeechStart {
+                timestamp_ms: 32,
+                ..
+            })
+        ));
+        assert_eq!(d.current_state(), VadState::Speech);
+
+        assert_eq!(d.update(0.1), None);
+        assert!(matches!(
+            d.update(0.1),
+            Some(VadEvent::SpeechEnd {
+                timestamp_ms: 128,
+                duration_ms: 96,
+                ..
+            })
+        ));
+        assert!(!d.in_transition());
+    }
+
+    #[test]
+    fn dip_below_threshold_cancels_onset() {
+        let mut d = SpeechDebouncer::new(&config());
+        d.update(0.9);
+        d.update(0.0);
+        assert!(!d.in_transition());
+        assert_eq!(d.update(0.9), None);
+        assert_eq!(d.current_state(), VadState::Silence);
+    }
+
+    #[test]
+    fn speculative_start_precedes_confirmed_onset() {
+        let mut d = SpeechDebouncer::new(&SileroConfig {
+            speculative_slope: Some(0.3),
+            ..config()
+        });
+        assert_eq!(d.update(0.1), None);
+        assert!(matches!(
+            d.update(0.6),
+            Some(VadEvent::SpeculativeStart {
+                timestamp_ms: 64,
+                ..
+            })
+        ));
+        assert!(d.is_speculating());
+        assert!(matches!(d.update(0.9), Some(VadEvent::SpeechStart { .. })));
+        assert!(!d.is_speculating());
+    }
+
+    #[test]
+    fn speculative_start_is_cancelled_when_probability_drops() {
+        let mut d = SpeechDebouncer::new(&SileroConfig {
+            speculative_slope: Some(0.15),
+            ..config()
+        });
+        // Rise that stays below threshold keeps the speculation open
+        assert!(matches!(
+            d.update(0.2),
+            Some(VadEvent::SpeculativeStart { .. })
+        ));
+        assert_eq!(d.update(0.25), None);
+        assert!(matches!(
+            d.update(0.1),
+            Some(VadEvent::SpeculativeCancel { timestamp_ms: 96 })
+        ));
+        assert!(!d.in_transition());
+        assert_eq!(d.current_state(), VadState::Silence);
+    }
+
+    #[test]
+    fn no_speculation_by_default() {
+        let mut d = SpeechDebouncer::new(&config());
+        assert_eq!(d.update(0.0), None);
+        assert_eq!(d.update(0.9), None);
+        assert!(!d.is_speculating());
+    }
+}
@@ -1,8 +1,16 @@
+pub mod batched;
 pub mod config;
+pub mod debounce;
+#[cfg(feature = "silero")]
+pub mod silero_batch;
 #[cfg(feature = "silero")]
 pub mod silero_wrapper;
 
+pub use batched::{BatchModel, BatchStats, BatchedVadEngine, BatchedVadStream};
 pub use config::SileroConfig;
+pub use debounce::SpeechDebouncer;
 
+#[cfg(feature = "silero")]
+pub use silero_batch::SileroBatchModel;
 #[cfg(feature = "silero")]
 pub use silero_wrapper::SileroEngine;
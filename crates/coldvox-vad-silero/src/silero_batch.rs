@@ -0,0 +1,101 @@
+use crate::batched::{BatchModel, BatchedVadEngine, BATCH_FRAME_SAMPLES};
+use crate::config::SileroConfig;
+use ort::session::builder::GraphOptimizationLevel;
+use ort::session::Session;
+use ort::value::Tensor;
+use std::path::Path;
+
+/// Samples of the previous window prepended to each input, as the Silero v5
+/// reference wrapper does at 16 kHz.
+const CONTEXT_SAMPLES: usize = 64;
+/// LSTM state is `[2, batch, 128]`.
+const RNN_STATE: usize = 2 * 128;
+
+/// Silero v5 ONNX model run with a batch dimension of one row per stream.
+pub struct SileroBatchModel {
+    session: Session,
+}
+
+impl SileroBatchModel {
+    /// Load a Silero v5 `silero_vad.onnx` (dynamic batch axis).
+    pub fn from_file(path: impl AsRef<Path>) -> Result<Self, String> {
+        let path = path.as_ref();
+        let session = Session::builder()
+            .and_then(|b| b.with_optimization_level(GraphOptimizationLevel::Level3))
+            .and_then(|b| b.with_intra_threads(1))
+            .and_then(|b| b.commit_from_file(path))
+            .map_err(|e| format!("Failed to load Silero model {}: {}", path.display(), e))?;
+        Ok(Self { session })
+    }
+}
+
+impl BatchModel for SileroBatchModel {
+    fn state_len(&self) -> usize {
+        RNN_STATE + CONTEXT_SAMPLES
+    }
+
+    fn infer(
+        &mut self,
+        frames: &[f32],
+        states: &mut [f32],
+        probs: &mut [f32],
+    ) -> Result<(), String> {
+        let batch = probs.len();
+        let per_stream = self.state_len();
+        let width = CONTEXT_SAMPLES + BATCH_FRAME_SAMPLES;
+
+        // Per-stream [rnn | context] blocks -> input [batch, 576] and state [2, batch, 128]
+        // (one allocation each per batch; the tensors take ownership)
+        let mut input = Vec::with_capacity(width * batch);
+        let mut state = vec![0.0f32; RNN_STATE * batch];
+        for b in 0..batch {
+            let s = &states[b * per_stream..(b + 1) * per_stream];
+            input.extend_from_slice(&s[RNN_STATE..]);
+            input
+                .extend_from_slice(&frames[b * BATCH_FRAME_SAMPLES..(b + 1) * BATCH_FRAME_SAMPLES]);
+            for layer in 0..2 {
+                let dst = (layer * batch + b) * 128;
+                state[dst..dst + 128].copy_from_slice(&s[layer * 128..(layer + 1) * 128]);
+            }
+        }
+
+        let to_err = |e: ort::Error| format!("Silero batch inference failed: {}", e);
+        let input = Tensor::from_array(([batch, width], input)).map_err(to_err)?;
+        let state = Tensor::from_array(([2, batch, 128], state)).map_err(to_err)?;
+        let sr = Tensor::from_array(([0usize; 0], vec![16_000i64])).map_err(to_err)?;
+
+        let outputs = self
+            .session
+            .run(ort::inputs!["input" => input, "state" => state, "sr" => sr])
+            .map_err(to_err)?;
+        let (_, out) = outputs["output"]
+            .try_extract_tensor::<f32>()
+            .map_err(to_err)?;
+        let (_, new_state) = outputs["stateN"]
+            .try_extract_tensor::<f32>()
+            .map_err(to_err)?;
+        if out.len() < batch || new_state.len() < RNN_STATE * batch {
+            return Err("Silero batch inference returned short output".to_string());
+        }
+
+        probs.copy_from_slice(&out[..batch]);
+        for b in 0..batch {
+            let s = &mut states[b * per_stream..(b + 1) * per_stream];
+            for layer in 0..2 {
+                let src = (layer * batch + b) * 128;
+                s[layer * 128..(layer + 1) * 128].copy_from_slice(&new_state[src..src + 128]);
+            }
+            let frame = &frames[b * BATCH_FRAME_SAMPLES..(b + 1) * BATCH_FRAME_SAMPLES];
+            s[RNN_STATE..].copy_from_slice(&frame[BATCH_FRAME_SAMPLES - CONTEXT_SAMPLES..]);
+        }
+        Ok(())
+    }
+}
+
+impl BatchedVadEngine {
+    /// Batched engine backed by the Silero v5 ONNX model at `model_path`.
+    pub fn silero(model_path: impl AsRef<Path>, config: SileroConfig) -> Result<Self, String> {
+        let model = SileroBatchModel::from_file(model_path)?;
+        Ok(Self::with_model(Box::new(model), config))
+    }
+}
@@ -1,6 +1,6 @@
 use crate::config::SileroConfig;
-use coldvox_vad::{VadEngine, VadEvent, VadState};
-use std::time::Instant;
+use crate::debounce::SpeechDebouncer;
+use coldvox_vad::{CascadeConfig, EnergyGate, GateStats, VadEngine, VadEvent, VadState};
 use voice_activity_detector::VoiceActivityDetector;
 
 #[derive(Copy, Clone, Default)]
@@ -15,11 +15,10 @@ impl voice_activity_detector::Sample for I16Sample {
 pub struct SileroEngine {
     detector: VoiceActivityDetector,
     config: SileroConfig,
-    current_state: VadState,
-    speech_start_time: Option<Instant>,
-    silence_start_time: Option<Instant>,
-    speech_start_timestamp_ms: u64,
-    frames_processed: u64,
+    debouncer: SpeechDebouncer,
+    gate: Option<EnergyGate>,
+    /// The last frame skipped inference, so the model state is stale.
+    gated: bool,
     last_probability: f32,
 }
 
@@ -33,75 +32,32 @@ impl SileroEngine {
 
         Ok(Self {
             detector,
+            debouncer: SpeechDebouncer::new(&config),
             config,
-            current_state: VadState::Silence,
-            speech_start_time: None,
-            silence_start_time: None,
-            speech_start_timestamp_ms: 0,
-            frames_processed: 0,
+            gate: None,
+            gated: false,
             last_probability: 0.0,
         })
     }
 
-    fn process_probability(&mut self, probability: f32) -> Option<VadEvent> {
-        let timestamp_ms = self.frames_processed * 512 * 1000 / 16000;
-
-        match self.current_state {
-            VadState::Silence => {
-                if probability >= self.config.threshold {
-                    if self.speech_start_time.is_none() {
-                        self.speech_start_time = Some(Instant::now());
-                        self.speech_start_timestamp_ms = timestamp_ms;
-                    } else if let Some(start) = self.speech_start_time {
-                        if start.elapsed().as_millis() >= self.config.min_speech_duration_ms as u128
-                        {
-                            self.current_state = VadState::Speech;
-                            self.speech_start_time = None;
-                            self.silence_start_time = None;
-
-                            return Some(VadEvent::SpeechStart {
-                                timestamp_ms: self.speech_start_timestamp_ms,
-                                energy_db: probability_to_db(probability),
-                            });
-                        }
-                    }
-                } else {
-                    self.speech_start_time = None;
-                }
-            }
-            VadState::Speech => {
-                if probability < self.config.threshold {
-                    if self.silence_start_time.is_none() {
-                        self.silence_start_time = Some(Instant::now());
-                    } else if let Some(start) = self.silence_start_time {
-                        if start.elapsed().as_millis()
-                            >= self.config.min_silence_duration_ms as u128
-                        {
-                            self.current_state = VadState::Silence;
-                            self.speech_start_time = None;
-                            self.silence_start_time = None;
-
-                            let duration_ms = timestamp_ms - self.speech_start_timestamp_ms;
-
-                            return Some(VadEvent::SpeechEnd {
-                                timestamp_ms,
-                                duration_ms,
-                                energy_db: probability_to_db(probability),
-                            });
-                        }
-                    }
-                } else {
-                    self.silence_start_time = None;
-                }
-            }
-        }
-
-        None
+    /// Put an energy gate in front of the model. Frames below the noise-floor
+    /// margin count as probability 0 while the debouncer is idle in silence;
+    /// in speech or mid-transition every frame is inferred, so hangover is
+    /// unchanged. The model's recurrent state is reset when the gate reopens,
+    /// so onset is scored from a clean start rather than from the frame
+    /// before the gated stretch.
+    pub fn with_gate(mut self, cascade: &CascadeConfig) -> Self {
+        self.gate = Some(EnergyGate::new(cascade));
+        self
     }
 }
 
-impl VadEngine for SileroEngine {
-    fn process(&mut self, frame: &[i16]) -> Result<Option<VadEvent>, String> {
+impl SileroEngine {
+    fn process_frame(
+        &mut self,
+        frame: &[i16],
+        energy_dbfs: Option<f32>,
+    ) -> Result<Option<VadEvent>, String> {
         if frame.len() != 512 {
             return Err(format!(
                 "Silero VAD requires 512 samples, got {}",
@@ -109,33 +65,66 @@ impl VadEngine for SileroEngine {
             ));
         }
 
+        if let Some(gate) = &mut self.gate {
+            let hold = self.debouncer.current_state() == VadState::Speech
+                || self.debouncer.in_transition();
+            let admitted = match energy_dbfs {
+                Some(dbfs) => gate.admit_dbfs(dbfs, hold),
+                None => gate.admit(frame, hold),
+            };
+            if !admitted {
+                self.gated = true;
+                self.last_probability = 0.0;
+                return Ok(self.debouncer.update(0.0));
+            }
+            if std::mem::take(&mut self.gated) {
+                self.detector.reset();
+            }
+        }
+
         let probability = self.detector.predict(frame.iter().map(|&s| I16Sample(s)));
+        if let Some(gate) = &mut self.gate {
+            gate.observe(probability >= self.config.threshold);
+        }
 
         tracing::trace!(
             "Silero VAD: probability={:.4}, threshold={:.4}, state={:?}",
             probability,
             self.config.threshold,
-            self.current_state
+            self.debouncer.current_state()
         );
 
         self.last_probability = probability;
-        self.frames_processed += 1;
 
-        Ok(self.process_probability(probability))
+        Ok(self.debouncer.update(probability))
+    }
+}
+
+impl VadEngine for SileroEngine {
+    fn process(&mut self, frame: &[i16]) -> Result<Option<VadEvent>, String> {
+        self.process_frame(frame, None)
+    }
+
+    fn process_with_energy(
+        &mut self,
+        frame: &[i16],
+        energy_dbfs: f32,
+    ) -> Result<Option<VadEvent>, String> {
+        self.process_frame(frame, Some(energy_dbfs))
     }
 
     fn reset(&mut self) {
         self.detector.reset();
-        self.current_state = VadState::Silence;
-        self.speech_start_time = None;
-        self.silence_start_time = None;
-        self.speech_start_timestamp_ms = 0;
-        self.frames_processed = 0;
+        self.debouncer.reset();
+        if let Some(gate) = &mut self.gate {
+            gate.reset();
+        }
+        self.gated = false;
         self.last_probability = 0.0;
     }
 
     fn current_state(&self) -> VadState {
-        self.current_state
+        self.debouncer.current_state()
     }
 
     fn required_sample_rate(&self) -> u32 {
@@ -145,13 +134,9 @@ impl VadEngine for SileroEngine {
     fn required_frame_size_samples(&self) -> usize {
         512
     }
-}
 
-fn probability_to_db(probability: f32) -> f32 {
-    if probability <= 0.0 {
-        -60.0
-    } else {
-        20.0 * probability.log10()
+    fn gate_stats(&self) -> Option<GateStats> {
+        self.gate.as_ref().map(EnergyGate::stats)
     }
 }
 
@@ -193,4 +178,51 @@ mod tests {
             "Error should mention required frame size: {err_long}"
         );
     }
+
+    #[test]
+    fn gated_engine_skips_inference_on_silence() {
+        let mut engine = SileroEngine::new(SileroConfig::default())
+            .expect("SileroEngine should create successfully")
+            .with_gate(&CascadeConfig::default());
+        let silence = vec![0i16; 512];
+        for _ in 0..10 {
+            assert!(engine.process(&silence).unwrap().is_none());
+        }
+        let loud: Vec<i16> = (0..512)
+            .map(|i| (8000.0 * (i as f32 * 0.2).sin()) as i16)
+            .collect();
+        engine.process(&loud).unwrap();
+        assert_eq!(
+            engine.gate_stats(),
+            Some(GateStats {
+                inferred: 1,
+                gated: 10
+            })
+        );
+        assert_eq!(engine.debouncer.frames_processed(), 11);
+    }
+
+    #[test]
+    fn reopened_gate_scores_from_fresh_state() {
+        let loud: Vec<i16> = (0..512)
+            .map(|i| (8000.0 * (i as f32 * 0.2).sin()) as i16)
+            .collect();
+        let mut fresh = SileroEngine::new(SileroConfig::default()).unwrap();
+        fresh.process(&loud).unwrap();
+
+        let mut engine = SileroEngine::new(SileroConfig::default())
+            .unwrap()
+            .with_gate(&CascadeConfig::default());
+        // Leave recurrent state behind, then let the gate close over silence
+        for _ in 0..3 {
+            engine.process(&loud).unwrap();
+        }
+        for _ in 0..20 {
+            engine.process(&[0i16; 512]).unwrap();
+        }
+        assert!(engine.gated);
+        engine.process(&loud).unwrap();
+
+        assert_eq!(engine.last_probability, fresh.last_probability);
+    }
 }
@@ -8,6 +8,9 @@ pub enum VadMode {
     // Level3 (energy-based) VAD is disabled by default - see Level3Config.enabled
     #[default]
     Silero, // ML-based VAD using ONNX - DEFAULT ACTIVE VAD
+    /// Energy gate in front of Silero: frames clearly below the adaptive noise
+    /// floor margin skip inference (see [`CascadeConfig`]).
+    Cascade,
 }
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
@@ -22,6 +25,10 @@ pub struct SileroConfig {
     pub min_silence_duration_ms: u32,
     /// The number of samples in a single processing window.
     pub window_size_samples: usize,
+    /// Emit `SpeculativeStart` when the speech probability rises by at least
+    /// this much in one frame while in silence. `None` disables speculation.
+    #[serde(default)]
+    pub speculative_slope: Option<f32>,
 }
 
 impl Default for SileroConfig {
@@ -31,6 +38,28 @@ impl Default for SileroConfig {
             min_speech_duration_ms: 250,
             min_silence_duration_ms: 100,
             window_size_samples: FRAME_SIZE_SAMPLES,
+            speculative_slope: None,
+        }
+    }
+}
+
+/// Energy pre-filter settings for [`VadMode::Cascade`].
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct CascadeConfig {
+    /// Frames at least this far above the noise floor are sent to Silero.
+    pub gate_margin_db: f32,
+    /// Starting noise floor estimate.
+    pub initial_floor_db: f32,
+    /// EMA weight applied to gated frames when tracking the noise floor.
+    pub ema_alpha: f32,
+}
+
+impl Default for CascadeConfig {
+    fn default() -> Self {
+        Self {
+            gate_margin_db: 6.0,
+            initial_floor_db: -50.0,
+            ema_alpha: 0.02,
         }
     }
 }
@@ -40,6 +69,9 @@ pub struct UnifiedVadConfig {
     pub mode: VadMode,
 
     pub silero: SileroConfig,
+    /// Only used by [`VadMode::Cascade`].
+    #[serde(default)]
+    pub cascade: CascadeConfig,
     pub frame_size_samples: usize,
     pub sample_rate_hz: u32,
 }
@@ -50,6 +82,7 @@ impl Default for UnifiedVadConfig {
             mode: VadMode::default(), // Uses Silero by default now
 
             silero: SileroConfig::default(),
+            cascade: CascadeConfig::default(),
             // Align default frame size with default engine (Silero) requirement
             // Both Silero and Level3 now use 512-sample windows at 16 kHz
             frame_size_samples: FRAME_SIZE_SAMPLES,
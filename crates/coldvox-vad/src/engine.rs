@@ -1,3 +1,4 @@
+use crate::gate::GateStats;
 use crate::types::{VadEvent, VadState};
 
 /// A trait for Voice Activity Detection (VAD) engines.
@@ -6,8 +7,23 @@ use crate::types::{VadEvent, VadState};
 /// allowing them to be used interchangeably in the audio pipeline.
 pub trait VadEngine: Send {
     fn process(&mut self, frame: &[i16]) -> Result<Option<VadEvent>, String>;
+
+    /// Process a frame whose RMS level (dBFS) was already measured upstream,
+    /// so energy-based stages need not rescan it.
+    fn process_with_energy(
+        &mut self,
+        frame: &[i16],
+        _energy_dbfs: f32,
+    ) -> Result<Option<VadEvent>, String> {
+        self.process(frame)
+    }
     fn reset(&mut self);
     fn current_state(&self) -> VadState;
     fn required_sample_rate(&self) -> u32;
     fn required_frame_size_samples(&self) -> usize;
+
+    /// Inferred/gated frame counts for engines with an energy pre-filter.
+    fn gate_stats(&self) -> Option<GateStats> {
+        None
+    }
 }
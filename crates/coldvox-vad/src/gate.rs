@@ -0,0 +1,177 @@
+use crate::config::CascadeConfig;
+use crate::energy::EnergyCalculator;
+use crate::threshold::AdaptiveThreshold;
+use crate::types::VadConfig;
+
+/// Cumulative counts of frames a gated engine sent to / kept from its model.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct GateStats {
+    pub inferred: u64,
+    pub gated: u64,
+}
+
+impl GateStats {
+    pub fn total(&self) -> u64 {
+        self.inferred + self.gated
+    }
+
+    /// Fraction of frames that skipped inference, in `0.0..=1.0`.
+    pub fn gated_ratio(&self) -> f64 {
+        match self.total() {
+            0 => 0.0,
+            total => self.gated as f64 / total as f64,
+        }
+    }
+}
+
+/// Cheap energy pre-filter for a neural VAD.
+///
+/// A frame is admitted when its dBFS is at least `gate_margin_db` above the
+/// adaptive noise floor, or when the caller holds the gate open (e.g. while its
+/// state machine is in speech or mid-transition). Rejected frames feed the
+/// noise floor estimate.
+pub struct EnergyGate {
+    energy: EnergyCalculator,
+    threshold: AdaptiveThreshold,
+    initial_floor_db: f32,
+    last_dbfs: f32,
+    stats: GateStats,
+}
+
+impl EnergyGate {
+    pub fn new(config: &CascadeConfig) -> Self {
+        let threshold = AdaptiveThreshold::new(&VadConfig {
+            onset_threshold_db: config.gate_margin_db,
+            offset_threshold_db: config.gate_margin_db,
+            ema_alpha: config.ema_alpha,
+            initial_floor_db: config.initial_floor_db,
+            ..Default::default()
+        });
+        Self {
+            energy: EnergyCalculator::new(),
+            threshold,
+            initial_floor_db: config.initial_floor_db,
+            last_dbfs: -100.0,
+            stats: GateStats::default(),
+        }
+    }
+
+    /// Whether `frame` should go to the model. `hold` forces the gate open.
+    pub fn admit(&mut self, frame: &[i16], hold: bool) -> bool {
+        let dbfs = self.energy.calculate_dbfs(frame);
+        self.admit_dbfs(dbfs, hold)
+    }
+
+    /// [`admit`](Self::admit) for a frame whose dBFS was measured upstream.
+    pub fn admit_dbfs(&mut self, dbfs: f32, hold: bool) -> bool {
+        self.last_dbfs = dbfs;
+
+        let open = hold || self.threshold.should_activate(dbfs);
+        if open {
+            self.stats.inferred += 1;
+        } else {
+            self.stats.gated += 1;
+            self.threshold.update(dbfs, false);
+        }
+        open
+    }
+
+    /// Report the model's verdict on the last admitted frame, so the floor can
+    /// follow noise that rose above the margin.
+    pub fn observe(&mut self, is_speech: bool) {
+        self.threshold.update(self.last_dbfs, is_speech);
+    }
+
+    pub fn noise_floor_db(&self) -> f32 {
+        self.threshold.current_floor()
+    }
+
+    pub fn last_dbfs(&self) -> f32 {
+        self.last_dbfs
+    }
+
+    pub fn stats(&self) -> GateStats {
+        self.stats
+    }
+
+    /// Restore the initial noise floor. Stats are cumulative and kept.
+    pub fn reset(&mut self) {
+        self.threshold.reset(self.initial_floor_db);
+        self.last_dbfs = -100.0;
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn tone(amplitude: f32) -> Vec<i16> {
+        (0..512)
+            .map(|i| (amplitude * (i as f32 * 0.1).sin()) as i16)
+            .collect()
+    }
+
+    #[test]
+    fn gates_silence_and_admits_loud_frames() {
+        let mut gate = EnergyGate::new(&CascadeConfig::default());
+        assert!(!gate.admit(&[0i16; 512], false));
+        assert!(!gate.admit(&tone(50.0), false));
+        assert!(gate.admit(&tone(8000.0), false));
+        assert_eq!(
+            gate.stats(),
+            GateStats {
+                inferred: 1,
+                gated: 2
+            }
+        );
+        assert!((gate.stats().gated_ratio() - 2.0 / 3.0).abs() < 1e-9);
+    }
+
+    #[test]
+    fn hold_forces_inference() {
+        let mut gate = EnergyGate::new(&CascadeConfig::default());
+        assert!(gate.admit(&[0i16; 512], true));
+        assert_eq!(gate.stats().inferred, 1);
+    }
+
+    #[test]
+    fn floor_tracks_rising_noise() {
+        let mut gate = EnergyGate::new(&CascadeConfig {
+            ema_alpha: 0.5,
+            ..Default::default()
+        });
+        // ~-40 dBFS noise is above the -50 dB floor + 6 dB margin at first
+        let noise = tone(460.0);
+        assert!(gate.admit(&noise, false));
+        for _ in 0..10 {
+            gate.admit(&noise, false);
+            gate.observe(false);
+        }
+        assert!(gate.noise_floor_db() > -42.0);
+        assert!(!gate.admit(&noise, false));
+
+        gate.reset();
+        assert_eq!(gate.noise_floor_db(), -50.0);
+    }
+
+    #[test]
+    fn precomputed_dbfs_matches_frame_scan() {
+        let mut scanned = EnergyGate::new(&CascadeConfig::default());
+        let mut precomputed = EnergyGate::new(&CascadeConfig::default());
+        let calc = EnergyCalculator::new();
+        for amplitude in [0.0, 50.0, 460.0, 8000.0, 460.0] {
+            let frame = tone(amplitude);
+            assert_eq!(
+                scanned.admit(&frame, false),
+                precomputed.admit_dbfs(calc.calculate_dbfs(&frame), false)
+            );
+        }
+        assert_eq!(scanned.stats(), precomputed.stats());
+        assert_eq!(scanned.noise_floor_db(), precomputed.noise_floor_db());
+    }
+
+    #[test]
+    fn empty_stats_ratio_is_zero() {
+        assert_eq!(GateStats::default().gated_ratio(), 0.0);
+    }
+}
@@ -2,14 +2,16 @@ pub mod config;
 pub mod constants;
 pub mod energy;
 pub mod engine;
+pub mod gate;
 pub mod state;
 pub mod threshold;
 pub mod types;
 
 // Core exports - grouped and sorted alphabetically
-pub use config::{UnifiedVadConfig, VadMode};
+pub use config::{CascadeConfig, UnifiedVadConfig, VadMode};
 pub use constants::{FRAME_DURATION_MS, FRAME_SIZE_SAMPLES, SAMPLE_RATE_HZ};
 pub use engine::VadEngine;
+pub use gate::{EnergyGate, GateStats};
 pub use types::{VadConfig, VadEvent, VadMetrics, VadState};
 
 /// Main VAD trait for processing audio frames
@@ -13,6 +13,17 @@ pub enum VadEvent {
         duration_ms: u64,
         energy_db: f32,
     },
+    /// Speech probability is rising fast enough that an onset is likely;
+    /// streaming consumers may start decoding. Followed by either
+    /// `SpeechStart` or `SpeculativeCancel`.
+    SpeculativeStart {
+        timestamp_ms: u64,
+        probability: f32,
+    },
+    /// The onset announced by `SpeculativeStart` did not materialize.
+    SpeculativeCancel {
+        timestamp_ms: u64,
+    },
 }
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]